@@ -0,0 +1,158 @@
+#include <benchmark/benchmark.h>
+
+#include <ayan/math/bvh.hpp>
+#include <ayan/math/transform.hpp>
+#include <ayan/sync.hpp>
+
+#include "Throughput.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+// Builds report triangles per second and the SAH cost of the tree (costs 1 : 1),
+// the argument is the triangle count. A grid of small triangles jittered over a
+// wavy surface, a stand-in for a scanned or tessellated mesh.
+
+namespace {
+
+std::vector<Trianglef> make_mesh(size_t count) {
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+  const size_t side = size_t(std::sqrt(double(count))) + 1;
+  const float step = 1.0f / float(side);
+  std::vector<Trianglef> triangles;
+  triangles.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    const float x = float(i % side) * step;
+    const float y = float(i / side) * step;
+    const Vec3f p(x, y, 0.2f * std::sin(12.0f * x) * std::cos(9.0f * y));
+    triangles.emplace_back(p,
+      p + Vec3f(step * (1 + jitter(rng)), step * jitter(rng), step * jitter(rng)),
+      p + Vec3f(step * jitter(rng), step * (1 + jitter(rng)), step * jitter(rng)));
+  }
+  return triangles;
+}
+
+void report(benchmark::State& state, const Bvh& bvh, size_t count) {
+  ayan::bench::set_throughput(state, count, sizeof(Trianglef));
+  state.counters["sah"] = bvh.stats().sah_cost;
+  state.counters["depth"] = double(bvh.stats().max_depth);
+}
+
+void BM_BvhBuild(benchmark::State& state) {
+  const auto triangles = make_mesh(size_t(state.range(0)));
+  Bvh bvh;
+  for (auto _ : state) {
+    bvh = Bvh::Build(triangles);
+    benchmark::DoNotOptimize(bvh.nodes().data());
+  }
+  report(state, bvh, triangles.size());
+}
+
+void BM_BvhBuildPool(benchmark::State& state) {
+  const auto triangles = make_mesh(size_t(state.range(0)));
+  auto& pool = ayan::sync::ThreadPool::Global();
+  Bvh bvh;
+  for (auto _ : state) {
+    bvh = Bvh::Build(pool, triangles);
+    benchmark::DoNotOptimize(bvh.nodes().data());
+  }
+  report(state, bvh, triangles.size());
+  state.counters["threads"] = double(pool.size() + 1);
+}
+
+std::vector<Rayf> make_rays(size_t count) {
+  std::mt19937 rng(2);
+  std::uniform_real_distribution<float> coord(0.0f, 1.0f);
+  std::vector<Rayf> rays;
+  for (size_t i = 0; i < count; ++i) {
+    rays.emplace_back(Vec3f(coord(rng), coord(rng), 2.0f), Vec3f(0.3f * coord(rng), 0.3f * coord(rng), -1.0f));
+  }
+  return rays;
+}
+
+void BM_BvhCollapse(benchmark::State& state) {
+  const auto triangles = make_mesh(size_t(1) << 20);
+  const Bvh bvh = Bvh::Build(ayan::sync::ThreadPool::Global(), triangles);
+  for (auto _ : state) {
+    const Bvh8 wide = Bvh8::Collapse(bvh);
+    benchmark::DoNotOptimize(wide.nodes().data());
+  }
+  ayan::bench::set_throughput(state, triangles.size(), sizeof(Trianglef));
+}
+
+// closest hits of rays from above onto the 1M triangle mesh, by the binary
+// tree and its collapsed BVH4 / BVH8:
+template<typename Tree>
+void BM_BvhIntersect(benchmark::State& state) {
+  constexpr size_t kRays = 4096;
+  const auto triangles = make_mesh(size_t(1) << 20);
+  const Tree bvh = Tree::Build(ayan::sync::ThreadPool::Global(), triangles);
+  const auto rays = make_rays(kRays);
+  for (auto _ : state) {
+    size_t hits = 0;
+    for (const Rayf& ray : rays) {
+      BvhHit hit;
+      hits += bvh.intersect(triangles, ray, hit);
+    }
+    benchmark::DoNotOptimize(hits);
+  }
+  ayan::bench::set_throughput(state, kRays, sizeof(Rayf));
+  state.counters["nodes"] = double(bvh.stats().inner_count);
+}
+
+// 4096 instances of one 64K triangle mesh on a grid, 256M triangles if flattened:
+std::vector<BvhInstance> make_instances() {
+  std::vector<BvhInstance> instances;
+  for (uint32_t i = 0; i < 4096; ++i) {
+    TRS<float> trs;
+    trs.translation = Vec3f(float(i % 64), float(i / 64), 0.0f);
+    trs.rotation = Quat<float>::AxisAngle(Vec3f(0, 0, 1), 0.1f * float(i % 7));
+    instances.push_back(BvhInstance{ 0, Transformf(trs.to_mat4()) });
+  }
+  return instances;
+}
+
+// moving one instance, a rebuild of the top tree only:
+void BM_InstanceMove(benchmark::State& state) {
+  const std::vector<MeshBvh> meshes{ MeshBvh::Build(make_mesh(size_t(1) << 16)) };
+  InstanceBvh scene = InstanceBvh::Build(meshes, make_instances());
+  TRS<float> trs;
+  for (auto _ : state) {
+    trs.translation = Vec3f(trs.translation.x() + 1.0f, 0.0f, 0.0f);
+    scene.set_transform(0, Transformf(trs.to_mat4()));
+    benchmark::DoNotOptimize(scene.bvh().nodes().data());
+  }
+  ayan::bench::set_throughput(state, 1, sizeof(BvhInstance));
+}
+
+void BM_InstanceIntersect(benchmark::State& state) {
+  constexpr size_t kRays = 4096;
+  const std::vector<MeshBvh> meshes{ MeshBvh::Build(make_mesh(size_t(1) << 16)) };
+  const InstanceBvh scene = InstanceBvh::Build(meshes, make_instances());
+  auto rays = make_rays(kRays);
+  for (Rayf& ray : rays) ray = Rayf(ray.origin() * 64.0f + Vec3f(0, 0, 1), ray.direction());
+  for (auto _ : state) {
+    size_t hits = 0;
+    for (const Rayf& ray : rays) {
+      InstanceHit hit;
+      hits += scene.intersect(ray, hit);
+    }
+    benchmark::DoNotOptimize(hits);
+  }
+  ayan::bench::set_throughput(state, kRays, sizeof(Rayf));
+}
+
+} // namespace
+
+BENCHMARK(BM_BvhBuild)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BvhBuildPool)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_BvhCollapse)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BvhIntersect<Bvh>);
+BENCHMARK(BM_BvhIntersect<Bvh4>);
+BENCHMARK(BM_BvhIntersect<Bvh8>);
+BENCHMARK(BM_InstanceMove)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_InstanceIntersect);
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <ayan/math/color.hpp>
+
+#include "Throughput.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+// A 1920x1080 HDR framebuffer to 8-bit sRGB. The naive loop is the usual
+// per-pixel std::pow with Reinhard, the rest are encode_srgb8() per curve.
+
+namespace {
+
+constexpr size_t kWidth = 1920;
+constexpr size_t kHeight = 1080;
+
+const std::vector<RGBf>& framebuffer() {
+  static const std::vector<RGBf> image = [] {
+    std::mt19937 rng(1);
+    std::exponential_distribution<float> radiance(1.5f);
+    std::vector<RGBf> pixels(kWidth * kHeight);
+    for (RGBf& pixel : pixels) pixel = RGBf(radiance(rng), radiance(rng), radiance(rng));
+    return pixels;
+  }();
+  return image;
+}
+
+void BM_EncodeNaive(benchmark::State& state) {
+  const std::vector<RGBf>& in = framebuffer();
+  std::vector<RGBA8> out(in.size());
+  const auto encode = [](float x) {
+    x = x / (1.0f + x);
+    x = x <= 0.0031308f ? 12.92f * x : 1.055f * std::pow(x, 1.0f / 2.4f) - 0.055f;
+    return static_cast<uint8_t>(std::clamp(x, 0.0f, 1.0f) * 255.0f + 0.5f);
+  };
+  for (auto _ : state) {
+    for (size_t i = 0; i < in.size(); ++i) {
+      out[i] = RGBA8{ encode(in[i].r()), encode(in[i].g()), encode(in[i].b()), 255 };
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  ayan::bench::set_throughput(state, in.size(), sizeof(RGBf) + sizeof(RGBA8));
+}
+
+template<ToneMap Curve>
+void BM_EncodeSrgb8(benchmark::State& state) {
+  const std::vector<RGBf>& in = framebuffer();
+  std::vector<RGBA8> out(in.size());
+  const ToneMapSettings settings{ Curve, 0.0f, true };
+  for (auto _ : state) {
+    encode_srgb8(settings, in, kWidth, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  ayan::bench::set_throughput(state, in.size(), sizeof(RGBf) + sizeof(RGBA8));
+}
+
+void BM_EncodeSrgb8Pool(benchmark::State& state) {
+  const std::vector<RGBf>& in = framebuffer();
+  std::vector<RGBA8> out(in.size());
+  const ToneMapSettings settings{ ToneMap::AgX, 0.0f, true };
+  ayan::sync::ThreadPool& pool = ayan::sync::ThreadPool::Global();
+  for (auto _ : state) {
+    encode_srgb8(pool, settings, in, kWidth, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  ayan::bench::set_throughput(state, in.size(), sizeof(RGBf) + sizeof(RGBA8));
+}
+
+} // namespace
+
+BENCHMARK(BM_EncodeNaive)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EncodeSrgb8<ToneMap::Clamp>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EncodeSrgb8<ToneMap::Reinhard>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EncodeSrgb8<ToneMap::ACES>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EncodeSrgb8<ToneMap::AgX>)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EncodeSrgb8Pool)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <ayan/math/compressed.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+// large enough not to fit in L2, where the smaller storage pays off:
+constexpr size_t kElements = 1 << 20;
+
+std::vector<Vec3f> make_normals() {
+  std::mt19937 rng(1);
+  std::normal_distribution<float> gauss;
+  std::vector<Vec3f> normals(kElements);
+  for (Vec3f& n : normals) n = Vec3f(gauss(rng), gauss(rng), gauss(rng)).normalize();
+  return normals;
+}
+
+// the baseline: streaming uncompressed Vec3f:
+void BM_CopyVec3f(benchmark::State& state) {
+  const auto in = make_normals();
+  std::vector<Vec3f> out(kElements);
+  for (auto _ : state) {
+    std::copy(in.begin(), in.end(), out.begin());
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kElements);
+  state.SetBytesProcessed(state.iterations() * kElements * sizeof(Vec3f));
+}
+
+void BM_DecodeHalfVec3(benchmark::State& state) {
+  const auto normals = make_normals();
+  std::vector<HalfVec3> in(kElements);
+  encode(normals, in);
+  std::vector<Vec3f> out(kElements);
+  for (auto _ : state) {
+    decode(in, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kElements);
+  state.SetBytesProcessed(state.iterations() * kElements * sizeof(HalfVec3));
+}
+
+void BM_DecodeOctNormal(benchmark::State& state) {
+  const auto normals = make_normals();
+  std::vector<OctNormal> in(kElements);
+  encode(normals, in);
+  std::vector<Vec3f> out(kElements);
+  for (auto _ : state) {
+    decode(in, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kElements);
+  state.SetBytesProcessed(state.iterations() * kElements * sizeof(OctNormal));
+}
+
+void BM_DecodeOctNormalScalar(benchmark::State& state) {
+  const auto normals = make_normals();
+  std::vector<OctNormal> in(kElements);
+  encode(normals, in);
+  std::vector<Vec3f> out(kElements);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kElements; ++i) out[i] = in[i].decode();
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kElements);
+}
+
+void BM_DecodeQuantized(benchmark::State& state) {
+  const auto positions = make_normals();
+  const PositionQuantizer quantizer(Vec3f(-1, -1, -1), Vec3f(1, 1, 1));
+  std::vector<QuantizedVec3> in(kElements);
+  quantizer.encode(positions, in);
+  std::vector<Vec3f> out(kElements);
+  for (auto _ : state) {
+    quantizer.decode(in, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kElements);
+  state.SetBytesProcessed(state.iterations() * kElements * sizeof(QuantizedVec3));
+}
+
+} // namespace
+
+BENCHMARK(BM_CopyVec3f);
+BENCHMARK(BM_DecodeHalfVec3);
+BENCHMARK(BM_DecodeOctNormal);
+BENCHMARK(BM_DecodeOctNormalScalar);
+BENCHMARK(BM_DecodeQuantized);
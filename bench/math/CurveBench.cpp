@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <ayan/math/curve.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+constexpr size_t kCount = 1 << 16;
+
+std::vector<Vec3f> make_points() {
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+  std::vector<Vec3f> points(kCount);
+  for (auto& p : points) p = Vec3f(dist(rng), dist(rng), dist(rng));
+  return points;
+}
+
+std::vector<Vec2i> make_pixels() {
+  std::vector<Vec2i> pixels;
+  pixels.reserve(kCount);
+  for (int y = 0; y < 256; ++y) {
+    for (int x = 0; x < 256; ++x) pixels.push_back(Vec2i(x, y));
+  }
+  return pixels;
+}
+
+const AABBf kBounds(Vec3f(-10.0f, -10.0f, -10.0f), Vec3f(10.0f, 10.0f, 10.0f));
+
+template<typename CodeT>
+void BM_MortonGridEncode(benchmark::State& state) {
+  const auto points = make_points();
+  const MortonGrid<CodeT> grid(kBounds);
+  std::vector<CodeT> codes(kCount);
+  for (auto _ : state) {
+    grid.encode(points, codes);
+    benchmark::DoNotOptimize(codes.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template<typename CodeT>
+void BM_MortonGridEncodeScalar(benchmark::State& state) {
+  const auto points = make_points();
+  const MortonGrid<CodeT> grid(kBounds);
+  std::vector<CodeT> codes(kCount);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) codes[i] = grid.encode(points[i]);
+    benchmark::DoNotOptimize(codes.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template<typename CodeT>
+void BM_MortonDecode(benchmark::State& state) {
+  const auto points = make_points();
+  const MortonGrid<CodeT> grid(kBounds);
+  std::vector<CodeT> codes(kCount);
+  grid.encode(points, codes);
+  std::vector<Vec3i> cells(kCount);
+  for (auto _ : state) {
+    morton_decode<CodeT>(codes, cells);
+    benchmark::DoNotOptimize(cells.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_HilbertEncode(benchmark::State& state) {
+  const auto pixels = make_pixels();
+  std::vector<uint32_t> indices(kCount);
+  for (auto _ : state) {
+    hilbert_encode(pixels, indices, 8);
+    benchmark::DoNotOptimize(indices.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_HilbertEncodeScalar(benchmark::State& state) {
+  const auto pixels = make_pixels();
+  std::vector<uint32_t> indices(kCount);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) indices[i] = hilbert_encode(pixels[i], 8);
+    benchmark::DoNotOptimize(indices.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_HilbertDecode(benchmark::State& state) {
+  std::vector<uint32_t> indices(kCount);
+  for (uint32_t i = 0; i < kCount; ++i) indices[i] = i;
+  std::vector<Vec2i> pixels(kCount);
+  for (auto _ : state) {
+    hilbert_decode(indices, pixels, 8);
+    benchmark::DoNotOptimize(pixels.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace
+
+BENCHMARK(BM_MortonGridEncode<uint32_t>);
+BENCHMARK(BM_MortonGridEncode<uint64_t>);
+BENCHMARK(BM_MortonGridEncodeScalar<uint32_t>);
+BENCHMARK(BM_MortonGridEncodeScalar<uint64_t>);
+BENCHMARK(BM_MortonDecode<uint32_t>);
+BENCHMARK(BM_MortonDecode<uint64_t>);
+BENCHMARK(BM_HilbertEncode);
+BENCHMARK(BM_HilbertEncodeScalar);
+BENCHMARK(BM_HilbertDecode);
@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <ayan/math/dispatch.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+constexpr size_t kElements = 4096;
+
+Vec3f random_vec(std::mt19937& rng, float lo, float hi) {
+  std::uniform_real_distribution<float> dist(lo, hi);
+  return Vec3f(dist(rng), dist(rng), dist(rng));
+}
+
+// state.range(0) is the dispatch::Level, levels this CPU lacks are skipped:
+bool enter_level(benchmark::State& state) {
+  const auto level = static_cast<dispatch::Level>(state.range(0));
+  if (!dispatch::force(level)) {
+    state.SkipWithError("level is not supported by this CPU");
+    return false;
+  }
+  state.SetLabel(dispatch::name(level));
+  return true;
+}
+
+void BM_DispatchTransformPoints(benchmark::State& state) {
+  if (!enter_level(state)) return;
+  std::mt19937 rng(1);
+  std::vector<Vec3f> in(kElements), out(kElements);
+  for (Vec3f& v : in) v = random_vec(rng, -4, 4);
+  const Mat4f matrix{
+    0, -2, 0, 5,
+    1,  0, 0, 6,
+    0,  0, 3, 7,
+    0,  0, 0, 1
+  };
+  for (auto _ : state) {
+    dispatch::transform_batch<TransformAs::Point>(matrix, in, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kElements);
+  dispatch::reset();
+}
+
+void BM_DispatchMultiply(benchmark::State& state) {
+  if (!enter_level(state)) return;
+  std::vector<Mat4f> a(256), b(256), out(256);
+  for (size_t n = 0; n < a.size(); ++n) {
+    for (size_t i = 0; i < 4; ++i) {
+      for (size_t j = 0; j < 4; ++j) {
+        a[n](i, j) = float((n * 7 + i * 4 + j) % 11) - 5;
+        b[n](i, j) = float((n * 3 + i + j * 4) % 13) - 6;
+      }
+    }
+  }
+  for (auto _ : state) {
+    dispatch::multiply(a, b, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * a.size());
+  dispatch::reset();
+}
+
+void BM_DispatchBoxes(benchmark::State& state) {
+  if (!enter_level(state)) return;
+  std::mt19937 rng(2);
+  std::vector<AABBf> boxes;
+  for (size_t i = 0; i < kElements; ++i) {
+    const Vec3f center = random_vec(rng, -4, 4);
+    boxes.emplace_back(center - Vec3f(0.5f, 0.5f, 0.5f), center + Vec3f(0.5f, 0.5f, 0.5f));
+  }
+  std::vector<float> t_entry(kElements);
+  const Rayf ray(Vec3f(-6, -5, -6), Vec3f(1, 0.9f, 1.1f));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(dispatch::intersect(ray, boxes, t_entry));
+  }
+  state.SetItemsProcessed(state.iterations() * kElements);
+  dispatch::reset();
+}
+
+void BM_DispatchTriangles(benchmark::State& state) {
+  if (!enter_level(state)) return;
+  std::mt19937 rng(3);
+  std::vector<Trianglef> triangles;
+  for (size_t i = 0; i < kElements; ++i) {
+    const Vec3f center = random_vec(rng, -1, 1);
+    triangles.emplace_back(center + random_vec(rng, -1, 1),
+      center + random_vec(rng, -1, 1), center + random_vec(rng, -1, 1));
+  }
+  const Rayf ray(Vec3f(-3, -2, -3), Vec3f(1, 0.7f, 1.2f));
+  TriangleHit<float> hit{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(dispatch::intersect(ray, triangles, hit));
+  }
+  state.SetItemsProcessed(state.iterations() * kElements);
+  dispatch::reset();
+}
+
+} // namespace
+
+BENCHMARK(BM_DispatchTransformPoints)->DenseRange(0, 3);
+BENCHMARK(BM_DispatchMultiply)->DenseRange(0, 3);
+BENCHMARK(BM_DispatchBoxes)->DenseRange(0, 3);
+BENCHMARK(BM_DispatchTriangles)->DenseRange(0, 3);
@@ -0,0 +1,219 @@
+#include <benchmark/benchmark.h>
+
+#include <ayan/math/geometry.hpp>
+
+#include "Throughput.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+constexpr size_t kPrimitives = 1024;
+constexpr size_t kRays = 256;
+
+template<typename NumT>
+Vec3<NumT> random_vec(std::mt19937& rng, NumT lo, NumT hi) {
+  std::uniform_real_distribution<NumT> dist(lo, hi);
+  return Vec3<NumT>(dist(rng), dist(rng), dist(rng));
+}
+
+// a cloud of small triangles and rays through it, roughly a third of the tests hit:
+template<typename NumT>
+std::vector<Triangle<NumT>> make_triangles() {
+  std::mt19937 rng(1);
+  std::vector<Triangle<NumT>> triangles;
+  for (size_t i = 0; i < kPrimitives; ++i) {
+    const Vec3<NumT> center = random_vec<NumT>(rng, -1, 1);
+    triangles.emplace_back(center + random_vec<NumT>(rng, -1, 1),
+      center + random_vec<NumT>(rng, -1, 1), center + random_vec<NumT>(rng, -1, 1));
+  }
+  return triangles;
+}
+
+template<typename NumT>
+std::vector<AABB<NumT>> make_boxes() {
+  std::mt19937 rng(2);
+  std::vector<AABB<NumT>> boxes;
+  for (size_t i = 0; i < kPrimitives; ++i) {
+    const Vec3<NumT> center = random_vec<NumT>(rng, -2, 2);
+    boxes.emplace_back(center - random_vec<NumT>(rng, 0, 1), center + random_vec<NumT>(rng, 0, 1));
+  }
+  return boxes;
+}
+
+template<typename NumT>
+std::vector<Ray<NumT>> make_rays() {
+  std::mt19937 rng(3);
+  std::vector<Ray<NumT>> rays;
+  for (size_t i = 0; i < kRays; ++i) {
+    const Vec3<NumT> origin = random_vec<NumT>(rng, -6, 6);
+    rays.emplace_back(origin, random_vec<NumT>(rng, -1, 1) - origin);
+  }
+  return rays;
+}
+
+template<typename NumT>
+void BM_TriangleScalar(benchmark::State& state) {
+  const auto triangles = make_triangles<NumT>();
+  const auto rays = make_rays<NumT>();
+  size_t r = 0;
+  for (auto _ : state) {
+    TriangleHit<NumT> hit{};
+    size_t hits = 0;
+    for (const auto& triangle : triangles) hits += triangle.intersect(rays[r], hit);
+    benchmark::DoNotOptimize(hits);
+    r = (r + 1) % kRays;
+  }
+  ayan::bench::set_throughput(state, kPrimitives, sizeof(Triangle<NumT>));
+}
+
+// one ray against a packet of triangles (BVH leaf):
+template<size_t Lanes, typename NumT>
+void BM_TriangleX(benchmark::State& state) {
+  const auto triangles = make_triangles<NumT>();
+  std::vector<TriangleX<Lanes, NumT>> packets;
+  for (size_t i = 0; i < kPrimitives; i += Lanes) packets.push_back(TriangleX<Lanes, NumT>::Load(triangles.data() + i));
+  const auto rays = make_rays<NumT>();
+  size_t r = 0;
+  for (auto _ : state) {
+    TriangleHitX<Lanes, NumT> hit{};
+    uint32_t hits = 0;
+    for (const auto& packet : packets) hits ^= packet.intersect(rays[r], hit).bits();
+    benchmark::DoNotOptimize(hits);
+    r = (r + 1) % kRays;
+  }
+  ayan::bench::set_throughput(state, kPrimitives, sizeof(Triangle<NumT>));
+}
+
+// a packet of rays against one triangle (coherent primary rays):
+template<size_t Lanes, typename NumT>
+void BM_RayX(benchmark::State& state) {
+  const auto triangles = make_triangles<NumT>();
+  const auto rays = make_rays<NumT>();
+  std::vector<RayX<Lanes, NumT>> packets;
+  for (size_t i = 0; i < kRays; i += Lanes) packets.push_back(RayX<Lanes, NumT>::Load(rays.data() + i));
+  size_t r = 0;
+  for (auto _ : state) {
+    TriangleHitX<Lanes, NumT> hit{};
+    uint32_t hits = 0;
+    for (const auto& triangle : triangles) hits ^= triangle.intersect(packets[r], hit).bits();
+    benchmark::DoNotOptimize(hits);
+    r = (r + 1) % packets.size();
+  }
+  // a triangle is read once per packet of rays:
+  ayan::bench::set_throughput(state, kPrimitives * Lanes, sizeof(Triangle<NumT>) / Lanes);
+}
+
+template<typename NumT>
+void BM_AABBScalar(benchmark::State& state) {
+  const auto boxes = make_boxes<NumT>();
+  const auto rays = make_rays<NumT>();
+  size_t r = 0;
+  for (auto _ : state) {
+    NumT t = 0;
+    size_t hits = 0;
+    for (const auto& box : boxes) hits += box.intersect(rays[r], t);
+    benchmark::DoNotOptimize(hits);
+    r = (r + 1) % kRays;
+  }
+  ayan::bench::set_throughput(state, kPrimitives, sizeof(AABB<NumT>));
+}
+
+template<size_t Lanes, typename NumT>
+void BM_AABBx(benchmark::State& state) {
+  const auto boxes = make_boxes<NumT>();
+  std::vector<AABBx<Lanes, NumT>> packets;
+  for (size_t i = 0; i < kPrimitives; i += Lanes) packets.push_back(AABBx<Lanes, NumT>::Load(boxes.data() + i));
+  const auto rays = make_rays<NumT>();
+  size_t r = 0;
+  for (auto _ : state) {
+    simd::Pack<NumT, Lanes> t;
+    uint32_t hits = 0;
+    for (const auto& packet : packets) hits ^= packet.intersect(rays[r], t).bits();
+    benchmark::DoNotOptimize(hits);
+    r = (r + 1) % kRays;
+  }
+  ayan::bench::set_throughput(state, kPrimitives, sizeof(AABB<NumT>));
+}
+
+// a camera at the origin looking down -z over boxes around it, about a sixth of them are visible:
+template<typename NumT>
+Frustum<NumT> make_frustum() {
+  const NumT near_z = NumT(0.1);
+  const NumT far_z = NumT(3);
+  const NumT zero = 0;
+  const NumT one = 1;
+  return Frustum<NumT>::FromViewProjection(Mat4<NumT>{
+    one, zero, zero, zero,
+    zero, one, zero, zero,
+    zero, zero, far_z / (near_z - far_z), near_z * far_z / (near_z - far_z),
+    zero, zero, -one, zero
+  });
+}
+
+template<typename NumT>
+void BM_FrustumScalar(benchmark::State& state) {
+  const auto boxes = make_boxes<NumT>();
+  const Frustum<NumT> frustum = make_frustum<NumT>();
+  std::vector<uint32_t> visible(boxes.size());
+  for (auto _ : state) {
+    size_t count = 0;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      if (frustum.intersects(boxes[i])) visible[count++] = uint32_t(i);
+    }
+    benchmark::DoNotOptimize(count);
+    benchmark::ClobberMemory();
+  }
+  ayan::bench::set_throughput(state, kPrimitives, sizeof(AABB<NumT>));
+}
+
+template<typename NumT>
+void BM_FrustumCull(benchmark::State& state) {
+  const auto boxes = make_boxes<NumT>();
+  const Frustum<NumT> frustum = make_frustum<NumT>();
+  std::vector<uint32_t> visible(boxes.size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frustum_cull<NumT>(frustum, boxes, visible));
+    benchmark::ClobberMemory();
+  }
+  ayan::bench::set_throughput(state, kPrimitives, sizeof(AABB<NumT>));
+}
+
+template<size_t Lanes, typename NumT>
+void BM_FrustumCullX(benchmark::State& state) {
+  const auto boxes = make_boxes<NumT>();
+  std::vector<AABBx<Lanes, NumT>> packets;
+  for (size_t i = 0; i < kPrimitives; i += Lanes) packets.push_back(AABBx<Lanes, NumT>::Load(boxes.data() + i));
+  const Frustum<NumT> frustum = make_frustum<NumT>();
+  std::vector<uint32_t> visible(boxes.size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(frustum_cull<Lanes>(frustum, packets, visible));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kPrimitives);
+}
+
+} // namespace
+
+BENCHMARK(BM_TriangleScalar<float>);
+BENCHMARK(BM_TriangleX<4, float>);
+BENCHMARK(BM_TriangleX<8, float>);
+BENCHMARK(BM_RayX<4, float>);
+BENCHMARK(BM_RayX<8, float>);
+BENCHMARK(BM_TriangleScalar<double>);
+BENCHMARK(BM_TriangleX<4, double>);
+BENCHMARK(BM_AABBScalar<float>);
+BENCHMARK(BM_AABBx<4, float>);
+BENCHMARK(BM_AABBx<8, float>);
+BENCHMARK(BM_AABBScalar<double>);
+BENCHMARK(BM_AABBx<4, double>);
+BENCHMARK(BM_FrustumScalar<float>);
+BENCHMARK(BM_FrustumCull<float>);
+BENCHMARK(BM_FrustumCullX<4, float>);
+BENCHMARK(BM_FrustumCullX<8, float>);
+BENCHMARK(BM_FrustumScalar<double>);
+BENCHMARK(BM_FrustumCull<double>);
+BENCHMARK(BM_FrustumCullX<4, double>);
@@ -0,0 +1,199 @@
+#include <benchmark/benchmark.h>
+
+#include <ayan/math/mat.hpp>
+
+#include <array>
+
+using namespace ayan::math;
+
+namespace {
+
+// 16 dot products through element access, the pre-SIMD way:
+template<typename NumT>
+Mat4<NumT> scalar_multiply(const Mat4<NumT>& a, const Mat4<NumT>& b) noexcept {
+  Mat4<NumT> result;
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 4; ++j) {
+      NumT sum = 0;
+      for (size_t k = 0; k < 4; ++k) {
+        sum += a(i, k) * b(k, j);
+      }
+      result(i, j) = sum;
+    }
+  }
+  return result;
+}
+
+template<typename NumT>
+std::array<Mat4<NumT>, 64> make_matrices() {
+  std::array<Mat4<NumT>, 64> mats;
+  for (size_t n = 0; n < mats.size(); ++n) {
+    for (size_t i = 0; i < 4; ++i) {
+      for (size_t j = 0; j < 4; ++j) {
+        mats[n](i, j) = static_cast<NumT>((n * 7 + i * 4 + j) % 11) - NumT(5);
+      }
+    }
+  }
+  return mats;
+}
+
+template<typename NumT>
+void BM_Mat4Multiply(benchmark::State& state) {
+  const auto mats = make_matrices<NumT>();
+  Mat4<NumT> acc;
+  size_t n = 0;
+  for (auto _ : state) {
+    acc = mats[n] * mats[(n + 1) & 63];
+    benchmark::DoNotOptimize(acc);
+    n = (n + 1) & 63;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename NumT>
+void BM_Mat4MultiplyScalar(benchmark::State& state) {
+  const auto mats = make_matrices<NumT>();
+  Mat4<NumT> acc;
+  size_t n = 0;
+  for (auto _ : state) {
+    acc = scalar_multiply(mats[n], mats[(n + 1) & 63]);
+    benchmark::DoNotOptimize(acc);
+    n = (n + 1) & 63;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename NumT>
+void BM_Mat4TimesVec4(benchmark::State& state) {
+  const auto mats = make_matrices<NumT>();
+  Vec4<NumT> vec{1, 2, 3, 1};
+  size_t n = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mats[n] * vec);
+    n = (n + 1) & 63;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename NumT>
+void BM_Mat4Inverse(benchmark::State& state) {
+  const auto mats = make_matrices<NumT>();
+  size_t n = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mats[n].inverse());
+    n = (n + 1) & 63;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename NumT>
+void BM_Mat4AffineInverse(benchmark::State& state) {
+  auto mats = make_matrices<NumT>();
+  for (auto& m : mats) {
+    m(3, 0) = m(3, 1) = m(3, 2) = NumT(0);
+    m(3, 3) = NumT(1);
+  }
+  size_t n = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mats[n].affine_inverse());
+    n = (n + 1) & 63;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename NumT>
+void BM_Mat3Multiply(benchmark::State& state) {
+  std::array<Mat3<NumT>, 64> mats;
+  const auto mats4 = make_matrices<NumT>();
+  for (size_t n = 0; n < mats.size(); ++n) mats[n] = Mat3<NumT>(mats4[n]);
+  Mat3<NumT> acc;
+  size_t n = 0;
+  for (auto _ : state) {
+    acc = mats[n] * mats[(n + 1) & 63];
+    benchmark::DoNotOptimize(acc);
+    n = (n + 1) & 63;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename NumT>
+void BM_Mat3TimesVec3(benchmark::State& state) {
+  std::array<Mat3<NumT>, 64> mats;
+  const auto mats4 = make_matrices<NumT>();
+  for (size_t n = 0; n < mats.size(); ++n) mats[n] = Mat3<NumT>(mats4[n]);
+  Vec3<NumT> vec{1, 2, 3};
+  size_t n = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mats[n] * vec);
+    n = (n + 1) & 63;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// the upper 3 rows of make_matrices(), the instance transform layout:
+template<typename NumT>
+std::array<Mat3x4<NumT>, 64> make_affine_matrices() {
+  std::array<Mat3x4<NumT>, 64> mats;
+  const auto mats4 = make_matrices<NumT>();
+  for (size_t n = 0; n < mats.size(); ++n) mats[n] = Mat3x4<NumT>(mats4[n]);
+  return mats;
+}
+
+template<typename NumT>
+void BM_Mat3x4Compose(benchmark::State& state) {
+  const auto mats = make_affine_matrices<NumT>();
+  Mat3x4<NumT> acc;
+  size_t n = 0;
+  for (auto _ : state) {
+    acc = mats[n] * mats[(n + 1) & 63];
+    benchmark::DoNotOptimize(acc);
+    n = (n + 1) & 63;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename NumT>
+void BM_Mat3x4TransformPoint(benchmark::State& state) {
+  const auto mats = make_affine_matrices<NumT>();
+  Vec3<NumT> point{1, 2, 3};
+  size_t n = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mats[n].transform_point(point));
+    n = (n + 1) & 63;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename NumT>
+void BM_Mat3x4Inverse(benchmark::State& state) {
+  const auto mats = make_affine_matrices<NumT>();
+  size_t n = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mats[n].inverse());
+    n = (n + 1) & 63;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_Mat4Multiply<float>);
+BENCHMARK(BM_Mat4MultiplyScalar<float>);
+BENCHMARK(BM_Mat4Multiply<double>);
+BENCHMARK(BM_Mat4MultiplyScalar<double>);
+BENCHMARK(BM_Mat4TimesVec4<float>);
+BENCHMARK(BM_Mat4TimesVec4<double>);
+BENCHMARK(BM_Mat4Inverse<float>);
+BENCHMARK(BM_Mat4Inverse<double>);
+BENCHMARK(BM_Mat4AffineInverse<float>);
+BENCHMARK(BM_Mat4AffineInverse<double>);
+BENCHMARK(BM_Mat3Multiply<float>);
+BENCHMARK(BM_Mat3Multiply<double>);
+BENCHMARK(BM_Mat3TimesVec3<float>);
+BENCHMARK(BM_Mat3TimesVec3<double>);
+BENCHMARK(BM_Mat3x4Compose<float>);
+BENCHMARK(BM_Mat3x4Compose<double>);
+BENCHMARK(BM_Mat3x4TransformPoint<float>);
+BENCHMARK(BM_Mat3x4TransformPoint<double>);
+BENCHMARK(BM_Mat3x4Inverse<float>);
+BENCHMARK(BM_Mat3x4Inverse<double>);
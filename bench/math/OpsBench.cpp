@@ -0,0 +1,200 @@
+#include <benchmark/benchmark.h>
+
+#include <ayan/math/vec.hpp>
+#include <ayan/math/mat.hpp>
+
+#include "Throughput.hpp"
+
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+using namespace ayan::math;
+
+// Every Vec2/3/4 and Mat4 operation over arrays of operands small enough to
+// stay in L1/L2, so the time is the cost of the operation and not of memory.
+// time_per_op is the number to compare between builds.
+
+namespace {
+
+constexpr size_t kCount = 1024;
+
+template<typename T>
+struct Scalar;
+
+template<size_t N, typename NumT>
+struct Scalar<Vec<N, NumT>> { using type = NumT; };
+
+template<size_t R, size_t C, typename NumT>
+struct Scalar<Mat<R, C, NumT>> { using type = NumT; };
+
+template<typename T>
+using scalar_t = typename Scalar<T>::type;
+
+// non-zero values of both signs (operands of a division), integers stay small
+// enough for Mat4 products not to overflow:
+template<typename NumT>
+NumT random_scalar(std::mt19937& rng) {
+  if constexpr (std::is_integral_v<NumT>) {
+    const NumT value = std::uniform_int_distribution<NumT>(1, 9)(rng);
+    return rng() % 2 ? value : -value;
+  } else {
+    const NumT value = std::uniform_real_distribution<NumT>(NumT(0.5), NumT(2))(rng);
+    return rng() % 2 ? value : -value;
+  }
+}
+
+template<typename T>
+T random_value(std::mt19937& rng) {
+  T value;
+  if constexpr (requires { value(0, 0); }) {
+    // affine (valid for affine_inverse() too) and diagonally dominant, far from singular:
+    for (size_t i = 0; i < 3; ++i) {
+      for (size_t j = 0; j < 4; ++j) value(i, j) = random_scalar<scalar_t<T>>(rng);
+      value(i, i) += scalar_t<T>(40);
+    }
+  } else {
+    for (size_t i = 0; i < std::tuple_size_v<T>; ++i) value[i] = random_scalar<scalar_t<T>>(rng);
+  }
+  return value;
+}
+
+template<typename T>
+std::vector<T> make_operands(std::mt19937& rng) {
+  std::vector<T> operands(kCount);
+  for (T& operand : operands) operand = random_value<T>(rng);
+  return operands;
+}
+
+// out[i] = Op{}(args[i]...), bytes are the operands read plus the result written:
+template<typename Op, typename... Args>
+void BM_Op(benchmark::State& state) {
+  using Result = std::invoke_result_t<Op, const Args&...>;
+  std::mt19937 rng(1);
+  // braced initialization runs left to right, the seeds are the same in every build:
+  const std::tuple<std::vector<Args>...> operands{ make_operands<Args>(rng)... };
+  std::vector<Result> out(kCount);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) {
+      out[i] = std::apply([i](const auto&... args) { return Op{}(args[i]...); }, operands);
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  ayan::bench::set_throughput(state, kCount, (sizeof(Args) + ... + sizeof(Result)));
+}
+
+// ----- ----- ---- Operations ---- ----- -----
+struct Negate { template<typename T> T operator()(const T& a) const { return -a; } };
+struct Add { template<typename T> T operator()(const T& a, const T& b) const { return a + b; } };
+struct Sub { template<typename T> T operator()(const T& a, const T& b) const { return a - b; } };
+// component-wise for vectors, the product for matrices and Mat4 * Vec4:
+struct Mul { template<typename A, typename B> auto operator()(const A& a, const B& b) const { return a * b; } };
+struct Div { template<typename T> T operator()(const T& a, const T& b) const { return a / b; } };
+struct Scale { template<typename T> T operator()(const T& a) const { return a * scalar_t<T>(3); } };
+struct DivScalar { template<typename T> T operator()(const T& a) const { return a / scalar_t<T>(3); } };
+struct Equal { template<typename T> int operator()(const T& a, const T& b) const { return a == b; } };
+struct AddAssign { template<typename T> T operator()(T a, const T& b) const { return a += b; } };
+struct MulAssign { template<typename T> T operator()(T a, const T& b) const { return a *= b; } };
+
+struct Dot { template<typename T> auto operator()(const T& a, const T& b) const { return a.dot(b); } };
+struct LengthSquared {
+  template<typename T> auto operator()(const T& a) const {
+    if constexpr (requires { a.lengthSquared(); }) return a.lengthSquared(); // Vec2
+    else return a.length_squared();
+  }
+};
+struct Length { template<typename T> auto operator()(const T& a) const { return a.length(); } };
+struct Normalize { template<typename T> T operator()(const T& a) const { return a.normalize(); } };
+struct DistanceSquared { template<typename T> auto operator()(const T& a, const T& b) const { return a.distance_squared(b); } };
+struct Distance { template<typename T> auto operator()(const T& a, const T& b) const { return a.distance(b); } };
+struct Cross { template<typename T> T operator()(const T& a, const T& b) const { return a.cross(b); } };
+struct Triple { template<typename T> auto operator()(const T& a, const T& b, const T& c) const { return a.triple(b, c); } };
+struct Perpendicular { template<typename T> T operator()(const T& a) const { return a.perpendicular(); } };
+
+struct Transpose { template<typename T> T operator()(const T& a) const { return a.transpose(); } };
+struct Determinant { template<typename T> auto operator()(const T& a) const { return a.determinant(); } };
+struct Trace { template<typename T> auto operator()(const T& a) const { return a.trace(); } };
+struct Inverse { template<typename T> T operator()(const T& a) const { return a.inverse(); } };
+struct AffineInverse { template<typename T> T operator()(const T& a) const { return a.affine_inverse(); } };
+// random operands fail every check but is_orthogonal(), which is always a product:
+struct IsIdentity { template<typename T> int operator()(const T& a) const { return a.is_identity(); } };
+struct IsDiagonal { template<typename T> int operator()(const T& a) const { return a.is_diagonal(); } };
+struct IsSymmetric { template<typename T> int operator()(const T& a) const { return a.is_symmetric(); } };
+struct IsOrthogonal { template<typename T> int operator()(const T& a) const { return a.is_orthogonal(); } };
+
+} // namespace
+
+// ----- ----- ---- Registration ---- ----- -----
+#define AYAN_BENCH_VEC_OPS(VecT)                     \
+  BENCHMARK(BM_Op<Negate, VecT>);                    \
+  BENCHMARK(BM_Op<Add, VecT, VecT>);                 \
+  BENCHMARK(BM_Op<Sub, VecT, VecT>);                 \
+  BENCHMARK(BM_Op<Mul, VecT, VecT>);                 \
+  BENCHMARK(BM_Op<Div, VecT, VecT>);                 \
+  BENCHMARK(BM_Op<Scale, VecT>);                     \
+  BENCHMARK(BM_Op<DivScalar, VecT>);                 \
+  BENCHMARK(BM_Op<Equal, VecT, VecT>);               \
+  BENCHMARK(BM_Op<Dot, VecT, VecT>);                 \
+  BENCHMARK(BM_Op<LengthSquared, VecT>);             \
+  BENCHMARK(BM_Op<DistanceSquared, VecT, VecT>)
+
+// length(), normalize() and distance() take a square root:
+#define AYAN_BENCH_VEC_FLOAT_OPS(VecT)               \
+  BENCHMARK(BM_Op<Length, VecT>);                    \
+  BENCHMARK(BM_Op<Normalize, VecT>);                 \
+  BENCHMARK(BM_Op<Distance, VecT, VecT>)
+
+#define AYAN_BENCH_MAT4_OPS(NumT)                      \
+  BENCHMARK(BM_Op<Add, Mat4<NumT>, Mat4<NumT>>);       \
+  BENCHMARK(BM_Op<Sub, Mat4<NumT>, Mat4<NumT>>);       \
+  BENCHMARK(BM_Op<Mul, Mat4<NumT>, Mat4<NumT>>);       \
+  BENCHMARK(BM_Op<Mul, Mat4<NumT>, Vec4<NumT>>);       \
+  BENCHMARK(BM_Op<AddAssign, Mat4<NumT>, Mat4<NumT>>); \
+  BENCHMARK(BM_Op<MulAssign, Mat4<NumT>, Mat4<NumT>>); \
+  BENCHMARK(BM_Op<Scale, Mat4<NumT>>);                 \
+  BENCHMARK(BM_Op<DivScalar, Mat4<NumT>>);             \
+  BENCHMARK(BM_Op<Equal, Mat4<NumT>, Mat4<NumT>>);     \
+  BENCHMARK(BM_Op<Transpose, Mat4<NumT>>);             \
+  BENCHMARK(BM_Op<Determinant, Mat4<NumT>>);           \
+  BENCHMARK(BM_Op<Trace, Mat4<NumT>>);                 \
+  BENCHMARK(BM_Op<IsIdentity, Mat4<NumT>>);            \
+  BENCHMARK(BM_Op<IsDiagonal, Mat4<NumT>>);            \
+  BENCHMARK(BM_Op<IsSymmetric, Mat4<NumT>>);           \
+  BENCHMARK(BM_Op<IsOrthogonal, Mat4<NumT>>)
+
+AYAN_BENCH_VEC_OPS(Vec2f);
+AYAN_BENCH_VEC_FLOAT_OPS(Vec2f);
+BENCHMARK(BM_Op<Perpendicular, Vec2f>);
+AYAN_BENCH_VEC_OPS(Vec2d);
+AYAN_BENCH_VEC_FLOAT_OPS(Vec2d);
+BENCHMARK(BM_Op<Perpendicular, Vec2d>);
+AYAN_BENCH_VEC_OPS(Vec2i);
+BENCHMARK(BM_Op<Perpendicular, Vec2i>);
+
+AYAN_BENCH_VEC_OPS(Vec3f);
+AYAN_BENCH_VEC_FLOAT_OPS(Vec3f);
+BENCHMARK(BM_Op<Cross, Vec3f, Vec3f>);
+BENCHMARK(BM_Op<Triple, Vec3f, Vec3f, Vec3f>);
+AYAN_BENCH_VEC_OPS(Vec3d);
+AYAN_BENCH_VEC_FLOAT_OPS(Vec3d);
+BENCHMARK(BM_Op<Cross, Vec3d, Vec3d>);
+BENCHMARK(BM_Op<Triple, Vec3d, Vec3d, Vec3d>);
+AYAN_BENCH_VEC_OPS(Vec3i);
+BENCHMARK(BM_Op<Cross, Vec3i, Vec3i>);
+BENCHMARK(BM_Op<Triple, Vec3i, Vec3i, Vec3i>);
+
+AYAN_BENCH_VEC_OPS(Vec4f);
+AYAN_BENCH_VEC_FLOAT_OPS(Vec4f);
+AYAN_BENCH_VEC_OPS(Vec4d);
+AYAN_BENCH_VEC_FLOAT_OPS(Vec4d);
+AYAN_BENCH_VEC_OPS(Vec4i);
+
+AYAN_BENCH_MAT4_OPS(float);
+BENCHMARK(BM_Op<Inverse, Mat4<float>>);
+BENCHMARK(BM_Op<AffineInverse, Mat4<float>>);
+AYAN_BENCH_MAT4_OPS(double);
+BENCHMARK(BM_Op<Inverse, Mat4<double>>);
+BENCHMARK(BM_Op<AffineInverse, Mat4<double>>);
+AYAN_BENCH_MAT4_OPS(int);
@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+
+#include <ayan/math/sampling.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+constexpr size_t kCount = 4096;
+
+// the baseline, one <random> engine:
+void BM_Mt19937Uniform(benchmark::State& state) {
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+  std::vector<float> out(kCount);
+  for (auto _ : state) {
+    for (float& value : out) value = dist(rng);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_Pcg32Float(benchmark::State& state) {
+  Pcg32 rng = Pcg32::ForSample(1, 0);
+  std::vector<float> out(kCount);
+  for (auto _ : state) {
+    for (float& value : out) value = rng.next_float();
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_Pcg32x8Float(benchmark::State& state) {
+  auto rng = Pcg32x<8>::ForSamples(1, 0);
+  std::vector<float> out(kCount);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; i += 8) rng.next_float().store_unaligned(out.data() + i);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_SobolSample(benchmark::State& state) {
+  const SobolSampler sampler(1);
+  std::vector<float> out(kCount);
+  for (auto _ : state) {
+    for (uint32_t i = 0; i < kCount; ++i) out[i] = sampler.sample(7, i, 5);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_SobolSamples(benchmark::State& state) {
+  const SobolSampler sampler(1);
+  std::vector<float> out(kCount);
+  for (auto _ : state) {
+    sampler.samples(7, 0, 5, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+// one sample per pixel over a 64 x 64 tile, the real-time case:
+void BM_BlueNoiseSample(benchmark::State& state) {
+  const BlueNoiseSampler sampler(1);
+  std::vector<float> out(kCount);
+  for (auto _ : state) {
+    for (uint32_t i = 0; i < kCount; ++i) out[i] = sampler.sample(Vec2i(int(i % 64), int(i / 64)), 0, 2);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_BlueNoiseSamples(benchmark::State& state) {
+  const BlueNoiseSampler sampler(kCount);
+  std::vector<float> out(kCount);
+  for (auto _ : state) {
+    sampler.samples(Vec2i(3, 5), 0, 2, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace
+
+BENCHMARK(BM_Mt19937Uniform);
+BENCHMARK(BM_Pcg32Float);
+BENCHMARK(BM_Pcg32x8Float);
+BENCHMARK(BM_SobolSample);
+BENCHMARK(BM_SobolSamples);
+BENCHMARK(BM_BlueNoiseSample);
+BENCHMARK(BM_BlueNoiseSamples);
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ayan::bench {
+
+// `ops` operations per iteration, each reading and writing `bytes_per_op` bytes
+// in total. Reported as items_per_second, bytes_per_second and time_per_op
+// (seconds in JSON, printed as ns), the last one is comparable across
+// benchmarks with different batch sizes:
+inline void set_throughput(benchmark::State& state, size_t ops, size_t bytes_per_op) {
+  state.SetItemsProcessed(int64_t(state.iterations() * ops));
+  state.SetBytesProcessed(int64_t(state.iterations() * ops * bytes_per_op));
+  state.counters["time_per_op"] = benchmark::Counter(double(ops),
+    benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+} // namespace ayan::bench
@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include <ayan/math/simd.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+constexpr size_t kCount = 4096;
+// the native width: 8 with AVX, 4 with SSE only:
+constexpr size_t kLanes = simd::IsNative<float, 8> ? 8 : 4;
+using Pack = simd::Pack<float, kLanes>;
+
+std::vector<float> make_inputs(float lo, float hi) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> dist(lo, hi);
+  std::vector<float> values(kCount);
+  for (float& value : values) value = dist(rng);
+  return values;
+}
+
+// std:: per element against the same function over packs of kLanes:
+template<typename ScalarFunc>
+void run_scalar(benchmark::State& state, float lo, float hi, ScalarFunc func) {
+  const std::vector<float> in = make_inputs(lo, hi);
+  std::vector<float> out(kCount);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) out[i] = func(in[i]);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template<typename PackFunc>
+void run_packed(benchmark::State& state, float lo, float hi, PackFunc func) {
+  const std::vector<float> in = make_inputs(lo, hi);
+  std::vector<float> out(kCount);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; i += kLanes) func(Pack::LoadUnaligned(in.data() + i)).store_unaligned(out.data() + i);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_StdSin(benchmark::State& state) {
+  run_scalar(state, -10.0f, 10.0f, [](float x) { return std::sin(x); });
+}
+
+void BM_PackSin(benchmark::State& state) {
+  run_packed(state, -10.0f, 10.0f, [](const Pack& x) { return simd::sin(x); });
+}
+
+void BM_StdSinCos(benchmark::State& state) {
+  run_scalar(state, -10.0f, 10.0f, [](float x) { return std::sin(x) + std::cos(x); });
+}
+
+void BM_PackSinCos(benchmark::State& state) {
+  run_packed(state, -10.0f, 10.0f, [](const Pack& x) {
+    const auto [s, c] = simd::sincos(x);
+    return s + c;
+  });
+}
+
+void BM_StdExp(benchmark::State& state) {
+  run_scalar(state, -20.0f, 20.0f, [](float x) { return std::exp(x); });
+}
+
+void BM_PackExp(benchmark::State& state) {
+  run_packed(state, -20.0f, 20.0f, [](const Pack& x) { return simd::exp(x); });
+}
+
+void BM_StdLog(benchmark::State& state) {
+  run_scalar(state, 1e-3f, 1e3f, [](float x) { return std::log(x); });
+}
+
+void BM_PackLog(benchmark::State& state) {
+  run_packed(state, 1e-3f, 1e3f, [](const Pack& x) { return simd::log(x); });
+}
+
+// the sRGB encode exponent:
+void BM_StdPow(benchmark::State& state) {
+  run_scalar(state, 0.0f, 1.0f, [](float x) { return std::pow(x, 1.0f / 2.4f); });
+}
+
+void BM_PackPow(benchmark::State& state) {
+  run_packed(state, 0.0f, 1.0f, [](const Pack& x) { return simd::pow(x, 1.0f / 2.4f); });
+}
+
+void BM_StdAtan2(benchmark::State& state) {
+  run_scalar(state, -10.0f, 10.0f, [](float x) { return std::atan2(x, 0.5f); });
+}
+
+void BM_PackAtan2(benchmark::State& state) {
+  run_packed(state, -10.0f, 10.0f, [](const Pack& x) { return simd::atan2(x, Pack(0.5f)); });
+}
+
+} // namespace
+
+BENCHMARK(BM_StdSin);
+BENCHMARK(BM_PackSin);
+BENCHMARK(BM_StdSinCos);
+BENCHMARK(BM_PackSinCos);
+BENCHMARK(BM_StdExp);
+BENCHMARK(BM_PackExp);
+BENCHMARK(BM_StdLog);
+BENCHMARK(BM_PackLog);
+BENCHMARK(BM_StdPow);
+BENCHMARK(BM_PackPow);
+BENCHMARK(BM_StdAtan2);
+BENCHMARK(BM_PackAtan2);
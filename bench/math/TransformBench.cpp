@@ -0,0 +1,187 @@
+#include <benchmark/benchmark.h>
+
+#include <ayan/math/transform.hpp>
+
+#include "Throughput.hpp"
+
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+template<typename NumT>
+Mat4<NumT> bench_matrix() {
+  return Mat4<NumT>{
+    0, -2, 0, 5,
+    1,  0, 0, 6,
+    0,  0, 3, 7,
+    0,  0, 0, 1
+  };
+}
+
+template<typename NumT>
+std::vector<Vec3<NumT>> make_points(size_t count) {
+  std::vector<Vec3<NumT>> points(count);
+  for (size_t i = 0; i < count; ++i) {
+    points[i] = Vec3<NumT>(NumT(i % 7), NumT(i % 5), NumT(i % 11));
+  }
+  return points;
+}
+
+// bytes read and written per element:
+template<typename NumT>
+void set_throughput(benchmark::State& state, size_t count) {
+  ayan::bench::set_throughput(state, count, 2 * sizeof(Vec3<NumT>));
+}
+
+// one Vec3 at a time through Mat4 * Vec4, the pre-batch way:
+template<typename NumT>
+void BM_TransformPointsLoop(benchmark::State& state) {
+  const Mat4<NumT> m = bench_matrix<NumT>();
+  const auto in = make_points<NumT>(size_t(state.range(0)));
+  std::vector<Vec3<NumT>> out(in.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < in.size(); ++i) {
+      const Vec4<NumT> r = m * Vec4<NumT>(in[i].x(), in[i].y(), in[i].z(), NumT(1));
+      out[i] = Vec3<NumT>(r.x(), r.y(), r.z());
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  set_throughput<NumT>(state, in.size());
+}
+
+template<typename NumT>
+void BM_TransformPointsBatch(benchmark::State& state) {
+  const Mat4<NumT> m = bench_matrix<NumT>();
+  const auto in = make_points<NumT>(size_t(state.range(0)));
+  std::vector<Vec3<NumT>> out(in.size());
+  for (auto _ : state) {
+    transform_batch<TransformAs::Point>(m, in, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  set_throughput<NumT>(state, in.size());
+}
+
+template<typename NumT>
+void BM_TransformPointsThreaded(benchmark::State& state) {
+  const Mat4<NumT> m = bench_matrix<NumT>();
+  const auto in = make_points<NumT>(size_t(state.range(0)));
+  std::vector<Vec3<NumT>> out(in.size());
+  for (auto _ : state) {
+    transform_batch<TransformAs::Point>(ayan::sync::ThreadPool::Global(), m, in, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  set_throughput<NumT>(state, in.size());
+}
+
+template<typename NumT>
+void BM_TransformPointsSoA(benchmark::State& state) {
+  using Packet = Vec3x<detail::batch_lanes<NumT>, NumT>;
+  const Mat4<NumT> m = bench_matrix<NumT>();
+  const auto points = make_points<NumT>(size_t(state.range(0)));
+  std::vector<Packet> in;
+  for (size_t i = 0; i + Packet::lanes <= points.size(); i += Packet::lanes) {
+    in.push_back(Packet::Load(points.data() + i));
+  }
+  std::vector<Packet> out(in.size());
+  for (auto _ : state) {
+    transform_batch<TransformAs::Point, Packet::lanes, NumT>(m, in, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  set_throughput<NumT>(state, in.size() * Packet::lanes);
+}
+
+// a binary tree stored parents first (node i hangs under (i - 1) / 2):
+template<typename NumT>
+std::vector<TRS<NumT>> make_nodes(size_t count, std::vector<uint32_t>& parents) {
+  std::vector<TRS<NumT>> nodes(count);
+  parents.resize(count);
+  for (size_t i = 0; i < count; ++i) {
+    const NumT f = NumT(i % 13) * NumT(0.1);
+    nodes[i] = TRS<NumT>{ Vec3<NumT>(f, NumT(1) - f, NumT(0.5)),
+      Quat<NumT>::AxisAngle(Vec3<NumT>::UnitZ(), f), Vec3<NumT>::One() };
+    parents[i] = i == 0 ? kNoParent : uint32_t((i - 1) / 2);
+  }
+  return nodes;
+}
+
+template<typename NumT>
+void BM_QuatMultiply(benchmark::State& state) {
+  std::vector<uint32_t> parents;
+  const auto nodes = make_nodes<NumT>(64, parents);
+  Quat<NumT> acc;
+  size_t n = 0;
+  for (auto _ : state) {
+    acc = nodes[n].rotation * nodes[(n + 1) & 63].rotation;
+    benchmark::DoNotOptimize(acc);
+    n = (n + 1) & 63;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// the per-frame hierarchy update in TRS form:
+template<typename NumT>
+void BM_PropagateHierarchyTRS(benchmark::State& state) {
+  std::vector<uint32_t> parents;
+  const auto local = make_nodes<NumT>(size_t(state.range(0)), parents);
+  std::vector<TRS<NumT>> world(local.size());
+  for (auto _ : state) {
+    propagate_hierarchy<NumT>(local, parents, world);
+    benchmark::DoNotOptimize(world.data());
+    benchmark::ClobberMemory();
+  }
+  ayan::bench::set_throughput(state, local.size(), 2 * sizeof(TRS<NumT>) + sizeof(uint32_t));
+}
+
+// the same update with every node already a Mat4, the pre-TRS way:
+template<typename NumT>
+void BM_PropagateHierarchyMat4(benchmark::State& state) {
+  std::vector<uint32_t> parents;
+  const auto nodes = make_nodes<NumT>(size_t(state.range(0)), parents);
+  std::vector<Mat4<NumT>> local(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i) local[i] = nodes[i].to_mat4();
+  std::vector<Mat4<NumT>> world(local.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < local.size(); ++i) {
+      world[i] = parents[i] == kNoParent ? local[i] : world[parents[i]] * local[i];
+    }
+    benchmark::DoNotOptimize(world.data());
+    benchmark::ClobberMemory();
+  }
+  ayan::bench::set_throughput(state, local.size(), 2 * sizeof(Mat4<NumT>) + sizeof(uint32_t));
+}
+
+template<typename NumT>
+void BM_TRSToAffine(benchmark::State& state) {
+  std::vector<uint32_t> parents;
+  const auto nodes = make_nodes<NumT>(64, parents);
+  size_t n = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(nodes[n].to_affine());
+    n = (n + 1) & 63;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_TransformPointsLoop<float>)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK(BM_TransformPointsBatch<float>)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK(BM_TransformPointsThreaded<float>)->Arg(1 << 20);
+BENCHMARK(BM_TransformPointsSoA<float>)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK(BM_TransformPointsLoop<double>)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK(BM_TransformPointsBatch<double>)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK(BM_TransformPointsSoA<double>)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK(BM_QuatMultiply<float>);
+BENCHMARK(BM_QuatMultiply<double>);
+BENCHMARK(BM_PropagateHierarchyTRS<float>)->Arg(1 << 12);
+BENCHMARK(BM_PropagateHierarchyMat4<float>)->Arg(1 << 12);
+BENCHMARK(BM_PropagateHierarchyTRS<double>)->Arg(1 << 12);
+BENCHMARK(BM_PropagateHierarchyMat4<double>)->Arg(1 << 12);
+BENCHMARK(BM_TRSToAffine<float>);
+BENCHMARK(BM_TRSToAffine<double>);
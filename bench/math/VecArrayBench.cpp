@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <ayan/math/array.hpp>
+
+#include "Throughput.hpp"
+
+#include <vector>
+
+using namespace ayan::math;
+
+// The same bulk operations over Vec3f arrays in each Layout. 1 << 12 vectors
+// stay in L1/L2, 1 << 20 are bound by memory.
+
+namespace {
+
+template<typename ArrayT>
+ArrayT make_array(size_t count) {
+  ArrayT array;
+  array.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    array.push_back(Vec3f(float(i % 7) - 3, float(i % 5) + 1, float(i % 11) - 5));
+  }
+  return array;
+}
+
+template<typename ArrayT>
+void BM_VecArrayAdd(benchmark::State& state) {
+  ArrayT a = make_array<ArrayT>(size_t(state.range(0)));
+  const ArrayT b = make_array<ArrayT>(a.size());
+  for (auto _ : state) {
+    a += b;
+    benchmark::DoNotOptimize(a.data());
+    benchmark::ClobberMemory();
+  }
+  ayan::bench::set_throughput(state, a.size(), 3 * sizeof(Vec3f));
+}
+
+template<typename ArrayT>
+void BM_VecArrayDot(benchmark::State& state) {
+  const ArrayT a = make_array<ArrayT>(size_t(state.range(0)));
+  const ArrayT b = make_array<ArrayT>(a.size());
+  std::vector<float> out(a.size());
+  for (auto _ : state) {
+    a.dot(b, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  ayan::bench::set_throughput(state, a.size(), 2 * sizeof(Vec3f) + sizeof(float));
+}
+
+template<typename ArrayT, Precision P>
+void BM_VecArrayNormalize(benchmark::State& state) {
+  const ArrayT source = make_array<ArrayT>(size_t(state.range(0)));
+  ArrayT a = source;
+  for (auto _ : state) {
+    a.template normalize<P>();
+    benchmark::DoNotOptimize(a.data());
+    benchmark::ClobberMemory();
+  }
+  ayan::bench::set_throughput(state, a.size(), 2 * sizeof(Vec3f));
+}
+
+template<typename ArrayT>
+void BM_VecArrayTransform(benchmark::State& state) {
+  // rotation about z, so the points stay bounded over the iterations:
+  const Mat4f m{
+    0, -1, 0, 0,
+    1,  0, 0, 0,
+    0,  0, 1, 0,
+    0,  0, 0, 1
+  };
+  ArrayT a = make_array<ArrayT>(size_t(state.range(0)));
+  for (auto _ : state) {
+    a.template transform<TransformAs::Point>(m);
+    benchmark::DoNotOptimize(a.data());
+    benchmark::ClobberMemory();
+  }
+  ayan::bench::set_throughput(state, a.size(), 2 * sizeof(Vec3f));
+}
+
+using AoS = VecArrayAoS<3, float>;
+using SoA = VecArraySoA<3, float>;
+using AoSoA = VecArrayAoSoA<3, float>;
+
+} // namespace
+
+#define AYAN_BENCH_VEC_ARRAY(ArrayT)                                                  \
+  BENCHMARK(BM_VecArrayAdd<ArrayT>)->Arg(1 << 12)->Arg(1 << 20);                      \
+  BENCHMARK(BM_VecArrayDot<ArrayT>)->Arg(1 << 12)->Arg(1 << 20);                      \
+  BENCHMARK(BM_VecArrayNormalize<ArrayT, Precision::Exact>)->Arg(1 << 12)->Arg(1 << 20); \
+  BENCHMARK(BM_VecArrayNormalize<ArrayT, Precision::Fast>)->Arg(1 << 12);            \
+  BENCHMARK(BM_VecArrayTransform<ArrayT>)->Arg(1 << 12)->Arg(1 << 20)
+
+AYAN_BENCH_VEC_ARRAY(AoS);
+AYAN_BENCH_VEC_ARRAY(SoA);
+AYAN_BENCH_VEC_ARRAY(AoSoA);
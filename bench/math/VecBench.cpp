@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <ayan/math/vec.hpp>
+#include <ayan/math/expr.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+constexpr size_t kCount = 4096;
+
+std::vector<Vec3f> make_vectors() {
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+  std::vector<Vec3f> vecs(kCount);
+  for (auto& v : vecs) v = Vec3f(dist(rng), dist(rng), dist(rng));
+  return vecs;
+}
+
+template<Precision P>
+void BM_Vec3Normalize(benchmark::State& state) {
+  const auto vecs = make_vectors();
+  std::vector<Vec3f> out(kCount);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) out[i] = vecs[i].normalize<P>();
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template<Precision P>
+void BM_Vec3Length(benchmark::State& state) {
+  const auto vecs = make_vectors();
+  for (auto _ : state) {
+    float sum = 0.0f;
+    for (const auto& v : vecs) sum += v.length<P>();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template<Precision P>
+void BM_Vec3x8Normalize(benchmark::State& state) {
+  const auto vecs = make_vectors();
+  std::vector<Vec3f> out(kCount);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; i += 8) Vec3x8f::Load(vecs.data() + i).normalize<P>().store(out.data() + i);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+// a + b * s - c * t over arrays, with temporaries or as one expression:
+template<typename NumT>
+void BM_Vec3ChainOperators(benchmark::State& state) {
+  std::vector<Vec3<NumT>> a(kCount, Vec3<NumT>(1, 2, 3)), b(kCount, Vec3<NumT>(4, 5, 6)), c(kCount, Vec3<NumT>(7, 8, 9));
+  std::vector<Vec3<NumT>> out(kCount);
+  const NumT s = NumT(0.5);
+  const NumT t = NumT(0.25);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) out[i] = a[i] + b[i] * s - c[i] * t;
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template<typename NumT, Precision P>
+void BM_Vec3ChainExpr(benchmark::State& state) {
+  std::vector<Vec3<NumT>> a(kCount, Vec3<NumT>(1, 2, 3)), b(kCount, Vec3<NumT>(4, 5, 6)), c(kCount, Vec3<NumT>(7, 8, 9));
+  std::vector<Vec3<NumT>> out(kCount);
+  const NumT s = NumT(0.5);
+  const NumT t = NumT(0.25);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kCount; ++i) out[i] = eval<P>(lazy(a[i]) + lazy(b[i]) * s - lazy(c[i]) * t);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+} // namespace
+
+BENCHMARK(BM_Vec3Normalize<Precision::Exact>);
+BENCHMARK(BM_Vec3Normalize<Precision::Fast>);
+BENCHMARK(BM_Vec3Normalize<Precision::FastRefined>);
+BENCHMARK(BM_Vec3Length<Precision::Exact>);
+BENCHMARK(BM_Vec3Length<Precision::Fast>);
+BENCHMARK(BM_Vec3Length<Precision::FastRefined>);
+BENCHMARK(BM_Vec3x8Normalize<Precision::Exact>);
+BENCHMARK(BM_Vec3x8Normalize<Precision::Fast>);
+BENCHMARK(BM_Vec3x8Normalize<Precision::FastRefined>);
+BENCHMARK(BM_Vec3ChainOperators<float>);
+BENCHMARK(BM_Vec3ChainExpr<float, Precision::Exact>);
+BENCHMARK(BM_Vec3ChainExpr<float, Precision::Fast>);
+BENCHMARK(BM_Vec3ChainOperators<double>);
+BENCHMARK(BM_Vec3ChainExpr<double, Precision::Exact>);
+BENCHMARK(BM_Vec3ChainExpr<double, Precision::Fast>);
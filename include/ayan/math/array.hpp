@@ -0,0 +1,3 @@
+#pragma once
+
+#include "../src/math/vec/vec_array.hpp"
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "../src/math/bvh/bvh.hpp"
+#include "../src/math/bvh/wide_bvh.hpp"
+#include "../src/math/bvh/instance_bvh.hpp"
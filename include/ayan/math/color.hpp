@@ -0,0 +1,4 @@
+#pragma once
+
+#include "../src/math/color/color.hpp"
+#include "../src/math/color/tonemap.hpp"
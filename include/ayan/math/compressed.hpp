@@ -0,0 +1,5 @@
+#pragma once
+
+#include "../src/math/vec/half.hpp"
+#include "../src/math/vec/octahedral.hpp"
+#include "../src/math/vec/quantized.hpp"
@@ -0,0 +1,4 @@
+#pragma once
+
+#include "../src/math/curve/morton.hpp"
+#include "../src/math/curve/hilbert.hpp"
@@ -0,0 +1,3 @@
+#pragma once
+
+#include "../src/math/vec/expr.hpp"
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "../src/math/geometry/ray.hpp"
+#include "../src/math/geometry/aabb.hpp"
+#include "../src/math/geometry/aabbx.hpp"
+#include "../src/math/geometry/rayx.hpp"
+#include "../src/math/geometry/triangle.hpp"
+#include "../src/math/geometry/frustum.hpp"
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "../src/math/lut/lut.hpp"
+#include "../src/math/lut/srgb.hpp"
+#include "../src/math/lut/bsdf.hpp"
@@ -3,3 +3,4 @@
 #include "../src/math/matrix/mat2.hpp"
 #include "../src/math/matrix/mat3.hpp"
 #include "../src/math/matrix/mat4.hpp"
+#include "../src/math/matrix/mat3x4.hpp"
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "../src/math/sampling/pcg.hpp"
+#include "../src/math/sampling/sobol.hpp"
+#include "../src/math/sampling/blue_noise.hpp"
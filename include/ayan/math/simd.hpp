@@ -0,0 +1,4 @@
+#pragma once
+
+#include "../src/math/simd/pack.hpp"
+#include "../src/math/simd/transcendental.hpp"
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "../src/math/transform/transform.hpp"
+#include "../src/math/transform/batch.hpp"
+#include "../src/math/transform/quat.hpp"
+#include "../src/math/transform/trs.hpp"
@@ -3,3 +3,5 @@
 #include "../src/math/vec/vec2.hpp"
 #include "../src/math/vec/vec3.hpp"
 #include "../src/math/vec/vec4.hpp"
+#include "../src/math/vec/vec3x.hpp"
+#include "../src/math/vec/transcendental.hpp"
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "../src/sync/mutex/Mutex.hpp"
+#include "../src/sync/condvar/CondVar.hpp"
+#include "../src/sync/barrier/Barrier.hpp"
+#include "../src/sync/waitgroup/WaitGroup.hpp"
+#include "../src/sync/threadpool/ThreadPool.hpp"
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <ayan/math/vec.hpp>
+#include <ayan/math/geometry.hpp>
+#include <ayan/sync.hpp>
+
+#include "../detail/aligned_allocator.hpp"
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//        BOUNDING VOLUME HIERARCHY (BINNED SAH)        |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// Binary BVH over primitive boxes (triangles or anything else with bounds).
+// Each node is split by the surface area heuristic evaluated at the borders
+// of kBvhBins bins of the centroid bounds along each axis (Wald, "On fast
+// construction of SAH-based bounding volume hierarchies", 2007). A primitive
+// box is one 4-float pack for each corner, so putting it into the bins of
+// all 3 axes is a few pack min/max.
+// With a ThreadPool the nodes above kBvhSubtreeSize primitives are binned
+// and partitioned in parallel chunks, and every subtree below that is built
+// by one task as soon as it is found, all joined by a WaitGroup. The tree does
+// not depend on the thread count.
+// Nodes are 32 bytes, siblings are adjacent and share a 64-byte line.
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// centroid bins per axis and node:
+inline constexpr size_t kBvhBins = 16;
+// no path from the root to a leaf is longer (the traversal stack):
+inline constexpr size_t kBvhMaxDepth = 96;
+// largest subtree built by a single task of a parallel build:
+inline constexpr size_t kBvhSubtreeSize = size_t(1) << 16;
+
+struct BvhNode {
+  AABBf bounds;
+  // inner node: index of the first child, the second one follows;
+  // leaf: its first primitive in Bvh::indices():
+  uint32_t offset;
+  // 0 for inner nodes:
+  uint32_t count;
+
+  bool is_leaf() const noexcept { return count != 0; }
+};
+
+struct BvhBuildSettings {
+  // a node with more primitives is always split:
+  size_t max_leaf_size = 4;
+  // SAH costs of visiting a node and of testing one primitive:
+  float traversal_cost = 1.0f;
+  float intersection_cost = 1.0f;
+};
+
+struct BvhBuildStats {
+  double build_seconds = 0.0;
+  // expected cost of a ray that hits the root box, by the costs of the settings:
+  float sah_cost = 0.0f;
+  size_t inner_count = 0;
+  size_t leaf_count = 0;
+  size_t max_depth = 0;
+};
+
+// the closest hit, `primitive` indexes the span the Bvh was built over:
+struct BvhHit {
+  float t;
+  float u;
+  float v;
+  uint32_t primitive;
+};
+
+class Bvh {
+public: // Types:
+  using node_list_type = std::vector<BvhNode, detail::AlignedAllocator<BvhNode>>;
+
+private: // Fields:
+  // [0] is the root, [1] is unused: sibling pairs start at even indices:
+  node_list_type node_list;
+  // primitives in leaf order:
+  std::vector<uint32_t> prim_indices;
+  BvhBuildStats build_stats;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  // without nodes, nothing is hit:
+  Bvh() noexcept = default;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // primitive `i` is bounds[i] (triangles[i]). Empty and NaN boxes are binned
+  // as if their centroid was at the lower corner of the centroid bounds:
+  static Bvh Build(std::span<const AABBf> bounds, const BvhBuildSettings& settings = {});
+  static Bvh Build(std::span<const Trianglef> triangles, const BvhBuildSettings& settings = {});
+
+  // The same, subtrees built by the workers of `pool`, the calling thread
+  // (which may be a task of `pool`) takes part:
+  static Bvh Build(sync::ThreadPool& pool, std::span<const AABBf> bounds, const BvhBuildSettings& settings = {});
+  static Bvh Build(sync::ThreadPool& pool, std::span<const Trianglef> triangles, const BvhBuildSettings& settings = {});
+
+  // ----- ----- ---- Element access ---- ----- -----
+  std::span<const BvhNode> nodes() const noexcept;
+  std::span<const uint32_t> indices() const noexcept;
+  const BvhBuildStats& stats() const noexcept;
+
+  // ----- ----- ---- Properties ----- ----- ----
+  bool is_empty() const noexcept;
+  // bounds of all primitives, empty box without nodes:
+  AABBf bounds() const noexcept;
+  // Expected cost of tracing a ray that hits the root box: every node costs
+  // `traversal_cost` and every leaf `intersection_cost` per primitive, weighted
+  // by the probability of reaching it (its surface area over the root's):
+  float sah_cost(float traversal_cost, float intersection_cost) const noexcept;
+
+  // ----- ----- ---- Intersection ----- ----- ----
+  // Closest hit within [ray.t_min(), ray.t_max()] among `triangles`, the
+  // span the Bvh was built over. Children are visited nearest first, `hit` is
+  // written only if something is hit:
+  bool intersect(std::span<const Trianglef> triangles, const Rayf& ray, BvhHit& hit) const noexcept;
+
+private: // Member functions:
+  template<typename BoundsFunc>
+  static Bvh BuildFrom(sync::ThreadPool* pool, size_t count, const BvhBuildSettings& settings, BoundsFunc&& bounds_of);
+
+  void compute_stats(const BvhBuildSettings& settings) noexcept;
+};
+
+} // namespace ayan::math
+
+#include "impl/builder.hpp"
+#include "impl/bvh.hpp"
@@ -0,0 +1,612 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <deque>
+#include <limits>
+#include <utility>
+
+#include "../bvh.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+using BvhPack = simd::Pack<float, 4>;
+
+// Nodes above kBvhSubtreeSize primitives are binned and partitioned in
+// chunks of this many, in parallel. The chunks depend only on the node, so
+// the tree does not depend on the number of threads:
+inline constexpr size_t kBvhChunkSize = size_t(1) << 14;
+// beyond this depth the split is the object median, which bounds the depth
+// by kBvhMaxDepth (a range of 2^32 primitives is halved 32 times):
+inline constexpr size_t kBvhSahDepth = kBvhMaxDepth - 32;
+
+// A primitive box, the lanes 0..2 of two packs. Lane 3 of `lower` holds the
+// primitive index (its bits), the builder moves 32 bytes per primitive:
+struct alignas(16) BvhPrimRef {
+  float lower[4];
+  float upper[4];
+
+  uint32_t index() const noexcept { return std::bit_cast<uint32_t>(lower[3]); }
+  // twice the centroid, lane 3 is meaningless:
+  BvhPack centroid2() const noexcept { return BvhPack::Load(lower) + BvhPack::Load(upper); }
+};
+
+// lanes 0..2 of min/max corners, empty by default. NaNs are dropped (the
+// box is the second operand of min/max):
+struct BvhPackBox {
+  BvhPack lower = BvhPack(std::numeric_limits<float>::infinity());
+  BvhPack upper = BvhPack(-std::numeric_limits<float>::infinity());
+
+  void extend(const BvhPack& point) noexcept {
+    lower = simd::min(point, lower);
+    upper = simd::max(point, upper);
+  }
+
+  void extend(const BvhPack& box_lower, const BvhPack& box_upper) noexcept {
+    lower = simd::min(box_lower, lower);
+    upper = simd::max(box_upper, upper);
+  }
+
+  void extend(const BvhPackBox& box) noexcept { extend(box.lower, box.upper); }
+
+  float surface_area() const noexcept {
+    const BvhPack extent = upper - lower;
+    if (extent[0] < 0.0f || extent[1] < 0.0f || extent[2] < 0.0f) return 0.0f;
+    return 2.0f * (extent[0] * extent[1] + extent[1] * extent[2] + extent[2] * extent[0]);
+  }
+
+  AABBf to_aabb() const noexcept {
+    alignas(16) float min[4];
+    alignas(16) float max[4];
+    lower.store(min);
+    upper.store(max);
+    return AABBf(Vec3f(min[0], min[1], min[2]), Vec3f(max[0], max[1], max[2]));
+  }
+};
+
+// Maps doubled centroids to `size` bins along all axes at once:
+struct BvhBinMapping {
+  BvhPack origin;
+  BvhPack scale;
+  size_t size;
+  // the same lanes, for one axis at a time:
+  alignas(16) float origin_lanes[4];
+  alignas(16) float scale_lanes[4];
+
+  // over the (doubled) centroid bounds, a flat axis puts everything into bin 0:
+  BvhBinMapping(const BvhPackBox& centroids2, size_t size) noexcept : origin(centroids2.lower), size(size) {
+    origin.store(origin_lanes);
+    (centroids2.upper - centroids2.lower).store(scale_lanes);
+    for (float& lane : scale_lanes) lane = lane > 0.0f ? float(size) * 0.99999f / lane : 0.0f;
+    scale = BvhPack::Load(scale_lanes);
+  }
+
+  // bins of the 3 axes in lanes 0..2:
+  void bins(const BvhPrimRef& ref, size_t (&out)[3]) const noexcept {
+    alignas(16) float lanes[4];
+    ((ref.centroid2() - origin) * scale).store(lanes);
+    for (size_t axis = 0; axis < 3; ++axis) out[axis] = clamp(lanes[axis]);
+  }
+
+  // the same rounding as bins():
+  size_t bin(const BvhPrimRef& ref, size_t axis) const noexcept {
+    return clamp((ref.lower[axis] + ref.upper[axis] - origin_lanes[axis]) * scale_lanes[axis]);
+  }
+
+private:
+  // NaN goes to bin 0:
+  size_t clamp(float position) const noexcept {
+    return std::min(size_t(position > 0.0f ? position : 0.0f), size - 1);
+  }
+};
+
+// Bounds and primitive counts of the bins of all 3 axes. Plain floats: only
+// the `size` bins in use are initialized, a node of a few primitives bins
+// into a few bins:
+struct BvhBins {
+  size_t size;
+  alignas(16) float lower[3][kBvhBins][4];
+  alignas(16) float upper[3][kBvhBins][4];
+  uint32_t counts[3][kBvhBins];
+
+  explicit BvhBins(size_t size) noexcept : size(size) {
+    const BvhPackBox empty;
+    for (size_t axis = 0; axis < 3; ++axis) {
+      for (size_t bin = 0; bin < size; ++bin) {
+        empty.lower.store(lower[axis][bin]);
+        empty.upper.store(upper[axis][bin]);
+        counts[axis][bin] = 0;
+      }
+    }
+  }
+
+  BvhPackBox box(size_t axis, size_t bin) const noexcept {
+    return BvhPackBox{ BvhPack::Load(lower[axis][bin]), BvhPack::Load(upper[axis][bin]) };
+  }
+
+  void extend(size_t axis, size_t bin, const BvhPack& box_lower, const BvhPack& box_upper) noexcept {
+    simd::min(box_lower, BvhPack::Load(lower[axis][bin])).store(lower[axis][bin]);
+    simd::max(box_upper, BvhPack::Load(upper[axis][bin])).store(upper[axis][bin]);
+  }
+
+  void add(const BvhPrimRef* refs, size_t begin, size_t end, const BvhBinMapping& mapping) noexcept {
+    for (size_t i = begin; i < end; ++i) {
+      const BvhPack box_lower = BvhPack::Load(refs[i].lower);
+      const BvhPack box_upper = BvhPack::Load(refs[i].upper);
+      size_t bins[3];
+      mapping.bins(refs[i], bins);
+      for (size_t axis = 0; axis < 3; ++axis) {
+        extend(axis, bins[axis], box_lower, box_upper);
+        ++counts[axis][bins[axis]];
+      }
+    }
+  }
+
+  void merge(const BvhBins& oth) noexcept {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      for (size_t bin = 0; bin < size; ++bin) {
+        extend(axis, bin, BvhPack::Load(oth.lower[axis][bin]), BvhPack::Load(oth.upper[axis][bin]));
+        counts[axis][bin] += oth.counts[axis][bin];
+      }
+    }
+  }
+};
+
+// primitives [begin, end) of the reference array, their bounds and the
+// bounds of their doubled centroids:
+struct BvhRange {
+  size_t begin;
+  size_t end;
+  BvhPackBox bounds;
+  BvhPackBox centroids2;
+
+  size_t count() const noexcept { return end - begin; }
+};
+
+// Ranges [begin, end) of the reference array, read as one sequence:
+struct BvhRuns {
+  struct Cursor {
+    size_t run;
+    size_t position;
+  };
+
+  std::vector<size_t> begins;
+  std::vector<size_t> ends;
+  // elements before each run:
+  std::vector<size_t> starts;
+  size_t total = 0;
+
+  void add(size_t begin, size_t end) {
+    if (begin >= end) return;
+    begins.push_back(begin);
+    ends.push_back(end);
+    starts.push_back(total);
+    total += end - begin;
+  }
+
+  // at the k-th element:
+  Cursor at(size_t k) const noexcept {
+    if (k >= total) return Cursor{ begins.size(), 0 };
+    const size_t run = size_t(std::upper_bound(starts.begin(), starts.end(), k) - starts.begin()) - 1;
+    return Cursor{ run, begins[run] + (k - starts[run]) };
+  }
+
+  // the position under the cursor, then moves it to the next element:
+  size_t next(Cursor& cursor) const noexcept {
+    const size_t position = cursor.position++;
+    if (cursor.position == ends[cursor.run] && cursor.run + 1 < begins.size()) {
+      cursor.position = begins[++cursor.run];
+    }
+    return position;
+  }
+};
+
+// A subtree built by one task: nodes[0] is its root, the rest are appended
+// to the final node list in the order the subtrees were found:
+struct BvhSubtree {
+  BvhRange range;
+  size_t depth;
+  // index of the root in the top of the tree:
+  size_t root;
+  Bvh::node_list_type nodes;
+  std::atomic_flag taken;
+
+  BvhSubtree(const BvhRange& range, size_t depth, size_t root) noexcept
+    : range(range), depth(depth), root(root) {}
+};
+
+class BvhBuilder {
+private: // Fields:
+  const BvhBuildSettings& settings;
+  BvhPrimRef* refs;
+  sync::ThreadPool* pool;
+  // the top of the tree, the nodes are allocated by the calling thread:
+  Bvh::node_list_type top;
+  // std::deque keeps the subtrees in place while tasks hold them:
+  std::deque<BvhSubtree> subtrees;
+  sync::WaitGroup subtrees_done;
+
+public: // Member functions:
+  BvhBuilder(const BvhBuildSettings& settings, BvhPrimRef* refs, sync::ThreadPool* pool) noexcept
+    : settings(settings), refs(refs), pool(pool) {}
+
+  // the nodes over `root`, all of its primitives:
+  Bvh::node_list_type build(const BvhRange& root) {
+    top.resize(2);
+    build_top(root);
+    // the calling thread takes the subtrees no worker has started yet:
+    for (auto it = subtrees.rbegin(); it != subtrees.rend(); ++it) run_subtree(*it);
+    if (pool != nullptr) pool->wait(subtrees_done);
+    return assemble();
+  }
+
+private: // Member functions:
+  // ----- ----- ---- Splitting ----- ----- ----
+  // The child ranges of `range`, false if it becomes a leaf. Nodes of the top
+  // of the tree (`chunked`) are processed by chunks:
+  bool split(const BvhRange& range, size_t depth, BvhRange& left, BvhRange& right, bool chunked) {
+    const size_t count = range.count();
+    if (count <= 1) return false;
+
+    // fewer bins for small nodes, where the sweep would cost more than the binning:
+    const BvhBinMapping mapping(range.centroids2, std::min(kBvhBins, 4 + count / 16));
+    const size_t size = mapping.size;
+    size_t axis = 0;
+    size_t split_bin = size;
+    if (depth < kBvhSahDepth) {
+      const BvhBins bins = collect_bins(range, mapping, chunked);
+      float best_cost = std::numeric_limits<float>::infinity();
+      for (size_t a = 0; a < 3; ++a) {
+        // areas and counts right of each border, then a sweep from the left:
+        float right_areas[kBvhBins];
+        uint32_t right_counts[kBvhBins];
+        BvhPackBox box;
+        uint32_t total = 0;
+        for (size_t bin = size - 1; bin > 0; --bin) {
+          box.extend(bins.box(a, bin));
+          total += bins.counts[a][bin];
+          right_areas[bin] = box.surface_area();
+          right_counts[bin] = total;
+        }
+        box = BvhPackBox();
+        total = 0;
+        for (size_t bin = 0; bin + 1 < size; ++bin) {
+          box.extend(bins.box(a, bin));
+          total += bins.counts[a][bin];
+          if (total == 0 || right_counts[bin + 1] == 0) continue;
+          const float cost = box.surface_area() * float(total) + right_areas[bin + 1] * float(right_counts[bin + 1]);
+          if (cost < best_cost) {
+            best_cost = cost;
+            axis = a;
+            split_bin = bin;
+          }
+        }
+      }
+
+      const float area = range.bounds.surface_area();
+      const float leaf_cost = settings.intersection_cost * float(count);
+      const float split_cost = settings.traversal_cost +
+        settings.intersection_cost * (area > 0.0f ? best_cost / area : float(count));
+      if (count <= settings.max_leaf_size && (split_bin == size || leaf_cost <= split_cost)) return false;
+    } else if (count <= settings.max_leaf_size) {
+      return false;
+    }
+
+    left = BvhRange{ range.begin, 0, {}, {} };
+    right = BvhRange{ 0, range.end, {}, {} };
+    if (split_bin != size) {
+      const auto goes_left = [&](const BvhPrimRef& ref) { return mapping.bin(ref, axis) <= split_bin; };
+      left.end = chunked ? partition_chunks(range, left, right, goes_left) : partition(range, left, right, goes_left);
+    } else {
+      // no plane separates the centroids (or too deep): the object median
+      // along the longest centroid axis, half of the range on each side:
+      left.end = range.begin + count / 2;
+      const size_t median_axis = longest_axis(range.centroids2);
+      std::nth_element(refs + range.begin, refs + left.end, refs + range.end,
+        [median_axis](const BvhPrimRef& a, const BvhPrimRef& b) { return median_key(a, median_axis) < median_key(b, median_axis); });
+      collect_bounds(left, chunked);
+    }
+    right.begin = left.end;
+    if (split_bin == size) collect_bounds(right, chunked);
+    return true;
+  }
+
+  // the doubled centroid, NaN (empty boxes) first like in the bins:
+  static float median_key(const BvhPrimRef& ref, size_t axis) noexcept {
+    const float key = ref.lower[axis] + ref.upper[axis];
+    return key == key ? key : -std::numeric_limits<float>::infinity();
+  }
+
+  static size_t longest_axis(const BvhPackBox& box) noexcept {
+    const BvhPack extent = box.upper - box.lower;
+    size_t axis = 0;
+    for (size_t a = 1; a < 3; ++a) {
+      if (extent[a] > extent[axis]) axis = a;
+    }
+    return axis;
+  }
+
+  size_t chunk_count(const BvhRange& range) const noexcept {
+    return (range.count() + kBvhChunkSize - 1) / kBvhChunkSize;
+  }
+
+  // func(chunk, begin, end) for every chunk of `range`, on the pool if there is one:
+  template<typename Func>
+  void for_chunks(const BvhRange& range, Func&& func) {
+    const auto run = [&](size_t first, size_t last) {
+      for (size_t chunk = first; chunk < last; ++chunk) {
+        const size_t begin = range.begin + chunk * kBvhChunkSize;
+        func(chunk, begin, std::min(begin + kBvhChunkSize, range.end));
+      }
+    };
+    if (pool == nullptr) {
+      run(0, chunk_count(range));
+    } else {
+      pool->parallel_for(chunk_count(range), 1, run);
+    }
+  }
+
+  BvhBins collect_bins(const BvhRange& range, const BvhBinMapping& mapping, bool chunked) {
+    BvhBins bins(mapping.size);
+    if (!chunked) {
+      bins.add(refs, range.begin, range.end, mapping);
+      return bins;
+    }
+    sync::Mutex mutex;
+    for_chunks(range, [&](size_t, size_t begin, size_t end) {
+      BvhBins chunk(mapping.size);
+      chunk.add(refs, begin, end, mapping);
+      mutex.lock();
+      bins.merge(chunk);
+      mutex.unlock();
+    });
+    return bins;
+  }
+
+  // bounds of the primitives of `range`:
+  void collect_bounds(BvhRange& range, bool chunked) {
+    if (!chunked) {
+      for (size_t i = range.begin; i < range.end; ++i) extend(range, refs[i]);
+      return;
+    }
+    sync::Mutex mutex;
+    for_chunks(range, [&](size_t, size_t begin, size_t end) {
+      BvhRange chunk{ begin, end, {}, {} };
+      collect_bounds(chunk, false);
+      mutex.lock();
+      range.bounds.extend(chunk.bounds);
+      range.centroids2.extend(chunk.centroids2);
+      mutex.unlock();
+    });
+  }
+
+  static void extend(BvhRange& range, const BvhPrimRef& ref) noexcept {
+    range.bounds.extend(BvhPack::Load(ref.lower), BvhPack::Load(ref.upper));
+    range.centroids2.extend(ref.centroid2());
+  }
+
+  // Hoare partition, `left` gets the primitives satisfying `goes_left`:
+  template<typename Predicate>
+  size_t partition(const BvhRange& range, BvhRange& left, BvhRange& right, Predicate&& goes_left) noexcept {
+    size_t i = range.begin;
+    size_t j = range.end;
+    while (true) {
+      while (i < j && goes_left(refs[i])) extend(left, refs[i++]);
+      while (i < j && !goes_left(refs[j - 1])) extend(right, refs[--j]);
+      if (i == j) return i;
+      std::swap(refs[i], refs[j - 1]);
+    }
+  }
+
+  // Every chunk is partitioned on its own, then the right sides before the
+  // final middle are swapped with the left sides after it. Returns the middle:
+  template<typename Predicate>
+  size_t partition_chunks(const BvhRange& range, BvhRange& left, BvhRange& right, Predicate&& goes_left) {
+    const size_t chunks = chunk_count(range);
+    std::vector<BvhRange> lefts(chunks);
+    std::vector<BvhRange> rights(chunks);
+    for_chunks(range, [&](size_t chunk, size_t begin, size_t end) {
+      lefts[chunk] = BvhRange{ begin, 0, {}, {} };
+      rights[chunk] = BvhRange{ 0, end, {}, {} };
+      lefts[chunk].end = partition(BvhRange{ begin, end, {}, {} }, lefts[chunk], rights[chunk], goes_left);
+      rights[chunk].begin = lefts[chunk].end;
+    });
+
+    size_t middle = range.begin;
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+      left.bounds.extend(lefts[chunk].bounds);
+      left.centroids2.extend(lefts[chunk].centroids2);
+      right.bounds.extend(rights[chunk].bounds);
+      right.centroids2.extend(rights[chunk].centroids2);
+      middle += lefts[chunk].count();
+    }
+
+    // runs of primitives on the wrong side of `middle`, both hold the same number:
+    BvhRuns misplaced_right;
+    BvhRuns misplaced_left;
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+      misplaced_right.add(rights[chunk].begin, std::min(rights[chunk].end, middle));
+      misplaced_left.add(std::max(lefts[chunk].begin, middle), lefts[chunk].end);
+    }
+    const auto swap_runs = [&](size_t first, size_t last) {
+      BvhRuns::Cursor a = misplaced_right.at(first);
+      BvhRuns::Cursor b = misplaced_left.at(first);
+      for (size_t k = first; k < last; ++k) std::swap(refs[misplaced_right.next(a)], refs[misplaced_left.next(b)]);
+    };
+    if (pool == nullptr) {
+      swap_runs(0, misplaced_right.total);
+    } else {
+      pool->parallel_for(misplaced_right.total, kBvhChunkSize, swap_runs);
+    }
+    return middle;
+  }
+
+  // ----- ----- ---- Nodes ----- ----- ----
+  static void make_leaf(BvhNode& node, const BvhRange& range) noexcept {
+    node.bounds = range.bounds.to_aabb();
+    node.offset = uint32_t(range.begin);
+    node.count = uint32_t(range.count());
+  }
+
+  static void make_inner(BvhNode& node, const BvhRange& range, size_t first_child) noexcept {
+    node.bounds = range.bounds.to_aabb();
+    node.offset = uint32_t(first_child);
+    node.count = 0;
+  }
+
+  // depth first into `nodes`, on a single thread:
+  void build_node(Bvh::node_list_type& nodes, size_t index, const BvhRange& range, size_t depth) {
+    BvhRange left;
+    BvhRange right;
+    if (!split(range, depth, left, right, false)) {
+      make_leaf(nodes[index], range);
+      return;
+    }
+    const size_t children = nodes.size();
+    nodes.resize(children + 2);
+    make_inner(nodes[index], range, children);
+    build_node(nodes, children, left, depth + 1);
+    build_node(nodes, children + 1, right, depth + 1);
+  }
+
+  // The nodes above kBvhSubtreeSize primitives, breadth first: the largest
+  // ones are split before the pool is busy with subtrees, which are handed to
+  // it as they are found:
+  void build_top(const BvhRange& root) {
+    struct OpenNode {
+      size_t index;
+      BvhRange range;
+      size_t depth;
+    };
+    std::deque<OpenNode> open{ OpenNode{ 0, root, 0 } };
+    while (!open.empty()) {
+      const OpenNode node = open.front();
+      open.pop_front();
+      if (node.range.count() <= kBvhSubtreeSize) {
+        add_subtree(node.range, node.depth, node.index);
+        continue;
+      }
+      BvhRange left;
+      BvhRange right;
+      if (!split(node.range, node.depth, left, right, true)) {
+        make_leaf(top[node.index], node.range);
+        continue;
+      }
+      const size_t children = top.size();
+      top.resize(children + 2);
+      make_inner(top[node.index], node.range, children);
+      open.push_back(OpenNode{ children, left, node.depth + 1 });
+      open.push_back(OpenNode{ children + 1, right, node.depth + 1 });
+    }
+  }
+
+  void add_subtree(const BvhRange& range, size_t depth, size_t root) {
+    BvhSubtree& subtree = subtrees.emplace_back(range, depth, root);
+    if (pool == nullptr) return;
+    subtrees_done.add(1);
+    pool->submit([this, &subtree] {
+      run_subtree(subtree);
+      subtrees_done.done();
+    });
+  }
+
+  void run_subtree(BvhSubtree& subtree) {
+    if (subtree.taken.test_and_set(std::memory_order_acquire)) return;
+    // a binary tree over n primitives has at most 2n - 1 nodes:
+    subtree.nodes.reserve(2 * subtree.range.count() - 1);
+    subtree.nodes.resize(1);
+    build_node(subtree.nodes, 0, subtree.range, subtree.depth);
+  }
+
+  // Subtree roots replace their placeholders in the top, the other nodes of
+  // subtree `s` go after the top and the subtrees before it:
+  Bvh::node_list_type assemble() {
+    size_t total = top.size();
+    for (const BvhSubtree& subtree : subtrees) total += subtree.nodes.size() - 1;
+
+    Bvh::node_list_type nodes;
+    nodes.reserve(total);
+    nodes.insert(nodes.end(), top.begin(), top.end());
+    for (const BvhSubtree& subtree : subtrees) {
+      // local index k > 0 lands at base + k - 1, sibling pairs stay on even indices:
+      const uint32_t base = uint32_t(nodes.size());
+      const auto rebase = [base](BvhNode node) {
+        if (!node.is_leaf()) node.offset += base - 1;
+        return node;
+      };
+      nodes[subtree.root] = rebase(subtree.nodes[0]);
+      for (size_t k = 1; k < subtree.nodes.size(); ++k) nodes.push_back(rebase(subtree.nodes[k]));
+    }
+    return nodes;
+  }
+};
+
+} // namespace detail
+
+// ----- ----- ---- Static member funcs ---- ----- -----
+template<typename BoundsFunc>
+Bvh Bvh::BuildFrom(sync::ThreadPool* pool, size_t count, const BvhBuildSettings& settings, BoundsFunc&& bounds_of) {
+  const auto start = std::chrono::steady_clock::now();
+  Bvh bvh;
+  if (count == 0) return bvh;
+
+  std::vector<detail::BvhPrimRef> refs(count);
+  detail::BvhRange root{ 0, count, {}, {} };
+  const auto gather = [&](size_t begin, size_t end) {
+    detail::BvhRange chunk{ begin, end, {}, {} };
+    for (size_t i = begin; i < end; ++i) {
+      const AABBf box = bounds_of(i);
+      detail::BvhPrimRef& ref = refs[i];
+      ref = {
+        { box.min().x(), box.min().y(), box.min().z(), std::bit_cast<float>(uint32_t(i)) },
+        { box.max().x(), box.max().y(), box.max().z(), 0.0f }
+      };
+      chunk.bounds.extend(detail::BvhPack::Load(ref.lower), detail::BvhPack::Load(ref.upper));
+      chunk.centroids2.extend(ref.centroid2());
+    }
+    return chunk;
+  };
+  if (pool == nullptr) {
+    root = gather(0, count);
+  } else {
+    sync::Mutex mutex;
+    pool->parallel_for(count, detail::kBvhChunkSize, [&](size_t begin, size_t end) {
+      const detail::BvhRange chunk = gather(begin, end);
+      mutex.lock();
+      root.bounds.extend(chunk.bounds);
+      root.centroids2.extend(chunk.centroids2);
+      mutex.unlock();
+    });
+  }
+
+  detail::BvhBuilder builder(settings, refs.data(), pool);
+  bvh.node_list = builder.build(root);
+  bvh.prim_indices.resize(count);
+  for (size_t i = 0; i < count; ++i) bvh.prim_indices[i] = refs[i].index();
+
+  bvh.build_stats.build_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  bvh.compute_stats(settings);
+  return bvh;
+}
+
+inline Bvh Bvh::Build(std::span<const AABBf> bounds, const BvhBuildSettings& settings) {
+  return BuildFrom(nullptr, bounds.size(), settings, [&](size_t i) { return bounds[i]; });
+}
+
+inline Bvh Bvh::Build(std::span<const Trianglef> triangles, const BvhBuildSettings& settings) {
+  return BuildFrom(nullptr, triangles.size(), settings, [&](size_t i) { return triangles[i].bounds(); });
+}
+
+inline Bvh Bvh::Build(sync::ThreadPool& pool, std::span<const AABBf> bounds, const BvhBuildSettings& settings) {
+  return BuildFrom(&pool, bounds.size(), settings, [&](size_t i) { return bounds[i]; });
+}
+
+inline Bvh Bvh::Build(sync::ThreadPool& pool, std::span<const Trianglef> triangles, const BvhBuildSettings& settings) {
+  return BuildFrom(&pool, triangles.size(), settings, [&](size_t i) { return triangles[i].bounds(); });
+}
+
+} // namespace ayan::math
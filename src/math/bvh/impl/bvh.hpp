@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+
+#include "../bvh.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- Element access ---- ----- -----
+inline std::span<const BvhNode> Bvh::nodes() const noexcept { return node_list; }
+
+inline std::span<const uint32_t> Bvh::indices() const noexcept { return prim_indices; }
+
+inline const BvhBuildStats& Bvh::stats() const noexcept { return build_stats; }
+
+// ----- ----- ---- Properties ----- ----- ----
+inline bool Bvh::is_empty() const noexcept { return node_list.empty(); }
+
+inline AABBf Bvh::bounds() const noexcept {
+  return node_list.empty() ? AABBf() : node_list[0].bounds;
+}
+
+inline float Bvh::sah_cost(float traversal_cost, float intersection_cost) const noexcept {
+  if (node_list.empty()) return 0.0f;
+  const float root_area = node_list[0].bounds.surface_area();
+  if (!(root_area > 0.0f)) return node_list[0].is_leaf() ? intersection_cost * float(node_list[0].count) : traversal_cost;
+
+  double cost = 0.0;
+  uint32_t stack[kBvhMaxDepth + 1];
+  size_t size = 0;
+  stack[size++] = 0;
+  while (size > 0) {
+    const BvhNode& node = node_list[stack[--size]];
+    const double probability = double(node.bounds.surface_area()) / root_area;
+    if (node.is_leaf()) {
+      cost += probability * intersection_cost * node.count;
+    } else {
+      cost += probability * traversal_cost;
+      stack[size++] = node.offset;
+      stack[size++] = node.offset + 1;
+    }
+  }
+  return float(cost);
+}
+
+// ----- ----- ---- Intersection ----- ----- ----
+inline bool Bvh::intersect(std::span<const Trianglef> triangles, const Rayf& ray, BvhHit& hit) const noexcept {
+  if (node_list.empty()) return false;
+  float t_entry;
+  if (!node_list[0].bounds.intersect(ray, t_entry)) return false;
+
+  // far children with their entry distance, skipped once something closer is hit:
+  struct Deferred {
+    uint32_t node;
+    float t_entry;
+  };
+  Deferred stack[kBvhMaxDepth];
+  size_t size = 0;
+  Rayf closest = ray;
+  bool found = false;
+  uint32_t index = 0;
+  while (true) {
+    const BvhNode& node = node_list[index];
+    if (node.is_leaf()) {
+      for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+        TriangleHit<float> triangle_hit;
+        if (!triangles[prim_indices[i]].intersect(closest, triangle_hit)) continue;
+        closest.set_t_max(triangle_hit.t);
+        hit = BvhHit{ triangle_hit.t, triangle_hit.u, triangle_hit.v, prim_indices[i] };
+        found = true;
+      }
+    } else {
+      float t_first;
+      float t_second;
+      const bool first = node_list[node.offset].bounds.intersect(closest, t_first);
+      const bool second = node_list[node.offset + 1].bounds.intersect(closest, t_second);
+      if (first && second) {
+        const bool swap = t_second < t_first;
+        stack[size++] = Deferred{ swap ? node.offset : node.offset + 1, swap ? t_first : t_second };
+        index = swap ? node.offset + 1 : node.offset;
+        continue;
+      }
+      if (first || second) {
+        index = first ? node.offset : node.offset + 1;
+        continue;
+      }
+    }
+
+    do {
+      if (size == 0) return found;
+      --size;
+    } while (stack[size].t_entry > closest.t_max());
+    index = stack[size].node;
+  }
+}
+
+// ----- ----- ---- Private member funcs ----- ----- ----
+inline void Bvh::compute_stats(const BvhBuildSettings& settings) noexcept {
+  build_stats.sah_cost = sah_cost(settings.traversal_cost, settings.intersection_cost);
+  build_stats.inner_count = 0;
+  build_stats.leaf_count = 0;
+  build_stats.max_depth = 0;
+
+  std::pair<uint32_t, size_t> stack[kBvhMaxDepth + 1];
+  size_t size = 0;
+  stack[size++] = { 0, 0 };
+  while (size > 0) {
+    const auto [index, depth] = stack[--size];
+    const BvhNode& node = node_list[index];
+    build_stats.max_depth = std::max(build_stats.max_depth, depth);
+    if (node.is_leaf()) {
+      ++build_stats.leaf_count;
+    } else {
+      ++build_stats.inner_count;
+      stack[size++] = { node.offset, depth + 1 };
+      stack[size++] = { node.offset + 1, depth + 1 };
+    }
+  }
+}
+
+} // namespace ayan::math
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "../instance_bvh.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- MeshBvh ----- ----- ----
+inline MeshBvh MeshBvh::Build(std::vector<Trianglef> triangles, const BvhBuildSettings& settings) {
+  MeshBvh mesh;
+  mesh.triangle_list = std::move(triangles);
+  mesh.tree = Bvh8::Build(mesh.triangle_list, settings);
+  return mesh;
+}
+
+inline MeshBvh MeshBvh::Build(sync::ThreadPool& pool, std::vector<Trianglef> triangles, const BvhBuildSettings& settings) {
+  MeshBvh mesh;
+  mesh.triangle_list = std::move(triangles);
+  mesh.tree = Bvh8::Build(pool, mesh.triangle_list, settings);
+  return mesh;
+}
+
+inline std::span<const Trianglef> MeshBvh::triangles() const noexcept { return triangle_list; }
+
+inline const Bvh8& MeshBvh::bvh() const noexcept { return tree; }
+
+inline AABBf MeshBvh::bounds() const noexcept { return tree.bounds(); }
+
+inline bool MeshBvh::intersect(const Rayf& ray, BvhHit& hit) const noexcept {
+  return tree.intersect(triangle_list, ray, hit);
+}
+
+// ----- ----- ---- InstanceBvh ----- ----- ----
+inline InstanceBvh InstanceBvh::Build(std::span<const MeshBvh> meshes, std::vector<BvhInstance> instances,
+  const BvhBuildSettings& settings) {
+  for (const BvhInstance& instance : instances) {
+    if (instance.mesh >= meshes.size()) throw std::invalid_argument("[InstanceBvh]: an instance refers to a mesh out of range");
+    CheckTransform(instance.transform);
+  }
+
+  InstanceBvh scene;
+  scene.mesh_list = meshes;
+  scene.instance_list = std::move(instances);
+  scene.build_settings = settings;
+  scene.instance_boxes.resize(scene.instance_list.size());
+  for (size_t i = 0; i < scene.instance_list.size(); ++i) scene.update_bounds(i);
+  scene.rebuild();
+  return scene;
+}
+
+inline std::span<const MeshBvh> InstanceBvh::meshes() const noexcept { return mesh_list; }
+
+inline std::span<const BvhInstance> InstanceBvh::instances() const noexcept { return instance_list; }
+
+inline std::span<const AABBf> InstanceBvh::instance_bounds() const noexcept { return instance_boxes; }
+
+inline const Bvh8& InstanceBvh::bvh() const noexcept { return tree; }
+
+inline bool InstanceBvh::is_empty() const noexcept { return tree.is_empty(); }
+
+inline AABBf InstanceBvh::bounds() const noexcept { return tree.bounds(); }
+
+inline void InstanceBvh::set_transform(size_t index, const Transformf& transform) {
+  check_index(index);
+  CheckTransform(transform);
+  instance_list[index].transform = transform;
+  update_bounds(index);
+  rebuild();
+}
+
+inline void InstanceBvh::set_transforms(std::span<const uint32_t> indices, std::span<const Transformf> transforms) {
+  if (indices.size() != transforms.size()) throw std::invalid_argument("[InstanceBvh]: one transform per index is expected");
+  for (size_t i = 0; i < indices.size(); ++i) {
+    check_index(indices[i]);
+    CheckTransform(transforms[i]);
+  }
+
+  for (size_t i = 0; i < indices.size(); ++i) {
+    instance_list[indices[i]].transform = transforms[i];
+    update_bounds(indices[i]);
+  }
+  rebuild();
+}
+
+inline bool InstanceBvh::intersect(const Rayf& ray, InstanceHit& hit) const noexcept {
+  Rayf closest = ray;
+  bool found = false;
+  tree.traverse(closest, [&](uint32_t first, uint32_t count, Rayf& current) {
+    for (uint32_t i = first; i < first + count; ++i) {
+      const uint32_t index = tree.indices()[i];
+      const BvhInstance& instance = instance_list[index];
+      // the same interval, affine maps keep t:
+      const Rayf local(instance.transform.inverse_point(current.origin()),
+        instance.transform.inverse_vector(current.direction()), current.t_min(), current.t_max());
+      BvhHit mesh_hit;
+      if (!mesh_list[instance.mesh].intersect(local, mesh_hit)) continue;
+      current.set_t_max(mesh_hit.t);
+      hit = InstanceHit{ mesh_hit.t, mesh_hit.u, mesh_hit.v, mesh_hit.primitive, index };
+      found = true;
+    }
+  });
+  return found;
+}
+
+// ----- ----- ---- Private member funcs ----- ----- ----
+inline void InstanceBvh::CheckTransform(const Transformf& transform) {
+  if (!transform.matrix().is_affine()) throw std::invalid_argument("[InstanceBvh]: an instance transform must be affine");
+}
+
+inline void InstanceBvh::check_index(size_t index) const {
+  if (index >= instance_list.size()) throw std::invalid_argument("[InstanceBvh]: instance index out of range");
+}
+
+// The 8 transformed corners of the mesh box, widened for the rounding of the
+// transform. Coordinate `a` of m * p + t is a sum of 4 terms, its error is a few
+// ulps of sum_j |m(a, j) * p(j)| + |t(a)| (not of the result, the terms may cancel),
+// bounded over the corners with the largest |p(j)|:
+inline void InstanceBvh::update_bounds(size_t index) {
+  const BvhInstance& instance = instance_list[index];
+  const AABBf local = mesh_list[instance.mesh].bounds();
+  AABBf world;
+  if (!local.is_empty()) {
+    for (size_t corner = 0; corner < 8; ++corner) {
+      const Vec3f point(local.corner(corner & 1).x(), local.corner((corner >> 1) & 1).y(), local.corner(corner >> 2).z());
+      world.extend(instance.transform.transform_point(point));
+    }
+    const Mat4f& m = instance.transform.matrix();
+    Vec3f min = world.min();
+    Vec3f max = world.max();
+    for (size_t a = 0; a < 3; ++a) {
+      float magnitude = std::abs(m(a, 3));
+      for (size_t j = 0; j < 3; ++j) {
+        magnitude += std::abs(m(a, j)) * std::max(std::abs(local.min()[j]), std::abs(local.max()[j]));
+      }
+      const float pad = magnitude * 0x1p-20f;
+      min[a] -= pad;
+      max[a] += pad;
+    }
+    world = AABBf(min, max);
+  }
+  instance_boxes[index] = world;
+}
+
+inline void InstanceBvh::rebuild() { tree = Bvh8::Build(instance_boxes, build_settings); }
+
+} // namespace ayan::math
@@ -0,0 +1,283 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "../wide_bvh.hpp"
+#include "../../detail/uint_lanes.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+// grid step of an axis, the smallest float with lo + 255 * step >= hi:
+inline float wide_bvh_scale(float lo, float hi) noexcept {
+  float scale = (hi - lo) / 255.0f;
+  while (lo + 255.0f * scale < hi) scale = std::nextafter(scale, std::numeric_limits<float>::infinity());
+  return scale;
+}
+
+// lower and upper grid lines of [lo, hi] within [origin, origin + 255 * scale],
+// checked with the decoding of the traversal:
+inline void wide_bvh_quantize(float origin, float scale, float lo, float hi, uint8_t& lower, uint8_t& upper) noexcept {
+  // NaN (0 / 0, inf / inf) goes to 0 and the checks below:
+  auto grid = [&](float value) {
+    const float x = (value - origin) / scale;
+    return x > 0.0f ? (x < 255.0f ? x : 255.0f) : 0.0f;
+  };
+  auto decode = [&](int q) { return origin + float(q) * scale; };
+  int q_lo = int(std::floor(grid(lo)));
+  int q_hi = int(std::ceil(grid(hi)));
+  while (q_lo > 0 && decode(q_lo) > lo) --q_lo;
+  while (q_hi < 255 && decode(q_hi) < hi) ++q_hi;
+  lower = uint8_t(q_lo);
+  upper = uint8_t(q_hi);
+}
+
+} // namespace ayan::math::detail
+
+// ----- ----- ---- WideBvhNode ----- ----- ----
+template<size_t Width>
+AABBx<Width, float> WideBvhNode<Width>::child_bounds() const noexcept {
+  using pack_type = simd::Pack<float, Width>;
+  // unfused like the scalar decode, the lanes are the same floats:
+  auto axis = [&](const uint8_t* bytes, size_t a) {
+    return pack_type(origin[a]) + detail::bytes_to_float<Width>(bytes) * pack_type(scale[a]);
+  };
+  return AABBx<Width, float>(Vec3x<Width, float>(axis(lower[0], 0), axis(lower[1], 1), axis(lower[2], 2)),
+    Vec3x<Width, float>(axis(upper[0], 0), axis(upper[1], 1), axis(upper[2], 2)));
+}
+
+template<size_t Width>
+AABBf WideBvhNode<Width>::child_bounds(size_t index) const noexcept {
+  Vec3f min;
+  Vec3f max;
+  for (size_t a = 0; a < 3; ++a) {
+    min[a] = origin[a] + float(lower[a][index]) * scale[a];
+    max[a] = origin[a] + float(upper[a][index]) * scale[a];
+  }
+  return AABBf(min, max);
+}
+
+// ----- ----- ---- Static member funcs ---- ----- -----
+template<size_t Width>
+WideBvh<Width> WideBvh<Width>::Build(std::span<const AABBf> bounds, const BvhBuildSettings& settings) {
+  CheckPrimitiveCount(bounds.size());
+  BvhBuildSettings binary = settings;
+  binary.max_leaf_size = std::min(settings.max_leaf_size, kWideBvhMaxLeafSize);
+  return Collapse(Bvh::Build(bounds, binary), settings);
+}
+
+template<size_t Width>
+WideBvh<Width> WideBvh<Width>::Build(std::span<const Trianglef> triangles, const BvhBuildSettings& settings) {
+  CheckPrimitiveCount(triangles.size());
+  BvhBuildSettings binary = settings;
+  binary.max_leaf_size = std::min(settings.max_leaf_size, kWideBvhMaxLeafSize);
+  return Collapse(Bvh::Build(triangles, binary), settings);
+}
+
+template<size_t Width>
+WideBvh<Width> WideBvh<Width>::Build(sync::ThreadPool& pool, std::span<const AABBf> bounds, const BvhBuildSettings& settings) {
+  CheckPrimitiveCount(bounds.size());
+  BvhBuildSettings binary = settings;
+  binary.max_leaf_size = std::min(settings.max_leaf_size, kWideBvhMaxLeafSize);
+  return Collapse(Bvh::Build(pool, bounds, binary), settings);
+}
+
+template<size_t Width>
+WideBvh<Width> WideBvh<Width>::Build(sync::ThreadPool& pool, std::span<const Trianglef> triangles, const BvhBuildSettings& settings) {
+  CheckPrimitiveCount(triangles.size());
+  BvhBuildSettings binary = settings;
+  binary.max_leaf_size = std::min(settings.max_leaf_size, kWideBvhMaxLeafSize);
+  return Collapse(Bvh::Build(pool, triangles, binary), settings);
+}
+
+template<size_t Width>
+WideBvh<Width> WideBvh<Width>::Collapse(const Bvh& bvh, const BvhBuildSettings& settings) {
+  const auto start = std::chrono::steady_clock::now();
+  WideBvh result;
+  if (bvh.is_empty()) return result;
+  CheckPrimitiveCount(bvh.indices().size());
+  result.prim_indices.assign(bvh.indices().begin(), bvh.indices().end());
+  result.root_bounds = bvh.bounds();
+  // no more nodes than binary inner nodes:
+  result.node_list.reserve(bvh.stats().inner_count + 1);
+
+  double cost = 0.0;
+  result.collapse(bvh, 0, 0, settings, cost);
+  const float root_area = result.root_bounds.surface_area();
+  result.build_stats.sah_cost = root_area > 0.0f ? float(cost / root_area) : float(cost);
+  result.build_stats.inner_count = result.node_list.size();
+  result.build_stats.build_seconds = bvh.stats().build_seconds
+    + std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return result;
+}
+
+// ----- ----- ---- Element access ---- ----- -----
+template<size_t Width>
+std::span<const WideBvhNode<Width>> WideBvh<Width>::nodes() const noexcept { return node_list; }
+
+template<size_t Width>
+std::span<const uint32_t> WideBvh<Width>::indices() const noexcept { return prim_indices; }
+
+template<size_t Width>
+const BvhBuildStats& WideBvh<Width>::stats() const noexcept { return build_stats; }
+
+// ----- ----- ---- Properties ----- ----- ----
+template<size_t Width>
+bool WideBvh<Width>::is_empty() const noexcept { return node_list.empty(); }
+
+template<size_t Width>
+AABBf WideBvh<Width>::bounds() const noexcept { return root_bounds; }
+
+// ----- ----- ---- Intersection ----- ----- ----
+template<size_t Width>
+template<typename LeafFunc>
+void WideBvh<Width>::traverse(Rayf& ray, LeafFunc&& leaf) const {
+  if (node_list.empty()) return;
+
+  // hit children not visited yet with their entry distance, a node defers at
+  // most Width - 1 of them and no path is deeper than the binary tree's:
+  struct Deferred {
+    uint32_t child;
+    float t_entry;
+  };
+  Deferred stack[(Width - 1) * kBvhMaxDepth];
+  size_t size = 0;
+  uint32_t child = 0;
+  while (true) {
+    if (node_type::is_leaf(child)) {
+      const uint32_t count = node_type::leaf_count(child);
+      if (count != 0) leaf(node_type::leaf_first(child), count, ray);
+    } else {
+      const node_type& node = node_list[child];
+      simd::Pack<float, Width> t_entry;
+      uint32_t bits = node.child_bounds().intersect(ray, t_entry).bits();
+      if (bits != 0) {
+        alignas(sizeof(float) * Width) float t[Width];
+        t_entry.store(t);
+        // insertion sort of the few hits, nearest first:
+        Deferred hits[Width];
+        size_t count = 0;
+        for (; bits != 0; bits &= bits - 1) {
+          const size_t lane = size_t(std::countr_zero(bits));
+          const Deferred hit{ node.children[lane], t[lane] };
+          size_t i = count++;
+          for (; i > 0 && hits[i - 1].t_entry > hit.t_entry; --i) hits[i] = hits[i - 1];
+          hits[i] = hit;
+        }
+        for (size_t i = count - 1; i > 0; --i) stack[size++] = hits[i];
+        child = hits[0].child;
+        continue;
+      }
+    }
+
+    do {
+      if (size == 0) return;
+      --size;
+    } while (stack[size].t_entry > ray.t_max());
+    child = stack[size].child;
+  }
+}
+
+template<size_t Width>
+bool WideBvh<Width>::intersect(std::span<const Trianglef> triangles, const Rayf& ray, BvhHit& hit) const noexcept {
+  Rayf closest = ray;
+  bool found = false;
+  traverse(closest, [&](uint32_t first, uint32_t count, Rayf& current) {
+    for (uint32_t i = first; i < first + count; ++i) {
+      TriangleHit<float> triangle_hit;
+      if (!triangles[prim_indices[i]].intersect(current, triangle_hit)) continue;
+      current.set_t_max(triangle_hit.t);
+      hit = BvhHit{ triangle_hit.t, triangle_hit.u, triangle_hit.v, prim_indices[i] };
+      found = true;
+    }
+  });
+  return found;
+}
+
+// ----- ----- ---- Private member funcs ----- ----- ----
+template<size_t Width>
+void WideBvh<Width>::CheckPrimitiveCount(size_t count) {
+  if (count >= kWideBvhMaxPrimitives) {
+    throw std::invalid_argument("[WideBvh]: a wide BVH holds fewer than kWideBvhMaxPrimitives primitives");
+  }
+}
+
+template<size_t Width>
+uint32_t WideBvh<Width>::collapse(const Bvh& bvh, uint32_t index, size_t depth, const BvhBuildSettings& settings, double& cost) {
+  const std::span<const BvhNode> binary = bvh.nodes();
+  const uint32_t wide = uint32_t(node_list.size());
+  node_list.emplace_back();
+  cost += double(binary[index].bounds.surface_area()) * settings.traversal_cost;
+
+  // binary nodes becoming the children, a root leaf is the only child:
+  uint32_t slots[Width];
+  size_t count = 0;
+  if (binary[index].is_leaf()) {
+    slots[count++] = index;
+  } else {
+    slots[count++] = binary[index].offset;
+    slots[count++] = binary[index].offset + 1;
+  }
+  while (count < Width) {
+    size_t widest = Width;
+    float widest_area = -1.0f;
+    for (size_t i = 0; i < count; ++i) {
+      const BvhNode& node = binary[slots[i]];
+      if (node.is_leaf() || node.bounds.is_empty() || !(node.bounds.surface_area() > widest_area)) continue;
+      widest = i;
+      widest_area = node.bounds.surface_area();
+    }
+    if (widest == Width) break;
+    const uint32_t first = binary[slots[widest]].offset;
+    slots[widest] = first;
+    slots[count++] = first + 1;
+  }
+
+  // quantized boxes, empty ones are dropped:
+  node_type& node = node_list[wide];
+  const AABBf& box = binary[index].bounds;
+  for (size_t a = 0; a < 3; ++a) {
+    node.origin[a] = box.min()[a];
+    node.scale[a] = detail::wide_bvh_scale(box.min()[a], box.max()[a]);
+  }
+  for (size_t i = 0; i < Width; ++i) {
+    const bool used = i < count && !binary[slots[i]].bounds.is_empty();
+    for (size_t a = 0; a < 3; ++a) {
+      node.lower[a][i] = 255;
+      node.upper[a][i] = 0;
+      if (!used) continue;
+      const AABBf& child = binary[slots[i]].bounds;
+      detail::wide_bvh_quantize(node.origin[a], node.scale[a], child.min()[a], child.max()[a],
+        node.lower[a][i], node.upper[a][i]);
+    }
+    node.children[i] = node_type::Empty();
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    const BvhNode& child = binary[slots[i]];
+    if (child.bounds.is_empty()) continue;
+    uint32_t word;
+    if (child.is_leaf()) {
+      if (child.count > kWideBvhMaxLeafSize) {
+        throw std::invalid_argument("[WideBvh]: a leaf of the binary BVH has more than kWideBvhMaxLeafSize primitives");
+      }
+      word = node_type::Leaf(child.offset, child.count);
+      cost += double(child.bounds.surface_area()) * settings.intersection_cost * child.count;
+      ++build_stats.leaf_count;
+      build_stats.max_depth = std::max(build_stats.max_depth, depth + 1);
+    } else {
+      word = collapse(bvh, slots[i], depth + 1, settings, cost);
+    }
+    // `node` may have moved:
+    node_list[wide].children[i] = word;
+  }
+  return wide;
+}
+
+} // namespace ayan::math
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <ayan/math/vec.hpp>
+#include <ayan/math/geometry.hpp>
+#include <ayan/math/transform.hpp>
+#include <ayan/sync.hpp>
+
+#include "bvh.hpp"
+#include "wide_bvh.hpp"
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//             TWO-LEVEL BVH (INSTANCING)               |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// A MeshBvh (bottom level) is a mesh and its tree, built once. An InstanceBvh
+// (top level) places meshes in the world by Transforms, each with its inverse
+// computed once, and has a tree over the world boxes of the instances only.
+// A ray reaching an instance is taken into object space by the inverse and
+// traced through the tree of the mesh, so a mesh placed a thousand times is
+// stored once. Moving instances rebuilds just the top tree.
+// Transforms must be affine: a ray has the same t in both spaces (the direction
+// is transformed but not normalized).
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+class MeshBvh {
+private: // Fields:
+  std::vector<Trianglef> triangle_list;
+  Bvh8 tree;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  // without triangles, nothing is hit:
+  MeshBvh() noexcept = default;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  static MeshBvh Build(std::vector<Trianglef> triangles, const BvhBuildSettings& settings = {});
+  static MeshBvh Build(sync::ThreadPool& pool, std::vector<Trianglef> triangles, const BvhBuildSettings& settings = {});
+
+  // ----- ----- ---- Element access ---- ----- -----
+  std::span<const Trianglef> triangles() const noexcept;
+  const Bvh8& bvh() const noexcept;
+
+  // ----- ----- ---- Properties ----- ----- ----
+  // in object space:
+  AABBf bounds() const noexcept;
+
+  // ----- ----- ---- Intersection ----- ----- ----
+  // closest hit of an object space ray, `primitive` indexes triangles():
+  bool intersect(const Rayf& ray, BvhHit& hit) const noexcept;
+};
+
+// mesh `mesh` of the InstanceBvh placed by `transform` (object -> world):
+struct BvhInstance {
+  uint32_t mesh;
+  Transformf transform;
+};
+
+// the closest hit, `primitive` indexes the triangles of the mesh of `instance`:
+struct InstanceHit {
+  float t;
+  float u;
+  float v;
+  uint32_t primitive;
+  uint32_t instance;
+};
+
+class InstanceBvh {
+private: // Fields:
+  // not owned, outlive the InstanceBvh:
+  std::span<const MeshBvh> mesh_list;
+  std::vector<BvhInstance> instance_list;
+  // world bounds of instance `i`:
+  std::vector<AABBf> instance_boxes;
+  Bvh8 tree;
+  BvhBuildSettings build_settings;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  // without instances, nothing is hit:
+  InstanceBvh() noexcept = default;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // `meshes` are shared by the instances and must outlive the result, the
+  // settings are kept for the rebuilds of the top tree. std::invalid_argument
+  // is thrown for an instance of a mesh out of range or with a projective transform:
+  static InstanceBvh Build(std::span<const MeshBvh> meshes, std::vector<BvhInstance> instances,
+    const BvhBuildSettings& settings = {});
+
+  // ----- ----- ---- Element access ---- ----- -----
+  std::span<const MeshBvh> meshes() const noexcept;
+  std::span<const BvhInstance> instances() const noexcept;
+  std::span<const AABBf> instance_bounds() const noexcept;
+  // over instance_bounds():
+  const Bvh8& bvh() const noexcept;
+
+  // ----- ----- ---- Properties ----- ----- ----
+  bool is_empty() const noexcept;
+  AABBf bounds() const noexcept;
+
+  // ----- ----- ---- Modifiers ----- ----- ----
+  // Moves instance `index` and rebuilds the top tree, no mesh tree is touched.
+  // An index out of range or a projective transform throws std::invalid_argument
+  // and leaves the InstanceBvh as it was:
+  void set_transform(size_t index, const Transformf& transform);
+  // Moves instance indices[i] by transforms[i], one rebuild for all of them. Throws
+  // as set_transform() (nothing is moved then) and for spans of different sizes:
+  void set_transforms(std::span<const uint32_t> indices, std::span<const Transformf> transforms);
+
+  // ----- ----- ---- Intersection ----- ----- ----
+  // Closest hit within [ray.t_min(), ray.t_max()] of a world space ray,
+  // `hit` is written only if something is hit:
+  bool intersect(const Rayf& ray, InstanceHit& hit) const noexcept;
+
+private: // Member functions:
+  static void CheckTransform(const Transformf& transform);
+  void check_index(size_t index) const;
+  // world box of instance `index` from its mesh box and transform:
+  void update_bounds(size_t index);
+  void rebuild();
+};
+
+} // namespace ayan::math
+
+#include "impl/instance_bvh.hpp"
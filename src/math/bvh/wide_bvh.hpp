@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <ayan/math/vec.hpp>
+#include <ayan/math/geometry.hpp>
+#include <ayan/sync.hpp>
+
+#include "bvh.hpp"
+#include "../detail/aligned_allocator.hpp"
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//         WIDE BVH (4 / 8 CHILDREN, QUANTIZED)         |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// A binary SAH Bvh collapsed into nodes of up to `Width` children: starting
+// from the two children of a node, the inner child of the largest surface area
+// is replaced by its own two until `Width` are collected.
+// Child boxes are stored SoA as bytes on a grid over the node box (Ylitie et
+// al., "Efficient incoherent ray traversal on GPUs through compressed wide
+// BVHs", 2017), lower corners rounded down and upper ones up, so a decoded box
+// always contains the exact one. A node of BVH4 is one 64-byte line, BVH8 two.
+// Traversal decodes all child boxes at once into an AABBx, tests them with one
+// slab test and visits the hit ones nearest first.
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// a leaf child: the bit, its primitive count and first primitive:
+inline constexpr uint32_t kWideBvhLeafBit = uint32_t(1) << 31;
+inline constexpr size_t kWideBvhMaxLeafSize = 15;
+// primitives addressable by a leaf child:
+inline constexpr size_t kWideBvhMaxPrimitives = size_t(1) << 27;
+
+template<size_t Width>
+struct alignas(64) WideBvhNode {
+  static_assert(Width == 4 || Width == 8, "a wide BVH node has 4 or 8 children");
+
+  // the node box is [origin, origin + 255 * scale], child `i` spans
+  // [origin + lower[i] * scale, origin + upper[i] * scale] on each axis:
+  float origin[3];
+  float scale[3];
+  uint8_t lower[3][Width];
+  uint8_t upper[3][Width];
+  // index of an inner node, a Leaf() or Empty():
+  uint32_t children[Width];
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // `count` (1 to kWideBvhMaxLeafSize) primitives from WideBvh::indices()[first]:
+  static constexpr uint32_t Leaf(uint32_t first, uint32_t count) noexcept { return kWideBvhLeafBit | count << 27 | first; }
+  // an unused slot, a leaf without primitives:
+  static constexpr uint32_t Empty() noexcept { return kWideBvhLeafBit; }
+
+  static constexpr bool is_leaf(uint32_t child) noexcept { return (child & kWideBvhLeafBit) != 0; }
+  static constexpr uint32_t leaf_first(uint32_t child) noexcept { return child & (uint32_t(kWideBvhMaxPrimitives) - 1); }
+  static constexpr uint32_t leaf_count(uint32_t child) noexcept { return (child >> 27) & 0xFu; }
+
+  // ----- ----- ---- Decoding ----- ----- ----
+  // all child boxes, empty slots decode to boxes with min > max:
+  AABBx<Width, float> child_bounds() const noexcept;
+  // the same for one child, bitwise equal to its lane:
+  AABBf child_bounds(size_t index) const noexcept;
+};
+
+template<size_t Width>
+class WideBvh {
+public: // Types:
+  using node_type = WideBvhNode<Width>;
+  using node_list_type = std::vector<node_type, detail::AlignedAllocator<node_type>>;
+
+private: // Fields:
+  // [0] is the root:
+  node_list_type node_list;
+  // primitives in leaf order:
+  std::vector<uint32_t> prim_indices;
+  AABBf root_bounds;
+  BvhBuildStats build_stats;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  // without nodes, nothing is hit:
+  WideBvh() noexcept = default;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // A binary Bvh::Build with leaves of at most kWideBvhMaxLeafSize, collapsed.
+  // Throws std::invalid_argument for kWideBvhMaxPrimitives or more primitives:
+  static WideBvh Build(std::span<const AABBf> bounds, const BvhBuildSettings& settings = {});
+  static WideBvh Build(std::span<const Trianglef> triangles, const BvhBuildSettings& settings = {});
+  static WideBvh Build(sync::ThreadPool& pool, std::span<const AABBf> bounds, const BvhBuildSettings& settings = {});
+  static WideBvh Build(sync::ThreadPool& pool, std::span<const Trianglef> triangles, const BvhBuildSettings& settings = {});
+
+  // `bvh` with leaves of at most kWideBvhMaxLeafSize over fewer than
+  // kWideBvhMaxPrimitives primitives, the stats use the costs of `settings`.
+  // Subtrees of empty (or NaN) boxes can't be hit and are dropped. Throws
+  // std::invalid_argument if a leaf or the primitive count doesn't fit a child word:
+  static WideBvh Collapse(const Bvh& bvh, const BvhBuildSettings& settings = {});
+
+  // ----- ----- ---- Element access ---- ----- -----
+  std::span<const node_type> nodes() const noexcept;
+  std::span<const uint32_t> indices() const noexcept;
+  // build_seconds includes the binary build, sah_cost is the one of the wide tree:
+  const BvhBuildStats& stats() const noexcept;
+
+  // ----- ----- ---- Properties ----- ----- ----
+  bool is_empty() const noexcept;
+  // exact bounds of all primitives, empty box without nodes:
+  AABBf bounds() const noexcept;
+
+  // ----- ----- ---- Intersection ----- ----- ----
+  // Visits the leaves whose box `ray` enters within [t_min, t_max], nearest
+  // box first. `leaf(first, count, ray)` tests indices()[first, first + count)
+  // and may shrink ray.t_max(), boxes entered beyond it are then skipped:
+  template<typename LeafFunc>
+  void traverse(Rayf& ray, LeafFunc&& leaf) const;
+
+  // Closest hit within [ray.t_min(), ray.t_max()] among `triangles`, the span
+  // the tree was built over, `hit` is written only if something is hit:
+  bool intersect(std::span<const Trianglef> triangles, const Rayf& ray, BvhHit& hit) const noexcept;
+
+private: // Member functions:
+  static void CheckPrimitiveCount(size_t count);
+
+  // a node for the subtree of binary node `index`, returns its index:
+  uint32_t collapse(const Bvh& bvh, uint32_t index, size_t depth, const BvhBuildSettings& settings, double& cost);
+};
+
+static_assert(sizeof(WideBvhNode<4>) == 64 && sizeof(WideBvhNode<8>) == 128);
+
+using Bvh4 = WideBvh<4>;
+using Bvh8 = WideBvh<8>;
+
+} // namespace ayan::math
+
+#include "impl/wide_bvh.hpp"
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+
+#include "../vec/vec3.hpp"
+#include "../vec/vec4.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// Linear RGB (Rec.709 primaries) radiance or reflectance, unbounded.
+// Laid out as Vec3<NumT>, so framebuffers convert to and from Vec3 arrays:
+template<typename NumT = float> requires (std::floating_point<NumT>)
+class RGB {
+private: // Fields:
+  Vec3<NumT> channels;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  constexpr RGB() noexcept; // black
+  constexpr RGB(NumT r, NumT g, NumT b) noexcept;
+  constexpr explicit RGB(const Vec3<NumT>& channels) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  static constexpr RGB Black() noexcept;
+  static constexpr RGB White() noexcept;
+  static constexpr RGB Gray(NumT value) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  constexpr NumT& r() noexcept;
+  constexpr NumT& g() noexcept;
+  constexpr NumT& b() noexcept;
+  constexpr const NumT& r() const noexcept;
+  constexpr const NumT& g() const noexcept;
+  constexpr const NumT& b() const noexcept;
+  constexpr NumT& operator[](size_t index) noexcept;
+  constexpr const NumT& operator[](size_t index) const noexcept;
+
+  constexpr const Vec3<NumT>& vec() const noexcept;
+
+  // ----- ----- ---- Operators ----- ----- ----
+  constexpr RGB& operator+=(const RGB& oth) noexcept;
+  constexpr RGB& operator-=(const RGB& oth) noexcept;
+  // per channel (filtering by a reflectance):
+  constexpr RGB& operator*=(const RGB& oth) noexcept;
+  constexpr RGB& operator*=(NumT scalar) noexcept;
+  constexpr RGB& operator/=(NumT scalar) noexcept;
+
+  constexpr bool operator==(const RGB& oth) const noexcept;
+
+  // ----- ----- ---- Queries ----- ----- ----
+  // Rec.709 relative luminance Y:
+  constexpr NumT luminance() const noexcept;
+  constexpr NumT max_channel() const noexcept;
+  constexpr bool is_black() const noexcept;
+};
+
+// Linear RGB with straight (not premultiplied) alpha, laid out as Vec4<NumT>:
+template<typename NumT = float> requires (std::floating_point<NumT>)
+class RGBA {
+private: // Fields:
+  Vec4<NumT> channels;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  constexpr RGBA() noexcept; // opaque black
+  constexpr RGBA(NumT r, NumT g, NumT b, NumT a = NumT(1)) noexcept;
+  constexpr explicit RGBA(const RGB<NumT>& rgb, NumT a = NumT(1)) noexcept;
+  constexpr explicit RGBA(const Vec4<NumT>& channels) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  constexpr NumT& r() noexcept;
+  constexpr NumT& g() noexcept;
+  constexpr NumT& b() noexcept;
+  constexpr NumT& a() noexcept;
+  constexpr const NumT& r() const noexcept;
+  constexpr const NumT& g() const noexcept;
+  constexpr const NumT& b() const noexcept;
+  constexpr const NumT& a() const noexcept;
+  constexpr NumT& operator[](size_t index) noexcept;
+  constexpr const NumT& operator[](size_t index) const noexcept;
+
+  constexpr RGB<NumT> rgb() const noexcept;
+  constexpr const Vec4<NumT>& vec() const noexcept;
+
+  constexpr bool operator==(const RGBA& oth) const noexcept;
+};
+
+// 8-bit display-encoded pixel, the layout of RGBA8 textures and image files:
+struct RGBA8 {
+  uint8_t r = 0;
+  uint8_t g = 0;
+  uint8_t b = 0;
+  uint8_t a = 255;
+
+  constexpr bool operator==(const RGBA8&) const noexcept = default;
+};
+
+// ----- ----- ---- Binary operators ----- ----- ----
+template<typename NumT>
+constexpr RGB<NumT> operator+(const RGB<NumT>& a, const RGB<NumT>& b) noexcept;
+
+template<typename NumT>
+constexpr RGB<NumT> operator-(const RGB<NumT>& a, const RGB<NumT>& b) noexcept;
+
+template<typename NumT>
+constexpr RGB<NumT> operator*(const RGB<NumT>& a, const RGB<NumT>& b) noexcept;
+
+template<typename NumT>
+constexpr RGB<NumT> operator*(const RGB<NumT>& color, std::type_identity_t<NumT> scalar) noexcept;
+
+template<typename NumT>
+constexpr RGB<NumT> operator*(std::type_identity_t<NumT> scalar, const RGB<NumT>& color) noexcept;
+
+template<typename NumT>
+constexpr RGB<NumT> operator/(const RGB<NumT>& color, std::type_identity_t<NumT> scalar) noexcept;
+
+using RGBf = RGB<float>;
+using RGBd = RGB<double>;
+using RGBAf = RGBA<float>;
+using RGBAd = RGBA<double>;
+
+} // namespace ayan::math
+
+#include "impl/color.hpp"
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <algorithm>
+
+#include "../color.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- RGB ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGB<NumT>::RGB() noexcept : channels(NumT(0), NumT(0), NumT(0)) {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGB<NumT>::RGB(NumT r, NumT g, NumT b) noexcept : channels(r, g, b) {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGB<NumT>::RGB(const Vec3<NumT>& channels) noexcept : channels(channels) {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGB<NumT> RGB<NumT>::Black() noexcept { return RGB(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGB<NumT> RGB<NumT>::White() noexcept { return Gray(NumT(1)); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGB<NumT> RGB<NumT>::Gray(NumT value) noexcept { return RGB(value, value, value); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT& RGB<NumT>::r() noexcept { return channels.x(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT& RGB<NumT>::g() noexcept { return channels.y(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT& RGB<NumT>::b() noexcept { return channels.z(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const NumT& RGB<NumT>::r() const noexcept { return channels.x(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const NumT& RGB<NumT>::g() const noexcept { return channels.y(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const NumT& RGB<NumT>::b() const noexcept { return channels.z(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT& RGB<NumT>::operator[](size_t index) noexcept { return channels[index]; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const NumT& RGB<NumT>::operator[](size_t index) const noexcept { return channels[index]; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const Vec3<NumT>& RGB<NumT>::vec() const noexcept { return channels; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGB<NumT>& RGB<NumT>::operator+=(const RGB& oth) noexcept {
+  channels += oth.channels;
+  return *this;
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGB<NumT>& RGB<NumT>::operator-=(const RGB& oth) noexcept {
+  channels -= oth.channels;
+  return *this;
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGB<NumT>& RGB<NumT>::operator*=(const RGB& oth) noexcept {
+  channels *= oth.channels;
+  return *this;
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGB<NumT>& RGB<NumT>::operator*=(NumT scalar) noexcept {
+  channels *= scalar;
+  return *this;
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGB<NumT>& RGB<NumT>::operator/=(NumT scalar) noexcept {
+  channels /= scalar;
+  return *this;
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr bool RGB<NumT>::operator==(const RGB& oth) const noexcept { return channels == oth.channels; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT RGB<NumT>::luminance() const noexcept {
+  return NumT(0.2126) * r() + NumT(0.7152) * g() + NumT(0.0722) * b();
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT RGB<NumT>::max_channel() const noexcept { return std::max({ r(), g(), b() }); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr bool RGB<NumT>::is_black() const noexcept {
+  return r() == NumT(0) && g() == NumT(0) && b() == NumT(0);
+}
+
+// ----- ----- ---- RGBA ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGBA<NumT>::RGBA() noexcept : channels(NumT(0), NumT(0), NumT(0), NumT(1)) {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGBA<NumT>::RGBA(NumT r, NumT g, NumT b, NumT a) noexcept : channels(r, g, b, a) {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGBA<NumT>::RGBA(const RGB<NumT>& rgb, NumT a) noexcept : channels(rgb.r(), rgb.g(), rgb.b(), a) {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGBA<NumT>::RGBA(const Vec4<NumT>& channels) noexcept : channels(channels) {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT& RGBA<NumT>::r() noexcept { return channels.x(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT& RGBA<NumT>::g() noexcept { return channels.y(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT& RGBA<NumT>::b() noexcept { return channels.z(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT& RGBA<NumT>::a() noexcept { return channels.w(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const NumT& RGBA<NumT>::r() const noexcept { return channels.x(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const NumT& RGBA<NumT>::g() const noexcept { return channels.y(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const NumT& RGBA<NumT>::b() const noexcept { return channels.z(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const NumT& RGBA<NumT>::a() const noexcept { return channels.w(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT& RGBA<NumT>::operator[](size_t index) noexcept { return channels[index]; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const NumT& RGBA<NumT>::operator[](size_t index) const noexcept { return channels[index]; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr RGB<NumT> RGBA<NumT>::rgb() const noexcept { return RGB<NumT>(r(), g(), b()); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const Vec4<NumT>& RGBA<NumT>::vec() const noexcept { return channels; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr bool RGBA<NumT>::operator==(const RGBA& oth) const noexcept { return channels == oth.channels; }
+
+// ----- ----- ---- Binary operators ----- ----- ----
+template<typename NumT>
+constexpr RGB<NumT> operator+(const RGB<NumT>& a, const RGB<NumT>& b) noexcept { return RGB<NumT>(a) += b; }
+
+template<typename NumT>
+constexpr RGB<NumT> operator-(const RGB<NumT>& a, const RGB<NumT>& b) noexcept { return RGB<NumT>(a) -= b; }
+
+template<typename NumT>
+constexpr RGB<NumT> operator*(const RGB<NumT>& a, const RGB<NumT>& b) noexcept { return RGB<NumT>(a) *= b; }
+
+template<typename NumT>
+constexpr RGB<NumT> operator*(const RGB<NumT>& color, std::type_identity_t<NumT> scalar) noexcept {
+  return RGB<NumT>(color) *= scalar;
+}
+
+template<typename NumT>
+constexpr RGB<NumT> operator*(std::type_identity_t<NumT> scalar, const RGB<NumT>& color) noexcept {
+  return RGB<NumT>(color) *= scalar;
+}
+
+template<typename NumT>
+constexpr RGB<NumT> operator/(const RGB<NumT>& color, std::type_identity_t<NumT> scalar) noexcept {
+  return RGB<NumT>(color) /= scalar;
+}
+
+} // namespace ayan::math
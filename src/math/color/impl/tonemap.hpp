@@ -0,0 +1,287 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../tonemap.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+// The curves are written once for scalars and packs: std:: and simd::
+// overloads of min/max/log/pow are both found, the packs by ADL.
+
+template<typename T>
+T select_value(bool condition, const T& if_true, const T& if_false) noexcept {
+  return condition ? if_true : if_false;
+}
+
+template<size_t Lanes>
+simd::Pack<float, Lanes> select_value(const simd::Mask<float, Lanes>& mask,
+  const simd::Pack<float, Lanes>& if_true, const simd::Pack<float, Lanes>& if_false) noexcept
+{
+  return simd::select(mask, if_true, if_false);
+}
+
+// NaN of a pack goes to 0 (maxps returns the second operand), not of a scalar:
+template<typename T>
+T clamp_unit(const T& x) noexcept {
+  using std::max;
+  using std::min;
+  return min(max(x, T(0.0f)), T(1.0f));
+}
+
+template<typename T>
+T reinhard_curve(const T& x) noexcept {
+  return x / (x + 1.0f);
+}
+
+// Narkowicz, "ACES Filmic Tone Mapping Curve", 2015:
+template<typename T>
+T aces_curve(const T& x) noexcept {
+  return clamp_unit((x * (x * 2.51f + 0.03f)) / (x * (x * 2.43f + 0.59f) + 0.14f));
+}
+
+// the AgX log2 encoding followed by the 6th order fit of its contrast sigmoid:
+template<typename T>
+T agx_curve(const T& x) noexcept {
+  using std::log;
+  using std::max;
+  constexpr float min_ev = -12.47393f;
+  constexpr float max_ev = 4.026069f;
+  constexpr float inv_log2 = 1.4426950408889634f;
+  const T ev = log(max(x, T(1e-10f))) * inv_log2;
+  const T v = clamp_unit((ev - min_ev) * (1.0f / (max_ev - min_ev)));
+  const T v2 = v * v;
+  const T v4 = v2 * v2;
+  return v4 * v2 * 15.5f - v4 * v * 40.14f + v4 * 31.96f - v2 * v * 6.868f + v2 * 0.4298f + v * 0.1191f - 0.00232f;
+}
+
+template<ToneMap Curve, typename T>
+void apply_curve(T& r, T& g, T& b) noexcept {
+  if constexpr (Curve == ToneMap::Clamp) {
+    r = clamp_unit(r);
+    g = clamp_unit(g);
+    b = clamp_unit(b);
+  } else if constexpr (Curve == ToneMap::Reinhard) {
+    r = reinhard_curve(r);
+    g = reinhard_curve(g);
+    b = reinhard_curve(b);
+  } else if constexpr (Curve == ToneMap::ACES) {
+    r = aces_curve(r);
+    g = aces_curve(g);
+    b = aces_curve(b);
+  } else {
+    using std::max;
+    using std::pow;
+    // inset (mixes some of every channel in, so saturated colours desaturate as they brighten):
+    const T ir = agx_curve(r * 0.842479062253094f + g * 0.0784335999999992f + b * 0.0792237451477643f);
+    const T ig = agx_curve(r * 0.0423282422610123f + g * 0.878468636469772f + b * 0.0791661274605434f);
+    const T ib = agx_curve(r * 0.0423756549057051f + g * 0.0784336f + b * 0.879142973793104f);
+    // outset, the sigmoid output is display-encoded with gamma 2.2:
+    const T outset_r = ir * 1.19687900512017f - ig * 0.0980208811401368f - ib * 0.0990297440797205f;
+    const T outset_g = ig * 1.15190312990417f - ir * 0.0528968517574562f - ib * 0.0989611768448433f;
+    const T outset_b = ib * 1.15107367264116f - ir * 0.0529716355144438f - ig * 0.0980434501171241f;
+    r = clamp_unit(pow(max(outset_r, T(0.0f)), 2.2f));
+    g = clamp_unit(pow(max(outset_g, T(0.0f)), 2.2f));
+    b = clamp_unit(pow(max(outset_b, T(0.0f)), 2.2f));
+  }
+}
+
+template<typename T>
+T linear_to_srgb(const T& linear) noexcept {
+  using std::pow;
+  return select_value(linear <= T(0.0031308f), linear * 12.92f, pow(linear, 1.0f / 2.4f) * 1.055f - 0.055f);
+}
+
+template<typename T>
+T srgb_to_linear(const T& encoded) noexcept {
+  using std::pow;
+  return select_value(encoded <= T(0.04045f), encoded * (1.0f / 12.92f), pow((encoded + 0.055f) * (1.0f / 1.055f), 2.4f));
+}
+
+inline constexpr uint8_t kBayer8[8][8] = {
+  {  0, 32,  8, 40,  2, 34, 10, 42 },
+  { 48, 16, 56, 24, 50, 18, 58, 26 },
+  { 12, 44,  4, 36, 14, 46,  6, 38 },
+  { 60, 28, 52, 20, 62, 30, 54, 22 },
+  {  3, 35, 11, 43,  1, 33,  9, 41 },
+  { 51, 19, 59, 27, 49, 17, 57, 25 },
+  { 15, 47,  7, 39, 13, 45,  5, 37 },
+  { 63, 31, 55, 23, 61, 29, 53, 21 }
+};
+
+// pixels per task of a threaded encode_srgb8():
+inline constexpr size_t kEncodeGrain = size_t(1) << 14;
+
+// widest native pack for float:
+inline constexpr size_t color_lanes = simd::IsNative<float, 8> ? 8 : 4;
+
+// in[0] is pixel `first` of a `width` wide image (its position picks the dither offsets):
+template<ToneMap Curve, typename PixelT>
+void encode_range(float scale, bool dither, const PixelT* in, size_t first, size_t count, size_t width, RGBA8* out) noexcept {
+  constexpr size_t lanes = color_lanes;
+  constexpr bool has_alpha = std::is_same_v<PixelT, RGBAf>;
+  using pack_type = simd::Pack<float, lanes>;
+  using packet_type = Vec3x<lanes, float>;
+
+  // inf still saturates every curve, NaN becomes 0:
+  const pack_type scales(scale);
+  const pack_type zero = pack_type::Zero();
+  const pack_type largest(65504.0f);
+  const pack_type full(255.0f);
+
+  size_t x = first % width;
+  size_t y = first / width;
+  for (size_t i = 0; i < count; i += lanes) {
+    const size_t n = std::min(lanes, count - i);
+    alignas(sizeof(float) * lanes) float channels[4][lanes] = {};
+    packet_type rgb;
+    pack_type alpha;
+    if (!has_alpha && n == lanes) {
+      simd::load_deinterleave3(&in[i][0], rgb.x(), rgb.y(), rgb.z());
+    } else {
+      // the tail is padded with black:
+      for (size_t lane = 0; lane < n; ++lane) {
+        for (size_t c = 0; c < (has_alpha ? 4 : 3); ++c) channels[c][lane] = in[i + lane][c];
+      }
+      rgb = packet_type(pack_type::Load(channels[0]), pack_type::Load(channels[1]), pack_type::Load(channels[2]));
+      if constexpr (has_alpha) alpha = pack_type::Load(channels[3]);
+    }
+
+    for (size_t c = 0; c < 3; ++c) rgb[c] = simd::min(simd::max(rgb[c] * scales, zero), largest);
+    rgb = tone_map<Curve>(rgb);
+    // the OETF from its table, in [0, 1] for any input:
+    for (size_t c = 0; c < 3; ++c) (kLinearToSrgbLut(rgb[c]) * full).store(channels[c]);
+    if constexpr (has_alpha) (detail::clamp_unit(alpha) * full).store(channels[3]);
+
+    // the values are in [0, 255], + an offset below 1 truncates to [0, 255]; alpha is
+    // coverage, not a displayed intensity, so it is rounded and never dithered:
+    for (size_t lane = 0; lane < n; ++lane) {
+      const float offset = dither_offset(x, y, dither);
+      RGBA8& pixel = out[i + lane];
+      pixel.r = uint8_t(channels[0][lane] + offset);
+      pixel.g = uint8_t(channels[1][lane] + offset);
+      pixel.b = uint8_t(channels[2][lane] + offset);
+      pixel.a = has_alpha ? uint8_t(channels[3][lane] + 0.5f) : uint8_t(255);
+      if (++x == width) {
+        x = 0;
+        ++y;
+      }
+    }
+  }
+}
+
+// resolves the curve, then runs over the whole image or its stripes on `pool`:
+template<typename PixelT>
+void run_encode(sync::ThreadPool* pool, const ToneMapSettings& settings,
+  const PixelT* in, size_t count, size_t width, RGBA8* out)
+{
+  if (count == 0) return;
+  if (width == 0) throw std::invalid_argument("[encode_srgb8]: an image with pixels cannot be 0 pixels wide");
+  const float scale = std::exp2(settings.exposure);
+  auto run = [&]<ToneMap Curve>() {
+    if (pool == nullptr) {
+      encode_range<Curve>(scale, settings.dither, in, 0, count, width, out);
+      return;
+    }
+    const size_t rows = (count + width - 1) / width;
+    pool->parallel_for(rows, std::max<size_t>(1, kEncodeGrain / width), [&](size_t begin, size_t end) {
+      const size_t first = begin * width;
+      const size_t last = std::min(end * width, count);
+      encode_range<Curve>(scale, settings.dither, in + first, first, last - first, width, out + first);
+    });
+  };
+
+  switch (settings.curve) {
+    case ToneMap::Clamp: run.template operator()<ToneMap::Clamp>(); break;
+    case ToneMap::Reinhard: run.template operator()<ToneMap::Reinhard>(); break;
+    case ToneMap::ACES: run.template operator()<ToneMap::ACES>(); break;
+    case ToneMap::AgX: run.template operator()<ToneMap::AgX>(); break;
+  }
+}
+
+} // namespace detail
+
+// ----- ----- ---- Tone curves ----- ----- ----
+template<ToneMap Curve, typename NumT> requires (std::floating_point<NumT>)
+RGB<NumT> tone_map(const RGB<NumT>& color) noexcept {
+  RGB<NumT> result = color;
+  detail::apply_curve<Curve>(result.r(), result.g(), result.b());
+  return result;
+}
+
+template<ToneMap Curve, size_t Lanes>
+Vec3x<Lanes, float> tone_map(const Vec3x<Lanes, float>& color) noexcept {
+  Vec3x<Lanes, float> result = color;
+  detail::apply_curve<Curve>(result.x(), result.y(), result.z());
+  return result;
+}
+
+// ----- ----- ---- sRGB transfer functions ----- ----- ----
+template<typename NumT> requires (std::floating_point<NumT>)
+NumT linear_to_srgb(NumT linear) noexcept {
+  return detail::linear_to_srgb(linear);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+NumT srgb_to_linear(NumT encoded) noexcept {
+  return detail::srgb_to_linear(encoded);
+}
+
+template<size_t Lanes>
+simd::Pack<float, Lanes> linear_to_srgb(const simd::Pack<float, Lanes>& linear) noexcept {
+  return detail::linear_to_srgb(linear);
+}
+
+template<size_t Lanes>
+simd::Pack<float, Lanes> srgb_to_linear(const simd::Pack<float, Lanes>& encoded) noexcept {
+  return detail::srgb_to_linear(encoded);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+RGB<NumT> linear_to_srgb(const RGB<NumT>& linear) noexcept {
+  return RGB<NumT>(linear_to_srgb(linear.r()), linear_to_srgb(linear.g()), linear_to_srgb(linear.b()));
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+RGB<NumT> srgb_to_linear(const RGB<NumT>& encoded) noexcept {
+  return RGB<NumT>(srgb_to_linear(encoded.r()), srgb_to_linear(encoded.g()), srgb_to_linear(encoded.b()));
+}
+
+// ----- ----- ---- Quantization ----- ----- ----
+constexpr float dither_offset(size_t x, size_t y, bool dither) noexcept {
+  return dither ? (float(detail::kBayer8[y & 7][x & 7]) + 0.5f) * (1.0f / 64.0f) : 0.5f;
+}
+
+// ----- ----- ---- Framebuffers ----- ----- ----
+inline void encode_srgb8(const ToneMapSettings& settings,
+  std::span<const RGBf> in, size_t width, std::span<RGBA8> out)
+{
+  detail::run_encode(nullptr, settings, in.data(), in.size(), width, out.data());
+}
+
+inline void encode_srgb8(const ToneMapSettings& settings,
+  std::span<const RGBAf> in, size_t width, std::span<RGBA8> out)
+{
+  detail::run_encode(nullptr, settings, in.data(), in.size(), width, out.data());
+}
+
+inline void encode_srgb8(sync::ThreadPool& pool, const ToneMapSettings& settings,
+  std::span<const RGBf> in, size_t width, std::span<RGBA8> out)
+{
+  detail::run_encode(&pool, settings, in.data(), in.size(), width, out.data());
+}
+
+inline void encode_srgb8(sync::ThreadPool& pool, const ToneMapSettings& settings,
+  std::span<const RGBAf> in, size_t width, std::span<RGBA8> out)
+{
+  detail::run_encode(&pool, settings, in.data(), in.size(), width, out.data());
+}
+
+} // namespace ayan::math
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+#include <ayan/sync.hpp>
+
+#include "color.hpp"
+#include "../vec/vec3x.hpp"
+#include "../simd/transcendental.hpp"
+#include "../lut/srgb.hpp"
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//          TONE MAPPING AND DISPLAY ENCODING           |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// Linear radiance -> exposure (x 2^EV) -> tone curve into [0, 1] -> sRGB OETF
+// -> 8 bits, rounded or with an 8x8 ordered (Bayer) dither that hides banding
+// in smooth gradients. Curves:
+//   Clamp    - min(x, 1), for images that are already in range;
+//   Reinhard - x / (1 + x) per channel;
+//   ACES     - Narkowicz's fit of the ACES RRT + sRGB ODT, per channel;
+//   AgX      - Sobotka's AgX base: inset, log2 encoding over [-12.47, 4.03] EV,
+//              a polynomial fit of the sigmoid, outset. Bright saturated
+//              colours go to white instead of skewing their hue.
+// Packets go through simd::pow/log (Vec3x, 8 pixels with AVX or 4 with SSE);
+// the scalar functions are std:: based and may differ in the last bits. The
+// framebuffer encoder reads the OETF from kLinearToSrgbLut (lut/srgb.hpp).
+// encode_srgb8() runs a whole framebuffer, in stripes of rows on a ThreadPool
+// if one is given. NaN radiance encodes as black.
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+enum class ToneMap {
+  Clamp,
+  Reinhard,
+  ACES,
+  AgX
+};
+
+struct ToneMapSettings {
+  ToneMap curve = ToneMap::AgX;
+  float exposure = 0.0f; // stops, radiance is scaled by 2^exposure first;
+  bool dither = true;    // ordered dither instead of rounding to 8 bits;
+};
+
+// ----- ----- ---- Tone curves ----- ----- ----
+// linear radiance >= 0 to linear display values in [0, 1]:
+template<ToneMap Curve, typename NumT> requires (std::floating_point<NumT>)
+RGB<NumT> tone_map(const RGB<NumT>& color) noexcept;
+
+// r, g, b of `Lanes` pixels in x, y, z:
+template<ToneMap Curve, size_t Lanes>
+Vec3x<Lanes, float> tone_map(const Vec3x<Lanes, float>& color) noexcept;
+
+// ----- ----- ---- sRGB transfer functions ----- ----- ----
+// IEC 61966-2-1, [0, 1] to [0, 1]:
+template<typename NumT> requires (std::floating_point<NumT>)
+NumT linear_to_srgb(NumT linear) noexcept;
+
+template<typename NumT> requires (std::floating_point<NumT>)
+NumT srgb_to_linear(NumT encoded) noexcept;
+
+template<size_t Lanes>
+simd::Pack<float, Lanes> linear_to_srgb(const simd::Pack<float, Lanes>& linear) noexcept;
+
+template<size_t Lanes>
+simd::Pack<float, Lanes> srgb_to_linear(const simd::Pack<float, Lanes>& encoded) noexcept;
+
+// per channel:
+template<typename NumT> requires (std::floating_point<NumT>)
+RGB<NumT> linear_to_srgb(const RGB<NumT>& linear) noexcept;
+
+template<typename NumT> requires (std::floating_point<NumT>)
+RGB<NumT> srgb_to_linear(const RGB<NumT>& encoded) noexcept;
+
+// ----- ----- ---- Quantization ----- ----- ----
+// added to value * 255 before truncation, in (0, 1): the 8x8 Bayer matrix at
+// (x, y) or 0.5 (rounding) without dither:
+constexpr float dither_offset(size_t x, size_t y, bool dither) noexcept;
+
+// ----- ----- ---- Framebuffers ----- ----- ----
+// out[i] is the display encoding of in[i], pixel `i` is at (i % width, i / width)
+// which picks its dither offset. `out` holds at least in.size() pixels.
+// Alpha (RGBA) is quantized linearly and rounded (never dithered), RGB input gets alpha 255. An empty image
+// is a no-op, `width == 0` for any other throws std::invalid_argument:
+inline void encode_srgb8(const ToneMapSettings& settings,
+  std::span<const RGBf> in, size_t width, std::span<RGBA8> out);
+
+inline void encode_srgb8(const ToneMapSettings& settings,
+  std::span<const RGBAf> in, size_t width, std::span<RGBA8> out);
+
+// The same, stripes of rows split across the workers of `pool` (the calling
+// thread takes part and may itself be a task of `pool`):
+inline void encode_srgb8(sync::ThreadPool& pool, const ToneMapSettings& settings,
+  std::span<const RGBf> in, size_t width, std::span<RGBA8> out);
+
+inline void encode_srgb8(sync::ThreadPool& pool, const ToneMapSettings& settings,
+  std::span<const RGBAf> in, size_t width, std::span<RGBA8> out);
+
+} // namespace ayan::math
+
+#include "impl/tonemap.hpp"
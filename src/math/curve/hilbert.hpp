@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "../vec/vec2.hpp"
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                  HILBERT CURVE INDICES               |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// Position of a cell along the Hilbert curve of `order` over a 2^order x
+// 2^order grid (order in [1, 16]). Unlike Morton codes the curve never jumps:
+// consecutive indices are neighbouring cells, the better order for tiles and
+// pixels. For a w x h screen take order = std::bit_width(max(w, h) - 1) and
+// skip the indices that decode outside of it.
+// Bit-parallel prefix scans instead of a loop over the levels, so the batch
+// versions run 8 (AVX2) or 4 (SSE2) cells per step.
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// coordinates of `cell` are in [0, 2^order), higher bits are dropped:
+constexpr uint32_t hilbert_encode(const Vec2i& cell, uint32_t order) noexcept;
+constexpr Vec2i hilbert_decode(uint32_t index, uint32_t order) noexcept;
+
+// element-wise, the output span must hold at least as many elements as the input:
+inline void hilbert_encode(std::span<const Vec2i> cells, std::span<uint32_t> indices, uint32_t order) noexcept;
+inline void hilbert_decode(std::span<const uint32_t> indices, std::span<Vec2i> cells, uint32_t order) noexcept;
+
+} // namespace ayan::math
+
+#include "impl/hilbert.hpp"
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <initializer_list>
+#include <type_traits>
+
+#include "../hilbert.hpp"
+#include "../morton.hpp"
+#include "../../detail/uint_lanes.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+// `W` below is uint32_t or UintLanes<uint32_t, N>.
+// bit `i` is the xor of bits [i, 16):
+template<typename W>
+AYAN_SIMD_INLINE constexpr W prefix_xor16(W x) noexcept {
+  x = (x >> 8) ^ x;
+  x = (x >> 4) ^ x;
+  x = (x >> 2) ^ x;
+  x = (x >> 1) ^ x;
+  return x;
+}
+
+// The state of the curve (orientation and reflection) at every level depends on
+// all levels above it. Instead of a loop over the levels it is composed as a
+// prefix scan over the 16 bit positions in log2(16) rounds, every position at once
+// (the method of rawrunprotected/hilbert_curves, public domain):
+template<typename W>
+AYAN_SIMD_INLINE constexpr W hilbert_index(W x, W y, uint32_t order) noexcept {
+  x = (x << int(16 - order)) & 0xFFFFu;
+  y = (y << int(16 - order)) & 0xFFFFu;
+
+  W A, B, C, D;
+  {
+    const W a = x ^ y;
+    const W b = a ^ 0xFFFFu;
+    const W c = (x | y) ^ 0xFFFFu;
+    const W d = x & (y ^ 0xFFFFu);
+    A = a | (b >> 1);
+    B = (a >> 1) ^ a;
+    C = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+    D = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+  }
+  for (int shift : {2, 4}) {
+    const W a = A, b = B, c = C, d = D;
+    A = (a & (a >> shift)) ^ (b & (b >> shift));
+    B = (a & (b >> shift)) ^ (b & ((a ^ b) >> shift));
+    C = C ^ ((a & (c >> shift)) ^ (b & (d >> shift)));
+    D = D ^ ((b & (c >> shift)) ^ ((a ^ b) & (d >> shift)));
+  }
+  {
+    const W a = A, b = B, c = C, d = D;
+    C = C ^ ((a & (c >> 8)) ^ (b & (d >> 8)));
+    D = D ^ ((b & (c >> 8)) ^ ((a ^ b) & (d >> 8)));
+  }
+
+  const W a = C ^ (C >> 1);
+  const W b = D ^ (D >> 1);
+  const W i0 = x ^ y;
+  const W i1 = b | ((i0 | a) ^ 0xFFFFu);
+  return ((interleave16(i1) << 1) | interleave16(i0)) >> int(32 - 2 * order);
+}
+
+template<typename W>
+AYAN_SIMD_INLINE constexpr void hilbert_cell(W index, uint32_t order, W& x, W& y) noexcept {
+  index = index << int(32 - 2 * order);
+  const W i0 = deinterleave16(index);
+  const W i1 = deinterleave16(index >> 1);
+  const W t0 = prefix_xor16((i0 | i1) ^ 0xFFFFu);
+  const W t1 = prefix_xor16(i0 & i1);
+  const W a = ((i0 ^ 0xFFFFu) & t1) | (i0 & t0);
+  x = (a ^ i1) >> int(16 - order);
+  y = (a ^ i0 ^ i1) >> int(16 - order);
+}
+
+// `Lanes` Vec2i at `src` -> lanes of x and y (and back):
+#if defined(AYAN_SIMD_AVX2)
+AYAN_SIMD_INLINE void load_deinterleave2(const Vec2i* src, U32x8& x, U32x8& y) noexcept {
+  const __m256 a = _mm256_loadu_ps(reinterpret_cast<const float*>(src));
+  const __m256 b = _mm256_loadu_ps(reinterpret_cast<const float*>(src + 4));
+  // x0 x1 x4 x5 | x2 x3 x6 x7 -> x0 ... x7:
+  x.reg = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))),
+    _MM_SHUFFLE(3, 1, 2, 0));
+  y.reg = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))),
+    _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+AYAN_SIMD_INLINE void store_interleave2(Vec2i* dst, U32x8 x, U32x8 y) noexcept {
+  // x0 y0 x1 y1 | x4 y4 x5 y5 and x2 y2 x3 y3 | x6 y6 x7 y7:
+  const __m256i low = _mm256_unpacklo_epi32(x.reg, y.reg);
+  const __m256i high = _mm256_unpackhi_epi32(x.reg, y.reg);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_permute2x128_si256(low, high, 0x20));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 4), _mm256_permute2x128_si256(low, high, 0x31));
+}
+#elif defined(AYAN_SIMD_SSE2)
+AYAN_SIMD_INLINE void load_deinterleave2(const Vec2i* src, U32x4& x, U32x4& y) noexcept {
+  const __m128 a = _mm_loadu_ps(reinterpret_cast<const float*>(src));
+  const __m128 b = _mm_loadu_ps(reinterpret_cast<const float*>(src + 2));
+  x.reg = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+  y.reg = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+AYAN_SIMD_INLINE void store_interleave2(Vec2i* dst, U32x4 x, U32x4 y) noexcept {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi32(x.reg, y.reg));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2), _mm_unpackhi_epi32(x.reg, y.reg));
+}
+#endif
+
+} // namespace detail
+
+// ----- ----- ---- Indices ----- ----- ----
+constexpr uint32_t hilbert_encode(const Vec2i& cell, uint32_t order) noexcept {
+  return detail::hilbert_index(uint32_t(cell.x()), uint32_t(cell.y()), order);
+}
+
+constexpr Vec2i hilbert_decode(uint32_t index, uint32_t order) noexcept {
+  uint32_t x = 0, y = 0;
+  detail::hilbert_cell(index, order, x, y);
+  return Vec2i(int(x), int(y));
+}
+
+// Vec2i is tightly packed, `Lanes` cells are 2 * Lanes consecutive ints:
+static_assert(sizeof(Vec2i) == 2 * sizeof(int) && sizeof(int) == sizeof(uint32_t));
+
+inline void hilbert_encode(std::span<const Vec2i> cells, std::span<uint32_t> indices, uint32_t order) noexcept {
+  size_t i = 0;
+#if defined(AYAN_SIMD_SSE2)
+  constexpr size_t Lanes = detail::uint32_lanes;
+  for (; i + Lanes <= cells.size(); i += Lanes) {
+    detail::UintLanes<uint32_t, Lanes> x, y;
+    detail::load_deinterleave2(cells.data() + i, x, y);
+    detail::hilbert_index(x, y, order).store_unaligned(indices.data() + i);
+  }
+#endif
+  for (; i < cells.size(); ++i) indices[i] = hilbert_encode(cells[i], order);
+}
+
+inline void hilbert_decode(std::span<const uint32_t> indices, std::span<Vec2i> cells, uint32_t order) noexcept {
+  size_t i = 0;
+#if defined(AYAN_SIMD_SSE2)
+  constexpr size_t Lanes = detail::uint32_lanes;
+  for (; i + Lanes <= indices.size(); i += Lanes) {
+    using lanes_type = detail::UintLanes<uint32_t, Lanes>;
+    lanes_type x, y;
+    detail::hilbert_cell(lanes_type::LoadUnaligned(indices.data() + i), order, x, y);
+    detail::store_interleave2(cells.data() + i, x, y);
+  }
+#endif
+  for (; i < indices.size(); ++i) cells[i] = hilbert_decode(indices[i], order);
+}
+
+} // namespace ayan::math
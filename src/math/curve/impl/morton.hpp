@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+
+#include "../morton.hpp"
+#include "../../vec/vec3x.hpp"
+#include "../../detail/uint_lanes.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+// the low 10 bits of every lane to every third bit of a 30-bit code ("magic bits"),
+// `W` is uint32_t or UintLanes<uint32_t, N>:
+template<typename W>
+AYAN_SIMD_INLINE constexpr W morton_spread10(W x) noexcept {
+  x = x & 0x000003FFu;
+  x = (x | (x << 16)) & 0x030000FFu;
+  x = (x | (x << 8)) & 0x0300F00Fu;
+  x = (x | (x << 4)) & 0x030C30C3u;
+  x = (x | (x << 2)) & 0x09249249u;
+  return x;
+}
+
+template<typename W>
+AYAN_SIMD_INLINE constexpr W morton_compact10(W x) noexcept {
+  x = x & 0x09249249u;
+  x = (x | (x >> 2)) & 0x030C30C3u;
+  x = (x | (x >> 4)) & 0x0300F00Fu;
+  x = (x | (x >> 8)) & 0x030000FFu;
+  x = (x | (x >> 16)) & 0x000003FFu;
+  return x;
+}
+
+// the low 21 bits to every third bit of a 63-bit code, `W` is uint64_t or UintLanes<uint64_t, N>:
+template<typename W>
+AYAN_SIMD_INLINE constexpr W morton_spread21(W x) noexcept {
+  x = x & 0x00000000001FFFFFull;
+  x = (x | (x << 32)) & 0x001F00000000FFFFull;
+  x = (x | (x << 16)) & 0x001F0000FF0000FFull;
+  x = (x | (x << 8)) & 0x100F00F00F00F00Full;
+  x = (x | (x << 4)) & 0x10C30C30C30C30C3ull;
+  x = (x | (x << 2)) & 0x1249249249249249ull;
+  return x;
+}
+
+constexpr uint64_t morton_compact21(uint64_t x) noexcept {
+  x = x & 0x1249249249249249ull;
+  x = (x | (x >> 2)) & 0x10C30C30C30C30C3ull;
+  x = (x | (x >> 4)) & 0x100F00F00F00F00Full;
+  x = (x | (x >> 8)) & 0x001F0000FF0000FFull;
+  x = (x | (x >> 16)) & 0x001F00000000FFFFull;
+  x = (x | (x >> 32)) & 0x00000000001FFFFFull;
+  return x;
+}
+
+// The low 16 bits of every lane to the even bits (2D Morton order of x) and back,
+// `W` is uint32_t or UintLanes<uint32_t, N>:
+template<typename W>
+AYAN_SIMD_INLINE constexpr W interleave16(W x) noexcept {
+#if defined(AYAN_SIMD_BMI2)
+  if constexpr (std::same_as<W, uint32_t>) {
+    if (!std::is_constant_evaluated()) return _pdep_u32(x, 0x55555555u);
+  }
+#endif
+  x = (x | (x << 8)) & 0x00FF00FFu;
+  x = (x | (x << 4)) & 0x0F0F0F0Fu;
+  x = (x | (x << 2)) & 0x33333333u;
+  x = (x | (x << 1)) & 0x55555555u;
+  return x;
+}
+
+template<typename W>
+AYAN_SIMD_INLINE constexpr W deinterleave16(W x) noexcept {
+#if defined(AYAN_SIMD_BMI2)
+  if constexpr (std::same_as<W, uint32_t>) {
+    if (!std::is_constant_evaluated()) return _pext_u32(x, 0x55555555u);
+  }
+#endif
+  x = x & 0x55555555u;
+  x = (x | (x >> 1)) & 0x33333333u;
+  x = (x | (x >> 2)) & 0x0F0F0F0Fu;
+  x = (x | (x >> 4)) & 0x00FF00FFu;
+  x = (x | (x >> 8)) & 0x0000FFFFu;
+  return x;
+}
+
+// cell lanes (32-bit) -> `Lanes` codes at `dst`:
+template<MortonCode CodeT, size_t Lanes>
+AYAN_SIMD_INLINE void morton_store(UintLanes<uint32_t, Lanes> x, UintLanes<uint32_t, Lanes> y,
+  UintLanes<uint32_t, Lanes> z, CodeT* dst) noexcept
+{
+  if constexpr (std::same_as<CodeT, uint32_t>) {
+    (morton_spread10(x) | (morton_spread10(y) << 1) | (morton_spread10(z) << 2)).store_unaligned(dst);
+  } else {
+    const auto interleave = [](auto x, auto y, auto z) {
+      return morton_spread21(x) | (morton_spread21(y) << 1) | (morton_spread21(z) << 2);
+    };
+    interleave(widen_low(x), widen_low(y), widen_low(z)).store_unaligned(dst);
+    interleave(widen_high(x), widen_high(y), widen_high(z)).store_unaligned(dst + Lanes / 2);
+  }
+}
+
+} // namespace detail
+
+// ----- ----- ---- Codes ----- ----- ----
+template<MortonCode CodeT>
+constexpr CodeT morton_encode(const Vec3i& cell) noexcept {
+  const CodeT x = CodeT(uint32_t(cell.x()));
+  const CodeT y = CodeT(uint32_t(cell.y()));
+  const CodeT z = CodeT(uint32_t(cell.z()));
+  if constexpr (std::same_as<CodeT, uint32_t>) {
+#if defined(AYAN_SIMD_BMI2)
+    if (!std::is_constant_evaluated()) {
+      return _pdep_u32(x, 0x09249249u) | _pdep_u32(y, 0x12492492u) | _pdep_u32(z, 0x24924924u);
+    }
+#endif
+    return detail::morton_spread10(x) | (detail::morton_spread10(y) << 1) | (detail::morton_spread10(z) << 2);
+  } else {
+#if defined(AYAN_SIMD_BMI2)
+    if (!std::is_constant_evaluated()) {
+      return _pdep_u64(x, 0x1249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull)
+        | _pdep_u64(z, 0x4924924924924924ull);
+    }
+#endif
+    return detail::morton_spread21(x) | (detail::morton_spread21(y) << 1) | (detail::morton_spread21(z) << 2);
+  }
+}
+
+template<MortonCode CodeT>
+constexpr Vec3i morton_decode(CodeT code) noexcept {
+  if constexpr (std::same_as<CodeT, uint32_t>) {
+#if defined(AYAN_SIMD_BMI2)
+    if (!std::is_constant_evaluated()) {
+      return Vec3i(int(_pext_u32(code, 0x09249249u)), int(_pext_u32(code, 0x12492492u)),
+        int(_pext_u32(code, 0x24924924u)));
+    }
+#endif
+    return Vec3i(int(detail::morton_compact10(code)), int(detail::morton_compact10(code >> 1)),
+      int(detail::morton_compact10(code >> 2)));
+  } else {
+#if defined(AYAN_SIMD_BMI2)
+    if (!std::is_constant_evaluated()) {
+      return Vec3i(int(_pext_u64(code, 0x1249249249249249ull)), int(_pext_u64(code, 0x2492492492492492ull)),
+        int(_pext_u64(code, 0x4924924924924924ull)));
+    }
+#endif
+    return Vec3i(int(detail::morton_compact21(code)), int(detail::morton_compact21(code >> 1)),
+      int(detail::morton_compact21(code >> 2)));
+  }
+}
+
+template<MortonCode CodeT>
+void morton_encode(std::span<const Vec3i> cells, std::span<CodeT> codes) noexcept {
+  for (size_t i = 0; i < cells.size(); ++i) codes[i] = morton_encode<CodeT>(cells[i]);
+}
+
+template<MortonCode CodeT>
+void morton_decode(std::span<const CodeT> codes, std::span<Vec3i> cells) noexcept {
+  for (size_t i = 0; i < codes.size(); ++i) cells[i] = morton_decode(codes[i]);
+}
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                      MortonGrid                      |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<MortonCode CodeT>
+MortonGrid<CodeT>::MortonGrid(const AABBf& bounds) noexcept : origin(bounds.min()) {
+  const Vec3f extent = bounds.extent();
+  for (size_t axis = 0; axis < 3; ++axis) {
+    scale[axis] = extent[axis] > 0.0f ? float(1u << morton_axis_bits<CodeT>) / extent[axis] : 0.0f;
+  }
+}
+
+template<MortonCode CodeT>
+Vec3i MortonGrid<CodeT>::cell(const Vec3f& point) const noexcept {
+  constexpr float last_cell = float((1u << morton_axis_bits<CodeT>) - 1);
+  Vec3i result;
+  for (size_t axis = 0; axis < 3; ++axis) {
+    result[axis] = int(std::clamp((point[axis] - origin[axis]) * scale[axis], 0.0f, last_cell));
+  }
+  return result;
+}
+
+template<MortonCode CodeT>
+CodeT MortonGrid<CodeT>::encode(const Vec3f& point) const noexcept {
+  return morton_encode<CodeT>(cell(point));
+}
+
+template<MortonCode CodeT>
+void MortonGrid<CodeT>::encode(std::span<const Vec3f> points, std::span<CodeT> codes) const noexcept {
+  size_t i = 0;
+#if defined(AYAN_SIMD_SSE2)
+  constexpr size_t Lanes = detail::uint32_lanes;
+  using packet_type = Vec3x<Lanes, float>;
+  using lanes_type = detail::UintLanes<uint32_t, Lanes>;
+  constexpr float last = float((1u << morton_axis_bits<CodeT>) - 1);
+  const packet_type origins(origin);
+  const packet_type scales(scale);
+  const packet_type zero = packet_type::Zero();
+  const packet_type last_cell(Vec3f(last, last, last));
+
+  for (; i + Lanes <= points.size(); i += Lanes) {
+    // the same operations as cell(), clamp(v, 0, last) is min(max(v, 0), last) without NaN:
+    const packet_type cells = min(max((packet_type::Load(points.data() + i) - origins) * scales, zero), last_cell);
+    detail::morton_store(lanes_type::Truncate(cells.x()), lanes_type::Truncate(cells.y()),
+      lanes_type::Truncate(cells.z()), codes.data() + i);
+  }
+#endif
+  for (; i < points.size(); ++i) codes[i] = encode(points[i]);
+}
+
+} // namespace ayan::math
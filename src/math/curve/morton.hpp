@@ -0,0 +1,66 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+#include "../vec/vec3.hpp"
+#include "../geometry/aabb.hpp"
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                  MORTON (Z-ORDER) CODES              |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// Bits of a cell interleaved as ... z1 y1 x1 z0 y0 x0: sorted by the code,
+// points close in space are close in the array (LBVH builds, primitive order).
+// 10 bits per axis in a 30-bit uint32_t code, 21 bits in a 63-bit uint64_t one.
+// One pdep/pext per axis with BMI2 (microcoded and slow on AMD before Zen 3,
+// build without -mbmi2 there), shifts and masks otherwise.
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+template<typename CodeT>
+concept MortonCode = std::same_as<CodeT, uint32_t> || std::same_as<CodeT, uint64_t>;
+
+// bits per axis:
+template<MortonCode CodeT>
+inline constexpr uint32_t morton_axis_bits = sizeof(CodeT) == 4 ? 10 : 21;
+
+// coordinates of `cell` are in [0, 2^morton_axis_bits), higher bits are dropped:
+template<MortonCode CodeT>
+constexpr CodeT morton_encode(const Vec3i& cell) noexcept;
+
+template<MortonCode CodeT>
+constexpr Vec3i morton_decode(CodeT code) noexcept;
+
+// element-wise, the output span must hold at least as many elements as the input:
+template<MortonCode CodeT>
+void morton_encode(std::span<const Vec3i> cells, std::span<CodeT> codes) noexcept;
+
+template<MortonCode CodeT>
+void morton_decode(std::span<const CodeT> codes, std::span<Vec3i> cells) noexcept;
+
+// Splits `bounds` into 2^morton_axis_bits cells per axis and gives Morton codes
+// to points inside (primitive centroids of a BVH build). Points outside are
+// clamped to the border cells, a flat axis is cell 0, NaN isn't allowed:
+template<MortonCode CodeT>
+class MortonGrid {
+private: // Fields:
+  Vec3f origin;
+  Vec3f scale; // cells per unit of length, 0 on a flat axis;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  explicit MortonGrid(const AABBf& bounds) noexcept;
+
+  // ----- ----- ---- Conversion ----- ----- ----
+  Vec3i cell(const Vec3f& point) const noexcept;
+  CodeT encode(const Vec3f& point) const noexcept;
+
+  // 8 (AVX2) or 4 (SSE2) points per step, the same codes as the scalar encode():
+  void encode(std::span<const Vec3f> points, std::span<CodeT> codes) const noexcept;
+};
+
+} // namespace ayan::math
+
+#include "impl/morton.hpp"
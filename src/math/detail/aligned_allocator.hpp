@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+#include "simd.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::detail {
+
+// std::allocator with `Alignment`-byte aligned blocks (64 - a cache line and
+// an AVX-512 register), so aligned pack loads work from the first element:
+template<typename T, size_t Alignment = 64>
+struct AlignedAllocator {
+  static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0);
+
+  using value_type = T;
+
+  template<typename U>
+  struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+  AlignedAllocator() noexcept = default;
+
+  template<typename U>
+  AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+  T* allocate(size_t count) {
+    return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+  }
+
+  void deallocate(T* ptr, size_t count) noexcept {
+    ::operator delete(ptr, count * sizeof(T), std::align_val_t(Alignment));
+  }
+
+  template<typename U>
+  bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+};
+
+} // namespace ayan::math::detail
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+#include "simd.hpp"
+
+// double precision sqrt/exp/log/pow/cos that also run in constant expressions
+// (std:: ones are not constexpr before C++26), for tables built at compile
+// time. At run time they are the std:: functions.
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::detail {
+
+constexpr double cx_sqrt(double x) noexcept {
+  if (!std::is_constant_evaluated()) return std::sqrt(x);
+  if (!(x > 0.0)) return 0.0;
+  // half the exponent for the first guess, Newton doubles the correct bits:
+  double root = std::bit_cast<double>((std::bit_cast<uint64_t>(x) >> 1) + (uint64_t(1023) << 51));
+  for (int i = 0; i < 6; ++i) root = 0.5 * (root + x / root);
+  return root;
+}
+
+// x > 0:
+constexpr double cx_log(double x) noexcept {
+  if (!std::is_constant_evaluated()) return std::log(x);
+  // x = m * 2^e with m in [sqrt(1/2), sqrt(2)), log(m) = 2 * atanh((m - 1) / (m + 1)):
+  const uint64_t bits = std::bit_cast<uint64_t>(x);
+  int exponent = int((bits >> 52) & 0x7FF) - 1023;
+  double m = std::bit_cast<double>((bits & ((uint64_t(1) << 52) - 1)) | (uint64_t(1023) << 52));
+  if (m > 1.4142135623730951) {
+    m *= 0.5;
+    ++exponent;
+  }
+  const double s = (m - 1.0) / (m + 1.0);
+  const double s2 = s * s;
+  double term = s;
+  double sum = 0.0;
+  for (int k = 1; k < 40; k += 2) {
+    sum += term / k;
+    term *= s2;
+  }
+  return 2.0 * sum + exponent * 0.6931471805599453;
+}
+
+// |x| < 700:
+constexpr double cx_exp(double x) noexcept {
+  if (!std::is_constant_evaluated()) return std::exp(x);
+  // x = k * ln2 + r with |r| <= ln2 / 2, e^x = 2^k * e^r:
+  const double k = double(int64_t(x * 1.4426950408889634 + (x < 0.0 ? -0.5 : 0.5)));
+  const double r = x - k * 0.6931471805599453;
+  double term = 1.0;
+  double sum = 1.0;
+  for (int n = 1; n < 24; ++n) {
+    term *= r / n;
+    sum += term;
+  }
+  return sum * std::bit_cast<double>(uint64_t(int64_t(k) + 1023) << 52);
+}
+
+// x >= 0:
+constexpr double cx_pow(double x, double y) noexcept {
+  if (!std::is_constant_evaluated()) return std::pow(x, y);
+  return x > 0.0 ? cx_exp(y * cx_log(x)) : 0.0;
+}
+
+// |x| <= pi:
+constexpr double cx_cos(double x) noexcept {
+  if (!std::is_constant_evaluated()) return std::cos(x);
+  const double x2 = x * x;
+  double term = 1.0;
+  double sum = 1.0;
+  for (int n = 1; n < 16; ++n) {
+    term *= -x2 / double((2 * n - 1) * (2 * n));
+    sum += term;
+  }
+  return sum;
+}
+
+} // namespace ayan::math::detail
@@ -0,0 +1,79 @@
+#pragma once
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//          INSTRUCTION SETS AVAILABLE AT COMPILE TIME  |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// AYAN_SIMD_SSE2   - baseline of every x86-64 CPU     |
+// AYAN_SIMD_SSE41  - blendv, round, dpps              |
+// AYAN_SIMD_AVX    - 256-bit float/double registers   |
+// AYAN_SIMD_AVX2   - 256-bit integer ops              |
+// AYAN_SIMD_FMA    - fused multiply-add               |
+// AYAN_SIMD_F16C   - float <-> half conversions       |
+// AYAN_SIMD_BMI2   - pdep/pext bit scatter and gather |
+// AYAN_SIMD_AVX512 - 512-bit registers, mask registers|
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// The set is chosen by compiler flags (-msse4.1, -mavx2 -mfma, -march=native);
+// without any flags an x86-64 build gets SSE2 only, other targets get the
+// scalar fallback of simd::Pack.
+
+#if defined(__SSE2__) || defined(_M_X64)
+  #define AYAN_SIMD_SSE2 1
+#endif
+
+#if defined(__SSE4_1__)
+  #define AYAN_SIMD_SSE41 1
+#endif
+
+#if defined(__AVX__)
+  #define AYAN_SIMD_AVX 1
+#endif
+
+#if defined(__AVX2__)
+  #define AYAN_SIMD_AVX2 1
+#endif
+
+#if defined(__FMA__)
+  #define AYAN_SIMD_FMA 1
+#endif
+
+#if defined(__F16C__)
+  #define AYAN_SIMD_F16C 1
+#endif
+
+#if defined(__BMI2__)
+  #define AYAN_SIMD_BMI2 1
+#endif
+
+#if defined(__AVX512F__) && defined(__AVX512VL__)
+  #define AYAN_SIMD_AVX512 1
+#endif
+
+// Everything in ayan::math lives in an inline namespace named after the
+// instruction set above, so that translation units built with different flags
+// (the kernels of math/dispatch) never share an inline function or a template
+// instantiation. Layouts of the types don't depend on it:
+#if defined(AYAN_SIMD_AVX512)
+  #define AYAN_SIMD_NAMESPACE isa_avx512
+#elif defined(AYAN_SIMD_AVX2) && defined(AYAN_SIMD_FMA)
+  #define AYAN_SIMD_NAMESPACE isa_avx2
+#elif defined(AYAN_SIMD_AVX)
+  #define AYAN_SIMD_NAMESPACE isa_avx
+#elif defined(__SSE4_2__)
+  #define AYAN_SIMD_NAMESPACE isa_sse42
+#elif defined(AYAN_SIMD_SSE41)
+  #define AYAN_SIMD_NAMESPACE isa_sse41
+#elif defined(AYAN_SIMD_SSE2)
+  #define AYAN_SIMD_NAMESPACE isa_sse2
+#else
+  #define AYAN_SIMD_NAMESPACE isa_scalar
+#endif
+
+#if defined(AYAN_SIMD_SSE2)
+  #include <immintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+  #define AYAN_SIMD_INLINE inline __attribute__((always_inline))
+#else
+  #define AYAN_SIMD_INLINE inline
+#endif
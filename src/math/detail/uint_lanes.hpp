@@ -0,0 +1,200 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "simd.hpp"
+#include "../simd/pack.hpp"
+
+// Unsigned integer lanes of one register with just the operators the curve
+// encoders and the samplers are written with, so one template body runs on a
+// scalar uint32_t / uint64_t and on 4 or 8 lanes at once (simd::Pack has no
+// integer ops). Arithmetic wraps around like on the unsigned scalars.
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::detail {
+
+template<typename T, size_t Lanes>
+struct UintLanes;
+
+#if defined(AYAN_SIMD_SSE2)
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                  4 x uint32_t, 2 x uint64_t          |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<>
+struct UintLanes<uint32_t, 4> {
+  __m128i reg;
+
+  AYAN_SIMD_INLINE static UintLanes Broadcast(uint32_t value) noexcept { return {_mm_set1_epi32(int(value))}; }
+  AYAN_SIMD_INLINE static UintLanes LoadUnaligned(const uint32_t* src) noexcept {
+    return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))};
+  }
+  // lanes of a float pack truncated towards zero (in the int32 range):
+  AYAN_SIMD_INLINE static UintLanes Truncate(const simd::Pack<float, 4>& pack) noexcept {
+    return {_mm_cvttps_epi32(pack.native())};
+  }
+  // 4 bytes zero-extended to the lanes:
+  AYAN_SIMD_INLINE static UintLanes LoadBytes(const uint8_t* src) noexcept {
+    int bytes;
+    std::memcpy(&bytes, src, sizeof(bytes));
+#if defined(AYAN_SIMD_SSE41)
+    return {_mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes))};
+#else
+    const __m128i zero = _mm_setzero_si128();
+    return {_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero), zero)};
+#endif
+  }
+
+  AYAN_SIMD_INLINE void store_unaligned(uint32_t* dst) const noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), reg);
+  }
+};
+
+template<>
+struct UintLanes<uint64_t, 2> {
+  __m128i reg;
+
+  AYAN_SIMD_INLINE static UintLanes Broadcast(uint64_t value) noexcept { return {_mm_set1_epi64x((long long)value)}; }
+
+  AYAN_SIMD_INLINE void store_unaligned(uint64_t* dst) const noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), reg);
+  }
+};
+
+using U32x4 = UintLanes<uint32_t, 4>;
+using U64x2 = UintLanes<uint64_t, 2>;
+
+AYAN_SIMD_INLINE U32x4 operator&(U32x4 a, U32x4 b) noexcept { return {_mm_and_si128(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U32x4 operator|(U32x4 a, U32x4 b) noexcept { return {_mm_or_si128(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U32x4 operator^(U32x4 a, U32x4 b) noexcept { return {_mm_xor_si128(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U32x4 operator&(U32x4 a, uint32_t b) noexcept { return a & U32x4::Broadcast(b); }
+AYAN_SIMD_INLINE U32x4 operator^(U32x4 a, uint32_t b) noexcept { return a ^ U32x4::Broadcast(b); }
+AYAN_SIMD_INLINE U32x4 operator<<(U32x4 a, int count) noexcept { return {_mm_slli_epi32(a.reg, count)}; }
+AYAN_SIMD_INLINE U32x4 operator>>(U32x4 a, int count) noexcept { return {_mm_srli_epi32(a.reg, count)}; }
+AYAN_SIMD_INLINE U32x4 operator+(U32x4 a, U32x4 b) noexcept { return {_mm_add_epi32(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U32x4 operator-(U32x4 a, U32x4 b) noexcept { return {_mm_sub_epi32(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U32x4 operator+(U32x4 a, uint32_t b) noexcept { return a + U32x4::Broadcast(b); }
+
+AYAN_SIMD_INLINE U32x4 operator*(U32x4 a, U32x4 b) noexcept {
+#if defined(AYAN_SIMD_SSE41)
+  return {_mm_mullo_epi32(a.reg, b.reg)};
+#else
+  // low halves of the 64-bit products of the even and the odd lanes:
+  const __m128i even = _mm_mul_epu32(a.reg, b.reg);
+  const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a.reg, 4), _mm_srli_si128(b.reg, 4));
+  return {_mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+    _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)))};
+#endif
+}
+AYAN_SIMD_INLINE U32x4 operator*(U32x4 a, uint32_t b) noexcept { return a * U32x4::Broadcast(b); }
+
+// lanes below 2^31 to floats:
+AYAN_SIMD_INLINE simd::Pack<float, 4> to_float(U32x4 a) noexcept { return simd::Pack<float, 4>(_mm_cvtepi32_ps(a.reg)); }
+
+AYAN_SIMD_INLINE U64x2 operator&(U64x2 a, U64x2 b) noexcept { return {_mm_and_si128(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U64x2 operator|(U64x2 a, U64x2 b) noexcept { return {_mm_or_si128(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U64x2 operator&(U64x2 a, uint64_t b) noexcept { return a & U64x2::Broadcast(b); }
+AYAN_SIMD_INLINE U64x2 operator<<(U64x2 a, int count) noexcept { return {_mm_slli_epi64(a.reg, count)}; }
+
+// zero-extended lower and upper half of the lanes:
+AYAN_SIMD_INLINE U64x2 widen_low(U32x4 a) noexcept { return {_mm_unpacklo_epi32(a.reg, _mm_setzero_si128())}; }
+AYAN_SIMD_INLINE U64x2 widen_high(U32x4 a) noexcept { return {_mm_unpackhi_epi32(a.reg, _mm_setzero_si128())}; }
+#endif
+
+#if defined(AYAN_SIMD_AVX2)
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                  8 x uint32_t, 4 x uint64_t          |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<>
+struct UintLanes<uint32_t, 8> {
+  __m256i reg;
+
+  AYAN_SIMD_INLINE static UintLanes Broadcast(uint32_t value) noexcept { return {_mm256_set1_epi32(int(value))}; }
+  AYAN_SIMD_INLINE static UintLanes LoadUnaligned(const uint32_t* src) noexcept {
+    return {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src))};
+  }
+  AYAN_SIMD_INLINE static UintLanes Truncate(const simd::Pack<float, 8>& pack) noexcept {
+    return {_mm256_cvttps_epi32(pack.native())};
+  }
+  AYAN_SIMD_INLINE static UintLanes LoadBytes(const uint8_t* src) noexcept {
+    return {_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)))};
+  }
+
+  AYAN_SIMD_INLINE void store_unaligned(uint32_t* dst) const noexcept {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), reg);
+  }
+};
+
+template<>
+struct UintLanes<uint64_t, 4> {
+  __m256i reg;
+
+  AYAN_SIMD_INLINE static UintLanes Broadcast(uint64_t value) noexcept { return {_mm256_set1_epi64x((long long)value)}; }
+
+  AYAN_SIMD_INLINE void store_unaligned(uint64_t* dst) const noexcept {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), reg);
+  }
+};
+
+using U32x8 = UintLanes<uint32_t, 8>;
+using U64x4 = UintLanes<uint64_t, 4>;
+
+AYAN_SIMD_INLINE U32x8 operator&(U32x8 a, U32x8 b) noexcept { return {_mm256_and_si256(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U32x8 operator|(U32x8 a, U32x8 b) noexcept { return {_mm256_or_si256(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U32x8 operator^(U32x8 a, U32x8 b) noexcept { return {_mm256_xor_si256(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U32x8 operator&(U32x8 a, uint32_t b) noexcept { return a & U32x8::Broadcast(b); }
+AYAN_SIMD_INLINE U32x8 operator^(U32x8 a, uint32_t b) noexcept { return a ^ U32x8::Broadcast(b); }
+AYAN_SIMD_INLINE U32x8 operator<<(U32x8 a, int count) noexcept { return {_mm256_slli_epi32(a.reg, count)}; }
+AYAN_SIMD_INLINE U32x8 operator>>(U32x8 a, int count) noexcept { return {_mm256_srli_epi32(a.reg, count)}; }
+AYAN_SIMD_INLINE U32x8 operator+(U32x8 a, U32x8 b) noexcept { return {_mm256_add_epi32(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U32x8 operator-(U32x8 a, U32x8 b) noexcept { return {_mm256_sub_epi32(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U32x8 operator+(U32x8 a, uint32_t b) noexcept { return a + U32x8::Broadcast(b); }
+AYAN_SIMD_INLINE U32x8 operator*(U32x8 a, U32x8 b) noexcept { return {_mm256_mullo_epi32(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U32x8 operator*(U32x8 a, uint32_t b) noexcept { return a * U32x8::Broadcast(b); }
+
+AYAN_SIMD_INLINE simd::Pack<float, 8> to_float(U32x8 a) noexcept { return simd::Pack<float, 8>(_mm256_cvtepi32_ps(a.reg)); }
+
+AYAN_SIMD_INLINE U64x4 operator&(U64x4 a, U64x4 b) noexcept { return {_mm256_and_si256(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U64x4 operator|(U64x4 a, U64x4 b) noexcept { return {_mm256_or_si256(a.reg, b.reg)}; }
+AYAN_SIMD_INLINE U64x4 operator&(U64x4 a, uint64_t b) noexcept { return a & U64x4::Broadcast(b); }
+AYAN_SIMD_INLINE U64x4 operator<<(U64x4 a, int count) noexcept { return {_mm256_slli_epi64(a.reg, count)}; }
+
+AYAN_SIMD_INLINE U64x4 widen_low(U32x8 a) noexcept { return {_mm256_cvtepu32_epi64(_mm256_castsi256_si128(a.reg))}; }
+AYAN_SIMD_INLINE U64x4 widen_high(U32x8 a) noexcept { return {_mm256_cvtepu32_epi64(_mm256_extracti128_si256(a.reg, 1))}; }
+#endif
+
+// all lanes set to `value`, for the templates that also take a plain integer:
+template<typename W>
+AYAN_SIMD_INLINE constexpr W splat(uint32_t value) noexcept {
+  if constexpr (std::is_integral_v<W>) {
+    return W(value);
+  } else {
+    return W::Broadcast(value);
+  }
+}
+
+// the widest lanes of this build, 1 (plain integers) without SSE2:
+#if defined(AYAN_SIMD_AVX2)
+inline constexpr size_t uint32_lanes = 8;
+#elif defined(AYAN_SIMD_SSE2)
+inline constexpr size_t uint32_lanes = 4;
+#else
+inline constexpr size_t uint32_lanes = 1;
+#endif
+
+// `Lanes` bytes as floats, one conversion where the integer lanes exist:
+template<size_t Lanes>
+AYAN_SIMD_INLINE simd::Pack<float, Lanes> bytes_to_float(const uint8_t* src) noexcept {
+#if defined(AYAN_SIMD_AVX2)
+  if constexpr (Lanes == 8) return to_float(U32x8::LoadBytes(src));
+#endif
+#if defined(AYAN_SIMD_SSE2)
+  if constexpr (Lanes == 4) return to_float(U32x4::LoadBytes(src));
+#endif
+  alignas(sizeof(float) * Lanes) float lanes[Lanes];
+  for (size_t i = 0; i < Lanes; ++i) lanes[i] = float(src[i]);
+  return simd::Pack<float, Lanes>::Load(lanes);
+}
+
+} // namespace ayan::math::detail
@@ -2,7 +2,9 @@
 
 #include <type_traits>
 
-namespace ayan::math::detail {
+#include "simd.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::detail {
 
 template <typename T>
 concept ValidNumType = std::is_arithmetic_v<T>;
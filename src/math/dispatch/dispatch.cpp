@@ -0,0 +1,156 @@
+#include "dispatch.hpp"
+#include "kernels/kernels.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(AYAN_DISPATCH_X86)
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+  #else
+    #include <cpuid.h>
+  #endif
+#endif
+
+namespace ayan::math::dispatch {
+
+namespace {
+
+#if defined(AYAN_DISPATCH_X86)
+
+struct CpuidRegs {
+  uint32_t eax, ebx, ecx, edx;
+};
+
+CpuidRegs cpuid(uint32_t leaf, uint32_t subleaf) noexcept {
+  CpuidRegs regs{};
+#if defined(_MSC_VER)
+  int out[4];
+  __cpuidex(out, static_cast<int>(leaf), static_cast<int>(subleaf));
+  regs = {uint32_t(out[0]), uint32_t(out[1]), uint32_t(out[2]), uint32_t(out[3])};
+#else
+  __cpuid_count(leaf, subleaf, regs.eax, regs.ebx, regs.ecx, regs.edx);
+#endif
+  return regs;
+}
+
+// register state the OS saves on a context switch (XCR0):
+uint64_t os_saved_state() noexcept {
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  uint32_t lo, hi;
+  __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+  return (uint64_t(hi) << 32) | lo;
+#endif
+}
+
+bool has_bit(uint32_t reg, int bit) noexcept {
+  return (reg >> bit) & 1u;
+}
+
+// AVX needs both the instructions and an OS that saves YMM (and ZMM for
+// AVX-512) registers, a CPU may report them under an OS that doesn't:
+Level query_level() noexcept {
+  const uint32_t max_leaf = cpuid(0, 0).eax;
+  const CpuidRegs leaf1 = cpuid(1, 0);
+  if (!has_bit(leaf1.ecx, 20) || !has_bit(leaf1.ecx, 23)) return Level::Baseline; // SSE4.2, POPCNT
+
+  const bool osxsave = has_bit(leaf1.ecx, 27);
+  const bool avx = has_bit(leaf1.ecx, 28);
+  const bool fma = has_bit(leaf1.ecx, 12);
+  if (!osxsave || !avx || max_leaf < 7) return Level::SSE42;
+
+  const uint64_t xcr0 = os_saved_state();
+  if ((xcr0 & 0x6) != 0x6) return Level::SSE42; // XMM, YMM
+
+  const CpuidRegs leaf7 = cpuid(7, 0);
+  if (!has_bit(leaf7.ebx, 5) || !fma) return Level::SSE42; // AVX2
+
+  const bool avx512 = has_bit(leaf7.ebx, 16) && has_bit(leaf7.ebx, 17) // F, DQ
+    && has_bit(leaf7.ebx, 30) && has_bit(leaf7.ebx, 31);               // BW, VL
+  if (!avx512 || (xcr0 & 0xE0) != 0xE0) return Level::AVX2;            // opmask, ZMM
+
+  return Level::AVX512;
+}
+
+#else
+
+Level query_level() noexcept {
+  return Level::Baseline;
+}
+
+#endif
+
+const Kernels& table(Level level) noexcept {
+#if defined(AYAN_DISPATCH_X86)
+  switch (level) {
+    case Level::AVX512: return detail::avx512_kernels();
+    case Level::AVX2: return detail::avx2_kernels();
+    case Level::SSE42: return detail::sse42_kernels();
+    case Level::Baseline: break;
+  }
+#endif
+  return detail::baseline_kernels();
+}
+
+bool supported(Level level) noexcept {
+  return static_cast<uint8_t>(level) <= static_cast<uint8_t>(detected());
+}
+
+// AYAN_MATH_ISA, a level above detected() falls back to detected():
+Level initial_level() noexcept {
+  if (const char* env = std::getenv("AYAN_MATH_ISA")) {
+    for (Level level : {Level::Baseline, Level::SSE42, Level::AVX2, Level::AVX512}) {
+      if (std::strcmp(env, name(level)) == 0 && supported(level)) return level;
+    }
+  }
+  return detected();
+}
+
+std::atomic<const Kernels*> active_table{nullptr};
+
+} // namespace
+
+const char* name(Level level) noexcept {
+  switch (level) {
+    case Level::Baseline: return "baseline";
+    case Level::SSE42: return "sse4.2";
+    case Level::AVX2: return "avx2";
+    case Level::AVX512: return "avx512";
+  }
+  return "unknown";
+}
+
+Level detected() noexcept {
+  static const Level level = query_level();
+  return level;
+}
+
+Level active() noexcept {
+  return kernels().level;
+}
+
+bool force(Level level) noexcept {
+  if (!supported(level)) return false;
+  active_table.store(&table(level), std::memory_order_release);
+  return true;
+}
+
+void reset() noexcept {
+  active_table.store(&table(detected()), std::memory_order_release);
+}
+
+const Kernels& kernels() noexcept {
+  const Kernels* current = active_table.load(std::memory_order_acquire);
+  if (current == nullptr) {
+    // racing first calls pick the same table, a force() in between wins:
+    const Kernels* initial = &table(initial_level());
+    active_table.compare_exchange_strong(current, initial, std::memory_order_acq_rel);
+    return current != nullptr ? *current : *initial;
+  }
+  return *current;
+}
+
+} // namespace ayan::math::dispatch
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include <ayan/math/vec.hpp>
+#include <ayan/math/mat.hpp>
+#include <ayan/math/geometry.hpp>
+#include <ayan/math/transform.hpp>
+#include <ayan/math/color.hpp>
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//              RUNTIME INSTRUCTION SET DISPATCH        |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// The bulk kernels below are compiled once per level (AyanMathDispatch) and
+// the best level the CPU and the OS support is picked on the first call.
+// AYAN_MATH_ISA=baseline|sse4.2|avx2|avx512 in the environment or force()
+// selects a lower level to benchmark or reproduce results. No kernel fuses
+// a * b + c, so every level gives bit-identical results.
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// Unlike the rest of ayan::math this namespace isn't versioned by
+// AYAN_SIMD_NAMESPACE: all kernel variants register in the same table.
+
+namespace ayan::math::dispatch {
+
+enum class Level : uint8_t {
+  Baseline, // the flags AyanMathDispatch itself is built with (SSE2 on x86-64);
+  SSE42,
+  AVX2,     // + FMA, 8 floats per register;
+  AVX512    // F + VL + DQ + BW, 8-wide kernels with EVEX encoding and mask registers;
+};
+
+// "baseline", "sse4.2", "avx2", "avx512":
+const char* name(Level level) noexcept;
+
+// the best level of this CPU, queried by cpuid once:
+Level detected() noexcept;
+// the level the kernels run at:
+Level active() noexcept;
+// false (and nothing changes) if the CPU doesn't support `level`:
+bool force(Level level) noexcept;
+// back to detected(), ignores AYAN_MATH_ISA:
+void reset() noexcept;
+
+// One variant of every kernel. Arguments are plain floats, so variants built
+// with different AYAN_SIMD_NAMESPACE share it (layouts of Vec3f, Vec4f, Mat4f,
+// AABBf and Trianglef are the same in all of them).
+// `as` is a TransformAs, a ray is {origin.xyz, direction.xyz, t_min, t_max},
+// a hit is {t, u, v} and `curve` is a ToneMap over pixels of `channels` floats:
+struct Kernels {
+  Level level;
+  void (*transform_vec3)(int as, const float* matrix, const float* in, float* out, size_t count) noexcept;
+  void (*transform_vec4)(int as, const float* matrix, const float* in, float* out, size_t count) noexcept;
+  void (*multiply_mat4)(const float* a, const float* b, float* out, size_t count) noexcept;
+  size_t (*intersect_boxes)(const float* ray, const float* boxes, size_t count, float* t_entry) noexcept;
+  size_t (*intersect_triangles)(const float* ray, const float* triangles, size_t count, float* hit) noexcept;
+  void (*encode_srgb8)(int curve, float exposure, bool dither,
+    const float* in, size_t channels, size_t count, size_t width, uint8_t* out) noexcept;
+};
+
+// kernels of active():
+const Kernels& kernels() noexcept;
+
+// ----- ----- ---- Kernels ----- ----- ----
+// The spans passed to one kernel must be of the same size, std::invalid_argument
+// is thrown otherwise.
+
+// the same as math::transform_batch (float only, `out` may be the same span as `in`):
+template<TransformAs As>
+void transform_batch(const Mat4f& matrix,
+  std::span<const Vec3f> in, std::span<Vec3f> out);
+
+template<TransformAs As>
+void transform_batch(const Mat4f& matrix,
+  std::span<const Vec4f> in, std::span<Vec4f> out);
+
+// out[i] = a[i] * b[i]:
+inline void multiply(std::span<const Mat4f> a, std::span<const Mat4f> b, std::span<Mat4f> out);
+
+// Slab test of `ray` against every box, t_entry[i] is the entry distance or +inf
+// on a miss. Returns the number of boxes hit:
+inline size_t intersect(const Rayf& ray, std::span<const AABBf> boxes, std::span<float> t_entry);
+
+// Closest watertight hit of `ray` among `triangles` within [t_min, t_max].
+// Returns its index (triangles.size() on a miss), `hit` is written only on a hit:
+inline size_t intersect(const Rayf& ray, std::span<const Trianglef> triangles, TriangleHit<float>& hit) noexcept;
+
+// the same as math::encode_srgb8 (one thread):
+inline void encode_srgb8(const ToneMapSettings& settings,
+  std::span<const RGBf> in, size_t width, std::span<RGBA8> out);
+
+inline void encode_srgb8(const ToneMapSettings& settings,
+  std::span<const RGBAf> in, size_t width, std::span<RGBA8> out);
+
+} // namespace ayan::math::dispatch
+
+#include "impl/dispatch.hpp"
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+#include "../dispatch.hpp"
+
+namespace ayan::math::dispatch {
+
+namespace detail {
+
+// the kernels see the arrays as plain floats:
+static_assert(sizeof(Vec3f) == 3 * sizeof(float) && sizeof(Vec4f) == 4 * sizeof(float));
+static_assert(sizeof(Mat4f) == 16 * sizeof(float));
+static_assert(sizeof(AABBf) == 6 * sizeof(float) && sizeof(Trianglef) == 9 * sizeof(float));
+
+// the kernels can't throw, the wrappers check their arguments:
+inline void check_sizes(const char* kernel, size_t in, size_t out) {
+  if (in != out) throw std::invalid_argument(std::string("[") + kernel + "]: the spans must be of the same size");
+}
+
+// math::encode_srgb8 rejects the same images:
+inline void check_encode_width(size_t count, size_t width) {
+  if (count != 0 && width == 0) throw std::invalid_argument("[encode_srgb8]: an image with pixels cannot be 0 pixels wide");
+}
+static_assert(sizeof(RGBf) == 3 * sizeof(float) && sizeof(RGBAf) == 4 * sizeof(float) && sizeof(RGBA8) == 4);
+
+inline void pack_ray(const Rayf& ray, float (&out)[8]) noexcept {
+  out[0] = ray.origin().x();
+  out[1] = ray.origin().y();
+  out[2] = ray.origin().z();
+  out[3] = ray.direction().x();
+  out[4] = ray.direction().y();
+  out[5] = ray.direction().z();
+  out[6] = ray.t_min();
+  out[7] = ray.t_max();
+}
+
+} // namespace detail
+
+// ----- ----- ---- Kernels ----- ----- ----
+template<TransformAs As>
+void transform_batch(const Mat4f& matrix,
+  std::span<const Vec3f> in, std::span<Vec3f> out)
+{
+  detail::check_sizes("transform_batch", in.size(), out.size());
+  kernels().transform_vec3(static_cast<int>(As), &matrix(0, 0),
+    reinterpret_cast<const float*>(in.data()), reinterpret_cast<float*>(out.data()), in.size());
+}
+
+template<TransformAs As>
+void transform_batch(const Mat4f& matrix,
+  std::span<const Vec4f> in, std::span<Vec4f> out)
+{
+  detail::check_sizes("transform_batch", in.size(), out.size());
+  kernels().transform_vec4(static_cast<int>(As), &matrix(0, 0),
+    reinterpret_cast<const float*>(in.data()), reinterpret_cast<float*>(out.data()), in.size());
+}
+
+inline void multiply(std::span<const Mat4f> a, std::span<const Mat4f> b, std::span<Mat4f> out) {
+  detail::check_sizes("multiply", a.size(), b.size());
+  detail::check_sizes("multiply", a.size(), out.size());
+  kernels().multiply_mat4(reinterpret_cast<const float*>(a.data()),
+    reinterpret_cast<const float*>(b.data()), reinterpret_cast<float*>(out.data()), a.size());
+}
+
+inline size_t intersect(const Rayf& ray, std::span<const AABBf> boxes, std::span<float> t_entry) {
+  detail::check_sizes("intersect", boxes.size(), t_entry.size());
+  float packed[8];
+  detail::pack_ray(ray, packed);
+  return kernels().intersect_boxes(packed,
+    reinterpret_cast<const float*>(boxes.data()), boxes.size(), t_entry.data());
+}
+
+inline size_t intersect(const Rayf& ray, std::span<const Trianglef> triangles, TriangleHit<float>& hit) noexcept {
+  float packed[8];
+  detail::pack_ray(ray, packed);
+  float packed_hit[3];
+  const size_t index = kernels().intersect_triangles(packed,
+    reinterpret_cast<const float*>(triangles.data()), triangles.size(), packed_hit);
+  if (index != triangles.size()) {
+    hit = TriangleHit<float>{packed_hit[0], packed_hit[1], packed_hit[2]};
+  }
+  return index;
+}
+
+inline void encode_srgb8(const ToneMapSettings& settings,
+  std::span<const RGBf> in, size_t width, std::span<RGBA8> out)
+{
+  detail::check_encode_width(in.size(), width);
+  kernels().encode_srgb8(static_cast<int>(settings.curve), settings.exposure, settings.dither,
+    reinterpret_cast<const float*>(in.data()), 3, in.size(), width, reinterpret_cast<uint8_t*>(out.data()));
+}
+
+inline void encode_srgb8(const ToneMapSettings& settings,
+  std::span<const RGBAf> in, size_t width, std::span<RGBA8> out)
+{
+  detail::check_encode_width(in.size(), width);
+  kernels().encode_srgb8(static_cast<int>(settings.curve), settings.exposure, settings.dither,
+    reinterpret_cast<const float*>(in.data()), 4, in.size(), width, reinterpret_cast<uint8_t*>(out.data()));
+}
+
+} // namespace ayan::math::dispatch
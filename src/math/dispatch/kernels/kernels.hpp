@@ -0,0 +1,14 @@
+#pragma once
+
+#include "../dispatch.hpp"
+
+namespace ayan::math::dispatch::detail {
+
+// Tables of the variants, each one is defined by kernels.inl in its own
+// translation unit built with the flags of the level:
+const Kernels& baseline_kernels() noexcept;
+const Kernels& sse42_kernels() noexcept;
+const Kernels& avx2_kernels() noexcept;
+const Kernels& avx512_kernels() noexcept;
+
+} // namespace ayan::math::dispatch::detail
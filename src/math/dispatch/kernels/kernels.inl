@@ -0,0 +1,145 @@
+// Body of every kernels_<level>.cpp, the including file defines:
+//   AYAN_DISPATCH_TABLE - name of the table function declared in kernels.hpp;
+//   AYAN_DISPATCH_LEVEL - the Level it reports;
+//   AYAN_DISPATCH_LANES - width of the box and triangle packets.
+// The math headers are compiled here with the flags of the level, so they land
+// in their own AYAN_SIMD_NAMESPACE; the kernels have internal linkage. Inline
+// functions outside it (std:: templates) are still weak symbols shared with the
+// other levels, the build makes them local to each kernel object (objcopy, see
+// src/math/CMakeLists.txt) and the DispatchIsolation test checks the library.
+
+#include <bit>
+#include <limits>
+
+#include "kernels.hpp"
+
+namespace ayan::math::dispatch {
+
+namespace {
+
+constexpr size_t kLanes = AYAN_DISPATCH_LANES;
+
+using BoxPacket = AABBx<kLanes, float>;
+using TrianglePacket = TriangleX<kLanes, float>;
+
+Rayf unpack_ray(const float* ray) noexcept {
+  return Rayf(Vec3f(ray[0], ray[1], ray[2]), Vec3f(ray[3], ray[4], ray[5]), ray[6], ray[7]);
+}
+
+template<typename VecT>
+void transform_kernel(int as, const float* matrix, const float* in, float* out, size_t count) noexcept {
+  const Mat4f& m = *reinterpret_cast<const Mat4f*>(matrix);
+  const std::span<const VecT> src(reinterpret_cast<const VecT*>(in), count);
+  const std::span<VecT> dst(reinterpret_cast<VecT*>(out), count);
+  switch (static_cast<TransformAs>(as)) {
+    case TransformAs::Point: math::transform_batch<TransformAs::Point, float>(m, src, dst); break;
+    case TransformAs::Vector: math::transform_batch<TransformAs::Vector, float>(m, src, dst); break;
+    case TransformAs::Normal: math::transform_batch<TransformAs::Normal, float>(m, src, dst); break;
+  }
+}
+
+void multiply_kernel(const float* a, const float* b, float* out, size_t count) noexcept {
+  const Mat4f* lhs = reinterpret_cast<const Mat4f*>(a);
+  const Mat4f* rhs = reinterpret_cast<const Mat4f*>(b);
+  Mat4f* dst = reinterpret_cast<Mat4f*>(out);
+  for (size_t i = 0; i < count; ++i) dst[i] = lhs[i] * rhs[i];
+}
+
+size_t boxes_kernel(const float* ray_data, const float* boxes, size_t count, float* t_entry) noexcept {
+  const Rayf ray = unpack_ray(ray_data);
+  const AABBf* src = reinterpret_cast<const AABBf*>(boxes);
+  const simd::Pack<float, kLanes> miss(std::numeric_limits<float>::infinity());
+
+  size_t hits = 0;
+  size_t i = 0;
+  for (; i + kLanes <= count; i += kLanes) {
+    simd::Pack<float, kLanes> t;
+    const auto mask = BoxPacket::Load(src + i).intersect(ray, t);
+    simd::select(mask, t, miss).store_unaligned(t_entry + i);
+    hits += std::popcount(mask.bits());
+  }
+  for (; i < count; ++i) {
+    float t;
+    if (src[i].intersect(ray, t)) {
+      t_entry[i] = t;
+      ++hits;
+    } else {
+      t_entry[i] = std::numeric_limits<float>::infinity();
+    }
+  }
+  return hits;
+}
+
+size_t triangles_kernel(const float* ray_data, const float* triangles, size_t count, float* hit) noexcept {
+  Rayf ray = unpack_ray(ray_data);
+  const Trianglef* src = reinterpret_cast<const Trianglef*>(triangles);
+
+  // t_max shrinks to the closest hit, so a later hit is strictly closer
+  // or at the same t (ties keep the lowest index):
+  size_t closest = count;
+  TriangleHit<float> best{};
+  auto accept = [&](size_t index, const TriangleHit<float>& candidate) {
+    if (closest != count && !(candidate.t < best.t)) return;
+    closest = index;
+    best = candidate;
+    ray.set_t_max(candidate.t);
+  };
+
+  size_t i = 0;
+  for (; i + kLanes <= count; i += kLanes) {
+    TriangleHitX<kLanes, float> packet_hit;
+    for (uint32_t bits = TrianglePacket::Load(src + i).intersect(ray, packet_hit).bits(); bits != 0; bits &= bits - 1) {
+      const size_t lane = std::countr_zero(bits);
+      accept(i + lane, TriangleHit<float>{packet_hit.t[lane], packet_hit.u[lane], packet_hit.v[lane]});
+    }
+  }
+  for (; i < count; ++i) {
+    TriangleHit<float> candidate;
+    if (src[i].intersect(ray, candidate)) accept(i, candidate);
+  }
+
+  if (closest != count) {
+    hit[0] = best.t;
+    hit[1] = best.u;
+    hit[2] = best.v;
+  }
+  return closest;
+}
+
+template<typename PixelT>
+void encode_pixels(const ToneMapSettings& settings, const float* in, size_t count, size_t width, uint8_t* out) noexcept {
+  math::encode_srgb8(settings, std::span<const PixelT>(reinterpret_cast<const PixelT*>(in), count),
+    width, std::span<RGBA8>(reinterpret_cast<RGBA8*>(out), count));
+}
+
+void encode_kernel(int curve, float exposure, bool dither,
+  const float* in, size_t channels, size_t count, size_t width, uint8_t* out) noexcept
+{
+  const ToneMapSettings settings{ static_cast<ToneMap>(curve), exposure, dither };
+  if (channels == 4) {
+    encode_pixels<RGBAf>(settings, in, count, width, out);
+  } else {
+    encode_pixels<RGBf>(settings, in, count, width, out);
+  }
+}
+
+} // namespace
+
+namespace detail {
+
+const Kernels& AYAN_DISPATCH_TABLE() noexcept {
+  static constexpr Kernels table{
+    Level::AYAN_DISPATCH_LEVEL,
+    &transform_kernel<Vec3f>,
+    &transform_kernel<Vec4f>,
+    &multiply_kernel,
+    &boxes_kernel,
+    &triangles_kernel,
+    &encode_kernel
+  };
+  return table;
+}
+
+} // namespace detail
+
+} // namespace ayan::math::dispatch
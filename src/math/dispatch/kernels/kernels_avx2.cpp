@@ -0,0 +1,5 @@
+#define AYAN_DISPATCH_TABLE avx2_kernels
+#define AYAN_DISPATCH_LEVEL AVX2
+#define AYAN_DISPATCH_LANES 8
+
+#include "kernels.inl"
@@ -0,0 +1,5 @@
+#define AYAN_DISPATCH_TABLE baseline_kernels
+#define AYAN_DISPATCH_LEVEL Baseline
+#define AYAN_DISPATCH_LANES 4
+
+#include "kernels.inl"
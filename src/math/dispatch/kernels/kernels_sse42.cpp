@@ -0,0 +1,5 @@
+#define AYAN_DISPATCH_TABLE sse42_kernels
+#define AYAN_DISPATCH_LEVEL SSE42
+#define AYAN_DISPATCH_LANES 4
+
+#include "kernels.inl"
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <limits>
+
+#include <ayan/math/vec.hpp>
+#include "fwd.hpp"
+#include "ray.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+// 1 + 2 * gamma(3): the far slab distance is scaled up by it so that rounding
+// in (corner - origin) * inv_dir can't turn a grazing hit into a miss:
+template<typename NumT>
+inline constexpr NumT slab_far_scale = NumT(1) + NumT(2) *
+  (NumT(3) * std::numeric_limits<NumT>::epsilon() * NumT(0.5)) /
+  (NumT(1) - NumT(3) * std::numeric_limits<NumT>::epsilon() * NumT(0.5));
+
+} // namespace detail
+
+// Axis-aligned bounding box. A default constructed box is empty
+// (min = +inf, max = -inf): extending it by anything gives that thing's bounds:
+template<typename NumT> requires (std::floating_point<NumT>)
+class AABB {
+private: // Fields:
+  // min and max, indexed by Ray::sign() to pick the entry corner:
+  Vec3<NumT> corners[2];
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  constexpr AABB() noexcept;
+  constexpr AABB(const Vec3<NumT>& min, const Vec3<NumT>& max) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  static constexpr AABB Empty() noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  constexpr const Vec3<NumT>& min() const noexcept;
+  constexpr const Vec3<NumT>& max() const noexcept;
+  // 0 - min, 1 - max:
+  constexpr const Vec3<NumT>& corner(size_t index) const noexcept;
+
+  // ----- ----- ---- Properties ----- ----- ----
+  constexpr bool is_empty() const noexcept;
+  constexpr bool contains(const Vec3<NumT>& point) const noexcept;
+  constexpr Vec3<NumT> center() const noexcept;
+  // max - min:
+  constexpr Vec3<NumT> extent() const noexcept;
+  constexpr NumT surface_area() const noexcept;
+  constexpr size_t largest_axis() const noexcept;
+
+  // ----- ----- ---- Modifiers ----- ----- ----
+  constexpr AABB& extend(const Vec3<NumT>& point) noexcept;
+  constexpr AABB& extend(const AABB& box) noexcept;
+
+  // ----- ----- ---- Intersection ----- ----- ----
+  // slab test against [ray.t_min(), ray.t_max()], scalar reference of AABBx::intersect:
+  bool intersect(const Ray<NumT>& ray, NumT& t_entry) const noexcept;
+};
+
+// bounds of both boxes:
+template<typename NumT>
+constexpr AABB<NumT> merge(const AABB<NumT>& a, const AABB<NumT>& b) noexcept;
+
+} // namespace ayan::math
+
+#include "impl/aabb.hpp"
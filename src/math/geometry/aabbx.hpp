@@ -0,0 +1,52 @@
+#pragma once
+
+#include <ayan/math/vec.hpp>
+#include "fwd.hpp"
+#include "aabb.hpp"
+#include "ray.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// SoA packet of `Lanes` boxes, the node layout of a wide BVH.
+// Unused lanes hold empty boxes, which are never hit:
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+class AABBx {
+public: // Types:
+  using pack_type = simd::Pack<NumT, Lanes>;
+  using mask_type = simd::Mask<NumT, Lanes>;
+  using packet_type = Vec3x<Lanes, NumT>;
+  static constexpr size_t lanes = Lanes;
+
+private: // Fields:
+  // min and max, indexed by Ray::sign() to pick the entry corner:
+  packet_type corners[2];
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  // `Lanes` empty boxes:
+  AABBx() noexcept;
+  AABBx(const packet_type& min, const packet_type& max) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // `Lanes` consecutive boxes starting at `src`:
+  static AABBx Load(const AABB<NumT>* src) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  const packet_type& min() const noexcept;
+  const packet_type& max() const noexcept;
+  const packet_type& corner(size_t index) const noexcept;
+
+  AABB<NumT> lane(size_t index) const noexcept;
+  void set_lane(size_t index, const AABB<NumT>& box) noexcept;
+
+  // ----- ----- ---- Intersection ----- ----- ----
+  // Slab test of one ray against all lanes, no branches. Lane `i` of the mask is set
+  // if the ray enters box `i` within [ray.t_min(), ray.t_max()], t_entry[i] is
+  // the entry distance (meaningful only for the set lanes). NaNs from
+  // 0 * inf are dropped by the operand order of min/max:
+  mask_type intersect(const Ray<NumT>& ray, pack_type& t_entry) const noexcept;
+};
+
+} // namespace ayan::math
+
+#include "impl/aabbx.hpp"
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include <ayan/math/vec.hpp>
+#include <ayan/math/mat.hpp>
+#include "fwd.hpp"
+#include "aabb.hpp"
+#include "aabbx.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// Depth range of the clip space a projection maps the visible volume to:
+enum class ClipDepth {
+  NegativeOneToOne, // OpenGL: -w <= z <= w;
+  ZeroToOne         // Direct3D, Vulkan, Metal (also reversed-Z): 0 <= z <= w;
+};
+
+// The 6 planes bounding the volume a view-projection matrix maps into clip
+// space. A plane is (n, d) with n pointing inside, so n.p + d >= 0 for the
+// points in its half-space:
+template<typename NumT> requires (std::floating_point<NumT>)
+class Frustum {
+public: // Types:
+  enum Side : size_t { Left, Right, Bottom, Top, Near, Far };
+
+private: // Fields:
+  // indexed by Side, unit normals:
+  std::array<Vec4<NumT>, 6> planes;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  // the planes are normalized, a plane with a zero normal becomes (0, 0, 0, 1)
+  // and keeps every point inside:
+  explicit Frustum(const std::array<Vec4<NumT>, 6>& planes) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // Gribb-Hartmann: each plane is row 3 of `view_proj` plus or minus one of the
+  // other rows (column vectors, clip = view_proj * (p, 1)). The planes are in
+  // the space `view_proj` maps from: world space for projection * view:
+  static Frustum FromViewProjection(const Mat4<NumT>& view_proj, ClipDepth depth = ClipDepth::ZeroToOne) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  constexpr const Vec4<NumT>& plane(size_t side) const noexcept;
+
+  // ----- ----- ---- Queries ----- ----- ----
+  constexpr NumT signed_distance(size_t side, const Vec3<NumT>& point) const noexcept;
+  constexpr bool contains(const Vec3<NumT>& point) const noexcept;
+
+  // false only if the box is entirely behind one of the planes (its corner
+  // farthest along the normal is outside). Conservative: a box off a corner of
+  // the frustum can straddle every plane and still pass. Empty boxes never pass:
+  constexpr bool intersects(const AABB<NumT>& box) const noexcept;
+
+  // the same test for all lanes, no branches:
+  template<size_t Lanes>
+  simd::Mask<NumT, Lanes> intersects(const AABBx<Lanes, NumT>& boxes) const noexcept;
+};
+
+// ----- ----- ---- Culling ----- ----- ----
+// Writes the indices of the boxes passing Frustum::intersects() to `visible`
+// in increasing order and returns their count. `visible` must hold as many
+// elements as there are boxes.
+
+// AoS, 8 (float, AVX) or 4 boxes per iteration, each group is transposed to an
+// AABBx on load:
+template<typename NumT> requires (std::floating_point<NumT>)
+size_t frustum_cull(const Frustum<NumT>& frustum,
+  std::type_identity_t<std::span<const AABB<NumT>>> boxes,
+  std::span<uint32_t> visible) noexcept;
+
+// SoA, one packet per iteration and no transposition (bounds kept in AABBx8
+// packets for this pass). Box `lane` of boxes[i] has the index i * Lanes + lane,
+// empty padding lanes are never visible:
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+size_t frustum_cull(const Frustum<NumT>& frustum,
+  std::type_identity_t<std::span<const AABBx<Lanes, NumT>>> boxes,
+  std::span<uint32_t> visible) noexcept;
+
+} // namespace ayan::math
+
+#include "impl/frustum.hpp"
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+
+#include "../detail/simd.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+template<typename NumT> requires (std::floating_point<NumT>)
+class Ray;
+
+template<typename NumT> requires (std::floating_point<NumT>)
+class AABB;
+
+// SoA packet of `Lanes` boxes:
+template<size_t Lanes, typename NumT = float> requires (std::floating_point<NumT>)
+class AABBx;
+
+// SoA packet of `Lanes` rays:
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+class RayX;
+
+template<typename NumT> requires (std::floating_point<NumT>)
+class Triangle;
+
+// SoA packet of `Lanes` triangles:
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+class TriangleX;
+
+template<typename NumT> requires (std::floating_point<NumT>)
+class Frustum;
+
+using Rayf = Ray<float>;
+using Rayd = Ray<double>;
+
+using AABBf = AABB<float>;
+using AABBd = AABB<double>;
+
+template<typename NumT> using AABBx4 = AABBx<4, NumT>;
+template<typename NumT> using AABBx8 = AABBx<8, NumT>;
+
+using AABBx4f = AABBx4<float>;
+using AABBx4d = AABBx4<double>;
+using AABBx8f = AABBx8<float>;
+
+using Frustumf = Frustum<float>;
+using Frustumd = Frustum<double>;
+
+} // namespace ayan::math
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <limits>
+
+#include "../aabb.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr AABB<NumT>::AABB() noexcept : corners{
+  Vec3<NumT>(std::numeric_limits<NumT>::infinity(), std::numeric_limits<NumT>::infinity(), std::numeric_limits<NumT>::infinity()),
+  Vec3<NumT>(-std::numeric_limits<NumT>::infinity(), -std::numeric_limits<NumT>::infinity(), -std::numeric_limits<NumT>::infinity())
+} {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr AABB<NumT>::AABB(const Vec3<NumT>& min, const Vec3<NumT>& max) noexcept : corners{min, max} {}
+
+// ----- ----- ---- Static member funcs ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr AABB<NumT> AABB<NumT>::Empty() noexcept {
+  return AABB();
+}
+
+// ----- ----- ---- Element access ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const Vec3<NumT>& AABB<NumT>::min() const noexcept { return corners[0]; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const Vec3<NumT>& AABB<NumT>::max() const noexcept { return corners[1]; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const Vec3<NumT>& AABB<NumT>::corner(size_t index) const noexcept { return corners[index]; }
+
+// ----- ----- ---- Properties ----- ----- ----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr bool AABB<NumT>::is_empty() const noexcept {
+  return corners[0].x() > corners[1].x() || corners[0].y() > corners[1].y() || corners[0].z() > corners[1].z();
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr bool AABB<NumT>::contains(const Vec3<NumT>& point) const noexcept {
+  return
+    point.x() >= corners[0].x() && point.x() <= corners[1].x() &&
+    point.y() >= corners[0].y() && point.y() <= corners[1].y() &&
+    point.z() >= corners[0].z() && point.z() <= corners[1].z();
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Vec3<NumT> AABB<NumT>::center() const noexcept {
+  return (corners[0] + corners[1]) * NumT(0.5);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Vec3<NumT> AABB<NumT>::extent() const noexcept {
+  return corners[1] - corners[0];
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT AABB<NumT>::surface_area() const noexcept {
+  if (is_empty()) return NumT(0);
+  const Vec3<NumT> e = extent();
+  return NumT(2) * (e.x() * e.y() + e.y() * e.z() + e.z() * e.x());
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr size_t AABB<NumT>::largest_axis() const noexcept {
+  const Vec3<NumT> e = extent();
+  if (e.x() >= e.y() && e.x() >= e.z()) return 0;
+  return e.y() >= e.z() ? 1 : 2;
+}
+
+// ----- ----- ---- Modifiers ----- ----- ----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr AABB<NumT>& AABB<NumT>::extend(const Vec3<NumT>& point) noexcept {
+  for (size_t axis = 0; axis < 3; ++axis) {
+    corners[0][axis] = point[axis] < corners[0][axis] ? point[axis] : corners[0][axis];
+    corners[1][axis] = point[axis] > corners[1][axis] ? point[axis] : corners[1][axis];
+  }
+  return *this;
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr AABB<NumT>& AABB<NumT>::extend(const AABB& box) noexcept {
+  for (size_t axis = 0; axis < 3; ++axis) {
+    corners[0][axis] = box.corners[0][axis] < corners[0][axis] ? box.corners[0][axis] : corners[0][axis];
+    corners[1][axis] = box.corners[1][axis] > corners[1][axis] ? box.corners[1][axis] : corners[1][axis];
+  }
+  return *this;
+}
+
+// ----- ----- ---- Intersection ----- ----- ----
+template<typename NumT> requires (std::floating_point<NumT>)
+bool AABB<NumT>::intersect(const Ray<NumT>& ray, NumT& t_entry) const noexcept {
+  NumT t0 = ray.t_min();
+  NumT t1 = ray.t_max();
+  for (size_t axis = 0; axis < 3; ++axis) {
+    const size_t sign = ray.sign(axis);
+    const NumT t_near = (corners[sign][axis] - ray.origin()[axis]) * ray.inv_direction()[axis];
+    const NumT t_far = (corners[1 - sign][axis] - ray.origin()[axis]) * ray.inv_direction()[axis] * detail::slab_far_scale<NumT>;
+    // 0 * inf is NaN (origin on a slab plane of an axis-parallel ray): the comparisons
+    // are false for NaN, so the running interval is kept, the same as maxps/minps:
+    t0 = t_near > t0 ? t_near : t0;
+    t1 = t_far < t1 ? t_far : t1;
+  }
+  t_entry = t0;
+  return t0 <= t1;
+}
+
+template<typename NumT>
+constexpr AABB<NumT> merge(const AABB<NumT>& a, const AABB<NumT>& b) noexcept {
+  AABB<NumT> result = a;
+  return result.extend(b);
+}
+
+} // namespace ayan::math
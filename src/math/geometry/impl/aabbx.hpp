@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../aabbx.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+AABBx<Lanes, NumT>::AABBx() noexcept
+  : corners{packet_type(AABB<NumT>::Empty().min()), packet_type(AABB<NumT>::Empty().max())} {}
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+AABBx<Lanes, NumT>::AABBx(const packet_type& min, const packet_type& max) noexcept : corners{min, max} {}
+
+// ----- ----- ---- Static member funcs ---- ----- -----
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+AABBx<Lanes, NumT> AABBx<Lanes, NumT>::Load(const AABB<NumT>* src) noexcept {
+  // AABB is a pair of Vec3, min of box `i` is the (2 * i)-th Vec3:
+  static_assert(sizeof(AABB<NumT>) == 2 * sizeof(Vec3<NumT>));
+  return AABBx(packet_type::LoadStrided(&src->min(), 2), packet_type::LoadStrided(&src->max(), 2));
+}
+
+// ----- ----- ---- Element access ---- ----- -----
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+const Vec3x<Lanes, NumT>& AABBx<Lanes, NumT>::min() const noexcept { return corners[0]; }
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+const Vec3x<Lanes, NumT>& AABBx<Lanes, NumT>::max() const noexcept { return corners[1]; }
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+const Vec3x<Lanes, NumT>& AABBx<Lanes, NumT>::corner(size_t index) const noexcept { return corners[index]; }
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+AABB<NumT> AABBx<Lanes, NumT>::lane(size_t index) const noexcept {
+  return AABB<NumT>(corners[0].lane(index), corners[1].lane(index));
+}
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+void AABBx<Lanes, NumT>::set_lane(size_t index, const AABB<NumT>& box) noexcept {
+  corners[0].set_lane(index, box.min());
+  corners[1].set_lane(index, box.max());
+}
+
+// ----- ----- ---- Intersection ----- ----- ----
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+simd::Mask<NumT, Lanes> AABBx<Lanes, NumT>::intersect(const Ray<NumT>& ray, pack_type& t_entry) const noexcept {
+  const pack_type far_scale(detail::slab_far_scale<NumT>);
+  pack_type t0(ray.t_min());
+  pack_type t1(ray.t_max());
+
+  // the sign of the ray picks the near corner per axis, an index and not a branch:
+  auto slab = [&](const pack_type& near_plane, const pack_type& far_plane, NumT origin, NumT inv_dir) {
+    const pack_type o(origin);
+    const pack_type inv(inv_dir);
+    // max(x, t0) / min(x, t1) return t0 / t1 if x is NaN:
+    t0 = simd::max((near_plane - o) * inv, t0);
+    t1 = simd::min((far_plane - o) * inv * far_scale, t1);
+  };
+  const size_t sx = ray.sign(0);
+  const size_t sy = ray.sign(1);
+  const size_t sz = ray.sign(2);
+  slab(corners[sx].x(), corners[1 - sx].x(), ray.origin().x(), ray.inv_direction().x());
+  slab(corners[sy].y(), corners[1 - sy].y(), ray.origin().y(), ray.inv_direction().y());
+  slab(corners[sz].z(), corners[1 - sz].z(), ray.origin().z(), ray.inv_direction().z());
+
+  t_entry = t0;
+  return t0 <= t1;
+}
+
+} // namespace ayan::math
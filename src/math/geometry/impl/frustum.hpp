@@ -0,0 +1,165 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+
+#include "../frustum.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+Frustum<NumT>::Frustum(const std::array<Vec4<NumT>, 6>& planes) noexcept : planes(planes) {
+  for (Vec4<NumT>& plane : this->planes) {
+    const NumT normal_length = std::sqrt(plane.x() * plane.x() + plane.y() * plane.y() + plane.z() * plane.z());
+    // a zero normal (the far plane of an infinite projection) bounds nothing:
+    plane = normal_length > NumT(0) ? plane / normal_length : Vec4<NumT>::UnitW();
+  }
+}
+
+// ----- ----- ---- Static member funcs ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+Frustum<NumT> Frustum<NumT>::FromViewProjection(const Mat4<NumT>& view_proj, ClipDepth depth) noexcept {
+  // -w <= x <= w is (row3 + row0).p >= 0 and (row3 - row0).p >= 0, the same for y and z:
+  const Vec4<NumT> r0 = view_proj.template row<0>();
+  const Vec4<NumT> r1 = view_proj.template row<1>();
+  const Vec4<NumT> r2 = view_proj.template row<2>();
+  const Vec4<NumT> r3 = view_proj.template row<3>();
+  return Frustum({
+    r3 + r0, r3 - r0,
+    r3 + r1, r3 - r1,
+    depth == ClipDepth::NegativeOneToOne ? r3 + r2 : r2, r3 - r2
+  });
+}
+
+// ----- ----- ---- Element access ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const Vec4<NumT>& Frustum<NumT>::plane(size_t side) const noexcept { return planes[side]; }
+
+// ----- ----- ---- Queries ----- ----- ----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT Frustum<NumT>::signed_distance(size_t side, const Vec3<NumT>& point) const noexcept {
+  const Vec4<NumT>& p = planes[side];
+  return p.x() * point.x() + p.y() * point.y() + p.z() * point.z() + p.w();
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr bool Frustum<NumT>::contains(const Vec3<NumT>& point) const noexcept {
+  for (size_t side = 0; side < 6; ++side) {
+    if (signed_distance(side, point) < NumT(0)) return false;
+  }
+  return true;
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr bool Frustum<NumT>::intersects(const AABB<NumT>& box) const noexcept {
+  for (const Vec4<NumT>& p : planes) {
+    // the corner farthest along the normal, max where the normal is positive:
+    const NumT distance =
+      p.x() * box.corner(p.x() >= NumT(0)).x() +
+      p.y() * box.corner(p.y() >= NumT(0)).y() +
+      p.z() * box.corner(p.z() >= NumT(0)).z() + p.w();
+    // written so that NaN (0 * inf of an empty box) is outside:
+    if (!(distance >= NumT(0))) return false;
+  }
+  return true;
+}
+
+namespace detail {
+
+// planes of a Frustum broadcast over `Lanes` lanes together with the index of
+// the farthest corner per axis, hoisted out of culling loops:
+template<size_t Lanes, typename NumT>
+class BroadcastFrustum {
+public: // Types:
+  using pack_type = simd::Pack<NumT, Lanes>;
+  using mask_type = simd::Mask<NumT, Lanes>;
+
+private: // Fields:
+  pack_type coefs[6][4]; // [side][x, y, z, d]
+  uint8_t corners[6][3]; // [side][axis], 1 where the normal is positive (max)
+
+public: // Member functions:
+  explicit BroadcastFrustum(const Frustum<NumT>& frustum) noexcept {
+    for (size_t side = 0; side < 6; ++side) {
+      const Vec4<NumT>& p = frustum.plane(side);
+      for (size_t i = 0; i < 4; ++i) coefs[side][i] = pack_type(p[i]);
+      for (size_t axis = 0; axis < 3; ++axis) corners[side][axis] = p[axis] >= NumT(0);
+    }
+  }
+
+  // the farthest corner is picked by an index per axis, as in AABBx::intersect():
+  mask_type intersects(const AABBx<Lanes, NumT>& boxes) const noexcept {
+    mask_type inside(true);
+    for (size_t side = 0; side < 6; ++side) {
+      // no FMA, the sum in the order of the scalar test so both agree on the boundary:
+      pack_type distance = coefs[side][0] * boxes.corner(corners[side][0]).x();
+      distance = distance + coefs[side][1] * boxes.corner(corners[side][1]).y();
+      distance = distance + coefs[side][2] * boxes.corner(corners[side][2]).z();
+      distance = distance + coefs[side][3];
+      inside &= distance >= pack_type::Zero();
+    }
+    return inside;
+  }
+};
+
+// appends base + i for every set bit i. A loop over the set bits measured faster
+// than storing every lane and advancing the output by its bit:
+inline size_t append_indices(uint32_t bits, uint32_t base, uint32_t* out) noexcept {
+  size_t count = 0;
+  for (; bits != 0; bits &= bits - 1) out[count++] = base + uint32_t(std::countr_zero(bits));
+  return count;
+}
+
+// widest native pack for NumT:
+template<typename NumT>
+inline constexpr size_t cull_lanes = simd::IsNative<NumT, 8> ? 8 : 4;
+
+} // namespace detail
+
+template<typename NumT> requires (std::floating_point<NumT>)
+template<size_t Lanes>
+simd::Mask<NumT, Lanes> Frustum<NumT>::intersects(const AABBx<Lanes, NumT>& boxes) const noexcept {
+  return detail::BroadcastFrustum<Lanes, NumT>(*this).intersects(boxes);
+}
+
+// ----- ----- ---- Culling ----- ----- ----
+template<typename NumT> requires (std::floating_point<NumT>)
+size_t frustum_cull(const Frustum<NumT>& frustum,
+  std::type_identity_t<std::span<const AABB<NumT>>> boxes,
+  std::span<uint32_t> visible) noexcept
+{
+  constexpr size_t lanes = detail::cull_lanes<NumT>;
+  using boxes_type = AABBx<lanes, NumT>;
+  const detail::BroadcastFrustum<lanes, NumT> planes(frustum);
+
+  uint32_t* out = visible.data();
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + lanes <= boxes.size(); i += lanes) {
+    count += detail::append_indices(planes.intersects(boxes_type::Load(boxes.data() + i)).bits(), uint32_t(i), out + count);
+  }
+  if (i < boxes.size()) {
+    // the remaining lanes stay empty and never pass:
+    boxes_type tail;
+    for (size_t lane = 0; i + lane < boxes.size(); ++lane) tail.set_lane(lane, boxes[i + lane]);
+    count += detail::append_indices(planes.intersects(tail).bits(), uint32_t(i), out + count);
+  }
+  return count;
+}
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+size_t frustum_cull(const Frustum<NumT>& frustum,
+  std::type_identity_t<std::span<const AABBx<Lanes, NumT>>> boxes,
+  std::span<uint32_t> visible) noexcept
+{
+  const detail::BroadcastFrustum<Lanes, NumT> planes(frustum);
+  uint32_t* out = visible.data();
+  size_t count = 0;
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    count += detail::append_indices(planes.intersects(boxes[i]).bits(), uint32_t(i * Lanes), out + count);
+  }
+  return count;
+}
+
+} // namespace ayan::math
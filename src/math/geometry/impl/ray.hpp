@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cmath>
+#include <utility>
+
+#include "../ray.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+Ray<NumT>::Ray() noexcept : Ray(Vec3<NumT>::Zero(), Vec3<NumT>::UnitZ()) {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+Ray<NumT>::Ray(const Vec3<NumT>& origin, const Vec3<NumT>& direction, NumT t_min, NumT t_max) noexcept
+  : orig(origin),
+    dir(direction),
+    inv_dir(NumT(1) / direction.x(), NumT(1) / direction.y(), NumT(1) / direction.z()),
+    dir_signs(uint32_t(inv_dir.x() < NumT(0)) | uint32_t(inv_dir.y() < NumT(0)) << 1 | uint32_t(inv_dir.z() < NumT(0)) << 2),
+    min_t(t_min),
+    max_t(t_max)
+{
+  const Vec3<NumT> abs_dir(std::abs(dir.x()), std::abs(dir.y()), std::abs(dir.z()));
+  const size_t kz = abs_dir.x() > abs_dir.y() ? (abs_dir.x() > abs_dir.z() ? 0 : 2) : (abs_dir.y() > abs_dir.z() ? 1 : 2);
+  size_t kx = (kz + 1) % 3;
+  size_t ky = (kx + 1) % 3;
+  if (dir[kz] < NumT(0)) std::swap(kx, ky);
+
+  axes = uint32_t(kx) | uint32_t(ky) << 2 | uint32_t(kz) << 4;
+  shear_coefs = Vec3<NumT>(dir[kx] / dir[kz], dir[ky] / dir[kz], NumT(1) / dir[kz]);
+}
+
+// ----- ----- ---- Element access ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+const Vec3<NumT>& Ray<NumT>::origin() const noexcept { return orig; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+const Vec3<NumT>& Ray<NumT>::direction() const noexcept { return dir; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+const Vec3<NumT>& Ray<NumT>::inv_direction() const noexcept { return inv_dir; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+size_t Ray<NumT>::sign(size_t axis) const noexcept { return (dir_signs >> axis) & 1u; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+NumT Ray<NumT>::t_min() const noexcept { return min_t; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+NumT Ray<NumT>::t_max() const noexcept { return max_t; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+void Ray<NumT>::set_t_max(NumT t) noexcept { max_t = t; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+size_t Ray<NumT>::axis(size_t index) const noexcept { return (axes >> (2 * index)) & 3u; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+const Vec3<NumT>& Ray<NumT>::shear() const noexcept { return shear_coefs; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+Vec3<NumT> Ray<NumT>::at(NumT t) const noexcept {
+  return orig + dir * t;
+}
+
+} // namespace ayan::math
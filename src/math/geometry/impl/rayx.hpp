@@ -0,0 +1,78 @@
+#pragma once
+
+#include "../rayx.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+RayX<Lanes, NumT>::RayX(const packet_type& origin, const packet_type& direction,
+  const pack_type& t_min, const pack_type& t_max) noexcept
+  : orig(origin), dir(direction), min_t(t_min), max_t(t_max)
+{
+  // the same choice of kz as Ray, lane by lane:
+  const pack_type ax = simd::abs(dir.x());
+  const pack_type ay = simd::abs(dir.y());
+  const pack_type az = simd::abs(dir.z());
+  kz_is_x = (ax > ay) & (ax > az);
+  kz_is_y = ~(ax > ay) & (ay > az);
+  const pack_type dz = simd::select(kz_is_x, dir.x(), simd::select(kz_is_y, dir.y(), dir.z()));
+  swapped = dz < pack_type::Zero();
+
+  const packet_type d = permute(dir);
+  shear_coefs = packet_type(d.x() / dz, d.y() / dz, pack_type(NumT(1)) / dz);
+}
+
+// ----- ----- ---- Static member funcs ---- ----- -----
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+RayX<Lanes, NumT> RayX<Lanes, NumT>::Load(const Ray<NumT>* src) noexcept {
+  alignas(64) NumT t_min[Lanes];
+  alignas(64) NumT t_max[Lanes];
+  packet_type origin;
+  packet_type direction;
+  for (size_t i = 0; i < Lanes; ++i) {
+    origin.set_lane(i, src[i].origin());
+    direction.set_lane(i, src[i].direction());
+    t_min[i] = src[i].t_min();
+    t_max[i] = src[i].t_max();
+  }
+  return RayX(origin, direction, pack_type::Load(t_min), pack_type::Load(t_max));
+}
+
+// ----- ----- ---- Element access ---- ----- -----
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+const Vec3x<Lanes, NumT>& RayX<Lanes, NumT>::origin() const noexcept { return orig; }
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+const Vec3x<Lanes, NumT>& RayX<Lanes, NumT>::direction() const noexcept { return dir; }
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+const simd::Pack<NumT, Lanes>& RayX<Lanes, NumT>::t_min() const noexcept { return min_t; }
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+const simd::Pack<NumT, Lanes>& RayX<Lanes, NumT>::t_max() const noexcept { return max_t; }
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+void RayX<Lanes, NumT>::set_t_max(const pack_type& t) noexcept { max_t = t; }
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+Ray<NumT> RayX<Lanes, NumT>::lane(size_t index) const noexcept {
+  return Ray<NumT>(orig.lane(index), dir.lane(index), min_t[index], max_t[index]);
+}
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+Vec3x<Lanes, NumT> RayX<Lanes, NumT>::permute(const packet_type& v) const noexcept {
+  // v[(kz + 1) % 3] and v[(kz + 2) % 3]:
+  const pack_type next = simd::select(kz_is_x, v.y(), simd::select(kz_is_y, v.z(), v.x()));
+  const pack_type prev = simd::select(kz_is_x, v.z(), simd::select(kz_is_y, v.x(), v.y()));
+  return packet_type(
+    simd::select(swapped, prev, next),
+    simd::select(swapped, next, prev),
+    simd::select(kz_is_x, v.x(), simd::select(kz_is_y, v.y(), v.z()))
+  );
+}
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+const Vec3x<Lanes, NumT>& RayX<Lanes, NumT>::shear() const noexcept { return shear_coefs; }
+
+} // namespace ayan::math
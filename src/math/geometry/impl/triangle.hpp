@@ -0,0 +1,204 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <type_traits>
+
+#include "../triangle.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+// Triangle vertices relative to the ray origin, permuted to (kx, ky, kz) and
+// sheared so that the ray is +z; the z coordinates are already scaled by shear.z.
+// Plain mul/sub on purpose (no FMA): a shared edge has to produce exactly
+// negated edge functions in both triangles, or a ray could slip between them,
+// and the packet versions stay bit-identical to the scalar one.
+template<typename NumT>
+bool watertight_test(
+  NumT ax, NumT ay, NumT az, NumT bx, NumT by, NumT bz, NumT cx, NumT cy, NumT cz,
+  NumT t_min, NumT t_max, TriangleHit<NumT>& hit) noexcept
+{
+  NumT u = cx * by - cy * bx;
+  NumT v = ax * cy - ay * cx;
+  NumT w = bx * ay - by * ax;
+
+  if constexpr (std::is_same_v<NumT, float>) {
+    if (u == 0.0f || v == 0.0f || w == 0.0f) {
+      // products of floats are exact in double, only the difference is rounded:
+      u = float(double(cx) * double(by) - double(cy) * double(bx));
+      v = float(double(ax) * double(cy) - double(ay) * double(cx));
+      w = float(double(bx) * double(ay) - double(by) * double(ax));
+    }
+  }
+
+  if ((u < NumT(0) || v < NumT(0) || w < NumT(0)) && (u > NumT(0) || v > NumT(0) || w > NumT(0))) return false;
+
+  const NumT det = u + v + w;
+  if (det == NumT(0)) return false;
+
+  // t * det, compared against the interval without dividing. Accepted as in the
+  // packet version, so a NaN (a vertex at infinity or NaN) is a miss in both:
+  const NumT t_scaled = u * az + v * bz + w * cz;
+  const NumT abs_det = std::abs(det);
+  const NumT signed_t = det < NumT(0) ? -t_scaled : t_scaled;
+  if (!(signed_t >= t_min * abs_det && signed_t <= t_max * abs_det)) return false;
+
+  const NumT inv_det = NumT(1) / det;
+  hit = TriangleHit<NumT>{t_scaled * inv_det, v * inv_det, w * inv_det};
+  return true;
+}
+
+// the same for `Lanes` (ray, triangle) pairs at once:
+template<size_t Lanes, typename NumT>
+simd::Mask<NumT, Lanes> watertight_test(
+  const Vec3x<Lanes, NumT>& a, const Vec3x<Lanes, NumT>& b, const Vec3x<Lanes, NumT>& c,
+  const simd::Pack<NumT, Lanes>& t_min, const simd::Pack<NumT, Lanes>& t_max,
+  TriangleHitX<Lanes, NumT>& hit) noexcept
+{
+  using pack_type = simd::Pack<NumT, Lanes>;
+  const pack_type zero = pack_type::Zero();
+
+  pack_type u = c.x() * b.y() - c.y() * b.x();
+  pack_type v = a.x() * c.y() - a.y() * c.x();
+  pack_type w = b.x() * a.y() - b.y() * a.x();
+
+  if constexpr (std::is_same_v<NumT, float>) {
+    const simd::Mask<NumT, Lanes> on_edge = (u == zero) | (v == zero) | (w == zero);
+    if (on_edge.any()) [[unlikely]] {
+      alignas(64) float us[Lanes], vs[Lanes], ws[Lanes];
+      u.store(us);
+      v.store(vs);
+      w.store(ws);
+      for (uint32_t bits = on_edge.bits(); bits != 0; bits &= bits - 1) {
+        const size_t i = size_t(std::countr_zero(bits));
+        us[i] = float(double(c.x()[i]) * double(b.y()[i]) - double(c.y()[i]) * double(b.x()[i]));
+        vs[i] = float(double(a.x()[i]) * double(c.y()[i]) - double(a.y()[i]) * double(c.x()[i]));
+        ws[i] = float(double(b.x()[i]) * double(a.y()[i]) - double(b.y()[i]) * double(a.x()[i]));
+      }
+      u = pack_type::Load(us);
+      v = pack_type::Load(vs);
+      w = pack_type::Load(ws);
+    }
+  }
+
+  const auto any_negative = (u < zero) | (v < zero) | (w < zero);
+  const auto any_positive = (u > zero) | (v > zero) | (w > zero);
+  const pack_type det = u + v + w;
+
+  const pack_type t_scaled = u * a.z() + v * b.z() + w * c.z();
+  const pack_type abs_det = simd::abs(det);
+  const pack_type signed_t = simd::select(det < zero, -t_scaled, t_scaled);
+
+  const pack_type inv_det = pack_type(NumT(1)) / det;
+  hit.t = t_scaled * inv_det;
+  hit.u = v * inv_det;
+  hit.v = w * inv_det;
+
+  return ~(any_negative & any_positive) & (det != zero) &
+    (signed_t >= t_min * abs_det) & (signed_t <= t_max * abs_det);
+}
+
+} // namespace detail
+
+// ----- ----- ---- Triangle ----- ----- ----
+template<typename NumT> requires (std::floating_point<NumT>)
+Triangle<NumT>::Triangle(const Vec3<NumT>& v0, const Vec3<NumT>& v1, const Vec3<NumT>& v2) noexcept
+  : verts{v0, v1, v2} {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+const Vec3<NumT>& Triangle<NumT>::vertex(size_t index) const noexcept { return verts[index]; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+AABB<NumT> Triangle<NumT>::bounds() const noexcept {
+  return AABB<NumT>().extend(verts[0]).extend(verts[1]).extend(verts[2]);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+bool Triangle<NumT>::intersect(const Ray<NumT>& ray, TriangleHit<NumT>& hit) const noexcept {
+  const size_t kx = ray.axis(0);
+  const size_t ky = ray.axis(1);
+  const size_t kz = ray.axis(2);
+  const Vec3<NumT>& shear = ray.shear();
+
+  const Vec3<NumT> a = verts[0] - ray.origin();
+  const Vec3<NumT> b = verts[1] - ray.origin();
+  const Vec3<NumT> c = verts[2] - ray.origin();
+
+  return detail::watertight_test(
+    a[kx] - shear.x() * a[kz], a[ky] - shear.y() * a[kz], shear.z() * a[kz],
+    b[kx] - shear.x() * b[kz], b[ky] - shear.y() * b[kz], shear.z() * b[kz],
+    c[kx] - shear.x() * c[kz], c[ky] - shear.y() * c[kz], shear.z() * c[kz],
+    ray.t_min(), ray.t_max(), hit);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+template<size_t Lanes>
+simd::Mask<NumT, Lanes> Triangle<NumT>::intersect(const RayX<Lanes, NumT>& rays, TriangleHitX<Lanes, NumT>& hit) const noexcept {
+  using packet_type = Vec3x<Lanes, NumT>;
+  const packet_type& shear = rays.shear();
+
+  // every lane has its own axes, so the permutation is done with selects:
+  auto transform = [&](const Vec3<NumT>& vertex) {
+    const packet_type p = rays.permute(packet_type(vertex) - rays.origin());
+    return packet_type(
+      p.x() - shear.x() * p.z(),
+      p.y() - shear.y() * p.z(),
+      shear.z() * p.z());
+  };
+
+  return detail::watertight_test(transform(verts[0]), transform(verts[1]), transform(verts[2]),
+    rays.t_min(), rays.t_max(), hit);
+}
+
+// ----- ----- ---- TriangleX ----- ----- ----
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+TriangleX<Lanes, NumT>::TriangleX() noexcept : verts{} {}
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+TriangleX<Lanes, NumT>::TriangleX(const packet_type& v0, const packet_type& v1, const packet_type& v2) noexcept
+  : verts{v0, v1, v2} {}
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+TriangleX<Lanes, NumT> TriangleX<Lanes, NumT>::Load(const Triangle<NumT>* src) noexcept {
+  static_assert(sizeof(Triangle<NumT>) == 3 * sizeof(Vec3<NumT>));
+  return TriangleX(packet_type::LoadStrided(&src->vertex(0), 3),
+    packet_type::LoadStrided(&src->vertex(1), 3), packet_type::LoadStrided(&src->vertex(2), 3));
+}
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+const Vec3x<Lanes, NumT>& TriangleX<Lanes, NumT>::vertex(size_t index) const noexcept { return verts[index]; }
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+Triangle<NumT> TriangleX<Lanes, NumT>::lane(size_t index) const noexcept {
+  return Triangle<NumT>(verts[0].lane(index), verts[1].lane(index), verts[2].lane(index));
+}
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+void TriangleX<Lanes, NumT>::set_lane(size_t index, const Triangle<NumT>& triangle) noexcept {
+  for (size_t i = 0; i < 3; ++i) verts[i].set_lane(index, triangle.vertex(i));
+}
+
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+simd::Mask<NumT, Lanes> TriangleX<Lanes, NumT>::intersect(const Ray<NumT>& ray, TriangleHitX<Lanes, NumT>& hit) const noexcept {
+  using pack_type = simd::Pack<NumT, Lanes>;
+  const size_t kx = ray.axis(0);
+  const size_t ky = ray.axis(1);
+  const size_t kz = ray.axis(2);
+  const pack_type sx(ray.shear().x());
+  const pack_type sy(ray.shear().y());
+  const pack_type sz(ray.shear().z());
+  const packet_type origin(ray.origin());
+
+  // one ray: the axes are the same for all lanes and just pick the components:
+  auto transform = [&](const packet_type& vertex) {
+    const packet_type p = vertex - origin;
+    return packet_type(p[kx] - sx * p[kz], p[ky] - sy * p[kz], sz * p[kz]);
+  };
+
+  return detail::watertight_test(transform(verts[0]), transform(verts[1]), transform(verts[2]),
+    pack_type(ray.t_min()), pack_type(ray.t_max()), hit);
+}
+
+} // namespace ayan::math
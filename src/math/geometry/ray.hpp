@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include <ayan/math/vec.hpp>
+#include "fwd.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// Half-line origin + t * direction for t in [t_min, t_max]. The inverse
+// direction and its sign bits are computed once here and reused by every slab test:
+template<typename NumT> requires (std::floating_point<NumT>)
+class Ray {
+private: // Fields:
+  Vec3<NumT> orig;
+  Vec3<NumT> dir;
+  // 1 / dir, a zero component becomes +-inf (the sign of the zero is kept):
+  Vec3<NumT> inv_dir;
+  // bit `axis` is set if inv_dir[axis] < 0:
+  uint32_t dir_signs;
+  // kx, ky, kz of the watertight triangle test, 2 bits each:
+  uint32_t axes;
+  // (dir[kx] / dir[kz], dir[ky] / dir[kz], 1 / dir[kz]):
+  Vec3<NumT> shear_coefs;
+  NumT min_t;
+  NumT max_t;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  Ray() noexcept;
+  Ray(const Vec3<NumT>& origin, const Vec3<NumT>& direction,
+    NumT t_min = NumT(0), NumT t_max = std::numeric_limits<NumT>::infinity()) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  const Vec3<NumT>& origin() const noexcept;
+  const Vec3<NumT>& direction() const noexcept;
+  const Vec3<NumT>& inv_direction() const noexcept;
+  // 1 if the ray goes towards -inf along `axis`, the index of the entry corner of a box:
+  size_t sign(size_t axis) const noexcept;
+  NumT t_min() const noexcept;
+  NumT t_max() const noexcept;
+  // shrinks the interval to the closest hit found so far:
+  void set_t_max(NumT t) noexcept;
+
+  // Watertight ray-triangle test (Woop et al. 2013) works in a space where the ray
+  // is +z. kz = axis(2) is the dominant axis of the direction, kx/ky are the other
+  // two (swapped if dir[kz] < 0 to keep the winding), shear() maps the ray to +z:
+  size_t axis(size_t index) const noexcept;
+  const Vec3<NumT>& shear() const noexcept;
+
+  Vec3<NumT> at(NumT t) const noexcept;
+};
+
+} // namespace ayan::math
+
+#include "impl/ray.hpp"
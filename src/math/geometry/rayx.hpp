@@ -0,0 +1,61 @@
+#pragma once
+
+#include <ayan/math/vec.hpp>
+#include "fwd.hpp"
+#include "ray.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// SoA packet of `Lanes` rays (coherent primary or shadow rays).
+// Lane `i` carries the same precomputed data as the i-th scalar Ray:
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+class RayX {
+public: // Types:
+  using pack_type = simd::Pack<NumT, Lanes>;
+  using mask_type = simd::Mask<NumT, Lanes>;
+  using packet_type = Vec3x<Lanes, NumT>;
+  static constexpr size_t lanes = Lanes;
+
+private: // Fields:
+  packet_type orig;
+  packet_type dir;
+  pack_type min_t;
+  pack_type max_t;
+  // kz per lane is x, y or neither (z); kx/ky are swapped where dir[kz] < 0:
+  mask_type kz_is_x;
+  mask_type kz_is_y;
+  mask_type swapped;
+  packet_type shear_coefs;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  RayX(const packet_type& origin, const packet_type& direction,
+    const pack_type& t_min, const pack_type& t_max) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // `Lanes` consecutive rays starting at `src`:
+  static RayX Load(const Ray<NumT>* src) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  const packet_type& origin() const noexcept;
+  const packet_type& direction() const noexcept;
+  const pack_type& t_min() const noexcept;
+  const pack_type& t_max() const noexcept;
+  void set_t_max(const pack_type& t) noexcept;
+  Ray<NumT> lane(size_t index) const noexcept;
+
+  // see Ray::axis(): (v[kx], v[ky], v[kz]) with the axes of every lane:
+  packet_type permute(const packet_type& v) const noexcept;
+  const packet_type& shear() const noexcept;
+};
+
+template<typename NumT> using RayX4 = RayX<4, NumT>;
+template<typename NumT> using RayX8 = RayX<8, NumT>;
+
+using RayX4f = RayX4<float>;
+using RayX4d = RayX4<double>;
+using RayX8f = RayX8<float>;
+
+} // namespace ayan::math
+
+#include "impl/rayx.hpp"
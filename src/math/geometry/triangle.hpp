@@ -0,0 +1,97 @@
+#pragma once
+
+#include <ayan/math/vec.hpp>
+#include "fwd.hpp"
+#include "aabb.hpp"
+#include "ray.hpp"
+#include "rayx.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// hit point = (1 - u - v) * v0 + u * v1 + v * v2 = ray.at(t):
+template<typename NumT>
+struct TriangleHit {
+  NumT t;
+  NumT u;
+  NumT v;
+};
+
+// the same per lane, meaningful only where the hit mask is set:
+template<size_t Lanes, typename NumT>
+struct TriangleHitX {
+  simd::Pack<NumT, Lanes> t;
+  simd::Pack<NumT, Lanes> u;
+  simd::Pack<NumT, Lanes> v;
+};
+
+// All intersection routines below are watertight (Woop, Benthin, Wald 2013):
+// the triangle is sheared into the space where the ray is +z and the 2D edge
+// functions are evaluated there. A ray through a shared edge or vertex hits at
+// least one of the triangles. Edge functions that come out exactly 0 in float
+// are recomputed in double. Both windings are hit, t is within [t_min, t_max].
+template<typename NumT> requires (std::floating_point<NumT>)
+class Triangle {
+private: // Fields:
+  Vec3<NumT> verts[3];
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  Triangle() noexcept = default;
+  Triangle(const Vec3<NumT>& v0, const Vec3<NumT>& v1, const Vec3<NumT>& v2) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  const Vec3<NumT>& vertex(size_t index) const noexcept;
+  AABB<NumT> bounds() const noexcept;
+
+  // ----- ----- ---- Intersection ----- ----- ----
+  // scalar reference, `hit` is written only on a hit:
+  bool intersect(const Ray<NumT>& ray, TriangleHit<NumT>& hit) const noexcept;
+  // packet of rays against this triangle:
+  template<size_t Lanes>
+  simd::Mask<NumT, Lanes> intersect(const RayX<Lanes, NumT>& rays, TriangleHitX<Lanes, NumT>& hit) const noexcept;
+};
+
+// SoA packet of `Lanes` triangles, tested against one ray at a time
+// (BVH leaves). A default constructed packet holds degenerate triangles that are never hit:
+template<size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+class TriangleX {
+public: // Types:
+  using pack_type = simd::Pack<NumT, Lanes>;
+  using mask_type = simd::Mask<NumT, Lanes>;
+  using packet_type = Vec3x<Lanes, NumT>;
+  static constexpr size_t lanes = Lanes;
+
+private: // Fields:
+  packet_type verts[3];
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  TriangleX() noexcept;
+  TriangleX(const packet_type& v0, const packet_type& v1, const packet_type& v2) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // `Lanes` consecutive triangles starting at `src`:
+  static TriangleX Load(const Triangle<NumT>* src) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  const packet_type& vertex(size_t index) const noexcept;
+  Triangle<NumT> lane(size_t index) const noexcept;
+  void set_lane(size_t index, const Triangle<NumT>& triangle) noexcept;
+
+  // ----- ----- ---- Intersection ----- ----- ----
+  mask_type intersect(const Ray<NumT>& ray, TriangleHitX<Lanes, NumT>& hit) const noexcept;
+};
+
+using Trianglef = Triangle<float>;
+using Triangled = Triangle<double>;
+
+template<typename NumT> using TriangleX4 = TriangleX<4, NumT>;
+template<typename NumT> using TriangleX8 = TriangleX<8, NumT>;
+
+using TriangleX4f = TriangleX4<float>;
+using TriangleX4d = TriangleX4<double>;
+using TriangleX8f = TriangleX8<float>;
+
+} // namespace ayan::math
+
+#include "impl/triangle.hpp"
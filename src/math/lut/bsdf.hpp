@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+
+#include "lut.hpp"
+#include "integrals.hpp"
+
+#include <ayan/math/generated/bsdf_tables.hpp>
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                  BSDF LOOKUP TABLES                  |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// Precomputed terms of microfacet shading, compiled into the binary: nothing
+// is integrated at startup and nothing is read from disk.
+//   ggx_albedo(mu, r)                  - E, single-scattering albedo of GGX
+//                                        with F = 1 (32 x 32);
+//   ggx_average_albedo(r)              - E_avg, its cosine-weighted average (32);
+//   ggx_dielectric_albedo(mu, r, eta)  - the same with the Fresnel of a
+//                                        dielectric, eta in [1, 3] (16^3): the
+//                                        energy a coat reflects, 1 - E reaches
+//                                        the layer below;
+//   fresnel_dielectric_average(eta)    - F_avg of a smooth dielectric, eta in
+//                                        [1, 3] (32, built at compile time);
+//   fresnel_schlick_average(f0)        - F_avg of Schlick's approximation, exact.
+// r is the perceptual roughness (alpha = r^2), mu the cosine to the normal.
+// The GGX tables take seconds to integrate, more than compilers allow in a
+// constant expression, so lut_gen writes them into a generated header at
+// build time. ggx_multiscatter() is the lobe that puts back the energy single
+// scattering loses (Kulla and Conty, "Revisiting Physically Based Shading at
+// Imageworks", 2017). Lookups are bilinear/trilinear, scalar or a packet at once.
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- Tables ----- ----- ----
+inline constexpr Lut2D<detail::kGGXAlbedoSize, detail::kGGXAlbedoSize> kGGXAlbedoLut{ detail::kGGXAlbedoValues };
+inline constexpr Lut1D<detail::kGGXAlbedoSize> kGGXAverageAlbedoLut{ detail::kGGXAverageAlbedoValues };
+inline constexpr Lut3D<detail::kGGXDielectricSize, detail::kGGXDielectricSize, detail::kGGXDielectricSize>
+  kGGXDielectricAlbedoLut{ detail::kGGXDielectricAlbedoValues };
+
+inline constexpr Lut1D<detail::kFresnelAverageSize> kFresnelDielectricAverageLut =
+  Lut1D<detail::kFresnelAverageSize>::Generate([](float u) {
+    return detail::integrate_fresnel_average(
+      detail::kTableEtaMin + u * (detail::kTableEtaMax - detail::kTableEtaMin), detail::kFresnelAverageSamples);
+  });
+
+// ----- ----- ---- GGX ----- ----- ----
+constexpr float ggx_albedo(float mu, float roughness) noexcept;
+template<size_t Lanes>
+simd::Pack<float, Lanes> ggx_albedo(const simd::Pack<float, Lanes>& mu, const simd::Pack<float, Lanes>& roughness) noexcept;
+
+constexpr float ggx_average_albedo(float roughness) noexcept;
+template<size_t Lanes>
+simd::Pack<float, Lanes> ggx_average_albedo(const simd::Pack<float, Lanes>& roughness) noexcept;
+
+constexpr float ggx_dielectric_albedo(float mu, float roughness, float eta) noexcept;
+template<size_t Lanes>
+simd::Pack<float, Lanes> ggx_dielectric_albedo(const simd::Pack<float, Lanes>& mu,
+  const simd::Pack<float, Lanes>& roughness, const simd::Pack<float, Lanes>& eta) noexcept;
+
+// the multiple-scattering BRDF with F = 1, added to the single-scattering
+// one: (1 - E(mu_o)) * (1 - E(mu_i)) / (pi * (1 - E_avg)):
+constexpr float ggx_multiscatter(float mu_o, float mu_i, float roughness) noexcept;
+template<size_t Lanes>
+simd::Pack<float, Lanes> ggx_multiscatter(const simd::Pack<float, Lanes>& mu_o,
+  const simd::Pack<float, Lanes>& mu_i, const simd::Pack<float, Lanes>& roughness) noexcept;
+
+// the tint of ggx_multiscatter() for a Fresnel with average `f_avg` (a float
+// or a pack, once per colour channel): f_avg^2 * E_avg / (1 - f_avg * (1 - E_avg)):
+template<typename T>
+constexpr T ggx_multiscatter_fresnel(const T& f_avg, const T& e_avg) noexcept;
+
+// ----- ----- ---- Fresnel ----- ----- ----
+constexpr float fresnel_dielectric_average(float eta) noexcept;
+template<size_t Lanes>
+simd::Pack<float, Lanes> fresnel_dielectric_average(const simd::Pack<float, Lanes>& eta) noexcept;
+
+// (20 * f0 + 1) / 21, a float or a pack:
+template<typename T>
+constexpr T fresnel_schlick_average(const T& f0) noexcept;
+
+} // namespace ayan::math
+
+#include "impl/bsdf.hpp"
@@ -0,0 +1,65 @@
+// Integrates the GGX tables of bsdf.hpp and writes them as constexpr arrays
+// into the header given as the only argument. Run by the build (see
+// src/math/CMakeLists.txt), the output is the same on every machine.
+
+#include <cstdio>
+#include <string>
+
+#include "../lut.hpp"
+#include "../integrals.hpp"
+
+using namespace ayan::math;
+
+namespace {
+
+template<size_t N>
+void write_values(std::FILE* out, const char* name, const float* values) {
+  std::fprintf(out, "inline constexpr std::array<float, %zu> %s = {", N, name);
+  for (size_t i = 0; i < N; ++i) {
+    std::fprintf(out, "%s%#.9gf,", i % 8 == 0 ? "\n  " : " ", double(values[i]));
+  }
+  std::fprintf(out, "\n};\n\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    std::fprintf(stderr, "usage: %s <output header>\n", argv[0]);
+    return 1;
+  }
+
+  constexpr size_t albedo_size = detail::kGGXAlbedoSize;
+  constexpr size_t dielectric_size = detail::kGGXDielectricSize;
+
+  const auto albedo = Lut2D<albedo_size, albedo_size>::Generate([](float mu, float roughness) {
+    return detail::integrate_ggx_albedo(mu, roughness, 0.0, detail::kGGXAlbedoSamples);
+  });
+  const auto average = Lut1D<albedo_size>::Generate([](float roughness) {
+    return detail::integrate_ggx_average_albedo(roughness, detail::kGGXAverageSamples);
+  });
+  const auto dielectric = Lut3D<dielectric_size, dielectric_size, dielectric_size>::Generate(
+    [](float mu, float roughness, float u) {
+      const double eta = detail::kTableEtaMin + u * (detail::kTableEtaMax - detail::kTableEtaMin);
+      return detail::integrate_ggx_albedo(mu, roughness, eta, detail::kGGXDielectricSamples);
+    });
+
+  const std::string path = argv[1];
+  std::FILE* out = std::fopen(path.c_str(), "w");
+  if (out == nullptr) {
+    std::fprintf(stderr, "%s: cannot write %s\n", argv[0], path.c_str());
+    return 1;
+  }
+
+  std::fprintf(out,
+    "// Generated by lut_gen from src/math/lut/integrals.hpp, do not edit.\n"
+    "#pragma once\n\n"
+    "#include <array>\n\n"
+    "namespace ayan::math::inline AYAN_SIMD_NAMESPACE::detail {\n\n");
+  write_values<albedo_size * albedo_size>(out, "kGGXAlbedoValues", albedo.data());
+  write_values<albedo_size>(out, "kGGXAverageAlbedoValues", average.data());
+  write_values<dielectric_size * dielectric_size * dielectric_size>(out, "kGGXDielectricAlbedoValues", dielectric.data());
+  std::fprintf(out, "} // namespace ayan::math::detail\n");
+
+  return std::fclose(out) == 0 ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <numbers>
+
+#include "../bsdf.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+// eta in [kTableEtaMin, kTableEtaMax] to [0, 1]:
+template<typename T>
+constexpr T eta_coordinate(const T& eta) noexcept {
+  return (eta - kTableEtaMin) * (1.0f / (kTableEtaMax - kTableEtaMin));
+}
+
+// written once for a float and a pack, std:: and simd:: max are both found:
+template<typename T>
+constexpr T multiscatter_lobe(const T& albedo_o, const T& albedo_i, const T& average) noexcept {
+  using std::max;
+  // 1 - E_avg is 0 for a mirror, and so is the numerator:
+  const T one(1.0f);
+  const T missing = max(one - average, T(1e-4f)) * std::numbers::pi_v<float>;
+  return (one - albedo_o) * (one - albedo_i) / missing;
+}
+
+} // namespace detail
+
+// ----- ----- ---- GGX ----- ----- ----
+constexpr float ggx_albedo(float mu, float roughness) noexcept {
+  return kGGXAlbedoLut(mu, roughness);
+}
+
+template<size_t Lanes>
+simd::Pack<float, Lanes> ggx_albedo(const simd::Pack<float, Lanes>& mu, const simd::Pack<float, Lanes>& roughness) noexcept {
+  return kGGXAlbedoLut(mu, roughness);
+}
+
+constexpr float ggx_average_albedo(float roughness) noexcept {
+  return kGGXAverageAlbedoLut(roughness);
+}
+
+template<size_t Lanes>
+simd::Pack<float, Lanes> ggx_average_albedo(const simd::Pack<float, Lanes>& roughness) noexcept {
+  return kGGXAverageAlbedoLut(roughness);
+}
+
+constexpr float ggx_dielectric_albedo(float mu, float roughness, float eta) noexcept {
+  return kGGXDielectricAlbedoLut(mu, roughness, detail::eta_coordinate(eta));
+}
+
+template<size_t Lanes>
+simd::Pack<float, Lanes> ggx_dielectric_albedo(const simd::Pack<float, Lanes>& mu,
+  const simd::Pack<float, Lanes>& roughness, const simd::Pack<float, Lanes>& eta) noexcept
+{
+  return kGGXDielectricAlbedoLut(mu, roughness, detail::eta_coordinate(eta));
+}
+
+constexpr float ggx_multiscatter(float mu_o, float mu_i, float roughness) noexcept {
+  return detail::multiscatter_lobe(ggx_albedo(mu_o, roughness), ggx_albedo(mu_i, roughness), ggx_average_albedo(roughness));
+}
+
+template<size_t Lanes>
+simd::Pack<float, Lanes> ggx_multiscatter(const simd::Pack<float, Lanes>& mu_o,
+  const simd::Pack<float, Lanes>& mu_i, const simd::Pack<float, Lanes>& roughness) noexcept
+{
+  return detail::multiscatter_lobe(ggx_albedo(mu_o, roughness), ggx_albedo(mu_i, roughness), ggx_average_albedo(roughness));
+}
+
+template<typename T>
+constexpr T ggx_multiscatter_fresnel(const T& f_avg, const T& e_avg) noexcept {
+  const T one(1.0f);
+  return f_avg * f_avg * e_avg / (one - f_avg * (one - e_avg));
+}
+
+// ----- ----- ---- Fresnel ----- ----- ----
+constexpr float fresnel_dielectric_average(float eta) noexcept {
+  return kFresnelDielectricAverageLut(detail::eta_coordinate(eta));
+}
+
+template<size_t Lanes>
+simd::Pack<float, Lanes> fresnel_dielectric_average(const simd::Pack<float, Lanes>& eta) noexcept {
+  return kFresnelDielectricAverageLut(detail::eta_coordinate(eta));
+}
+
+template<typename T>
+constexpr T fresnel_schlick_average(const T& f0) noexcept {
+  return (f0 * 20.0f + 1.0f) * (1.0f / 21.0f);
+}
+
+} // namespace ayan::math
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "../lut.hpp"
+#include "../../detail/uint_lanes.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+// the value below coordinate `u` on an axis of `n` values and the weight of the next one:
+struct LutTap {
+  size_t index;
+  float weight;
+};
+
+constexpr LutTap lut_tap(float u, size_t n) noexcept {
+  float x = u * float(n - 1);
+  x = !(x > 0.0f) ? 0.0f : (x < float(n - 1) ? x : float(n - 1));
+  const size_t index = std::min(size_t(x), n - 2);
+  return LutTap{ index, x - float(index) };
+}
+
+constexpr float lut_lerp(float a, float b, float t) noexcept {
+  return a + (b - a) * t;
+}
+
+// the same for `Lanes` coordinates, the index is returned as a float (whole
+// numbers are exact up to 2^24, far above any table):
+template<size_t Lanes>
+simd::Pack<float, Lanes> lut_tap(const simd::Pack<float, Lanes>& u, size_t n, simd::Pack<float, Lanes>& weight) noexcept {
+  using pack_type = simd::Pack<float, Lanes>;
+  // maxps keeps its second operand for NaN:
+  const pack_type x = simd::min(simd::max(u * float(n - 1), pack_type::Zero()), pack_type(float(n - 1)));
+  // x + 2^23 rounds x to a whole number, one less if that went up:
+  const pack_type magic(8388608.0f);
+  const pack_type rounded = (x + magic) - magic;
+  const pack_type index = simd::min(simd::select(rounded > x, rounded - 1.0f, rounded), pack_type(float(n - 2)));
+  weight = x - index;
+  return index;
+}
+
+template<size_t Lanes>
+simd::Pack<float, Lanes> lut_lerp(const simd::Pack<float, Lanes>& a, const simd::Pack<float, Lanes>& b,
+  const simd::Pack<float, Lanes>& t) noexcept
+{
+  return a + (b - a) * t;
+}
+
+// whole-number lanes to the int32 offsets of Pack::Gather:
+template<size_t Lanes>
+void lut_offsets(const simd::Pack<float, Lanes>& index, int32_t* offsets) noexcept {
+#if defined(AYAN_SIMD_SSE2)
+  if constexpr (Lanes == uint32_lanes) {
+    UintLanes<uint32_t, Lanes>::Truncate(index).store_unaligned(reinterpret_cast<uint32_t*>(offsets));
+    return;
+  }
+#endif
+  alignas(sizeof(float) * Lanes) float lanes[Lanes];
+  index.store(lanes);
+  for (size_t i = 0; i < Lanes; ++i) offsets[i] = int32_t(lanes[i]);
+}
+
+} // namespace detail
+
+// ----- ----- ---- Lut1D ---- ----- -----
+template<size_t N>
+constexpr Lut1D<N>::Lut1D(const values_type& values) noexcept : values(values) {}
+
+template<size_t N>
+template<typename Func>
+constexpr Lut1D<N> Lut1D<N>::Generate(Func&& func) {
+  values_type values{};
+  for (size_t x = 0; x < N; ++x) values[x] = float(func(Node(x)));
+  return Lut1D(values);
+}
+
+template<size_t N>
+constexpr float Lut1D<N>::Node(size_t index) noexcept {
+  return float(index) / float(N - 1);
+}
+
+template<size_t N>
+constexpr float Lut1D<N>::at(size_t x) const noexcept { return values[x]; }
+
+template<size_t N>
+constexpr const float* Lut1D<N>::data() const noexcept { return values.data(); }
+
+template<size_t N>
+constexpr float Lut1D<N>::operator()(float u) const noexcept {
+  const detail::LutTap tap = detail::lut_tap(u, N);
+  return detail::lut_lerp(values[tap.index], values[tap.index + 1], tap.weight);
+}
+
+template<size_t N>
+template<size_t Lanes>
+simd::Pack<float, Lanes> Lut1D<N>::operator()(const simd::Pack<float, Lanes>& u) const noexcept {
+  using pack_type = simd::Pack<float, Lanes>;
+  pack_type t;
+  alignas(sizeof(int32_t) * Lanes) int32_t offsets[Lanes];
+  detail::lut_offsets(detail::lut_tap(u, N, t), offsets);
+  return detail::lut_lerp(pack_type::Gather(values.data(), offsets), pack_type::Gather(values.data() + 1, offsets), t);
+}
+
+// ----- ----- ---- Lut2D ---- ----- -----
+template<size_t W, size_t H>
+constexpr Lut2D<W, H>::Lut2D(const values_type& values) noexcept : values(values) {}
+
+template<size_t W, size_t H>
+template<typename Func>
+constexpr Lut2D<W, H> Lut2D<W, H>::Generate(Func&& func) {
+  values_type values{};
+  for (size_t y = 0; y < H; ++y) {
+    for (size_t x = 0; x < W; ++x) values[y * W + x] = float(func(Lut1D<W>::Node(x), Lut1D<H>::Node(y)));
+  }
+  return Lut2D(values);
+}
+
+template<size_t W, size_t H>
+constexpr float Lut2D<W, H>::at(size_t x, size_t y) const noexcept { return values[y * W + x]; }
+
+template<size_t W, size_t H>
+constexpr const float* Lut2D<W, H>::data() const noexcept { return values.data(); }
+
+template<size_t W, size_t H>
+constexpr float Lut2D<W, H>::operator()(float u, float v) const noexcept {
+  const detail::LutTap tu = detail::lut_tap(u, W);
+  const detail::LutTap tv = detail::lut_tap(v, H);
+  const float* row = values.data() + tv.index * W + tu.index;
+  const float bottom = detail::lut_lerp(row[0], row[1], tu.weight);
+  const float top = detail::lut_lerp(row[W], row[W + 1], tu.weight);
+  return detail::lut_lerp(bottom, top, tv.weight);
+}
+
+template<size_t W, size_t H>
+template<size_t Lanes>
+simd::Pack<float, Lanes> Lut2D<W, H>::operator()(const simd::Pack<float, Lanes>& u,
+  const simd::Pack<float, Lanes>& v) const noexcept
+{
+  using pack_type = simd::Pack<float, Lanes>;
+  pack_type tu;
+  pack_type tv;
+  const pack_type x = detail::lut_tap(u, W, tu);
+  const pack_type y = detail::lut_tap(v, H, tv);
+  alignas(sizeof(int32_t) * Lanes) int32_t offsets[Lanes];
+  detail::lut_offsets(y * float(W) + x, offsets);
+
+  const float* base = values.data();
+  const pack_type bottom = detail::lut_lerp(pack_type::Gather(base, offsets), pack_type::Gather(base + 1, offsets), tu);
+  const pack_type top = detail::lut_lerp(pack_type::Gather(base + W, offsets), pack_type::Gather(base + W + 1, offsets), tu);
+  return detail::lut_lerp(bottom, top, tv);
+}
+
+// ----- ----- ---- Lut3D ---- ----- -----
+template<size_t W, size_t H, size_t D>
+constexpr Lut3D<W, H, D>::Lut3D(const values_type& values) noexcept : values(values) {}
+
+template<size_t W, size_t H, size_t D>
+template<typename Func>
+constexpr Lut3D<W, H, D> Lut3D<W, H, D>::Generate(Func&& func) {
+  values_type values{};
+  for (size_t z = 0; z < D; ++z) {
+    for (size_t y = 0; y < H; ++y) {
+      for (size_t x = 0; x < W; ++x) {
+        values[(z * H + y) * W + x] = float(func(Lut1D<W>::Node(x), Lut1D<H>::Node(y), Lut1D<D>::Node(z)));
+      }
+    }
+  }
+  return Lut3D(values);
+}
+
+template<size_t W, size_t H, size_t D>
+constexpr float Lut3D<W, H, D>::at(size_t x, size_t y, size_t z) const noexcept {
+  return values[(z * H + y) * W + x];
+}
+
+template<size_t W, size_t H, size_t D>
+constexpr const float* Lut3D<W, H, D>::data() const noexcept { return values.data(); }
+
+template<size_t W, size_t H, size_t D>
+constexpr float Lut3D<W, H, D>::operator()(float u, float v, float w) const noexcept {
+  const detail::LutTap tu = detail::lut_tap(u, W);
+  const detail::LutTap tv = detail::lut_tap(v, H);
+  const detail::LutTap tw = detail::lut_tap(w, D);
+  const float* front = values.data() + (tw.index * H + tv.index) * W + tu.index;
+  const float* back = front + W * H;
+  const float front_value = detail::lut_lerp(
+    detail::lut_lerp(front[0], front[1], tu.weight), detail::lut_lerp(front[W], front[W + 1], tu.weight), tv.weight);
+  const float back_value = detail::lut_lerp(
+    detail::lut_lerp(back[0], back[1], tu.weight), detail::lut_lerp(back[W], back[W + 1], tu.weight), tv.weight);
+  return detail::lut_lerp(front_value, back_value, tw.weight);
+}
+
+template<size_t W, size_t H, size_t D>
+template<size_t Lanes>
+simd::Pack<float, Lanes> Lut3D<W, H, D>::operator()(const simd::Pack<float, Lanes>& u,
+  const simd::Pack<float, Lanes>& v, const simd::Pack<float, Lanes>& w) const noexcept
+{
+  using pack_type = simd::Pack<float, Lanes>;
+  pack_type tu;
+  pack_type tv;
+  pack_type tw;
+  const pack_type x = detail::lut_tap(u, W, tu);
+  const pack_type y = detail::lut_tap(v, H, tv);
+  const pack_type z = detail::lut_tap(w, D, tw);
+  alignas(sizeof(int32_t) * Lanes) int32_t offsets[Lanes];
+  detail::lut_offsets((z * float(H) + y) * float(W) + x, offsets);
+
+  // bilinear in the two slices along w:
+  const auto slice = [&](const float* base) {
+    const pack_type bottom = detail::lut_lerp(pack_type::Gather(base, offsets), pack_type::Gather(base + 1, offsets), tu);
+    const pack_type top = detail::lut_lerp(pack_type::Gather(base + W, offsets), pack_type::Gather(base + W + 1, offsets), tu);
+    return detail::lut_lerp(bottom, top, tv);
+  };
+  return detail::lut_lerp(slice(values.data()), slice(values.data() + W * H), tw);
+}
+
+} // namespace ayan::math
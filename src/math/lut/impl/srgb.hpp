@@ -0,0 +1,11 @@
+#pragma once
+
+#include "../srgb.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+constexpr float srgb8_to_linear(uint8_t encoded) noexcept {
+  return kSrgb8ToLinear[encoded];
+}
+
+} // namespace ayan::math
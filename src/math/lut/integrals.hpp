@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <numbers>
+
+#include "../detail/constexpr_math.hpp"
+
+// The integrals behind the tables of bsdf.hpp, in double precision and
+// constexpr. Quadratures are midpoint rules: deterministic, so a table is the
+// same on every build. The GGX ones run at build time (see gen/lut_gen.cpp)
+// and in the tests, the Fresnel average is cheap enough for a constant expression.
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::detail {
+
+// ----- ----- ---- Table shapes ----- ----- ----
+// written by lut_gen, read by bsdf.hpp:
+inline constexpr size_t kGGXAlbedoSize = 32;      // mu x roughness, the average over roughness;
+inline constexpr int kGGXAlbedoSamples = 128;     // per axis of the visible normals grid;
+inline constexpr int kGGXAverageSamples = 64;     // and along mu;
+inline constexpr size_t kGGXDielectricSize = 16;  // mu x roughness x eta;
+inline constexpr int kGGXDielectricSamples = 64;
+inline constexpr size_t kFresnelAverageSize = 32; // eta;
+inline constexpr int kFresnelAverageSamples = 128;
+// eta axis of the dielectric tables:
+inline constexpr float kTableEtaMin = 1.0f;
+inline constexpr float kTableEtaMax = 3.0f;
+
+// ----- ----- ---- Integrals ----- ----- ----
+
+// unpolarized reflectance of a smooth dielectric boundary, `cos_i` of the
+// incident direction, eta = n_transmitted / n_incident (1 on total internal reflection):
+constexpr double fresnel_dielectric(double cos_i, double eta) noexcept {
+  const double g2 = eta * eta - 1.0 + cos_i * cos_i;
+  if (g2 < 0.0) return 1.0;
+  const double g = cx_sqrt(g2);
+  const double a = (g - cos_i) / (g + cos_i);
+  const double b = (cos_i * (g + cos_i) - 1.0) / (cos_i * (g - cos_i) + 1.0);
+  return 0.5 * a * a * (1.0 + b * b);
+}
+
+// cosine-weighted hemispherical average 2 * integral of F(mu) * mu dmu:
+constexpr double integrate_fresnel_average(double eta, int samples) noexcept {
+  double sum = 0.0;
+  for (int i = 0; i < samples; ++i) {
+    const double mu = (i + 0.5) / samples;
+    sum += fresnel_dielectric(mu, eta) * mu;
+  }
+  return 2.0 * sum / samples;
+}
+
+// Smith Lambda of GGX for a direction at `cos_theta` to the normal:
+constexpr double ggx_lambda(double alpha2, double cos_theta) noexcept {
+  const double cos2 = cos_theta * cos_theta;
+  return 0.5 * (cx_sqrt(1.0 + alpha2 * (1.0 - cos2) / cos2) - 1.0);
+}
+
+// Directional albedo of the GGX microfacet BRDF (height-correlated Smith G2,
+// alpha = roughness^2) lit from `mu` = cos(theta) of the view: the fraction of
+// energy reflected in a single scattering. With eta > 0 it is weighted by
+// fresnel_dielectric(v.h, eta), F = 1 otherwise. The visible normals are sampled
+// on a samples x samples grid (Heitz, "Sampling the GGX Distribution of
+// Visible Normals", 2018), the weight of one is G2 / G1(view) * F:
+constexpr double integrate_ggx_albedo(double mu, double roughness, double eta, int samples) noexcept {
+  const double alpha = std::max(roughness * roughness, 1e-3);
+  const double alpha2 = alpha * alpha;
+  mu = std::clamp(mu, 1e-4, 1.0);
+  const double sin_v = cx_sqrt(1.0 - mu * mu);
+  const double lambda_v = ggx_lambda(alpha2, mu);
+
+  // the view in the hemisphere configuration, T1 = (0, 1, 0), T2 = (-vz, 0, vx):
+  const double stretched = cx_sqrt(alpha2 * sin_v * sin_v + mu * mu);
+  const double vx = alpha * sin_v / stretched;
+  const double vz = mu / stretched;
+  const double s = 0.5 * (1.0 + vz);
+
+  double sum = 0.0;
+  for (int j = 0; j < samples; ++j) {
+    const double phi = std::numbers::pi * (2.0 * (j + 0.5) / samples - 1.0);
+    const double cos_phi = cx_cos(phi);
+    const double sin_phi = (phi < 0.0 ? -1.0 : 1.0) * cx_sqrt(1.0 - cos_phi * cos_phi);
+    for (int i = 0; i < samples; ++i) {
+      const double r = cx_sqrt((i + 0.5) / samples);
+      const double t1 = r * cos_phi;
+      const double t2 = (1.0 - s) * cx_sqrt(1.0 - t1 * t1) + s * r * sin_phi;
+      const double tz = cx_sqrt(std::max(0.0, 1.0 - t1 * t1 - t2 * t2));
+      // back to the ellipsoid configuration:
+      const double nx = alpha * (tz * vx - t2 * vz);
+      const double ny = alpha * t1;
+      const double nz = std::max(0.0, t2 * vx + tz * vz);
+      const double length = cx_sqrt(nx * nx + ny * ny + nz * nz);
+      const double cos_h = nz / length;
+      const double v_dot_h = (sin_v * nx + mu * nz) / length;
+      const double cos_l = 2.0 * v_dot_h * cos_h - mu;
+      if (cos_l <= 0.0) continue;
+      const double fresnel = eta > 0.0 ? fresnel_dielectric(v_dot_h, eta) : 1.0;
+      sum += fresnel * (1.0 + lambda_v) / (1.0 + lambda_v + ggx_lambda(alpha2, cos_l));
+    }
+  }
+  return sum / (double(samples) * samples);
+}
+
+// 2 * integral of integrate_ggx_albedo(mu) * mu dmu (F = 1), `samples` points along mu:
+constexpr double integrate_ggx_average_albedo(double roughness, int samples) noexcept {
+  double sum = 0.0;
+  for (int i = 0; i < samples; ++i) {
+    const double mu = (i + 0.5) / samples;
+    sum += integrate_ggx_albedo(mu, roughness, 0.0, samples) * mu;
+  }
+  return 2.0 * sum / samples;
+}
+
+} // namespace ayan::math::detail
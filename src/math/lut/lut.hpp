@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "../simd/pack.hpp"
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                  FLOAT LOOKUP TABLES                 |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// 1D, 2D and 3D tables of floats over [0, 1] on every axis: value `i` of an
+// axis of N sits at u = i / (N - 1), so both ends are exact, lookups
+// interpolate linearly (bilinear, trilinear) between the two nearest values.
+// Coordinates out of [0, 1] are clamped, NaN reads the first value.
+// The tables are literal types: Generate() fills one in a constant expression
+// (cheap functions only, compilers bound constexpr evaluation), the expensive
+// ones are integrated at build time into constexpr arrays (see bsdf.hpp).
+// The packet lookups are one gather per corner of the cell.
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+template<size_t N>
+class Lut1D {
+  static_assert(N >= 2, "a table has at least 2 values per axis");
+
+public: // Types:
+  using values_type = std::array<float, N>;
+
+private: // Fields:
+  alignas(64) values_type values;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  constexpr explicit Lut1D(const values_type& values) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // value `i` is func(Node(i)):
+  template<typename Func>
+  static constexpr Lut1D Generate(Func&& func);
+  // coordinate of value `index`:
+  static constexpr float Node(size_t index) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  constexpr float at(size_t x) const noexcept;
+  constexpr const float* data() const noexcept;
+
+  // ----- ----- ---- Lookups ----- ----- ----
+  constexpr float operator()(float u) const noexcept;
+  template<size_t Lanes>
+  simd::Pack<float, Lanes> operator()(const simd::Pack<float, Lanes>& u) const noexcept;
+};
+
+// W values along u, H along v, row-major (values[y * W + x]):
+template<size_t W, size_t H>
+class Lut2D {
+  static_assert(W >= 2 && H >= 2, "a table has at least 2 values per axis");
+
+public: // Types:
+  using values_type = std::array<float, W * H>;
+
+private: // Fields:
+  alignas(64) values_type values;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  constexpr explicit Lut2D(const values_type& values) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // value (x, y) is func(Lut1D<W>::Node(x), Lut1D<H>::Node(y)):
+  template<typename Func>
+  static constexpr Lut2D Generate(Func&& func);
+
+  // ----- ----- ---- Element access ---- ----- -----
+  constexpr float at(size_t x, size_t y) const noexcept;
+  constexpr const float* data() const noexcept;
+
+  // ----- ----- ---- Lookups ----- ----- ----
+  constexpr float operator()(float u, float v) const noexcept;
+  template<size_t Lanes>
+  simd::Pack<float, Lanes> operator()(const simd::Pack<float, Lanes>& u, const simd::Pack<float, Lanes>& v) const noexcept;
+};
+
+// W values along u, H along v, D along w (values[(z * H + y) * W + x]):
+template<size_t W, size_t H, size_t D>
+class Lut3D {
+  static_assert(W >= 2 && H >= 2 && D >= 2, "a table has at least 2 values per axis");
+
+public: // Types:
+  using values_type = std::array<float, W * H * D>;
+
+private: // Fields:
+  alignas(64) values_type values;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  constexpr explicit Lut3D(const values_type& values) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // value (x, y, z) is func(Lut1D<W>::Node(x), Lut1D<H>::Node(y), Lut1D<D>::Node(z)):
+  template<typename Func>
+  static constexpr Lut3D Generate(Func&& func);
+
+  // ----- ----- ---- Element access ---- ----- -----
+  constexpr float at(size_t x, size_t y, size_t z) const noexcept;
+  constexpr const float* data() const noexcept;
+
+  // ----- ----- ---- Lookups ----- ----- ----
+  constexpr float operator()(float u, float v, float w) const noexcept;
+  template<size_t Lanes>
+  simd::Pack<float, Lanes> operator()(const simd::Pack<float, Lanes>& u,
+    const simd::Pack<float, Lanes>& v, const simd::Pack<float, Lanes>& w) const noexcept;
+};
+
+} // namespace ayan::math
+
+#include "impl/lut.hpp"
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "lut.hpp"
+#include "../detail/constexpr_math.hpp"
+
+// sRGB transfer function tables, built at compile time. The encoding table is
+// what the 8-bit framebuffer encoder reads instead of evaluating pow() per
+// channel; the decoding one turns 8-bit sRGB textures into linear values.
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+// IEC 61966-2-1 in double, for the tables (defined here, the tables below
+// are evaluated right away):
+constexpr double srgb_oetf(double linear) noexcept {
+  return linear <= 0.0031308 ? linear * 12.92 : 1.055 * cx_pow(linear, 1.0 / 2.4) - 0.055;
+}
+
+constexpr double srgb_eotf(double encoded) noexcept {
+  return encoded <= 0.04045 ? encoded / 12.92 : cx_pow((encoded + 0.055) / 1.055, 2.4);
+}
+
+} // namespace detail
+
+// linear [0, 1] to sRGB-encoded [0, 1], within 2.5e-4 of linear_to_srgb() (a
+// sixteenth of an 8-bit step), 4 KiB:
+inline constexpr Lut1D<1024> kLinearToSrgbLut = Lut1D<1024>::Generate(
+  [](float linear) { return detail::srgb_oetf(linear); });
+
+// every 8-bit sRGB level decoded to linear:
+inline constexpr std::array<float, 256> kSrgb8ToLinear = [] {
+  std::array<float, 256> values{};
+  for (size_t i = 0; i < values.size(); ++i) values[i] = float(detail::srgb_eotf(double(i) / 255.0));
+  return values;
+}();
+
+constexpr float srgb8_to_linear(uint8_t encoded) noexcept;
+
+} // namespace ayan::math
+
+#include "impl/srgb.hpp"
@@ -2,7 +2,9 @@
 
 #include <cstddef>
 
-namespace ayan::math {
+#include "../detail/simd.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
 
 template<size_t Rows, size_t Cols, typename NumT = double>
 class Mat;
@@ -10,17 +12,25 @@ class Mat;
 template<typename T> using Mat2 = Mat<2, 2, T>;
 template<typename T> using Mat3 = Mat<3, 3, T>;
 template<typename T> using Mat4 = Mat<4, 4, T>;
+template<typename T> using Mat3x4 = Mat<3, 4, T>;
+// Mat3x4 under its role, an affine transform of 3D space:
+template<typename T> using Affine3 = Mat3x4<T>;
 
 using Mat2f = Mat2<float>;
 using Mat3f = Mat3<float>;
 using Mat4f = Mat4<float>;
+using Mat3x4f = Mat3x4<float>;
+using Affine3f = Affine3<float>;
 
 using Mat2d = Mat2<double>;
 using Mat3d = Mat3<double>;
 using Mat4d = Mat4<double>;
+using Mat3x4d = Mat3x4<double>;
+using Affine3d = Affine3<double>;
 
 using Mat2i = Mat2<int>;
 using Mat3i = Mat3<int>;
 using Mat4i = Mat4<int>;
+using Mat3x4i = Mat3x4<int>;
 
 } // namespace ayan::math
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <limits>
+#include <type_traits>
+
+#include "../mat2.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<2, 2, NumT>::Mat() noexcept : columns {
+  Vec2<NumT>::UnitX(),
+  Vec2<NumT>::UnitY()
+} {}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<2, 2, NumT> Mat<2, 2, NumT>::Identity() noexcept {
+  return Mat();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<2, 2, NumT>::Mat(const Vec2<NumT>& col0, const Vec2<NumT>& col1) noexcept
+: columns{col0, col1} {}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+template<typename U> requires (std::same_as<U, NumT> || std::convertible_to<U, NumT>)
+constexpr Mat<2, 2, NumT>::Mat(std::initializer_list<U> init_list) noexcept : Mat() {
+  if (init_list.size() != 4) return;
+  auto it = init_list.begin();
+
+  columns[0].x() = *it; ++it;
+  columns[1].x() = *it; ++it;
+
+  columns[0].y() = *it; ++it;
+  columns[1].y() = *it; ++it;
+}
+
+// ----- ----- ---- Element Access ---- ----- -----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+template <size_t index> requires (index < 2)
+constexpr Vec2<NumT> Mat<2, 2, NumT>::row() const noexcept {
+  return Vec2<NumT>(columns[0][index], columns[1][index]);
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+template <size_t index> requires (index < 2)
+constexpr Vec2<NumT>& Mat<2, 2, NumT>::col() noexcept {
+  return columns[index];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+template <size_t index> requires (index < 2)
+constexpr const Vec2<NumT>& Mat<2, 2, NumT>::col() const noexcept {
+  return columns[index];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT& Mat<2, 2, NumT>::operator()(size_t row, size_t col) noexcept {
+  return columns[col][row];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr const NumT& Mat<2, 2, NumT>::operator()(size_t row, size_t col) const noexcept {
+  return columns[col][row];
+}
+
+// ----- ----- ---- Operators ---- ----- -----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat2<NumT> Mat<2, 2, NumT>::operator+(const Mat2<NumT>& oth) const noexcept {
+  return Mat(columns[0] + oth.columns[0], columns[1] + oth.columns[1]);
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat2<NumT> Mat<2, 2, NumT>::operator-(const Mat2<NumT>& oth) const noexcept {
+  return Mat(columns[0] - oth.columns[0], columns[1] - oth.columns[1]);
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat2<NumT> Mat<2, 2, NumT>::operator*(NumT scalar) const noexcept {
+  return Mat(columns[0] * scalar, columns[1] * scalar);
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat2<NumT> Mat<2, 2, NumT>::operator/(NumT scalar) const noexcept {
+  return Mat(columns[0] / scalar, columns[1] / scalar);
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat2<NumT>& Mat<2, 2, NumT>::operator+=(const Mat2<NumT>& oth) noexcept {
+  columns[0] += oth.columns[0];
+  columns[1] += oth.columns[1];
+  return *this;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat2<NumT>& Mat<2, 2, NumT>::operator*=(const Mat2<NumT>& oth) noexcept {
+  *this = *this * oth;
+  return *this;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<2, 2, NumT>::operator==(const Mat2<NumT>& oth) const noexcept {
+  return columns[0] == oth.columns[0] && columns[1] == oth.columns[1];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<2, 2, NumT>::operator!=(const Mat2<NumT>& oth) const noexcept {
+  return !(*this == oth);
+}
+
+// ----- ----- ---- Linear Algebra Operations ----- ----- ----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat2<NumT> Mat<2, 2, NumT>::operator*(const Mat2<NumT>& oth) const noexcept {
+  return Mat(*this * oth.columns[0], *this * oth.columns[1]);
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Vec2<NumT> Mat<2, 2, NumT>::operator*(const Vec2<NumT>& vec) const noexcept {
+  return columns[0] * vec.x() + columns[1] * vec.y();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT Mat<2, 2, NumT>::determinant() const noexcept {
+  return columns[0].x() * columns[1].y() - columns[1].x() * columns[0].y();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat2<NumT> Mat<2, 2, NumT>::transpose() const noexcept {
+  return Mat(row<0>(), row<1>());
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT Mat<2, 2, NumT>::trace() const noexcept {
+  return columns[0].x() + columns[1].y();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat2<NumT> Mat<2, 2, NumT>::inverse() const noexcept requires (std::floating_point<NumT>) {
+  const NumT inv_det = NumT(1) / determinant();
+  return Mat(
+    Vec2<NumT>(columns[1].y(), -columns[0].y()) * inv_det,
+    Vec2<NumT>(-columns[1].x(), columns[0].x()) * inv_det
+  );
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<2, 2, NumT>::is_identity() const noexcept {
+  return *this == Mat();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<2, 2, NumT>::is_diagonal() const noexcept {
+  return columns[0].y() == NumT(0) && columns[1].x() == NumT(0);
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<2, 2, NumT>::is_symmetric() const noexcept {
+  return columns[0].y() == columns[1].x();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<2, 2, NumT>::is_orthogonal() const noexcept {
+  // M^T * M == I, the dot products of unit columns carry a few rounding errors:
+  NumT tolerance = NumT(0);
+  if constexpr (std::floating_point<NumT>) tolerance = NumT(8) * std::numeric_limits<NumT>::epsilon();
+
+  const Mat2<NumT> product = transpose() * *this;
+  for (size_t i = 0; i < 2; ++i) {
+    for (size_t j = 0; j < 2; ++j) {
+      const NumT diff = product(i, j) - (i == j ? NumT(1) : NumT(0));
+      if (diff > tolerance || -diff > tolerance) return false;
+    }
+  }
+  return true;
+}
+
+// ----- ----- ---- Utility functional methods ----- ----- ----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+template <typename Func> requires std::invocable<Func, NumT>
+constexpr auto Mat<2, 2, NumT>::map(Func&& func) noexcept(std::is_nothrow_invocable_v<Func, NumT>)
+  -> Mat2<std::invoke_result_t<Func, NumT>>
+{
+  using ResultT = std::invoke_result_t<Func, NumT>;
+  return Mat<2, 2, ResultT>(
+    Vec2<ResultT>(func(columns[0].x()), func(columns[0].y())),
+    Vec2<ResultT>(func(columns[1].x()), func(columns[1].y()))
+  );
+}
+
+// ----- ----- ---- External Operators ---- ----- ----
+template<typename NumT>
+constexpr Mat2<NumT> operator*(NumT scalar, const Mat2<NumT>& mat) noexcept {
+  return mat * scalar;
+}
+
+} // namespace ayan::math
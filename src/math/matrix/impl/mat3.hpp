@@ -0,0 +1,304 @@
+#pragma once
+
+#include <limits>
+#include <type_traits>
+
+#include "../mat3.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+template<typename NumT>
+constexpr Vec4<NumT> pad_column(const Vec3<NumT>& col) noexcept {
+  return Vec4<NumT>(col.x(), col.y(), col.z(), NumT(0));
+}
+
+template<typename NumT>
+constexpr Vec3<NumT> unpad_column(const Vec4<NumT>& col) noexcept {
+  return Vec3<NumT>(col.x(), col.y(), col.z());
+}
+
+} // namespace detail
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<3, 3, NumT>::Mat() noexcept : columns {
+  Vec4<NumT>(NumT(1), NumT(0), NumT(0), NumT(0)),
+  Vec4<NumT>(NumT(0), NumT(1), NumT(0), NumT(0)),
+  Vec4<NumT>(NumT(0), NumT(0), NumT(1), NumT(0))
+} {}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<3, 3, NumT> Mat<3, 3, NumT>::Identity() noexcept {
+  return Mat();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<3, 3, NumT>::Mat(const Vec3<NumT>& col0, const Vec3<NumT>& col1, const Vec3<NumT>& col2) noexcept
+: columns{detail::pad_column(col0), detail::pad_column(col1), detail::pad_column(col2)} {}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+template<typename U> requires (std::same_as<U, NumT> || std::convertible_to<U, NumT>)
+constexpr Mat<3, 3, NumT>::Mat(std::initializer_list<U> init_list) noexcept : Mat() {
+  if (init_list.size() != 9) return;
+  auto it = init_list.begin();
+
+  for (size_t row = 0; row < 3; ++row) {
+    for (size_t col = 0; col < 3; ++col) {
+      columns[col][row] = static_cast<NumT>(*it);
+      ++it;
+    }
+  }
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<3, 3, NumT>::Mat(const Mat4<NumT>& mat) noexcept
+: columns{
+  Vec4<NumT>(mat(0, 0), mat(1, 0), mat(2, 0), NumT(0)),
+  Vec4<NumT>(mat(0, 1), mat(1, 1), mat(2, 1), NumT(0)),
+  Vec4<NumT>(mat(0, 2), mat(1, 2), mat(2, 2), NumT(0))
+} {}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<3, 3, NumT> Mat<3, 3, NumT>::OrthonormalBasis(const Vec3<NumT>& normal) noexcept
+  requires (std::floating_point<NumT>)
+{
+  const NumT sign = normal.z() >= NumT(0) ? NumT(1) : NumT(-1);
+  const NumT a = NumT(-1) / (sign + normal.z());
+  const NumT b = normal.x() * normal.y() * a;
+  return Mat(
+    Vec3<NumT>(NumT(1) + sign * normal.x() * normal.x() * a, sign * b, -sign * normal.x()),
+    Vec3<NumT>(b, sign + normal.y() * normal.y() * a, -normal.y()),
+    normal
+  );
+}
+
+// ----- ----- ---- Element Access ---- ----- -----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+template <size_t index> requires (index < 3)
+constexpr Vec3<NumT> Mat<3, 3, NumT>::row() const noexcept {
+  return Vec3<NumT>(columns[0][index], columns[1][index], columns[2][index]);
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+template <size_t index> requires (index < 3)
+constexpr Vec3<NumT> Mat<3, 3, NumT>::col() const noexcept {
+  return detail::unpad_column(columns[index]);
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+template <size_t index> requires (index < 3)
+constexpr void Mat<3, 3, NumT>::set_col(const Vec3<NumT>& col) noexcept {
+  columns[index] = detail::pad_column(col);
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT& Mat<3, 3, NumT>::operator()(size_t row, size_t col) noexcept {
+  return columns[col][row];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr const NumT& Mat<3, 3, NumT>::operator()(size_t row, size_t col) const noexcept {
+  return columns[col][row];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat4<NumT> Mat<3, 3, NumT>::to_mat4() const noexcept {
+  return Mat4<NumT>(
+    detail::pad_column(col<0>()),
+    detail::pad_column(col<1>()),
+    detail::pad_column(col<2>()),
+    Vec4<NumT>::UnitW()
+  );
+}
+
+// ----- ----- ---- Operators ---- ----- -----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat3<NumT> Mat<3, 3, NumT>::operator+(const Mat3<NumT>& oth) const noexcept {
+  Mat result;
+  for (size_t j = 0; j < 3; ++j) {
+    result.columns[j] = columns[j] + oth.columns[j];
+  }
+  return result;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat3<NumT> Mat<3, 3, NumT>::operator-(const Mat3<NumT>& oth) const noexcept {
+  Mat result;
+  for (size_t j = 0; j < 3; ++j) {
+    result.columns[j] = columns[j] - oth.columns[j];
+  }
+  return result;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat3<NumT> Mat<3, 3, NumT>::operator*(NumT scalar) const noexcept {
+  Mat result;
+  for (size_t j = 0; j < 3; ++j) {
+    result.columns[j] = columns[j] * scalar;
+  }
+  return result;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat3<NumT> Mat<3, 3, NumT>::operator/(NumT scalar) const noexcept {
+  Mat result;
+  for (size_t j = 0; j < 3; ++j) {
+    result.columns[j] = columns[j] / scalar;
+  }
+  return result;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat3<NumT>& Mat<3, 3, NumT>::operator+=(const Mat3<NumT>& oth) noexcept {
+  columns[0] += oth.columns[0];
+  columns[1] += oth.columns[1];
+  columns[2] += oth.columns[2];
+  return *this;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat3<NumT>& Mat<3, 3, NumT>::operator*=(const Mat3<NumT>& oth) noexcept {
+  *this = *this * oth;
+  return *this;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<3, 3, NumT>::operator==(const Mat3<NumT>& oth) const noexcept {
+  return col<0>() == oth.col<0>() && col<1>() == oth.col<1>() && col<2>() == oth.col<2>();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<3, 3, NumT>::operator!=(const Mat3<NumT>& oth) const noexcept {
+  return !(*this == oth);
+}
+
+// ----- ----- ---- Linear Algebra Operations ----- ----- ----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat3<NumT> Mat<3, 3, NumT>::operator*(const Mat3<NumT>& oth) const noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return multiply_native(oth);
+  }
+
+  Mat result;
+  for (size_t j = 0; j < 3; ++j) {
+    result.columns[j] = detail::pad_column(*this * detail::unpad_column(oth.columns[j]));
+  }
+  return result;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Vec3<NumT> Mat<3, 3, NumT>::operator*(const Vec3<NumT>& vec) const noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return detail::unpad_column(multiply_native(detail::pad_column(vec)));
+  }
+
+  return col<0>() * vec.x() + col<1>() * vec.y() + col<2>() * vec.z();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+Mat3<NumT> Mat<3, 3, NumT>::multiply_native(const Mat3<NumT>& oth) const noexcept {
+  // columns of *this stay in registers for all 3 result columns:
+  const simd::Pack<NumT, 4> a0 = columns[0].to_pack();
+  const simd::Pack<NumT, 4> a1 = columns[1].to_pack();
+  const simd::Pack<NumT, 4> a2 = columns[2].to_pack();
+
+  Mat result;
+  for (size_t j = 0; j < 3; ++j) {
+    const Vec4<NumT>& b = oth.columns[j];
+    simd::Pack<NumT, 4> col = a0 * b.x();
+    col = col + a1 * b.y();
+    col = col + a2 * b.z();
+    result.columns[j] = Vec4<NumT>::FromPack(col);
+  }
+  return result;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+Vec4<NumT> Mat<3, 3, NumT>::multiply_native(const Vec4<NumT>& vec) const noexcept {
+  simd::Pack<NumT, 4> result = columns[0].to_pack() * vec.x();
+  result = result + columns[1].to_pack() * vec.y();
+  result = result + columns[2].to_pack() * vec.z();
+  return Vec4<NumT>::FromPack(result);
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT Mat<3, 3, NumT>::determinant() const noexcept {
+  return col<0>().triple(col<1>(), col<2>());
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat3<NumT> Mat<3, 3, NumT>::transpose() const noexcept {
+  return Mat3<NumT>(row<0>(), row<1>(), row<2>());
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT Mat<3, 3, NumT>::trace() const noexcept {
+  return columns[0][0] + columns[1][1] + columns[2][2];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat3<NumT> Mat<3, 3, NumT>::inverse() const noexcept requires (std::floating_point<NumT>) {
+  const Vec3<NumT> c0 = col<0>();
+  const Vec3<NumT> c1 = col<1>();
+  const Vec3<NumT> c2 = col<2>();
+
+  const Vec3<NumT> r0 = c1.cross(c2);
+  const NumT inv_det = NumT(1) / c0.dot(r0);
+  return Mat3<NumT>(r0 * inv_det, c2.cross(c0) * inv_det, c0.cross(c1) * inv_det).transpose();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<3, 3, NumT>::is_identity() const noexcept {
+  return *this == Mat();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<3, 3, NumT>::is_diagonal() const noexcept {
+  return columns[0][1] == NumT(0) && columns[0][2] == NumT(0) &&
+    columns[1][0] == NumT(0) && columns[1][2] == NumT(0) &&
+    columns[2][0] == NumT(0) && columns[2][1] == NumT(0);
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<3, 3, NumT>::is_symmetric() const noexcept {
+  return *this == transpose();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<3, 3, NumT>::is_orthogonal() const noexcept {
+  // M^T * M == I, the dot products of unit columns carry a few rounding errors:
+  NumT tolerance = NumT(0);
+  if constexpr (std::floating_point<NumT>) tolerance = NumT(8) * std::numeric_limits<NumT>::epsilon();
+
+  const Mat3<NumT> product = transpose() * *this;
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      const NumT diff = product(i, j) - (i == j ? NumT(1) : NumT(0));
+      if (diff > tolerance || -diff > tolerance) return false;
+    }
+  }
+  return true;
+}
+
+// ----- ----- ---- Utility functional methods ----- ----- ----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+template <typename Func> requires std::invocable<Func, NumT>
+constexpr auto Mat<3, 3, NumT>::map(Func&& func) noexcept(std::is_nothrow_invocable_v<Func, NumT>)
+  -> Mat3<std::invoke_result_t<Func, NumT>>
+{
+  return Mat<3, 3, std::invoke_result_t<Func, NumT>>(
+    col<0>().map(func),
+    col<1>().map(func),
+    col<2>().map(func)
+  );
+}
+
+// ----- ----- ---- External Operators ---- ----- ----
+template<typename NumT>
+constexpr Mat3<NumT> operator*(NumT scalar, const Mat3<NumT>& mat) noexcept {
+  return mat * scalar;
+}
+
+} // namespace ayan::math
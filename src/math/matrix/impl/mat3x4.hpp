@@ -0,0 +1,205 @@
+#pragma once
+
+#include <type_traits>
+
+#include "../mat3x4.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<3, 4, NumT>::Mat() noexcept : rows {
+  Vec4<NumT>(NumT(1), NumT(0), NumT(0), NumT(0)),
+  Vec4<NumT>(NumT(0), NumT(1), NumT(0), NumT(0)),
+  Vec4<NumT>(NumT(0), NumT(0), NumT(1), NumT(0))
+} {}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<3, 4, NumT> Mat<3, 4, NumT>::Identity() noexcept {
+  return Mat();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<3, 4, NumT>::Mat(const Vec4<NumT>& row0, const Vec4<NumT>& row1, const Vec4<NumT>& row2) noexcept
+: rows{row0, row1, row2} {}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<3, 4, NumT>::Mat(const Mat3<NumT>& linear, const Vec3<NumT>& translation) noexcept
+: rows{
+  Vec4<NumT>(linear(0, 0), linear(0, 1), linear(0, 2), translation.x()),
+  Vec4<NumT>(linear(1, 0), linear(1, 1), linear(1, 2), translation.y()),
+  Vec4<NumT>(linear(2, 0), linear(2, 1), linear(2, 2), translation.z())
+} {}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+template<typename U> requires (std::same_as<U, NumT> || std::convertible_to<U, NumT>)
+constexpr Mat<3, 4, NumT>::Mat(std::initializer_list<U> init_list) noexcept : Mat() {
+  if (init_list.size() != 12) return;
+  auto it = init_list.begin();
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 4; ++j, ++it) {
+      rows[i][j] = static_cast<NumT>(*it);
+    }
+  }
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<3, 4, NumT>::Mat(const Mat4<NumT>& mat) noexcept
+: rows{mat.template row<0>(), mat.template row<1>(), mat.template row<2>()} {}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat<3, 4, NumT> Mat<3, 4, NumT>::Translation(const Vec3<NumT>& offset) noexcept {
+  Mat result;
+  result.rows[0].w() = offset.x();
+  result.rows[1].w() = offset.y();
+  result.rows[2].w() = offset.z();
+  return result;
+}
+
+// ----- ----- ---- Element Access ---- ----- -----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+template <size_t index> requires (index < 3)
+constexpr Vec4<NumT>& Mat<3, 4, NumT>::row() noexcept {
+  return rows[index];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+template <size_t index> requires (index < 3)
+constexpr const Vec4<NumT>& Mat<3, 4, NumT>::row() const noexcept {
+  return rows[index];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT& Mat<3, 4, NumT>::operator()(size_t row, size_t col) noexcept {
+  return rows[row][col];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr const NumT& Mat<3, 4, NumT>::operator()(size_t row, size_t col) const noexcept {
+  return rows[row][col];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat3<NumT> Mat<3, 4, NumT>::linear() const noexcept {
+  return Mat3<NumT>(
+    Vec3<NumT>(rows[0].x(), rows[1].x(), rows[2].x()),
+    Vec3<NumT>(rows[0].y(), rows[1].y(), rows[2].y()),
+    Vec3<NumT>(rows[0].z(), rows[1].z(), rows[2].z())
+  );
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Vec3<NumT> Mat<3, 4, NumT>::translation() const noexcept {
+  return Vec3<NumT>(rows[0].w(), rows[1].w(), rows[2].w());
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat4<NumT> Mat<3, 4, NumT>::to_mat4() const noexcept {
+  return Mat4<NumT>(
+    Vec4<NumT>(rows[0].x(), rows[1].x(), rows[2].x(), NumT(0)),
+    Vec4<NumT>(rows[0].y(), rows[1].y(), rows[2].y(), NumT(0)),
+    Vec4<NumT>(rows[0].z(), rows[1].z(), rows[2].z(), NumT(0)),
+    Vec4<NumT>(rows[0].w(), rows[1].w(), rows[2].w(), NumT(1))
+  );
+}
+
+// ----- ----- ---- Operators ---- ----- -----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat3x4<NumT>& Mat<3, 4, NumT>::operator*=(const Mat3x4<NumT>& oth) noexcept {
+  *this = *this * oth;
+  return *this;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<3, 4, NumT>::operator==(const Mat3x4<NumT>& oth) const noexcept {
+  return rows[0] == oth.rows[0] && rows[1] == oth.rows[1] && rows[2] == oth.rows[2];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<3, 4, NumT>::operator!=(const Mat3x4<NumT>& oth) const noexcept {
+  return !(*this == oth);
+}
+
+// ----- ----- ---- Linear Algebra Operations ----- ----- ----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat3x4<NumT> Mat<3, 4, NumT>::operator*(const Mat3x4<NumT>& oth) const noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return multiply_native(oth);
+  }
+
+  Mat result;
+  for (size_t i = 0; i < 3; ++i) {
+    const Vec4<NumT>& a = rows[i];
+    result.rows[i] = oth.rows[0] * a.x() + oth.rows[1] * a.y() + oth.rows[2] * a.z();
+    result.rows[i].w() += a.w();
+  }
+  return result;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+Mat3x4<NumT> Mat<3, 4, NumT>::multiply_native(const Mat3x4<NumT>& oth) const noexcept {
+  // rows of oth stay in registers for all 3 result rows:
+  const simd::Pack<NumT, 4> b0 = oth.rows[0].to_pack();
+  const simd::Pack<NumT, 4> b1 = oth.rows[1].to_pack();
+  const simd::Pack<NumT, 4> b2 = oth.rows[2].to_pack();
+
+  // same order as the constexpr path, t(i) is added to the w lane last:
+  Mat result;
+  for (size_t i = 0; i < 3; ++i) {
+    const Vec4<NumT>& a = rows[i];
+    simd::Pack<NumT, 4> row = b0 * a.x();
+    row = row + b1 * a.y();
+    row = row + b2 * a.z();
+    result.rows[i] = Vec4<NumT>::FromPack(row);
+    result.rows[i].w() += a.w();
+  }
+  return result;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Vec3<NumT> Mat<3, 4, NumT>::transform_point(const Vec3<NumT>& point) const noexcept {
+  const Vec4<NumT> homogeneous(point.x(), point.y(), point.z(), NumT(1));
+  return Vec3<NumT>(rows[0].dot(homogeneous), rows[1].dot(homogeneous), rows[2].dot(homogeneous));
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Vec3<NumT> Mat<3, 4, NumT>::transform_vector(const Vec3<NumT>& vec) const noexcept {
+  const Vec4<NumT> direction(vec.x(), vec.y(), vec.z(), NumT(0));
+  return Vec3<NumT>(rows[0].dot(direction), rows[1].dot(direction), rows[2].dot(direction));
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT Mat<3, 4, NumT>::determinant() const noexcept {
+  const Vec3<NumT> r0(rows[0].x(), rows[0].y(), rows[0].z());
+  const Vec3<NumT> r1(rows[1].x(), rows[1].y(), rows[1].z());
+  const Vec3<NumT> r2(rows[2].x(), rows[2].y(), rows[2].z());
+  return r0.dot(r1.cross(r2));
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat3x4<NumT> Mat<3, 4, NumT>::inverse() const noexcept requires (std::floating_point<NumT>) {
+  const Vec3<NumT> a0(rows[0].x(), rows[1].x(), rows[2].x());
+  const Vec3<NumT> a1(rows[0].y(), rows[1].y(), rows[2].y());
+  const Vec3<NumT> a2(rows[0].z(), rows[1].z(), rows[2].z());
+  const Vec3<NumT> t = translation();
+
+  // rows of A^-1 are the pairwise cross products of the columns of A over det(A),
+  // stored as rows here, so no transpose is needed:
+  const NumT inv_det = NumT(1) / a0.dot(a1.cross(a2));
+  const Vec3<NumT> r0 = a1.cross(a2) * inv_det;
+  const Vec3<NumT> r1 = a2.cross(a0) * inv_det;
+  const Vec3<NumT> r2 = a0.cross(a1) * inv_det;
+
+  return Mat(
+    Vec4<NumT>(r0.x(), r0.y(), r0.z(), -r0.dot(t)),
+    Vec4<NumT>(r1.x(), r1.y(), r1.z(), -r1.dot(t)),
+    Vec4<NumT>(r2.x(), r2.y(), r2.z(), -r2.dot(t))
+  );
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<3, 4, NumT>::is_identity() const noexcept {
+  return *this == Mat();
+}
+
+} // namespace ayan::math
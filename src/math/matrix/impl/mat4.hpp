@@ -1,8 +1,11 @@
 #pragma once
 
+#include <limits>
+#include <type_traits>
+
 #include "../mat4.hpp"
 
-namespace ayan::math {
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
 
 // ----- ----- ---- Constructors ---- ----- -----
 template<typename NumT> requires (detail::ValidNumType<NumT>)
@@ -54,7 +57,7 @@ constexpr Mat<4, 4, NumT>::Mat(std::initializer_list<U> init_list) noexcept : Ma
 // ----- ----- ---- Element Access ---- ----- -----
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 template <size_t index> requires (index < 4)
-constexpr Vec4<NumT> Mat<4, 4, NumT>::row() noexcept {
+constexpr Vec4<NumT> Mat<4, 4, NumT>::row() const noexcept {
   Vec4<NumT> vec;
   switch (index){
     case 0: {
@@ -102,6 +105,16 @@ constexpr const Vec4<NumT>& Mat<4, 4, NumT>::col() const noexcept {
   return columns[index];
 }
 
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT& Mat<4, 4, NumT>::operator()(size_t row, size_t col) noexcept {
+  return columns[col][row];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr const NumT& Mat<4, 4, NumT>::operator()(size_t row, size_t col) const noexcept {
+  return columns[col][row];
+}
+
 // ----- ----- ---- Operators ---- ----- -----
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr Mat4<NumT> Mat<4, 4, NumT>::operator+(const Mat4<NumT>& oth) const noexcept {
@@ -174,15 +187,57 @@ constexpr bool Mat<4, 4, NumT>::operator!=(const Mat4<NumT>& oth) const noexcept
 // ----- ----- ---- Linear Algebra Operations ----- ----- ----
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr Mat4<NumT> Mat<4, 4, NumT>::operator*(const Mat4<NumT>& oth) const noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return multiply_native(oth);
+  }
+
   Mat result;
-  for (size_t i = 0; i < 4; ++i) {
-    for (size_t j = 0; j < 4; ++j) {
-      result(i, j) = row(i).dot(oth.col(j));
-    }
+  for (size_t j = 0; j < 4; ++j) {
+    result.columns[j] = *this * oth.columns[j];
+  }
+  return result;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Vec4<NumT> Mat<4, 4, NumT>::operator*(const Vec4<NumT>& vec) const noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return multiply_native(vec);
+  }
+
+  return columns[0] * vec.x() + columns[1] * vec.y() + columns[2] * vec.z() + columns[3] * vec.w();
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+Mat4<NumT> Mat<4, 4, NumT>::multiply_native(const Mat4<NumT>& oth) const noexcept {
+  // columns of *this stay in registers for all 4 result columns. Separate
+  // multiplies and adds in the order of the constexpr path: the same bits at
+  // compile time, at run time and on every dispatch level:
+  const simd::Pack<NumT, 4> a0 = columns[0].to_pack();
+  const simd::Pack<NumT, 4> a1 = columns[1].to_pack();
+  const simd::Pack<NumT, 4> a2 = columns[2].to_pack();
+  const simd::Pack<NumT, 4> a3 = columns[3].to_pack();
+
+  Mat result;
+  for (size_t j = 0; j < 4; ++j) {
+    const Vec4<NumT>& b = oth.columns[j];
+    simd::Pack<NumT, 4> col = a0 * b.x();
+    col = col + a1 * b.y();
+    col = col + a2 * b.z();
+    col = col + a3 * b.w();
+    result.columns[j] = Vec4<NumT>::FromPack(col);
   }
   return result;
 }
 
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+Vec4<NumT> Mat<4, 4, NumT>::multiply_native(const Vec4<NumT>& vec) const noexcept {
+  simd::Pack<NumT, 4> result = columns[0].to_pack() * vec.x();
+  result = result + columns[1].to_pack() * vec.y();
+  result = result + columns[2].to_pack() * vec.z();
+  result = result + columns[3].to_pack() * vec.w();
+  return Vec4<NumT>::FromPack(result);
+}
+
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr NumT Mat<4, 4, NumT>::determinant() const noexcept {
   NumT const& m00 = columns[0][0], m01 = columns[1][0], m02 = columns[2][0], m03 = columns[3][0];
@@ -203,41 +258,116 @@ constexpr NumT Mat<4, 4, NumT>::determinant() const noexcept {
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr Mat4<NumT> Mat<4, 4, NumT>::transpose() const noexcept {
-  auto m = Mat4<NumT>(
+  return Mat4<NumT>(
     row<0>(), row<1>(), row<2>(), row<3>()
   );
-  *this = m;
-  return *this;
 }
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr NumT Mat<4, 4, NumT>::trace() const noexcept {
-  // TODO: Implement trace calculation
-  return NumT{};
+  return columns[0][0] + columns[1][1] + columns[2][2] + columns[3][3];
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat4<NumT> Mat<4, 4, NumT>::inverse() const noexcept requires (std::floating_point<NumT>) {
+  const Vec4<NumT>& c0 = columns[0];
+  const Vec4<NumT>& c1 = columns[1];
+  const Vec4<NumT>& c2 = columns[2];
+  const Vec4<NumT>& c3 = columns[3];
+
+  // 2x2 sub-determinants of rows (r1, r2) taken from column pairs (2,3), (2,3), (1,3), (1,2):
+  auto factor = [&](size_t r1, size_t r2) {
+    return Vec4<NumT>(c2[r1], c2[r1], c1[r1], c1[r1]) * Vec4<NumT>(c3[r2], c3[r2], c3[r2], c2[r2]) -
+      Vec4<NumT>(c3[r1], c3[r1], c3[r1], c2[r1]) * Vec4<NumT>(c2[r2], c2[r2], c1[r2], c1[r2]);
+  };
+  const Vec4<NumT> fac0 = factor(2, 3);
+  const Vec4<NumT> fac1 = factor(1, 3);
+  const Vec4<NumT> fac2 = factor(1, 2);
+  const Vec4<NumT> fac3 = factor(0, 3);
+  const Vec4<NumT> fac4 = factor(0, 2);
+  const Vec4<NumT> fac5 = factor(0, 1);
+
+  const Vec4<NumT> vec0(c1[0], c0[0], c0[0], c0[0]);
+  const Vec4<NumT> vec1(c1[1], c0[1], c0[1], c0[1]);
+  const Vec4<NumT> vec2(c1[2], c0[2], c0[2], c0[2]);
+  const Vec4<NumT> vec3(c1[3], c0[3], c0[3], c0[3]);
+
+  const Vec4<NumT> sign_a(NumT(1), NumT(-1), NumT(1), NumT(-1));
+  const Vec4<NumT> sign_b(NumT(-1), NumT(1), NumT(-1), NumT(1));
+
+  // adjugate, column by column:
+  const Mat4<NumT> adjugate(
+    (vec1 * fac0 - vec2 * fac1 + vec3 * fac2) * sign_a,
+    (vec0 * fac0 - vec2 * fac3 + vec3 * fac4) * sign_b,
+    (vec0 * fac1 - vec1 * fac3 + vec3 * fac5) * sign_a,
+    (vec0 * fac2 - vec1 * fac4 + vec2 * fac5) * sign_b
+  );
+
+  // Laplace expansion along the first column reuses the first adjugate row:
+  const NumT det = c0.dot(adjugate.template row<0>());
+  return adjugate * (NumT(1) / det);
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Mat4<NumT> Mat<4, 4, NumT>::affine_inverse() const noexcept requires (std::floating_point<NumT>) {
+  const Vec3<NumT> a0(columns[0].x(), columns[0].y(), columns[0].z());
+  const Vec3<NumT> a1(columns[1].x(), columns[1].y(), columns[1].z());
+  const Vec3<NumT> a2(columns[2].x(), columns[2].y(), columns[2].z());
+  const Vec3<NumT> t(columns[3].x(), columns[3].y(), columns[3].z());
+
+  // rows of A^-1 are the pairwise cross products of the columns of A over det(A):
+  const NumT inv_det = NumT(1) / a0.dot(a1.cross(a2));
+  const Vec3<NumT> r0 = a1.cross(a2) * inv_det;
+  const Vec3<NumT> r1 = a2.cross(a0) * inv_det;
+  const Vec3<NumT> r2 = a0.cross(a1) * inv_det;
+
+  return Mat4<NumT>(
+    Vec4<NumT>(r0.x(), r1.x(), r2.x(), NumT(0)),
+    Vec4<NumT>(r0.y(), r1.y(), r2.y(), NumT(0)),
+    Vec4<NumT>(r0.z(), r1.z(), r2.z(), NumT(0)),
+    Vec4<NumT>(-r0.dot(t), -r1.dot(t), -r2.dot(t), NumT(1))
+  );
 }
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr bool Mat<4, 4, NumT>::is_identity() const noexcept {
-  // TODO: Implement identity check
-  return false;
+  return *this == Mat();
 }
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr bool Mat<4, 4, NumT>::is_diagonal() const noexcept {
-  // TODO: Implement diagonal check
-  return false;
+  for (size_t j = 0; j < 4; ++j) {
+    for (size_t i = 0; i < 4; ++i) {
+      if (i != j && columns[j][i] != NumT(0)) return false;
+    }
+  }
+  return true;
 }
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr bool Mat<4, 4, NumT>::is_symmetric() const noexcept {
-  // TODO: Implement symmetric check
-  return false;
+  return *this == transpose();
 }
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr bool Mat<4, 4, NumT>::is_orthogonal() const noexcept {
-  // TODO: Implement orthogonal check
-  return false;
+  // M^T * M == I, the dot products of unit columns carry a few rounding errors:
+  NumT tolerance = NumT(0);
+  if constexpr (std::floating_point<NumT>) tolerance = NumT(8) * std::numeric_limits<NumT>::epsilon();
+
+  const Mat4<NumT> product = transpose() * *this;
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 4; ++j) {
+      const NumT diff = product(i, j) - (i == j ? NumT(1) : NumT(0));
+      if (diff > tolerance || -diff > tolerance) return false;
+    }
+  }
+  return true;
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool Mat<4, 4, NumT>::is_affine() const noexcept {
+  return row<3>() == Vec4<NumT>::UnitW();
 }
 
 // ----- ----- ---- Utility functional methods ----- ----- ----
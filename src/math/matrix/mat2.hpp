@@ -0,0 +1,80 @@
+#pragma once
+
+#include <concepts>
+#include <initializer_list>
+#include <array>
+
+#include <ayan/math/vec.hpp>
+#include "fwd.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+class Mat<2, 2, NumT> {
+private:
+  // column-major storage, 4 contiguous values (one SSE register for float):
+  std::array<Vec2<NumT>, 2> columns;
+
+public:
+  // ----- ----- ---- Constructors ---- ----- -----
+  // Identity Mat as a neutral element in matrices multiplication:
+  constexpr Mat() noexcept;
+  static constexpr Mat Identity() noexcept;
+
+  constexpr Mat(const Vec2<NumT>& col0, const Vec2<NumT>& col1) noexcept;
+
+  template<typename U> requires (std::same_as<U, NumT> || std::convertible_to<U, NumT>)
+  constexpr Mat(std::initializer_list<U> init_list) noexcept;
+
+  // ----- ----- ---- Element Access ---- ----- -----
+  template <size_t index> requires (index < 2)
+  constexpr Vec2<NumT> row() const noexcept;
+
+  template <size_t index> requires (index < 2)
+  constexpr Vec2<NumT>& col() noexcept;
+
+  template <size_t index> requires (index < 2)
+  constexpr const Vec2<NumT>& col() const noexcept;
+
+  constexpr NumT& operator()(size_t row, size_t col) noexcept;
+  constexpr const NumT& operator()(size_t row, size_t col) const noexcept;
+
+  // ----- ----- ---- Operators ---- ----- -----
+  constexpr Mat2<NumT> operator+(const Mat2<NumT>& oth) const noexcept;
+  constexpr Mat2<NumT> operator-(const Mat2<NumT>& oth) const noexcept;
+  constexpr Mat2<NumT> operator*(NumT scalar) const noexcept;
+  constexpr Mat2<NumT> operator/(NumT scalar) const noexcept;
+  constexpr Mat2<NumT>& operator+=(const Mat2<NumT>& oth) noexcept;
+  constexpr Mat2<NumT>& operator*=(const Mat2<NumT>& oth) noexcept;
+  constexpr bool operator==(const Mat2<NumT>& oth) const noexcept;
+  constexpr bool operator!=(const Mat2<NumT>& oth) const noexcept;
+
+  // ----- ----- ---- Linear Algebra Operations ----- ----- ----
+  constexpr Mat2<NumT> operator*(const Mat2<NumT>& oth) const noexcept;
+  constexpr Vec2<NumT> operator*(const Vec2<NumT>& vec) const noexcept;
+  constexpr NumT determinant() const noexcept;
+  constexpr Mat2<NumT> transpose() const noexcept;
+  constexpr NumT trace() const noexcept;
+
+  // adjugate over the determinant, a singular matrix gives non-finite entries:
+  constexpr Mat2<NumT> inverse() const noexcept requires (std::floating_point<NumT>);
+
+  // Properties checking (exact comparisons, is_orthogonal() allows a few ulp for floats):
+  constexpr bool is_identity() const noexcept;
+  constexpr bool is_diagonal() const noexcept;
+  constexpr bool is_symmetric() const noexcept;
+  constexpr bool is_orthogonal() const noexcept;
+
+  // ----- ----- ---- Utility functional methods ----- ----- ----
+  template <typename Func> requires std::invocable<Func, NumT>
+  constexpr auto map(Func&& func) noexcept(std::is_nothrow_invocable_v<Func, NumT>)
+    -> Mat2<std::invoke_result_t<Func, NumT>>;
+};
+
+// ----- ----- ---- External Operators ---- ----- ----
+template<typename NumT>
+constexpr Mat2<NumT> operator*(NumT scalar, const Mat2<NumT>& mat) noexcept;
+
+} // namespace ayan::math
+
+#include "impl/mat2.hpp"
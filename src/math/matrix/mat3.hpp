@@ -0,0 +1,102 @@
+#pragma once
+
+#include <concepts>
+#include <initializer_list>
+#include <array>
+
+#include <ayan/math/vec.hpp>
+#include "fwd.hpp"
+#include "mat4.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+class Mat<3, 3, NumT> {
+private:
+  // column-major storage, every column is padded to a Vec4 so that it is loaded
+  // as one register (w is padding and never read):
+  std::array<Vec4<NumT>, 3> columns;
+
+public:
+  // ----- ----- ---- Constructors ---- ----- -----
+  // Identity Mat as a neutral element in matrices multiplication:
+  constexpr Mat() noexcept;
+  static constexpr Mat Identity() noexcept;
+
+  constexpr Mat(const Vec3<NumT>& col0, const Vec3<NumT>& col1, const Vec3<NumT>& col2) noexcept;
+
+  template<typename U> requires (std::same_as<U, NumT> || std::convertible_to<U, NumT>)
+  constexpr Mat(std::initializer_list<U> init_list) noexcept;
+
+  // upper-left 3x3 block of `mat` (drops translation and projection):
+  explicit constexpr Mat(const Mat4<NumT>& mat) noexcept;
+
+  // Shading frame (tangent, bitangent, normal) around the unit vector `normal`:
+  // right-handed, continuous except at normal.z() == -0, no normalization or
+  // division by a small number (Duff et al. 2017). Local -> world is *this * v,
+  // world -> local is transpose() * v:
+  static constexpr Mat OrthonormalBasis(const Vec3<NumT>& normal) noexcept requires (std::floating_point<NumT>);
+
+  // ----- ----- ---- Element Access ---- ----- -----
+  template <size_t index> requires (index < 3)
+  constexpr Vec3<NumT> row() const noexcept;
+
+  template <size_t index> requires (index < 3)
+  constexpr Vec3<NumT> col() const noexcept;
+
+  template <size_t index> requires (index < 3)
+  constexpr void set_col(const Vec3<NumT>& col) noexcept;
+
+  constexpr NumT& operator()(size_t row, size_t col) noexcept;
+  constexpr const NumT& operator()(size_t row, size_t col) const noexcept;
+
+  // the same matrix with (0, 0, 0, 1) as the last row and column:
+  constexpr Mat4<NumT> to_mat4() const noexcept;
+
+  // ----- ----- ---- Operators ---- ----- -----
+  constexpr Mat3<NumT> operator+(const Mat3<NumT>& oth) const noexcept;
+  constexpr Mat3<NumT> operator-(const Mat3<NumT>& oth) const noexcept;
+  constexpr Mat3<NumT> operator*(NumT scalar) const noexcept;
+  constexpr Mat3<NumT> operator/(NumT scalar) const noexcept;
+  constexpr Mat3<NumT>& operator+=(const Mat3<NumT>& oth) noexcept;
+  constexpr Mat3<NumT>& operator*=(const Mat3<NumT>& oth) noexcept;
+  constexpr bool operator==(const Mat3<NumT>& oth) const noexcept;
+  constexpr bool operator!=(const Mat3<NumT>& oth) const noexcept;
+
+  // ----- ----- ---- Linear Algebra Operations ----- ----- ----
+  // column combination as in Mat4 (3 broadcasts, multiplies and adds per
+  // column, no FMA):
+  constexpr Mat3<NumT> operator*(const Mat3<NumT>& oth) const noexcept;
+  constexpr Vec3<NumT> operator*(const Vec3<NumT>& vec) const noexcept;
+  constexpr NumT determinant() const noexcept;
+  constexpr Mat3<NumT> transpose() const noexcept;
+  constexpr NumT trace() const noexcept;
+
+  // rows of the inverse are the pairwise cross products of the columns over the
+  // determinant. A singular matrix gives non-finite entries:
+  constexpr Mat3<NumT> inverse() const noexcept requires (std::floating_point<NumT>);
+
+  // Properties checking (exact comparisons, is_orthogonal() allows a few ulp for floats):
+  constexpr bool is_identity() const noexcept;
+  constexpr bool is_diagonal() const noexcept;
+  constexpr bool is_symmetric() const noexcept;
+  constexpr bool is_orthogonal() const noexcept;
+
+  // ----- ----- ---- Utility functional methods ----- ----- ----
+  template <typename Func> requires std::invocable<Func, NumT>
+  constexpr auto map(Func&& func) noexcept(std::is_nothrow_invocable_v<Func, NumT>)
+    -> Mat3<std::invoke_result_t<Func, NumT>>;
+
+private:
+  // register kernels behind the constexpr operators (native packs only):
+  Mat3<NumT> multiply_native(const Mat3<NumT>& oth) const noexcept;
+  Vec4<NumT> multiply_native(const Vec4<NumT>& vec) const noexcept;
+};
+
+// ----- ----- ---- External Operators ---- ----- ----
+template<typename NumT>
+constexpr Mat3<NumT> operator*(NumT scalar, const Mat3<NumT>& mat) noexcept;
+
+} // namespace ayan::math
+
+#include "impl/mat3.hpp"
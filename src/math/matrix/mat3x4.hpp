@@ -0,0 +1,93 @@
+#pragma once
+
+#include <concepts>
+#include <initializer_list>
+#include <array>
+
+#include <ayan/math/vec.hpp>
+#include "fwd.hpp"
+#include "mat3.hpp"
+#include "mat4.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// Affine transform [A | t] with the implicit last row (0, 0, 0, 1): the upper
+// 3 rows of a Mat4, 48 bytes in float instead of 64. Meant for per-instance
+// storage; points and vectors go through the same 3 rows, so no conversion to
+// Mat4 is needed on the hot path.
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+class Mat<3, 4, NumT> {
+private:
+  // row-major storage, rows[i] = (A(i, 0), A(i, 1), A(i, 2), t(i)):
+  std::array<Vec4<NumT>, 3> rows;
+
+public:
+  // ----- ----- ---- Constructors ---- ----- -----
+  // Identity Mat as a neutral element in composition:
+  constexpr Mat() noexcept;
+  static constexpr Mat Identity() noexcept;
+
+  constexpr Mat(const Vec4<NumT>& row0, const Vec4<NumT>& row1, const Vec4<NumT>& row2) noexcept;
+
+  // [linear | translation]:
+  constexpr Mat(const Mat3<NumT>& linear, const Vec3<NumT>& translation) noexcept;
+
+  // 12 values, row by row:
+  template<typename U> requires (std::same_as<U, NumT> || std::convertible_to<U, NumT>)
+  constexpr Mat(std::initializer_list<U> init_list) noexcept;
+
+  // upper 3 rows of `mat`, exact if mat.is_affine():
+  explicit constexpr Mat(const Mat4<NumT>& mat) noexcept;
+
+  static constexpr Mat Translation(const Vec3<NumT>& offset) noexcept;
+
+  // ----- ----- ---- Element Access ---- ----- -----
+  template <size_t index> requires (index < 3)
+  constexpr Vec4<NumT>& row() noexcept;
+
+  template <size_t index> requires (index < 3)
+  constexpr const Vec4<NumT>& row() const noexcept;
+
+  constexpr NumT& operator()(size_t row, size_t col) noexcept;
+  constexpr const NumT& operator()(size_t row, size_t col) const noexcept;
+
+  constexpr Mat3<NumT> linear() const noexcept;
+  constexpr Vec3<NumT> translation() const noexcept;
+
+  // the same matrix with (0, 0, 0, 1) as the last row:
+  constexpr Mat4<NumT> to_mat4() const noexcept;
+
+  // ----- ----- ---- Operators ---- ----- -----
+  constexpr Mat3x4<NumT>& operator*=(const Mat3x4<NumT>& oth) noexcept;
+  constexpr bool operator==(const Mat3x4<NumT>& oth) const noexcept;
+  constexpr bool operator!=(const Mat3x4<NumT>& oth) const noexcept;
+
+  // ----- ----- ---- Linear Algebra Operations ----- ----- ----
+  // *this applied after oth. Row `i` of the product is a linear combination of
+  // the rows of oth weighted by rows[i], the implicit last row only adds t(i)
+  // to the translation. No FMA, so every path gives the same bits:
+  constexpr Mat3x4<NumT> operator*(const Mat3x4<NumT>& oth) const noexcept;
+
+  // A * point + t, a dot product per row:
+  constexpr Vec3<NumT> transform_point(const Vec3<NumT>& point) const noexcept;
+  // A * vec, the translation is ignored:
+  constexpr Vec3<NumT> transform_vector(const Vec3<NumT>& vec) const noexcept;
+
+  constexpr NumT determinant() const noexcept;
+
+  // [A^-1 | -A^-1 * t] by cross products, as Mat4::affine_inverse(). A singular
+  // A gives non-finite entries:
+  constexpr Mat3x4<NumT> inverse() const noexcept requires (std::floating_point<NumT>);
+
+  constexpr bool is_identity() const noexcept;
+
+private:
+  // register kernel behind the constexpr composition (native packs only):
+  Mat3x4<NumT> multiply_native(const Mat3x4<NumT>& oth) const noexcept;
+};
+
+static_assert(sizeof(Mat3x4f) == 48, "Mat3x4f must stay 3 rows of 4 floats");
+
+} // namespace ayan::math
+
+#include "impl/mat3x4.hpp"
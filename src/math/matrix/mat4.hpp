@@ -7,7 +7,7 @@
 #include <ayan/math/vec.hpp>
 #include "fwd.hpp"
 
-namespace ayan::math {
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 class Mat<4, 4, NumT> {
@@ -30,7 +30,7 @@ public:
 
   // ----- ----- ---- Element Access ---- ----- -----
   template <size_t index> requires (index < 4)
-  constexpr Vec4<NumT> row() noexcept;
+  constexpr Vec4<NumT> row() const noexcept;
 
   template <size_t index> requires (index < 4)
   constexpr Vec4<NumT>& col() noexcept;
@@ -38,6 +38,9 @@ public:
   template <size_t index> requires (index < 4)
   constexpr const Vec4<NumT>& col() const noexcept;
 
+  constexpr NumT& operator()(size_t row, size_t col) noexcept;
+  constexpr const NumT& operator()(size_t row, size_t col) const noexcept;
+
   // ----- ----- ---- Operators ---- ----- -----
   constexpr Mat4<NumT> operator+(const Mat4<NumT>& oth) const noexcept;
   constexpr Mat4<NumT> operator-(const Mat4<NumT>& oth) const noexcept;
@@ -49,21 +52,38 @@ public:
   constexpr bool operator!=(const Mat4<NumT>& oth) const noexcept;
 
   // ----- ----- ---- Linear Algebra Operations ----- ----- ----
+  // column `j` of the product is a linear combination of the columns of *this
+  // weighted by the components of oth.col<j>() (4 broadcasts, multiplies and
+  // adds per column). No FMA: constant evaluation and every dispatch level give the same bits:
   constexpr Mat4<NumT> operator*(const Mat4<NumT>& oth) const noexcept;
+  constexpr Vec4<NumT> operator*(const Vec4<NumT>& vec) const noexcept;
   constexpr NumT determinant() const noexcept;
   constexpr Mat4<NumT> transpose() const noexcept;
   constexpr NumT trace() const noexcept;
 
+  // general inverse by cofactors, evaluated 4 lanes at a time on the columns.
+  // A singular matrix gives non-finite entries (check determinant() if unsure):
+  constexpr Mat4<NumT> inverse() const noexcept requires (std::floating_point<NumT>);
+  // inverse of [A | t; 0 0 0 1] as [A^-1 | -A^-1 * t; 0 0 0 1], valid only if is_affine():
+  constexpr Mat4<NumT> affine_inverse() const noexcept requires (std::floating_point<NumT>);
+
   // Properties checking:
   constexpr bool is_identity() const noexcept;
   constexpr bool is_diagonal() const noexcept;
   constexpr bool is_symmetric() const noexcept;
   constexpr bool is_orthogonal() const noexcept;
+  // last row is exactly (0, 0, 0, 1):
+  constexpr bool is_affine() const noexcept;
 
   // ----- ----- ---- Utility functional methods ----- ----- ----
   template <typename Func> requires std::invocable<Func, NumT>
   constexpr auto map(Func&& func) noexcept(std::is_nothrow_invocable_v<Func, NumT>)
     -> Mat4<std::invoke_result_t<Func, NumT>>;
+
+private:
+  // register kernels behind the constexpr operators (native packs only):
+  Mat4<NumT> multiply_native(const Mat4<NumT>& oth) const noexcept;
+  Vec4<NumT> multiply_native(const Vec4<NumT>& vec) const noexcept;
 };
 
 // ----- ----- ---- External Operators ---- ----- ----
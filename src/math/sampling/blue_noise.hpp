@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "../vec/vec2.hpp"
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                  BLUE-NOISE TILE SAMPLER             |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// Hierarchically ordered pixels (Ahmed and Wonka, "Screen-Space Blue-Noise
+// Diffusion of Monte Carlo Sampling Error via Hierarchical Ordering of
+// Pixels", 2020). Every pixel of a 2^order x 2^order tile takes a consecutive
+// run of samples_per_pixel indices from one Owen-scrambled Sobol sequence.
+// The run is chosen by the pixel's Morton code with each base-4 digit
+// randomly permuted. Any aligned 2^j x 2^j block of pixels then holds a
+// stratified set of samples, so the error of neighbouring pixels is
+// anti-correlated (blue noise) without any precomputed texture. The tile
+// repeats over the screen.
+// Dimensions come in pairs (2n, 2n + 1) scrambled independently, best with a
+// power of two samples_per_pixel. A sample is a pure function of
+// (seed, pixel, sample, dimension).
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+class BlueNoiseSampler {
+private: // Fields:
+  uint32_t spp;
+  uint32_t order; // tile side is 2^order pixels;
+  uint32_t seed;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  // 4^tile_order * samples_per_pixel must fit in 32 bits, tile_order is in [1, 8]:
+  explicit BlueNoiseSampler(uint32_t samples_per_pixel, uint32_t tile_order = 6, uint32_t seed = 0) noexcept;
+
+  // ----- ----- ---- Properties ----- ----- ----
+  uint32_t samples_per_pixel() const noexcept;
+  uint32_t tile_size() const noexcept;
+
+  // ----- ----- ---- Samples ----- ----- ----
+  // `sample` < samples_per_pixel(), as a 32-bit fraction of 1:
+  uint32_t sample_bits(const Vec2i& pixel, uint32_t sample, uint32_t dimension) const noexcept;
+  // in [0, 1), the top 24 bits of sample_bits():
+  float sample(const Vec2i& pixel, uint32_t sample, uint32_t dimension) const noexcept;
+
+  // out[i] = sample(pixel, first_sample + i, dimension), 8 (AVX2) or 4 (SSE2) at a time:
+  void samples(const Vec2i& pixel, uint32_t first_sample, uint32_t dimension, std::span<float> out) const noexcept;
+};
+
+} // namespace ayan::math
+
+#include "impl/blue_noise.hpp"
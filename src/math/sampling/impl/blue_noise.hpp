@@ -0,0 +1,84 @@
+#pragma once
+
+#include "../blue_noise.hpp"
+#include "../../curve/morton.hpp"
+#include "scramble.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+// the 24 permutations of {0, 1, 2, 3}, 2 bits per image:
+inline constexpr uint8_t digit_permutations[24] = {
+  0xe4, 0xb4, 0xd8, 0x78, 0x9c, 0x6c, 0xe1, 0xb1, 0xc9, 0x39, 0x8d, 0x2d,
+  0xd2, 0x72, 0xc6, 0x36, 0x4e, 0x1e, 0x93, 0x63, 0x87, 0x27, 0x4b, 0x1b
+};
+
+// Morton code of `tile` (2 * order bits) with the digit of every level permuted
+// by a hash of the digits above it, a random quadtree order of the tile:
+inline uint32_t scrambled_pixel_index(uint32_t x, uint32_t y, uint32_t order, uint32_t seed) noexcept {
+  const uint32_t code = interleave16(x) | (interleave16(y) << 1);
+  uint32_t result = 0;
+  for (uint32_t level = 0; level < order; ++level) {
+    const uint32_t shift = 2 * (order - 1 - level);
+    // the digits above with a leading 1, unique over all levels:
+    const uint32_t node = (code >> (shift + 2)) | (1u << (2 * level));
+    const uint32_t permutation = digit_permutations[hash_combine(seed, node) % 24];
+    const uint32_t digit = (code >> shift) & 3u;
+    result |= ((permutation >> (2 * digit)) & 3u) << shift;
+  }
+  return result;
+}
+
+} // namespace detail
+
+// ----- ----- ---- Constructors ---- ----- -----
+inline BlueNoiseSampler::BlueNoiseSampler(uint32_t samples_per_pixel, uint32_t tile_order, uint32_t seed) noexcept
+: spp(samples_per_pixel), order(tile_order), seed(seed) {}
+
+// ----- ----- ---- Properties ----- ----- ----
+inline uint32_t BlueNoiseSampler::samples_per_pixel() const noexcept { return spp; }
+
+inline uint32_t BlueNoiseSampler::tile_size() const noexcept { return 1u << order; }
+
+// ----- ----- ---- Samples ----- ----- ----
+inline uint32_t BlueNoiseSampler::sample_bits(const Vec2i& pixel, uint32_t sample, uint32_t dimension) const noexcept {
+  const uint32_t pair_seed = detail::hash_combine(seed, dimension / 2);
+  const uint32_t mask = tile_size() - 1;
+  const uint32_t first = detail::scrambled_pixel_index(uint32_t(pixel.x()) & mask, uint32_t(pixel.y()) & mask,
+    order, pair_seed) * spp;
+  return detail::owen_scramble(detail::sobol_bits(first + sample, dimension % 2),
+    detail::hash_combine(pair_seed, dimension % 2 + 1));
+}
+
+inline float BlueNoiseSampler::sample(const Vec2i& pixel, uint32_t sample, uint32_t dimension) const noexcept {
+  return detail::unit_float(sample_bits(pixel, sample, dimension));
+}
+
+inline void BlueNoiseSampler::samples(const Vec2i& pixel, uint32_t first_sample, uint32_t dimension,
+  std::span<float> out) const noexcept
+{
+  const uint32_t pair_seed = detail::hash_combine(seed, dimension / 2);
+  const uint32_t scramble = detail::hash_combine(pair_seed, dimension % 2 + 1);
+  const uint32_t mask = tile_size() - 1;
+  const uint32_t first = detail::scrambled_pixel_index(uint32_t(pixel.x()) & mask, uint32_t(pixel.y()) & mask,
+    order, pair_seed) * spp + first_sample;
+
+  size_t i = 0;
+#if defined(AYAN_SIMD_SSE2)
+  constexpr size_t Lanes = detail::uint32_lanes;
+  using lanes_type = detail::UintLanes<uint32_t, Lanes>;
+  constexpr uint32_t lane_offsets[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+  const lanes_type offsets = lanes_type::LoadUnaligned(lane_offsets);
+  for (const size_t end = out.size() - out.size() % Lanes; i < end; i += Lanes) {
+    const lanes_type index = offsets + (first + uint32_t(i));
+    detail::unit_floats(detail::owen_scramble(detail::sobol_bits(index, dimension % 2), scramble))
+      .store_unaligned(out.data() + i);
+  }
+#endif
+  for (; i < out.size(); ++i) {
+    out[i] = detail::unit_float(detail::owen_scramble(detail::sobol_bits(first + uint32_t(i), dimension % 2), scramble));
+  }
+}
+
+} // namespace ayan::math
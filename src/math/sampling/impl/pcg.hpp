@@ -0,0 +1,181 @@
+#pragma once
+
+#include "../pcg.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+inline constexpr uint64_t pcg_multiplier = 6364136223846793005ull;
+
+// splitmix64 finalizer, spreads (pixel, sample) over the whole seed space:
+constexpr uint64_t mix64(uint64_t x) noexcept {
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+constexpr uint32_t pcg_output(uint64_t state) noexcept {
+  const uint32_t xorshifted = uint32_t(((state >> 18) ^ state) >> 27);
+  const uint32_t rot = uint32_t(state >> 59);
+  return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+}
+
+constexpr float pcg_unit_float(uint32_t bits) noexcept {
+  return float(bits >> 8) * 0x1p-24f;
+}
+
+// the affine map of `delta` LCG steps, state * mult + plus (Brown, "Random number
+// generation with arbitrary strides"):
+inline uint64_t pcg_advance(uint64_t state, uint64_t inc, uint64_t delta) noexcept {
+  uint64_t cur_mult = pcg_multiplier;
+  uint64_t cur_plus = inc;
+  uint64_t acc_mult = 1;
+  uint64_t acc_plus = 0;
+  for (; delta > 0; delta >>= 1) {
+    if (delta & 1) {
+      acc_mult *= cur_mult;
+      acc_plus = acc_plus * cur_mult + cur_plus;
+    }
+    cur_plus = (cur_mult + 1) * cur_plus;
+    cur_mult *= cur_mult;
+  }
+  return acc_mult * state + acc_plus;
+}
+
+#if defined(AYAN_SIMD_AVX2)
+// 4 lanes one step forward, their outputs as 4 x uint32_t:
+AYAN_SIMD_INLINE __m128i pcg_step4(uint64_t* states, const uint64_t* incs) noexcept {
+  const __m256i old = _mm256_load_si256(reinterpret_cast<const __m256i*>(states));
+  const __m256i inc = _mm256_load_si256(reinterpret_cast<const __m256i*>(incs));
+
+  // the low 64 bits of old * multiplier from three 32 x 32 -> 64 products:
+  const __m256i mult_low = _mm256_set1_epi64x(int64_t(pcg_multiplier & 0xffffffffu));
+  const __m256i mult_high = _mm256_set1_epi64x(int64_t(pcg_multiplier >> 32));
+  const __m256i low = _mm256_mul_epu32(old, mult_low);
+  const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(old, 32), mult_low),
+    _mm256_mul_epu32(old, mult_high));
+  const __m256i next = _mm256_add_epi64(_mm256_add_epi64(low, _mm256_slli_epi64(cross, 32)), inc);
+  _mm256_store_si256(reinterpret_cast<__m256i*>(states), next);
+
+  // low 32 bits of each 64-bit lane:
+  const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+  const __m256i xorshifted64 = _mm256_srli_epi64(_mm256_xor_si256(_mm256_srli_epi64(old, 18), old), 27);
+  const __m128i xorshifted = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(xorshifted64, even));
+  const __m128i rot = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(_mm256_srli_epi64(old, 59), even));
+  // a shift by 32 gives 0, so rot = 0 needs no masking:
+  return _mm_or_si128(_mm_srlv_epi32(xorshifted, rot),
+    _mm_sllv_epi32(xorshifted, _mm_sub_epi32(_mm_set1_epi32(32), rot)));
+}
+
+AYAN_SIMD_INLINE __m128 pcg_unit_float4(__m128i bits) noexcept {
+  return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(bits, 8)), _mm_set1_ps(0x1p-24f));
+}
+#endif
+
+} // namespace detail
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                        Pcg32                         |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+inline Pcg32::Pcg32() noexcept : state(0x853c49e6748fea9bull), inc(0xda3e39cb94b95bdbull) {}
+
+inline Pcg32::Pcg32(uint64_t seed, uint64_t stream) noexcept : state(0), inc((stream << 1) | 1u) {
+  next_u32();
+  state += seed;
+  next_u32();
+}
+
+inline Pcg32 Pcg32::ForSample(uint32_t pixel, uint32_t sample, uint32_t dimension, uint64_t seed) noexcept {
+  // neighbouring streams of one seed are correlated, every stream gets its own seed:
+  const uint64_t stream = (uint64_t(pixel) << 32) | sample;
+  Pcg32 rng(detail::mix64(stream ^ seed), stream);
+  rng.advance(dimension);
+  return rng;
+}
+
+inline uint32_t Pcg32::next_u32() noexcept {
+  const uint64_t old = state;
+  state = old * detail::pcg_multiplier + inc;
+  return detail::pcg_output(old);
+}
+
+inline float Pcg32::next_float() noexcept {
+  return detail::pcg_unit_float(next_u32());
+}
+
+inline void Pcg32::advance(uint64_t delta) noexcept {
+  state = detail::pcg_advance(state, inc, delta);
+}
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                        Pcg32x                        |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<size_t Lanes>
+Pcg32x<Lanes>::Pcg32x(const Pcg32* lanes) noexcept {
+  for (size_t i = 0; i < Lanes; ++i) {
+    states[i] = lanes[i].state;
+    incs[i] = lanes[i].inc;
+  }
+}
+
+template<size_t Lanes>
+Pcg32x<Lanes> Pcg32x<Lanes>::ForSamples(uint32_t pixel, uint32_t first_sample, uint32_t dimension, uint64_t seed) noexcept {
+  Pcg32 lanes[Lanes];
+  for (size_t i = 0; i < Lanes; ++i) lanes[i] = Pcg32::ForSample(pixel, first_sample + uint32_t(i), dimension, seed);
+  return Pcg32x(lanes);
+}
+
+template<size_t Lanes>
+Pcg32x<Lanes> Pcg32x<Lanes>::ForPixels(uint32_t first_pixel, uint32_t sample, uint32_t dimension, uint64_t seed) noexcept {
+  Pcg32 lanes[Lanes];
+  for (size_t i = 0; i < Lanes; ++i) lanes[i] = Pcg32::ForSample(first_pixel + uint32_t(i), sample, dimension, seed);
+  return Pcg32x(lanes);
+}
+
+template<size_t Lanes>
+Pcg32 Pcg32x<Lanes>::lane(size_t index) const noexcept {
+  Pcg32 rng;
+  rng.state = states[index];
+  rng.inc = incs[index];
+  return rng;
+}
+
+template<size_t Lanes>
+void Pcg32x<Lanes>::next_u32(uint32_t* out) noexcept {
+#if defined(AYAN_SIMD_AVX2)
+  for (size_t i = 0; i < Lanes; i += 4) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), detail::pcg_step4(states + i, incs + i));
+  }
+#else
+  for (size_t i = 0; i < Lanes; ++i) {
+    const uint64_t old = states[i];
+    states[i] = old * detail::pcg_multiplier + incs[i];
+    out[i] = detail::pcg_output(old);
+  }
+#endif
+}
+
+template<size_t Lanes>
+simd::Pack<float, Lanes> Pcg32x<Lanes>::next_float() noexcept {
+  using pack_type = simd::Pack<float, Lanes>;
+#if defined(AYAN_SIMD_AVX2)
+  if constexpr (Lanes == 8 && simd::IsNative<float, 8>) {
+    const __m128 low = detail::pcg_unit_float4(detail::pcg_step4(states, incs));
+    const __m128 high = detail::pcg_unit_float4(detail::pcg_step4(states + 4, incs + 4));
+    return pack_type(_mm256_set_m128(high, low));
+  }
+#endif
+  alignas(64) uint32_t bits[Lanes];
+  alignas(64) float values[Lanes];
+  next_u32(bits);
+  for (size_t i = 0; i < Lanes; ++i) values[i] = detail::pcg_unit_float(bits[i]);
+  return pack_type::Load(values);
+}
+
+template<size_t Lanes>
+void Pcg32x<Lanes>::advance(uint64_t delta) noexcept {
+  for (size_t i = 0; i < Lanes; ++i) states[i] = detail::pcg_advance(states[i], incs[i], delta);
+}
+
+} // namespace ayan::math
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "../../detail/uint_lanes.hpp"
+
+// Owen scrambling of Sobol points shared by SobolSampler and BlueNoiseSampler,
+// `W` below is uint32_t or UintLanes<uint32_t, N>.
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::detail {
+
+// ----- ----- ---- Hashing ----- ----- ----
+// "lowbias32" (Wellons, hash-prospector):
+constexpr uint32_t hash32(uint32_t x) noexcept {
+  x ^= x >> 16;
+  x *= 0x7feb352du;
+  x ^= x >> 15;
+  x *= 0x846ca68bu;
+  x ^= x >> 16;
+  return x;
+}
+
+constexpr uint32_t hash_combine(uint32_t seed, uint32_t value) noexcept {
+  return seed ^ (hash32(value) + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+}
+
+// ----- ----- ---- Scrambling ----- ----- ----
+template<typename W>
+AYAN_SIMD_INLINE constexpr W reverse_bits32(W x) noexcept {
+  x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+  x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+  x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+  x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+  return (x >> 16) | (x << 16);
+}
+
+// Every output bit depends on the input bits below it only, reversed that is a
+// nested uniform (Owen) scramble in base 2: the digit at every level is
+// flipped by a hash of the digits above it. Hash of Burley, "Practical
+// Hash-based Owen Scrambling" (JCGT 2020):
+template<typename W>
+AYAN_SIMD_INLINE constexpr W owen_scramble(W x, uint32_t seed) noexcept {
+  x = reverse_bits32(x);
+  x = x + seed;
+  x = x ^ (x * 0x6c50b47cu);
+  x = x ^ (x * 0xb82f1e52u);
+  x = x ^ (x * 0xc7afe638u);
+  x = x ^ (x * 0x8d22f6e6u);
+  return reverse_bits32(x);
+}
+
+// ----- ----- ---- Sobol ----- ----- ----
+inline constexpr uint32_t sobol_dimensions = 4;
+
+// Generator matrices (columns as 32-bit fractions) of the first Sobol dimensions,
+// primitive polynomials and initial numbers of Joe and Kuo (new-joe-kuo-6.21201):
+constexpr std::array<uint32_t, 32> sobol_matrix(uint32_t degree, uint32_t coeffs, std::array<uint32_t, 3> initial) noexcept {
+  std::array<uint32_t, 32> columns{};
+  if (degree == 0) { // van der Corput
+    for (uint32_t i = 0; i < 32; ++i) columns[i] = 1u << (31 - i);
+    return columns;
+  }
+  for (uint32_t i = 0; i < 32; ++i) {
+    if (i < degree) {
+      columns[i] = initial[i] << (31 - i);
+      continue;
+    }
+    columns[i] = columns[i - degree] ^ (columns[i - degree] >> degree);
+    for (uint32_t k = 1; k < degree; ++k) {
+      if ((coeffs >> (degree - 1 - k)) & 1u) columns[i] ^= columns[i - k];
+    }
+  }
+  return columns;
+}
+
+inline constexpr std::array<std::array<uint32_t, 32>, sobol_dimensions> sobol_matrices = {
+  sobol_matrix(0, 0, {}),
+  sobol_matrix(1, 0, {1}),
+  sobol_matrix(2, 1, {1, 3}),
+  sobol_matrix(3, 1, {1, 3, 1})
+};
+
+// point `index` of Sobol dimension `dimension` (< sobol_dimensions) as a 32-bit fraction.
+// All 32 columns masked by the bits of the index, a branch per bit would be
+// mispredicted half of the time on scrambled indices:
+template<typename W>
+AYAN_SIMD_INLINE constexpr W sobol_bits(W index, uint32_t dimension) noexcept {
+  const std::array<uint32_t, 32>& columns = sobol_matrices[dimension];
+  const W zero = splat<W>(0);
+  W result = zero;
+  for (uint32_t bit = 0; bit < 32; ++bit) {
+    result = result ^ ((zero - ((index >> int(bit)) & 1u)) & columns[bit]);
+  }
+  return result;
+}
+
+constexpr float unit_float(uint32_t bits) noexcept {
+  return float(bits >> 8) * 0x1p-24f;
+}
+
+// the same rounding as unit_float() in every lane:
+template<typename W>
+AYAN_SIMD_INLINE auto unit_floats(W bits) noexcept {
+  return to_float(bits >> 8) * 0x1p-24f;
+}
+
+} // namespace ayan::math::detail
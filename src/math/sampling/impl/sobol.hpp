@@ -0,0 +1,63 @@
+#pragma once
+
+#include "../sobol.hpp"
+#include "scramble.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+// the scrambles of one (pixel, dimension):
+struct SobolSeeds {
+  uint32_t shuffle;  // of the sample order, shared by a group of 4 dimensions;
+  uint32_t scramble; // of the point;
+};
+
+inline SobolSeeds sobol_seeds(uint32_t seed, uint32_t pixel, uint32_t dimension) noexcept {
+  const uint32_t group = hash_combine(hash_combine(seed, pixel), dimension / sobol_dimensions);
+  return {group, hash_combine(group, dimension % sobol_dimensions + 1)};
+}
+
+// shuffling the order by an Owen scramble keeps every aligned block of 2^k
+// samples an aligned block, so the prefixes stay stratified:
+template<typename W>
+AYAN_SIMD_INLINE W sobol_sample_bits(W sample, uint32_t dimension, const SobolSeeds& seeds) noexcept {
+  const W index = owen_scramble(sample, seeds.shuffle);
+  return owen_scramble(sobol_bits(index, dimension % sobol_dimensions), seeds.scramble);
+}
+
+} // namespace detail
+
+// ----- ----- ---- Constructors ---- ----- -----
+inline SobolSampler::SobolSampler(uint32_t seed) noexcept : seed(seed) {}
+
+// ----- ----- ---- Samples ----- ----- ----
+inline uint32_t SobolSampler::sample_bits(uint32_t pixel, uint32_t sample, uint32_t dimension) const noexcept {
+  return detail::sobol_sample_bits(sample, dimension, detail::sobol_seeds(seed, pixel, dimension));
+}
+
+inline float SobolSampler::sample(uint32_t pixel, uint32_t sample, uint32_t dimension) const noexcept {
+  return detail::unit_float(sample_bits(pixel, sample, dimension));
+}
+
+inline void SobolSampler::samples(uint32_t pixel, uint32_t first_sample, uint32_t dimension,
+  std::span<float> out) const noexcept
+{
+  const detail::SobolSeeds seeds = detail::sobol_seeds(seed, pixel, dimension);
+  size_t i = 0;
+#if defined(AYAN_SIMD_SSE2)
+  constexpr size_t Lanes = detail::uint32_lanes;
+  using lanes_type = detail::UintLanes<uint32_t, Lanes>;
+  constexpr uint32_t lane_offsets[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+  const lanes_type offsets = lanes_type::LoadUnaligned(lane_offsets);
+  for (const size_t end = out.size() - out.size() % Lanes; i < end; i += Lanes) {
+    const lanes_type sample = offsets + (first_sample + uint32_t(i));
+    detail::unit_floats(detail::sobol_sample_bits(sample, dimension, seeds)).store_unaligned(out.data() + i);
+  }
+#endif
+  for (; i < out.size(); ++i) {
+    out[i] = detail::unit_float(detail::sobol_sample_bits(first_sample + uint32_t(i), dimension, seeds));
+  }
+}
+
+} // namespace ayan::math
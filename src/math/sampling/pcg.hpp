@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../simd/pack.hpp"
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                  PCG32 RANDOM NUMBERS                |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// PCG-XSH-RR (O'Neill 2014): 64-bit LCG state, 32-bit output. 16 bytes per
+// generator instead of the 5 KB of std::mt19937, 2^63 independent streams and
+// advance() in O(log n), so the stream is picked by (pixel, sample) and the
+// position in it by the dimension: the numbers don't depend on which thread
+// or which lane draws them.
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+template<size_t Lanes>
+class Pcg32x;
+
+class Pcg32 {
+private: // Fields:
+  uint64_t state;
+  uint64_t inc; // stream selector, always odd;
+
+  template<size_t Lanes>
+  friend class Pcg32x;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  // the reference defaults (seed 0x853c49e6748fea9b, stream 0xda3e39cb94b95bdb):
+  Pcg32() noexcept;
+  // pcg32_srandom_r, the same numbers as the reference implementation:
+  Pcg32(uint64_t seed, uint64_t stream) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // position `dimension` of the stream of (pixel, sample), under a global `seed`:
+  static Pcg32 ForSample(uint32_t pixel, uint32_t sample, uint32_t dimension = 0, uint64_t seed = 0) noexcept;
+
+  // ----- ----- ---- Generation ----- ----- ----
+  uint32_t next_u32() noexcept;
+  // uniform in [0, 1), the top 24 bits of next_u32():
+  float next_float() noexcept;
+  // skips `delta` numbers in O(log delta), 2^64 - n goes n numbers back:
+  void advance(uint64_t delta) noexcept;
+};
+
+// `Lanes` Pcg32 side by side, lane `i` gives exactly the numbers of the Pcg32
+// it was made of. 4 lanes per AVX2 step (64-bit multiplies built from
+// 32-bit ones), one lane at a time otherwise:
+template<size_t Lanes = 8>
+class Pcg32x {
+  static_assert(Lanes > 0 && Lanes % 4 == 0, "Pcg32x needs a multiple of 4 lanes");
+
+private: // Fields:
+  alignas(64) uint64_t states[Lanes];
+  alignas(64) uint64_t incs[Lanes];
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  // lane `i` continues lanes[i]:
+  explicit Pcg32x(const Pcg32* lanes) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // lane `i` is Pcg32::ForSample(pixel, first_sample + i, dimension, seed):
+  static Pcg32x ForSamples(uint32_t pixel, uint32_t first_sample, uint32_t dimension = 0, uint64_t seed = 0) noexcept;
+  // lane `i` is Pcg32::ForSample(first_pixel + i, sample, dimension, seed):
+  static Pcg32x ForPixels(uint32_t first_pixel, uint32_t sample, uint32_t dimension = 0, uint64_t seed = 0) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  Pcg32 lane(size_t index) const noexcept;
+
+  // ----- ----- ---- Generation ----- ----- ----
+  // one number per lane to out[0, Lanes):
+  void next_u32(uint32_t* out) noexcept;
+  simd::Pack<float, Lanes> next_float() noexcept;
+  void advance(uint64_t delta) noexcept;
+};
+
+} // namespace ayan::math
+
+#include "impl/pcg.hpp"
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "../detail/simd.hpp"
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                OWEN-SCRAMBLED SOBOL POINTS           |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// Sobol points with hash-based nested uniform scrambling (Burley 2020). The
+// first 2^k samples of a pixel are stratified in every dimension and in
+// dimensions (4n, 4n + 1) as a pair ((0, k, 2)-nets), with the error of
+// random sampling falling as O(N^-1.5) for smooth integrands instead of
+// O(N^-0.5). Dimensions past the 4 Sobol ones repeat them, each group of 4
+// with its own shuffle of the sample order and its own scramble ("padding").
+// A sample is a pure function of (seed, pixel, sample, dimension).
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+class SobolSampler {
+private: // Fields:
+  uint32_t seed;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  explicit SobolSampler(uint32_t seed = 0) noexcept;
+
+  // ----- ----- ---- Samples ----- ----- ----
+  // as a 32-bit fraction of 1:
+  uint32_t sample_bits(uint32_t pixel, uint32_t sample, uint32_t dimension) const noexcept;
+  // in [0, 1), the top 24 bits of sample_bits():
+  float sample(uint32_t pixel, uint32_t sample, uint32_t dimension) const noexcept;
+
+  // out[i] = sample(pixel, first_sample + i, dimension), 8 (AVX2) or 4 (SSE2) at a time:
+  void samples(uint32_t pixel, uint32_t first_sample, uint32_t dimension, std::span<float> out) const noexcept;
+};
+
+} // namespace ayan::math
+
+#include "impl/sobol.hpp"
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../detail/simd.hpp"
+#include "../detail/validate.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::simd {
+
+// `Lanes` values of type `T` processed by a single instruction.
+// Generic version is a plain aligned array (the compiler is free to
+// auto-vectorize it), native specializations wrap SSE/AVX registers:
+template<typename T, size_t Lanes>
+class Pack;
+
+// Per-lane boolean result of a `Pack` comparison:
+template<typename T, size_t Lanes>
+class Mask;
+
+// true if Pack<T, Lanes> is backed by hardware registers in this build:
+template<typename T, size_t Lanes>
+inline constexpr bool IsNative = false;
+
+#if defined(AYAN_SIMD_SSE2)
+template<> inline constexpr bool IsNative<float, 4> = true;
+template<> inline constexpr bool IsNative<double, 4> = true;
+#endif
+
+#if defined(AYAN_SIMD_AVX)
+template<> inline constexpr bool IsNative<float, 8> = true;
+#endif
+
+using Pack4f = Pack<float, 4>;
+using Pack4d = Pack<double, 4>;
+using Pack4i = Pack<int, 4>;
+using Pack8f = Pack<float, 8>;
+using Pack8d = Pack<double, 8>;
+using Pack8i = Pack<int, 8>;
+
+using Mask4f = Mask<float, 4>;
+using Mask4d = Mask<double, 4>;
+using Mask8f = Mask<float, 8>;
+
+} // namespace ayan::math::simd
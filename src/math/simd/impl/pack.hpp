@@ -0,0 +1,398 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include "../pack.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::simd {
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                  Generic (scalar) Mask                |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+namespace detail {
+
+template<size_t Lanes>
+inline constexpr uint32_t all_lanes_bits = (Lanes >= 32) ? ~uint32_t{0} : ((uint32_t{1} << Lanes) - 1);
+
+} // namespace detail
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<typename T, size_t Lanes>
+Mask<T, Lanes>::Mask() noexcept : lanes_bits(0) {}
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes>::Mask(bool value) noexcept
+  : lanes_bits(value ? detail::all_lanes_bits<Lanes> : 0) {}
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> Mask<T, Lanes>::FromBits(uint32_t bits) noexcept {
+  Mask mask;
+  mask.lanes_bits = bits & detail::all_lanes_bits<Lanes>;
+  return mask;
+}
+
+// ----- ----- ---- Lane queries ---- ----- -----
+template<typename T, size_t Lanes>
+uint32_t Mask<T, Lanes>::bits() const noexcept { return lanes_bits; }
+
+template<typename T, size_t Lanes>
+bool Mask<T, Lanes>::operator[](size_t lane) const noexcept {
+  return (lanes_bits >> lane) & 1u;
+}
+
+template<typename T, size_t Lanes>
+bool Mask<T, Lanes>::any() const noexcept { return lanes_bits != 0; }
+
+template<typename T, size_t Lanes>
+bool Mask<T, Lanes>::all() const noexcept {
+  return lanes_bits == detail::all_lanes_bits<Lanes>;
+}
+
+template<typename T, size_t Lanes>
+bool Mask<T, Lanes>::none() const noexcept { return lanes_bits == 0; }
+
+// ----- ----- ---- Logical operators ---- ----- -----
+template<typename T, size_t Lanes>
+Mask<T, Lanes> Mask<T, Lanes>::operator~() const noexcept {
+  return FromBits(~lanes_bits);
+}
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes>& Mask<T, Lanes>::operator&=(const Mask& oth) noexcept {
+  lanes_bits &= oth.lanes_bits;
+  return *this;
+}
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes>& Mask<T, Lanes>::operator|=(const Mask& oth) noexcept {
+  lanes_bits |= oth.lanes_bits;
+  return *this;
+}
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes>& Mask<T, Lanes>::operator^=(const Mask& oth) noexcept {
+  lanes_bits ^= oth.lanes_bits;
+  return *this;
+}
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator&(const Mask<T, Lanes>& a, const Mask<T, Lanes>& b) noexcept {
+  Mask<T, Lanes> result = a;
+  return result &= b;
+}
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator|(const Mask<T, Lanes>& a, const Mask<T, Lanes>& b) noexcept {
+  Mask<T, Lanes> result = a;
+  return result |= b;
+}
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator^(const Mask<T, Lanes>& a, const Mask<T, Lanes>& b) noexcept {
+  Mask<T, Lanes> result = a;
+  return result ^= b;
+}
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                  Generic (scalar) Pack                |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<typename T, size_t Lanes>
+Pack<T, Lanes>::Pack() noexcept : data{} {}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes>::Pack(T scalar) noexcept {
+  data.fill(scalar);
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> Pack<T, Lanes>::Broadcast(T scalar) noexcept {
+  return Pack(scalar);
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> Pack<T, Lanes>::Zero() noexcept {
+  return Pack();
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> Pack<T, Lanes>::Load(const T* ptr) noexcept {
+  return LoadUnaligned(ptr);
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> Pack<T, Lanes>::LoadUnaligned(const T* ptr) noexcept {
+  Pack pack;
+  std::copy_n(ptr, Lanes, pack.data.begin());
+  return pack;
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> Pack<T, Lanes>::Gather(const T* base, const int32_t* indices) noexcept {
+  Pack pack;
+  for (size_t i = 0; i < Lanes; ++i) pack.data[i] = base[indices[i]];
+  return pack;
+}
+
+// ----- ----- ---- Element access ---- ----- -----
+template<typename T, size_t Lanes>
+void Pack<T, Lanes>::store(T* ptr) const noexcept {
+  store_unaligned(ptr);
+}
+
+template<typename T, size_t Lanes>
+void Pack<T, Lanes>::store_unaligned(T* ptr) const noexcept {
+  std::copy_n(data.begin(), Lanes, ptr);
+}
+
+template<typename T, size_t Lanes>
+T Pack<T, Lanes>::operator[](size_t lane) const noexcept {
+  return data[lane];
+}
+
+// ----- ----- ---- Operators ----- ----- ----
+template<typename T, size_t Lanes>
+Pack<T, Lanes> Pack<T, Lanes>::operator-() const noexcept {
+  Pack result;
+  for (size_t i = 0; i < Lanes; ++i) result.data[i] = -data[i];
+  return result;
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes>& Pack<T, Lanes>::operator+=(const Pack& oth) noexcept {
+  for (size_t i = 0; i < Lanes; ++i) data[i] += oth.data[i];
+  return *this;
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes>& Pack<T, Lanes>::operator-=(const Pack& oth) noexcept {
+  for (size_t i = 0; i < Lanes; ++i) data[i] -= oth.data[i];
+  return *this;
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes>& Pack<T, Lanes>::operator*=(const Pack& oth) noexcept {
+  for (size_t i = 0; i < Lanes; ++i) data[i] *= oth.data[i];
+  return *this;
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes>& Pack<T, Lanes>::operator/=(const Pack& oth) noexcept {
+  for (size_t i = 0; i < Lanes; ++i) data[i] /= oth.data[i];
+  return *this;
+}
+
+// lane-by-lane helpers for the generic free functions below:
+namespace detail {
+
+template<typename T, size_t Lanes, typename Func>
+Pack<T, Lanes> lanewise(Func&& func, const Pack<T, Lanes>& a) noexcept {
+  alignas(sizeof(T) * Lanes) T out[Lanes];
+  for (size_t i = 0; i < Lanes; ++i) out[i] = func(a[i]);
+  return Pack<T, Lanes>::Load(out);
+}
+
+template<typename T, size_t Lanes, typename Func>
+Pack<T, Lanes> lanewise(Func&& func, const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  alignas(sizeof(T) * Lanes) T out[Lanes];
+  for (size_t i = 0; i < Lanes; ++i) out[i] = func(a[i], b[i]);
+  return Pack<T, Lanes>::Load(out);
+}
+
+template<typename T, size_t Lanes, typename Pred>
+Mask<T, Lanes> lanewise_mask(Pred&& pred, const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  uint32_t bits = 0;
+  for (size_t i = 0; i < Lanes; ++i) bits |= uint32_t(pred(a[i], b[i])) << i;
+  return Mask<T, Lanes>::FromBits(bits);
+}
+
+} // namespace detail
+
+// ----- ----- ---- Arithmetic ----- ----- ----
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator+(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  Pack<T, Lanes> result = a;
+  return result += b;
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator-(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  Pack<T, Lanes> result = a;
+  return result -= b;
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator*(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  Pack<T, Lanes> result = a;
+  return result *= b;
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator/(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  Pack<T, Lanes> result = a;
+  return result /= b;
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator+(const Pack<T, Lanes>& a, std::type_identity_t<T> scalar) noexcept {
+  return a + Pack<T, Lanes>::Broadcast(scalar);
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator-(const Pack<T, Lanes>& a, std::type_identity_t<T> scalar) noexcept {
+  return a - Pack<T, Lanes>::Broadcast(scalar);
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator*(const Pack<T, Lanes>& a, std::type_identity_t<T> scalar) noexcept {
+  return a * Pack<T, Lanes>::Broadcast(scalar);
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator*(std::type_identity_t<T> scalar, const Pack<T, Lanes>& a) noexcept {
+  return Pack<T, Lanes>::Broadcast(scalar) * a;
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator/(const Pack<T, Lanes>& a, std::type_identity_t<T> scalar) noexcept {
+  return a / Pack<T, Lanes>::Broadcast(scalar);
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> min(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  // same operand order as `minps`: if any of them is NaN, `b` is returned:
+  return detail::lanewise([](T x, T y) { return x < y ? x : y; }, a, b);
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> max(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  return detail::lanewise([](T x, T y) { return x > y ? x : y; }, a, b);
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> abs(const Pack<T, Lanes>& a) noexcept {
+  return detail::lanewise([](T x) { return x < T(0) ? T(-x) : x; }, a);
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> fmadd(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b, const Pack<T, Lanes>& c) noexcept {
+  return a * b + c;
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> fnmadd(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b, const Pack<T, Lanes>& c) noexcept {
+  return c - a * b;
+}
+
+template<typename T, size_t Lanes> requires (std::floating_point<T>)
+Pack<T, Lanes> sqrt(const Pack<T, Lanes>& a) noexcept {
+  return detail::lanewise([](T x) { return std::sqrt(x); }, a);
+}
+
+template<typename T, size_t Lanes> requires (std::floating_point<T>)
+Pack<T, Lanes> rcp(const Pack<T, Lanes>& a) noexcept {
+  return Pack<T, Lanes>::Broadcast(T(1)) / a;
+}
+
+template<typename T, size_t Lanes> requires (std::floating_point<T>)
+Pack<T, Lanes> rsqrt(const Pack<T, Lanes>& a) noexcept {
+  return Pack<T, Lanes>::Broadcast(T(1)) / sqrt(a);
+}
+
+// ----- ----- ---- Horizontal reductions ----- ----- ----
+template<typename T, size_t Lanes>
+T hsum(const Pack<T, Lanes>& a) noexcept {
+  T sum = a[0];
+  for (size_t i = 1; i < Lanes; ++i) sum += a[i];
+  return sum;
+}
+
+template<typename T, size_t Lanes>
+T hmin(const Pack<T, Lanes>& a) noexcept {
+  T result = a[0];
+  for (size_t i = 1; i < Lanes; ++i) result = std::min(result, a[i]);
+  return result;
+}
+
+template<typename T, size_t Lanes>
+T hmax(const Pack<T, Lanes>& a) noexcept {
+  T result = a[0];
+  for (size_t i = 1; i < Lanes; ++i) result = std::max(result, a[i]);
+  return result;
+}
+
+// ----- ----- ---- Comparisons ----- ----- ----
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator==(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  return detail::lanewise_mask([](T x, T y) { return x == y; }, a, b);
+}
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator!=(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  return detail::lanewise_mask([](T x, T y) { return x != y; }, a, b);
+}
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator<(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  return detail::lanewise_mask([](T x, T y) { return x < y; }, a, b);
+}
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator<=(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  return detail::lanewise_mask([](T x, T y) { return x <= y; }, a, b);
+}
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator>(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  return detail::lanewise_mask([](T x, T y) { return x > y; }, a, b);
+}
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator>=(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept {
+  return detail::lanewise_mask([](T x, T y) { return x >= y; }, a, b);
+}
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> select(const Mask<T, Lanes>& mask,
+  const Pack<T, Lanes>& if_true, const Pack<T, Lanes>& if_false) noexcept
+{
+  alignas(sizeof(T) * Lanes) T out[Lanes];
+  for (size_t i = 0; i < Lanes; ++i) out[i] = mask[i] ? if_true[i] : if_false[i];
+  return Pack<T, Lanes>::Load(out);
+}
+
+// ----- ----- ---- Permutations ----- ----- ----
+template<size_t I0, size_t I1, size_t I2, size_t I3, typename T> requires (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4)
+Pack<T, 4> shuffle(const Pack<T, 4>& a) noexcept {
+  alignas(sizeof(T) * 4) T out[4] = { a[I0], a[I1], a[I2], a[I3] };
+  return Pack<T, 4>::Load(out);
+}
+
+// ----- ----- ---- Interleaved memory ----- ----- ----
+template<typename T, size_t Lanes>
+void load_deinterleave3(const T* src, Pack<T, Lanes>& a, Pack<T, Lanes>& b, Pack<T, Lanes>& c) noexcept {
+  alignas(sizeof(T) * Lanes) T as[Lanes];
+  alignas(sizeof(T) * Lanes) T bs[Lanes];
+  alignas(sizeof(T) * Lanes) T cs[Lanes];
+  for (size_t i = 0; i < Lanes; ++i) {
+    as[i] = src[3 * i];
+    bs[i] = src[3 * i + 1];
+    cs[i] = src[3 * i + 2];
+  }
+  a = Pack<T, Lanes>::Load(as);
+  b = Pack<T, Lanes>::Load(bs);
+  c = Pack<T, Lanes>::Load(cs);
+}
+
+template<typename T, size_t Lanes>
+void store_interleave3(T* dst, const Pack<T, Lanes>& a, const Pack<T, Lanes>& b, const Pack<T, Lanes>& c) noexcept {
+  for (size_t i = 0; i < Lanes; ++i) {
+    dst[3 * i] = a[i];
+    dst[3 * i + 1] = b[i];
+    dst[3 * i + 2] = c[i];
+  }
+}
+
+} // namespace ayan::math::simd
@@ -0,0 +1,323 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "../transcendental.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::simd {
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                  Exponent bit helpers                |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// The only places the kernels below look at the bits of a float. Generic
+// versions go lane by lane, native ones stay in registers:
+namespace detail {
+
+// a * b + c and c - a * b rounded twice. A fused version would make the
+// results depend on the instruction set, the error bounds hold without it:
+template<size_t Lanes>
+AYAN_SIMD_INLINE Pack<float, Lanes> madd(const Pack<float, Lanes>& a, const Pack<float, Lanes>& b,
+  const Pack<float, Lanes>& c) noexcept
+{
+  return a * b + c;
+}
+
+template<size_t Lanes>
+AYAN_SIMD_INLINE Pack<float, Lanes> nmadd(const Pack<float, Lanes>& a, const Pack<float, Lanes>& b,
+  const Pack<float, Lanes>& c) noexcept
+{
+  return c - a * b;
+}
+
+// x rounded to the nearest integer (ties to even), |x| < 2^22:
+template<size_t Lanes>
+AYAN_SIMD_INLINE Pack<float, Lanes> round_nearest(const Pack<float, Lanes>& x) noexcept {
+  // 1.5 * 2^23 leaves no fraction bits, the addition does the rounding:
+  const Pack<float, Lanes> magic(0x1.8p23f);
+  return (x + magic) - magic;
+}
+
+// 2^n for integral n in [-126, 127]:
+template<size_t Lanes>
+Pack<float, Lanes> pow2i(const Pack<float, Lanes>& n) noexcept {
+  return lanewise([](float v) { return std::bit_cast<float>(uint32_t(int32_t(v) + 127) << 23); }, n);
+}
+
+// x = mantissa * 2^exponent with the mantissa in [0.5, 1), x positive and normal:
+template<size_t Lanes>
+Pack<float, Lanes> split_exponent(const Pack<float, Lanes>& x, Pack<float, Lanes>& exponent) noexcept {
+  alignas(sizeof(float) * Lanes) float mantissas[Lanes];
+  alignas(sizeof(float) * Lanes) float exponents[Lanes];
+  for (size_t i = 0; i < Lanes; ++i) {
+    const uint32_t bits = std::bit_cast<uint32_t>(x[i]);
+    mantissas[i] = std::bit_cast<float>((bits & 0x807FFFFFu) | 0x3F000000u);
+    exponents[i] = float(int32_t(bits >> 23) - 126);
+  }
+  exponent = Pack<float, Lanes>::Load(exponents);
+  return Pack<float, Lanes>::Load(mantissas);
+}
+
+// |magnitude| with the sign bit of `sign`:
+template<size_t Lanes>
+Pack<float, Lanes> copy_sign(const Pack<float, Lanes>& magnitude, const Pack<float, Lanes>& sign) noexcept {
+  return lanewise([](float m, float s) { return std::copysign(m, s); }, magnitude, sign);
+}
+
+#if defined(AYAN_SIMD_SSE2)
+AYAN_SIMD_INLINE __m128 pow2i(__m128 n) noexcept {
+  return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23));
+}
+
+AYAN_SIMD_INLINE __m128 split_exponent(__m128 x, __m128& exponent) noexcept {
+  const __m128i bits = _mm_castps_si128(x);
+  exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+  return _mm_or_ps(_mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x807FFFFF))), _mm_set1_ps(0.5f));
+}
+
+AYAN_SIMD_INLINE Pack4f pow2i(const Pack4f& n) noexcept {
+  return Pack4f(pow2i(n.native()));
+}
+
+AYAN_SIMD_INLINE Pack4f split_exponent(const Pack4f& x, Pack4f& exponent) noexcept {
+  __m128 e;
+  const __m128 mantissa = split_exponent(x.native(), e);
+  exponent = Pack4f(e);
+  return Pack4f(mantissa);
+}
+
+AYAN_SIMD_INLINE Pack4f copy_sign(const Pack4f& magnitude, const Pack4f& sign) noexcept {
+  const __m128 sign_bit = _mm_set1_ps(-0.0f);
+  return Pack4f(_mm_or_ps(_mm_andnot_ps(sign_bit, magnitude.native()), _mm_and_ps(sign_bit, sign.native())));
+}
+#endif
+
+#if defined(AYAN_SIMD_AVX)
+AYAN_SIMD_INLINE Pack8f pow2i(const Pack8f& n) noexcept {
+#if defined(AYAN_SIMD_AVX2)
+  return Pack8f(_mm256_castsi256_ps(_mm256_slli_epi32(
+    _mm256_add_epi32(_mm256_cvtps_epi32(n.native()), _mm256_set1_epi32(127)), 23)));
+#else
+  // no 256-bit integer ops, one SSE half at a time:
+  const __m128 low = pow2i(_mm256_castps256_ps128(n.native()));
+  const __m128 high = pow2i(_mm256_extractf128_ps(n.native(), 1));
+  return Pack8f(_mm256_set_m128(high, low));
+#endif
+}
+
+AYAN_SIMD_INLINE Pack8f split_exponent(const Pack8f& x, Pack8f& exponent) noexcept {
+#if defined(AYAN_SIMD_AVX2)
+  const __m256i bits = _mm256_castps_si256(x.native());
+  exponent = Pack8f(_mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126))));
+  return Pack8f(_mm256_or_ps(_mm256_and_ps(x.native(), _mm256_castsi256_ps(_mm256_set1_epi32(0x807FFFFF))),
+    _mm256_set1_ps(0.5f)));
+#else
+  __m128 e_low, e_high;
+  const __m128 low = split_exponent(_mm256_castps256_ps128(x.native()), e_low);
+  const __m128 high = split_exponent(_mm256_extractf128_ps(x.native(), 1), e_high);
+  exponent = Pack8f(_mm256_set_m128(e_high, e_low));
+  return Pack8f(_mm256_set_m128(high, low));
+#endif
+}
+
+AYAN_SIMD_INLINE Pack8f copy_sign(const Pack8f& magnitude, const Pack8f& sign) noexcept {
+  const __m256 sign_bit = _mm256_set1_ps(-0.0f);
+  return Pack8f(_mm256_or_ps(_mm256_andnot_ps(sign_bit, magnitude.native()), _mm256_and_ps(sign_bit, sign.native())));
+}
+#endif
+
+} // namespace detail
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                     Trigonometry                     |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<size_t Lanes>
+AYAN_SIMD_INLINE SinCos<Pack<float, Lanes>> sincos(const Pack<float, Lanes>& x) noexcept {
+  using pack_type = Pack<float, Lanes>;
+
+  // x = q * pi/2 + r, |r| <= pi/4. pi/2 in three parts (Cody-Waite), the
+  // first two have trailing zero bits, so q * part is exact for |q| < 2^13:
+  const pack_type q = detail::round_nearest(x * 0.636619772367581343f);
+  pack_type r = detail::nmadd(q, pack_type(1.5703125f), x);
+  r = detail::nmadd(q, pack_type(4.837512969970703125e-4f), r);
+  r = detail::nmadd(q, pack_type(7.54978995489188216e-8f), r);
+
+  // sin(r) and cos(r) on [-pi/4, pi/4]:
+  const pack_type r2 = r * r;
+  pack_type sin_r = detail::madd(pack_type(-1.9515295891e-4f), r2, pack_type(8.3321608736e-3f));
+  sin_r = detail::madd(sin_r, r2, pack_type(-1.6666654611e-1f));
+  sin_r = detail::madd(sin_r * r2, r, r);
+  pack_type cos_r = detail::madd(pack_type(2.443315711809948e-5f), r2, pack_type(-1.388731625493765e-3f));
+  cos_r = detail::madd(cos_r, r2, pack_type(4.166664568298827e-2f));
+  cos_r = detail::madd(cos_r * r2, r2, detail::nmadd(pack_type(0.5f), r2, pack_type(1.0f)));
+
+  // the quadrant q mod 4 as m in {-2, -1, 0, 1, 2}: odd quadrants swap sin and
+  // cos, sin is negative in quadrants 2 and 3, cos in 1 and 2:
+  const pack_type m = detail::nmadd(detail::round_nearest(q * 0.25f), pack_type(4.0f), q);
+  const auto odd = abs(m) == pack_type(1.0f);
+  const auto sin_negative = (m < pack_type(-0.5f)) | (m > pack_type(1.5f));
+  const auto cos_negative = (m > pack_type(0.5f)) | (m < pack_type(-1.5f));
+  const pack_type s = select(odd, cos_r, sin_r);
+  const pack_type c = select(odd, sin_r, cos_r);
+  // r + r^3 p loses the sign of r = -0:
+  const pack_type sin_x = select(x == pack_type::Zero(), x, select(sin_negative, -s, s));
+  return { sin_x, select(cos_negative, -c, c) };
+}
+
+template<size_t Lanes>
+AYAN_SIMD_INLINE Pack<float, Lanes> sin(const Pack<float, Lanes>& x) noexcept {
+  return sincos(x).sin;
+}
+
+template<size_t Lanes>
+AYAN_SIMD_INLINE Pack<float, Lanes> cos(const Pack<float, Lanes>& x) noexcept {
+  return sincos(x).cos;
+}
+
+template<size_t Lanes>
+AYAN_SIMD_INLINE Pack<float, Lanes> atan2(const Pack<float, Lanes>& y, const Pack<float, Lanes>& x) noexcept {
+  using pack_type = Pack<float, Lanes>;
+  constexpr float inf = std::numeric_limits<float>::infinity();
+
+  // atan of a = min / max in [0, 1], both infinite is 1 and both zero is 0:
+  const pack_type ax = abs(x);
+  const pack_type ay = abs(y);
+  const pack_type lo = min(ax, ay);
+  const pack_type hi = max(ax, ay);
+  pack_type a = select(hi == pack_type::Zero(), pack_type::Zero(), lo / hi);
+  a = select(lo == pack_type(inf), pack_type(1.0f), a);
+
+  // [tan(pi/8), 1] is moved to [tan(-pi/8), 0] by atan(a) = pi/4 + atan((a - 1) / (a + 1)):
+  const auto upper = a > pack_type(0.414213562373095049f);
+  const pack_type t = select(upper, (a - 1.0f) / (a + 1.0f), a);
+  const pack_type z = t * t;
+  pack_type r = detail::madd(pack_type(8.05374449538e-2f), z, pack_type(-1.38776856032e-1f));
+  r = detail::madd(r, z, pack_type(1.99777106478e-1f));
+  r = detail::madd(r, z, pack_type(-3.33329491539e-1f));
+  r = detail::madd(r * z, t, t);
+  r = select(upper, r + 0.785398163397448310f, r);
+
+  // back to the octant of (x, y), the sign bit of x decides for x = -0:
+  r = select(ay > ax, pack_type(1.57079632679489662f) - r, r);
+  r = select(detail::copy_sign(pack_type(1.0f), x) < pack_type::Zero(), pack_type(3.14159265358979324f) - r, r);
+  r = detail::copy_sign(r, y);
+  return select((x != x) | (y != y), x + y, r);
+}
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//               Exponentials and logarithms            |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<size_t Lanes>
+AYAN_SIMD_INLINE Pack<float, Lanes> exp(const Pack<float, Lanes>& x) noexcept {
+  using pack_type = Pack<float, Lanes>;
+  constexpr float inf = std::numeric_limits<float>::infinity();
+  const pack_type lo(-87.3365447f); // ln(FLT_MIN)
+  const pack_type hi(88.7228394f);  // ln(FLT_MAX)
+
+  // x = n ln2 + r, |r| <= ln2 / 2, ln2 in two parts:
+  const pack_type clamped = min(max(x, lo), hi);
+  const pack_type n = detail::round_nearest(clamped * 1.44269504088896341f);
+  pack_type r = detail::nmadd(n, pack_type(0.693359375f), clamped);
+  r = detail::nmadd(n, pack_type(-2.12194440e-4f), r);
+
+  pack_type p = detail::madd(pack_type(1.9875691500e-4f), r, pack_type(1.3981999507e-3f));
+  p = detail::madd(p, r, pack_type(8.3334519073e-3f));
+  p = detail::madd(p, r, pack_type(4.1665795894e-2f));
+  p = detail::madd(p, r, pack_type(1.6666665459e-1f));
+  p = detail::madd(p, r, pack_type(5.0000001201e-1f));
+  p = detail::madd(p, r * r, r) + 1.0f;
+
+  // 2^128 has no float exponent, n = 128 is applied as 2^127 * 2:
+  const pack_type n_low = min(n, pack_type(127.0f));
+  pack_type result = p * detail::pow2i(n_low) * ((n - n_low) + 1.0f);
+  result = select(x > hi, pack_type(inf), result);
+  result = select(x < lo, pack_type::Zero(), result);
+  return select(x != x, x, result);
+}
+
+namespace detail {
+
+// x = 2^e * m with m in [sqrt(1/2), sqrt(2)) for positive x (denormals
+// included), returns ln(m):
+template<size_t Lanes>
+AYAN_SIMD_INLINE Pack<float, Lanes> log_mantissa(const Pack<float, Lanes>& x, Pack<float, Lanes>& e) noexcept {
+  using pack_type = Pack<float, Lanes>;
+
+  // denormals are scaled into the normal range first:
+  const auto denormal = x < pack_type(std::numeric_limits<float>::min());
+  const pack_type m = split_exponent(select(denormal, x * 0x1p23f, x), e);
+  e = select(denormal, e - 23.0f, e);
+
+  // m in [0.5, 1) -> 1 + t in [sqrt(1/2), sqrt(2)):
+  const auto low = m < pack_type(0.707106781186547524f);
+  e = select(low, e - 1.0f, e);
+  const pack_type t = select(low, m + m, m) - 1.0f;
+  const pack_type z = t * t;
+
+  pack_type p = detail::madd(pack_type(7.0376836292e-2f), t, pack_type(-1.1514610310e-1f));
+  p = detail::madd(p, t, pack_type(1.1676998740e-1f));
+  p = detail::madd(p, t, pack_type(-1.2420140846e-1f));
+  p = detail::madd(p, t, pack_type(1.4249322787e-1f));
+  p = detail::madd(p, t, pack_type(-1.6668057665e-1f));
+  p = detail::madd(p, t, pack_type(2.0000714765e-1f));
+  p = detail::madd(p, t, pack_type(-2.4999993993e-1f));
+  p = detail::madd(p, t, pack_type(3.3333331174e-1f));
+  return t + detail::nmadd(pack_type(0.5f), z, p * t * z);
+}
+
+} // namespace detail
+
+template<size_t Lanes>
+AYAN_SIMD_INLINE Pack<float, Lanes> log(const Pack<float, Lanes>& x) noexcept {
+  using pack_type = Pack<float, Lanes>;
+  constexpr float inf = std::numeric_limits<float>::infinity();
+
+  // ln2 in two parts, the first one has trailing zero bits:
+  pack_type e;
+  const pack_type log_m = detail::log_mantissa(x, e);
+  pack_type result = detail::madd(e, pack_type(0.693359375f), detail::madd(e, pack_type(-2.12194440e-4f), log_m));
+
+  result = select(x == pack_type::Zero(), pack_type(-inf), result);
+  result = select(x == pack_type(inf), x, result);
+  return select((x < pack_type::Zero()) | (x != x), pack_type(std::numeric_limits<float>::quiet_NaN()), result);
+}
+
+template<size_t Lanes>
+AYAN_SIMD_INLINE Pack<float, Lanes> pow(const Pack<float, Lanes>& x, const Pack<float, Lanes>& y) noexcept {
+  using pack_type = Pack<float, Lanes>;
+  constexpr float inf = std::numeric_limits<float>::infinity();
+
+  // |y| >= 2^100 gives 0 or inf for every x != 1 just like y = +-inf:
+  const pack_type yc = min(max(y, pack_type(-0x1p100f)), pack_type(0x1p100f));
+
+  // y log2(x) = y e + y log2(m). The rounding of y * e would cost up to |y e|
+  // ulp, so it is taken exactly: y = y_hi + y_lo with 16 bits in y_hi (Veltkamp)
+  // and e is an integer of at most 8 bits:
+  pack_type e;
+  const pack_type log2_m = detail::log_mantissa(x, e) * 1.44269504088896341f;
+  const pack_type y_split = yc * 257.0f;
+  const pack_type y_hi = y_split - (y_split - yc);
+  const pack_type y_lo = yc - y_hi;
+  const pack_type a = y_hi * e;
+  const pack_type n = min(max(detail::round_nearest(a), pack_type(-254.0f)), pack_type(254.0f));
+  const pack_type f = (a - n) + detail::madd(y_lo, e, yc * log2_m);
+
+  // 2^n in two steps, every half within the float exponent range:
+  const pack_type n_half = detail::round_nearest(n * 0.5f);
+  pack_type result = exp(f * 0.693147180559945309f) * detail::pow2i(n_half) * detail::pow2i(n - n_half);
+
+  result = select(x == pack_type::Zero(), select(y < pack_type::Zero(), pack_type(inf), pack_type::Zero()), result);
+  result = select(x == pack_type(inf), select(y < pack_type::Zero(), pack_type::Zero(), pack_type(inf)), result);
+  result = select((x < pack_type::Zero()) | (x != x) | (y != y), pack_type(std::numeric_limits<float>::quiet_NaN()), result);
+  // exactly 1 for x = 1 or y = 0, even if the other one is NaN:
+  return select((x == pack_type(1.0f)) | (y == pack_type::Zero()), pack_type(1.0f), result);
+}
+
+template<size_t Lanes>
+AYAN_SIMD_INLINE Pack<float, Lanes> pow(const Pack<float, Lanes>& x, std::type_identity_t<float> y) noexcept {
+  return pow(x, Pack<float, Lanes>::Broadcast(y));
+}
+
+} // namespace ayan::math::simd
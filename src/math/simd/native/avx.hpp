@@ -0,0 +1,387 @@
+#pragma once
+
+// AVX specializations: Pack<double, 4> in one __m256d and Pack<float, 8> in one __m256 register.
+
+#include "../pack.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::simd {
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                    Mask<double, 4>                   |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<>
+class Mask<double, 4> {
+private: // Fields:
+  __m256d reg; // all bits of a lane are set if the lane is true;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  AYAN_SIMD_INLINE Mask() noexcept : reg(_mm256_setzero_pd()) {}
+  AYAN_SIMD_INLINE explicit Mask(__m256d r) noexcept : reg(r) {}
+  AYAN_SIMD_INLINE explicit Mask(bool value) noexcept
+    : reg(_mm256_castsi256_pd(_mm256_set1_epi64x(value ? -1 : 0))) {}
+
+  AYAN_SIMD_INLINE static Mask FromBits(uint32_t bits) noexcept {
+    const auto lane = [](bool set) -> long long { return set ? -1 : 0; };
+    return Mask(_mm256_castsi256_pd(_mm256_setr_epi64x(
+      lane(bits & 1u), lane(bits & 2u), lane(bits & 4u), lane(bits & 8u))));
+  }
+
+  AYAN_SIMD_INLINE __m256d native() const noexcept { return reg; }
+
+  // ----- ----- ---- Lane queries ---- ----- -----
+  AYAN_SIMD_INLINE uint32_t bits() const noexcept { return uint32_t(_mm256_movemask_pd(reg)); }
+  AYAN_SIMD_INLINE bool operator[](size_t lane) const noexcept { return (bits() >> lane) & 1u; }
+  AYAN_SIMD_INLINE bool any() const noexcept { return bits() != 0; }
+  AYAN_SIMD_INLINE bool all() const noexcept { return bits() == 0xFu; }
+  AYAN_SIMD_INLINE bool none() const noexcept { return bits() == 0; }
+
+  // ----- ----- ---- Logical operators ---- ----- -----
+  AYAN_SIMD_INLINE Mask operator~() const noexcept {
+    return Mask(_mm256_xor_pd(reg, _mm256_castsi256_pd(_mm256_set1_epi64x(-1))));
+  }
+  AYAN_SIMD_INLINE Mask& operator&=(const Mask& oth) noexcept { reg = _mm256_and_pd(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Mask& operator|=(const Mask& oth) noexcept { reg = _mm256_or_pd(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Mask& operator^=(const Mask& oth) noexcept { reg = _mm256_xor_pd(reg, oth.reg); return *this; }
+};
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                    Pack<double, 4>                   |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<>
+class Pack<double, 4> {
+public: // Types:
+  using value_type = double;
+  using mask_type = Mask<double, 4>;
+  static constexpr size_t lanes = 4;
+
+private: // Fields:
+  __m256d reg;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  AYAN_SIMD_INLINE Pack() noexcept : reg(_mm256_setzero_pd()) {}
+  AYAN_SIMD_INLINE explicit Pack(double scalar) noexcept : reg(_mm256_set1_pd(scalar)) {}
+  AYAN_SIMD_INLINE explicit Pack(__m256d r) noexcept : reg(r) {}
+
+  AYAN_SIMD_INLINE static Pack Broadcast(double scalar) noexcept { return Pack(scalar); }
+  AYAN_SIMD_INLINE static Pack Zero() noexcept { return Pack(); }
+  AYAN_SIMD_INLINE static Pack Load(const double* ptr) noexcept { return Pack(_mm256_load_pd(ptr)); }
+  AYAN_SIMD_INLINE static Pack LoadUnaligned(const double* ptr) noexcept { return Pack(_mm256_loadu_pd(ptr)); }
+  AYAN_SIMD_INLINE static Pack Gather(const double* base, const int32_t* indices) noexcept {
+#if defined(AYAN_SIMD_AVX2)
+    return Pack(_mm256_mask_i32gather_pd(_mm256_setzero_pd(), base,
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices)), _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8));
+#else
+    return Pack(_mm256_setr_pd(base[indices[0]], base[indices[1]], base[indices[2]], base[indices[3]]));
+#endif
+  }
+
+  AYAN_SIMD_INLINE __m256d native() const noexcept { return reg; }
+
+  // ----- ----- ---- Element access ---- ----- -----
+  AYAN_SIMD_INLINE void store(double* ptr) const noexcept { _mm256_store_pd(ptr, reg); }
+  AYAN_SIMD_INLINE void store_unaligned(double* ptr) const noexcept { _mm256_storeu_pd(ptr, reg); }
+  AYAN_SIMD_INLINE double operator[](size_t lane) const noexcept {
+    alignas(32) double out[4];
+    store(out);
+    return out[lane];
+  }
+
+  // ----- ----- ---- Operators ----- ----- ----
+  AYAN_SIMD_INLINE Pack operator-() const noexcept { return Pack(_mm256_xor_pd(reg, _mm256_set1_pd(-0.0))); }
+  AYAN_SIMD_INLINE Pack& operator+=(const Pack& oth) noexcept { reg = _mm256_add_pd(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Pack& operator-=(const Pack& oth) noexcept { reg = _mm256_sub_pd(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Pack& operator*=(const Pack& oth) noexcept { reg = _mm256_mul_pd(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Pack& operator/=(const Pack& oth) noexcept { reg = _mm256_div_pd(reg, oth.reg); return *this; }
+};
+
+// ----- ----- ---- Arithmetic ----- ----- ----
+AYAN_SIMD_INLINE Pack4d operator+(const Pack4d& a, const Pack4d& b) noexcept { return Pack4d(_mm256_add_pd(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack4d operator-(const Pack4d& a, const Pack4d& b) noexcept { return Pack4d(_mm256_sub_pd(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack4d operator*(const Pack4d& a, const Pack4d& b) noexcept { return Pack4d(_mm256_mul_pd(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack4d operator/(const Pack4d& a, const Pack4d& b) noexcept { return Pack4d(_mm256_div_pd(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack4d min(const Pack4d& a, const Pack4d& b) noexcept { return Pack4d(_mm256_min_pd(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack4d max(const Pack4d& a, const Pack4d& b) noexcept { return Pack4d(_mm256_max_pd(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack4d abs(const Pack4d& a) noexcept { return Pack4d(_mm256_andnot_pd(_mm256_set1_pd(-0.0), a.native())); }
+AYAN_SIMD_INLINE Pack4d sqrt(const Pack4d& a) noexcept { return Pack4d(_mm256_sqrt_pd(a.native())); }
+AYAN_SIMD_INLINE Pack4d rcp(const Pack4d& a) noexcept { return Pack4d(1.0) / a; }
+AYAN_SIMD_INLINE Pack4d rsqrt(const Pack4d& a) noexcept { return Pack4d(1.0) / sqrt(a); }
+
+AYAN_SIMD_INLINE Pack4d fmadd(const Pack4d& a, const Pack4d& b, const Pack4d& c) noexcept {
+#if defined(AYAN_SIMD_FMA)
+  return Pack4d(_mm256_fmadd_pd(a.native(), b.native(), c.native()));
+#else
+  return a * b + c;
+#endif
+}
+
+AYAN_SIMD_INLINE Pack4d fnmadd(const Pack4d& a, const Pack4d& b, const Pack4d& c) noexcept {
+#if defined(AYAN_SIMD_FMA)
+  return Pack4d(_mm256_fnmadd_pd(a.native(), b.native(), c.native()));
+#else
+  return c - a * b;
+#endif
+}
+
+// ----- ----- ---- Horizontal reductions ----- ----- ----
+AYAN_SIMD_INLINE double hsum(const Pack4d& a) noexcept {
+  const __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(a.native()), _mm256_extractf128_pd(a.native(), 1));
+  return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+AYAN_SIMD_INLINE double hmin(const Pack4d& a) noexcept {
+  const __m128d m = _mm_min_pd(_mm256_castpd256_pd128(a.native()), _mm256_extractf128_pd(a.native(), 1));
+  return _mm_cvtsd_f64(_mm_min_sd(m, _mm_unpackhi_pd(m, m)));
+}
+
+AYAN_SIMD_INLINE double hmax(const Pack4d& a) noexcept {
+  const __m128d m = _mm_max_pd(_mm256_castpd256_pd128(a.native()), _mm256_extractf128_pd(a.native(), 1));
+  return _mm_cvtsd_f64(_mm_max_sd(m, _mm_unpackhi_pd(m, m)));
+}
+
+// ----- ----- ---- Comparisons ----- ----- ----
+AYAN_SIMD_INLINE Mask4d operator==(const Pack4d& a, const Pack4d& b) noexcept { return Mask4d(_mm256_cmp_pd(a.native(), b.native(), _CMP_EQ_OQ)); }
+AYAN_SIMD_INLINE Mask4d operator!=(const Pack4d& a, const Pack4d& b) noexcept { return Mask4d(_mm256_cmp_pd(a.native(), b.native(), _CMP_NEQ_UQ)); }
+AYAN_SIMD_INLINE Mask4d operator<(const Pack4d& a, const Pack4d& b) noexcept { return Mask4d(_mm256_cmp_pd(a.native(), b.native(), _CMP_LT_OQ)); }
+AYAN_SIMD_INLINE Mask4d operator<=(const Pack4d& a, const Pack4d& b) noexcept { return Mask4d(_mm256_cmp_pd(a.native(), b.native(), _CMP_LE_OQ)); }
+AYAN_SIMD_INLINE Mask4d operator>(const Pack4d& a, const Pack4d& b) noexcept { return Mask4d(_mm256_cmp_pd(a.native(), b.native(), _CMP_GT_OQ)); }
+AYAN_SIMD_INLINE Mask4d operator>=(const Pack4d& a, const Pack4d& b) noexcept { return Mask4d(_mm256_cmp_pd(a.native(), b.native(), _CMP_GE_OQ)); }
+
+// ----- ----- ---- Masks ----- ----- ----
+AYAN_SIMD_INLINE Mask4d operator&(const Mask4d& a, const Mask4d& b) noexcept { return Mask4d(_mm256_and_pd(a.native(), b.native())); }
+AYAN_SIMD_INLINE Mask4d operator|(const Mask4d& a, const Mask4d& b) noexcept { return Mask4d(_mm256_or_pd(a.native(), b.native())); }
+AYAN_SIMD_INLINE Mask4d operator^(const Mask4d& a, const Mask4d& b) noexcept { return Mask4d(_mm256_xor_pd(a.native(), b.native())); }
+
+AYAN_SIMD_INLINE Pack4d select(const Mask4d& mask, const Pack4d& if_true, const Pack4d& if_false) noexcept {
+  return Pack4d(_mm256_blendv_pd(if_false.native(), if_true.native(), mask.native()));
+}
+
+// ----- ----- ---- Permutations ----- ----- ----
+template<size_t I0, size_t I1, size_t I2, size_t I3> requires (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4)
+AYAN_SIMD_INLINE Pack4d shuffle(const Pack4d& a) noexcept {
+#if defined(AYAN_SIMD_AVX2)
+  return Pack4d(_mm256_permute4x64_pd(a.native(), _MM_SHUFFLE(I3, I2, I1, I0)));
+#else
+  // lane crossing permutations of doubles are AVX2-only, the halves are shuffled apart:
+  const __m128d lo = _mm256_castpd256_pd128(a.native());
+  const __m128d hi = _mm256_extractf128_pd(a.native(), 1);
+  return Pack4d(_mm256_insertf128_pd(_mm256_castpd128_pd256(detail::shuffle_pd_halves<I0, I1>(lo, hi)),
+    detail::shuffle_pd_halves<I2, I3>(lo, hi), 1));
+#endif
+}
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                    Mask<float, 8>                    |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<>
+class Mask<float, 8> {
+private: // Fields:
+  __m256 reg; // all bits of a lane are set if the lane is true;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  AYAN_SIMD_INLINE Mask() noexcept : reg(_mm256_setzero_ps()) {}
+  AYAN_SIMD_INLINE explicit Mask(__m256 r) noexcept : reg(r) {}
+  AYAN_SIMD_INLINE explicit Mask(bool value) noexcept
+    : reg(_mm256_castsi256_ps(_mm256_set1_epi32(value ? -1 : 0))) {}
+
+  AYAN_SIMD_INLINE static Mask FromBits(uint32_t bits) noexcept {
+    const __m256 lane_bit = _mm256_castsi256_ps(_mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128));
+    const __m256 masked = _mm256_and_ps(_mm256_castsi256_ps(_mm256_set1_epi32(int(bits))), lane_bit);
+    // integer compare is AVX2-only, the float compare of the same bits works on AVX:
+    return Mask(_mm256_cmp_ps(_mm256_cvtepi32_ps(_mm256_castps_si256(masked)),
+      _mm256_cvtepi32_ps(_mm256_castps_si256(lane_bit)), _CMP_EQ_OQ));
+  }
+
+  AYAN_SIMD_INLINE __m256 native() const noexcept { return reg; }
+
+  // ----- ----- ---- Lane queries ---- ----- -----
+  AYAN_SIMD_INLINE uint32_t bits() const noexcept { return uint32_t(_mm256_movemask_ps(reg)); }
+  AYAN_SIMD_INLINE bool operator[](size_t lane) const noexcept { return (bits() >> lane) & 1u; }
+  AYAN_SIMD_INLINE bool any() const noexcept { return bits() != 0; }
+  AYAN_SIMD_INLINE bool all() const noexcept { return bits() == 0xFFu; }
+  AYAN_SIMD_INLINE bool none() const noexcept { return bits() == 0; }
+
+  // ----- ----- ---- Logical operators ---- ----- -----
+  AYAN_SIMD_INLINE Mask operator~() const noexcept {
+    return Mask(_mm256_xor_ps(reg, _mm256_castsi256_ps(_mm256_set1_epi32(-1))));
+  }
+  AYAN_SIMD_INLINE Mask& operator&=(const Mask& oth) noexcept { reg = _mm256_and_ps(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Mask& operator|=(const Mask& oth) noexcept { reg = _mm256_or_ps(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Mask& operator^=(const Mask& oth) noexcept { reg = _mm256_xor_ps(reg, oth.reg); return *this; }
+};
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                    Pack<float, 8>                    |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<>
+class Pack<float, 8> {
+public: // Types:
+  using value_type = float;
+  using mask_type = Mask<float, 8>;
+  static constexpr size_t lanes = 8;
+
+private: // Fields:
+  __m256 reg;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  AYAN_SIMD_INLINE Pack() noexcept : reg(_mm256_setzero_ps()) {}
+  AYAN_SIMD_INLINE explicit Pack(float scalar) noexcept : reg(_mm256_set1_ps(scalar)) {}
+  AYAN_SIMD_INLINE explicit Pack(__m256 r) noexcept : reg(r) {}
+
+  AYAN_SIMD_INLINE static Pack Broadcast(float scalar) noexcept { return Pack(scalar); }
+  AYAN_SIMD_INLINE static Pack Zero() noexcept { return Pack(); }
+  AYAN_SIMD_INLINE static Pack Load(const float* ptr) noexcept { return Pack(_mm256_load_ps(ptr)); }
+  AYAN_SIMD_INLINE static Pack LoadUnaligned(const float* ptr) noexcept { return Pack(_mm256_loadu_ps(ptr)); }
+  AYAN_SIMD_INLINE static Pack Gather(const float* base, const int32_t* indices) noexcept {
+#if defined(AYAN_SIMD_AVX2)
+    return Pack(_mm256_mask_i32gather_ps(_mm256_setzero_ps(), base,
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices)), _mm256_castsi256_ps(_mm256_set1_epi32(-1)), 4));
+#else
+    return Pack(_mm256_setr_ps(
+      base[indices[0]], base[indices[1]], base[indices[2]], base[indices[3]],
+      base[indices[4]], base[indices[5]], base[indices[6]], base[indices[7]]));
+#endif
+  }
+
+  AYAN_SIMD_INLINE __m256 native() const noexcept { return reg; }
+
+  // ----- ----- ---- Element access ---- ----- -----
+  AYAN_SIMD_INLINE void store(float* ptr) const noexcept { _mm256_store_ps(ptr, reg); }
+  AYAN_SIMD_INLINE void store_unaligned(float* ptr) const noexcept { _mm256_storeu_ps(ptr, reg); }
+  AYAN_SIMD_INLINE float operator[](size_t lane) const noexcept {
+    alignas(32) float out[8];
+    store(out);
+    return out[lane];
+  }
+
+  // ----- ----- ---- Operators ----- ----- ----
+  AYAN_SIMD_INLINE Pack operator-() const noexcept { return Pack(_mm256_xor_ps(reg, _mm256_set1_ps(-0.0f))); }
+  AYAN_SIMD_INLINE Pack& operator+=(const Pack& oth) noexcept { reg = _mm256_add_ps(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Pack& operator-=(const Pack& oth) noexcept { reg = _mm256_sub_ps(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Pack& operator*=(const Pack& oth) noexcept { reg = _mm256_mul_ps(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Pack& operator/=(const Pack& oth) noexcept { reg = _mm256_div_ps(reg, oth.reg); return *this; }
+};
+
+// ----- ----- ---- Arithmetic ----- ----- ----
+AYAN_SIMD_INLINE Pack8f operator+(const Pack8f& a, const Pack8f& b) noexcept { return Pack8f(_mm256_add_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack8f operator-(const Pack8f& a, const Pack8f& b) noexcept { return Pack8f(_mm256_sub_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack8f operator*(const Pack8f& a, const Pack8f& b) noexcept { return Pack8f(_mm256_mul_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack8f operator/(const Pack8f& a, const Pack8f& b) noexcept { return Pack8f(_mm256_div_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack8f min(const Pack8f& a, const Pack8f& b) noexcept { return Pack8f(_mm256_min_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack8f max(const Pack8f& a, const Pack8f& b) noexcept { return Pack8f(_mm256_max_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack8f abs(const Pack8f& a) noexcept { return Pack8f(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.native())); }
+AYAN_SIMD_INLINE Pack8f sqrt(const Pack8f& a) noexcept { return Pack8f(_mm256_sqrt_ps(a.native())); }
+AYAN_SIMD_INLINE Pack8f rcp(const Pack8f& a) noexcept { return Pack8f(_mm256_rcp_ps(a.native())); }
+AYAN_SIMD_INLINE Pack8f rsqrt(const Pack8f& a) noexcept { return Pack8f(_mm256_rsqrt_ps(a.native())); }
+
+AYAN_SIMD_INLINE Pack8f fmadd(const Pack8f& a, const Pack8f& b, const Pack8f& c) noexcept {
+#if defined(AYAN_SIMD_FMA)
+  return Pack8f(_mm256_fmadd_ps(a.native(), b.native(), c.native()));
+#else
+  return a * b + c;
+#endif
+}
+
+AYAN_SIMD_INLINE Pack8f fnmadd(const Pack8f& a, const Pack8f& b, const Pack8f& c) noexcept {
+#if defined(AYAN_SIMD_FMA)
+  return Pack8f(_mm256_fnmadd_ps(a.native(), b.native(), c.native()));
+#else
+  return c - a * b;
+#endif
+}
+
+// ----- ----- ---- Horizontal reductions ----- ----- ----
+AYAN_SIMD_INLINE float hsum(const Pack8f& a) noexcept {
+  return hsum(Pack4f(_mm_add_ps(_mm256_castps256_ps128(a.native()), _mm256_extractf128_ps(a.native(), 1))));
+}
+
+AYAN_SIMD_INLINE float hmin(const Pack8f& a) noexcept {
+  return hmin(Pack4f(_mm_min_ps(_mm256_castps256_ps128(a.native()), _mm256_extractf128_ps(a.native(), 1))));
+}
+
+AYAN_SIMD_INLINE float hmax(const Pack8f& a) noexcept {
+  return hmax(Pack4f(_mm_max_ps(_mm256_castps256_ps128(a.native()), _mm256_extractf128_ps(a.native(), 1))));
+}
+
+// ----- ----- ---- Comparisons ----- ----- ----
+AYAN_SIMD_INLINE Mask8f operator==(const Pack8f& a, const Pack8f& b) noexcept { return Mask8f(_mm256_cmp_ps(a.native(), b.native(), _CMP_EQ_OQ)); }
+AYAN_SIMD_INLINE Mask8f operator!=(const Pack8f& a, const Pack8f& b) noexcept { return Mask8f(_mm256_cmp_ps(a.native(), b.native(), _CMP_NEQ_UQ)); }
+AYAN_SIMD_INLINE Mask8f operator<(const Pack8f& a, const Pack8f& b) noexcept { return Mask8f(_mm256_cmp_ps(a.native(), b.native(), _CMP_LT_OQ)); }
+AYAN_SIMD_INLINE Mask8f operator<=(const Pack8f& a, const Pack8f& b) noexcept { return Mask8f(_mm256_cmp_ps(a.native(), b.native(), _CMP_LE_OQ)); }
+AYAN_SIMD_INLINE Mask8f operator>(const Pack8f& a, const Pack8f& b) noexcept { return Mask8f(_mm256_cmp_ps(a.native(), b.native(), _CMP_GT_OQ)); }
+AYAN_SIMD_INLINE Mask8f operator>=(const Pack8f& a, const Pack8f& b) noexcept { return Mask8f(_mm256_cmp_ps(a.native(), b.native(), _CMP_GE_OQ)); }
+
+// ----- ----- ---- Masks ----- ----- ----
+AYAN_SIMD_INLINE Mask8f operator&(const Mask8f& a, const Mask8f& b) noexcept { return Mask8f(_mm256_and_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Mask8f operator|(const Mask8f& a, const Mask8f& b) noexcept { return Mask8f(_mm256_or_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Mask8f operator^(const Mask8f& a, const Mask8f& b) noexcept { return Mask8f(_mm256_xor_ps(a.native(), b.native())); }
+
+AYAN_SIMD_INLINE Pack8f select(const Mask8f& mask, const Pack8f& if_true, const Pack8f& if_false) noexcept {
+  return Pack8f(_mm256_blendv_ps(if_false.native(), if_true.native(), mask.native()));
+}
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                 Interleaved memory                  |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+namespace detail {
+
+inline constexpr auto shuffle_ps256 = []<int Imm>(__m256 x, __m256 y) noexcept { return _mm256_shuffle_ps(x, y, Imm); };
+
+// two 128-bit loads into the low and high lanes of one register:
+AYAN_SIMD_INLINE __m256 loadu2_ps(const float* lo, const float* hi) noexcept {
+  return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)), _mm_loadu_ps(hi), 1);
+}
+
+AYAN_SIMD_INLINE __m256d loadu2_pd(const double* lo, const double* hi) noexcept {
+  return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(lo)), _mm_loadu_pd(hi), 1);
+}
+
+AYAN_SIMD_INLINE void storeu2_pd(double* lo, double* hi, __m256d reg) noexcept {
+  _mm_storeu_pd(lo, _mm256_castpd256_pd128(reg));
+  _mm_storeu_pd(hi, _mm256_extractf128_pd(reg, 1));
+}
+
+} // namespace detail
+
+// triples 0..3 go to the low lanes and 4..7 to the high lanes, then the SSE shuffles run per lane:
+AYAN_SIMD_INLINE void load_deinterleave3(const float* src, Pack8f& a, Pack8f& b, Pack8f& c) noexcept {
+  __m256 ra, rb, rc;
+  detail::deinterleave3(
+    detail::loadu2_ps(src, src + 12), detail::loadu2_ps(src + 4, src + 16), detail::loadu2_ps(src + 8, src + 20),
+    ra, rb, rc, detail::shuffle_ps256);
+  a = Pack8f(ra);
+  b = Pack8f(rb);
+  c = Pack8f(rc);
+}
+
+AYAN_SIMD_INLINE void store_interleave3(float* dst, const Pack8f& a, const Pack8f& b, const Pack8f& c) noexcept {
+  __m256 m0, m1, m2;
+  detail::interleave3(a.native(), b.native(), c.native(), m0, m1, m2, detail::shuffle_ps256);
+  _mm_storeu_ps(dst, _mm256_castps256_ps128(m0));
+  _mm_storeu_ps(dst + 4, _mm256_castps256_ps128(m1));
+  _mm_storeu_ps(dst + 8, _mm256_castps256_ps128(m2));
+  _mm_storeu_ps(dst + 12, _mm256_extractf128_ps(m0, 1));
+  _mm_storeu_ps(dst + 16, _mm256_extractf128_ps(m1, 1));
+  _mm_storeu_ps(dst + 20, _mm256_extractf128_ps(m2, 1));
+}
+
+// m03 = a0 b0 | a2 b2, m14 = c0 a1 | c2 a3, m25 = b1 c1 | b3 c3:
+AYAN_SIMD_INLINE void load_deinterleave3(const double* src, Pack4d& a, Pack4d& b, Pack4d& c) noexcept {
+  const __m256d m03 = detail::loadu2_pd(src, src + 6);
+  const __m256d m14 = detail::loadu2_pd(src + 2, src + 8);
+  const __m256d m25 = detail::loadu2_pd(src + 4, src + 10);
+  a = Pack4d(_mm256_blend_pd(m03, m14, 0b1010));
+  b = Pack4d(_mm256_shuffle_pd(m03, m25, 0b0101));
+  c = Pack4d(_mm256_blend_pd(m14, m25, 0b1010));
+}
+
+AYAN_SIMD_INLINE void store_interleave3(double* dst, const Pack4d& a, const Pack4d& b, const Pack4d& c) noexcept {
+  detail::storeu2_pd(dst, dst + 6, _mm256_shuffle_pd(a.native(), b.native(), 0b0000));
+  detail::storeu2_pd(dst + 2, dst + 8, _mm256_blend_pd(c.native(), a.native(), 0b1010));
+  detail::storeu2_pd(dst + 4, dst + 10, _mm256_shuffle_pd(b.native(), c.native(), 0b1111));
+}
+
+} // namespace ayan::math::simd
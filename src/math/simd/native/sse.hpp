@@ -0,0 +1,234 @@
+#pragma once
+
+// SSE2 specializations: Pack<float, 4> in one __m128 register and
+// Pack<double, 4> in a pair of __m128d (replaced by __m256d with AVX).
+
+#include "../pack.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::simd {
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                    Mask<float, 4>                    |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<>
+class Mask<float, 4> {
+private: // Fields:
+  __m128 reg; // all bits of a lane are set if the lane is true;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  AYAN_SIMD_INLINE Mask() noexcept : reg(_mm_setzero_ps()) {}
+  AYAN_SIMD_INLINE explicit Mask(__m128 r) noexcept : reg(r) {}
+  AYAN_SIMD_INLINE explicit Mask(bool value) noexcept
+    : reg(_mm_castsi128_ps(_mm_set1_epi32(value ? -1 : 0))) {}
+
+  AYAN_SIMD_INLINE static Mask FromBits(uint32_t bits) noexcept {
+    const __m128i lane_bit = _mm_setr_epi32(1, 2, 4, 8);
+    const __m128i masked = _mm_and_si128(_mm_set1_epi32(int(bits)), lane_bit);
+    return Mask(_mm_castsi128_ps(_mm_cmpeq_epi32(masked, lane_bit)));
+  }
+
+  AYAN_SIMD_INLINE __m128 native() const noexcept { return reg; }
+
+  // ----- ----- ---- Lane queries ---- ----- -----
+  AYAN_SIMD_INLINE uint32_t bits() const noexcept { return uint32_t(_mm_movemask_ps(reg)); }
+  AYAN_SIMD_INLINE bool operator[](size_t lane) const noexcept { return (bits() >> lane) & 1u; }
+  AYAN_SIMD_INLINE bool any() const noexcept { return bits() != 0; }
+  AYAN_SIMD_INLINE bool all() const noexcept { return bits() == 0xFu; }
+  AYAN_SIMD_INLINE bool none() const noexcept { return bits() == 0; }
+
+  // ----- ----- ---- Logical operators ---- ----- -----
+  AYAN_SIMD_INLINE Mask operator~() const noexcept {
+    return Mask(_mm_xor_ps(reg, _mm_castsi128_ps(_mm_set1_epi32(-1))));
+  }
+  AYAN_SIMD_INLINE Mask& operator&=(const Mask& oth) noexcept { reg = _mm_and_ps(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Mask& operator|=(const Mask& oth) noexcept { reg = _mm_or_ps(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Mask& operator^=(const Mask& oth) noexcept { reg = _mm_xor_ps(reg, oth.reg); return *this; }
+};
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                    Pack<float, 4>                    |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<>
+class Pack<float, 4> {
+public: // Types:
+  using value_type = float;
+  using mask_type = Mask<float, 4>;
+  static constexpr size_t lanes = 4;
+
+private: // Fields:
+  __m128 reg;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  AYAN_SIMD_INLINE Pack() noexcept : reg(_mm_setzero_ps()) {}
+  AYAN_SIMD_INLINE explicit Pack(float scalar) noexcept : reg(_mm_set1_ps(scalar)) {}
+  AYAN_SIMD_INLINE explicit Pack(__m128 r) noexcept : reg(r) {}
+
+  AYAN_SIMD_INLINE static Pack Broadcast(float scalar) noexcept { return Pack(scalar); }
+  AYAN_SIMD_INLINE static Pack Zero() noexcept { return Pack(); }
+  AYAN_SIMD_INLINE static Pack Load(const float* ptr) noexcept { return Pack(_mm_load_ps(ptr)); }
+  AYAN_SIMD_INLINE static Pack LoadUnaligned(const float* ptr) noexcept { return Pack(_mm_loadu_ps(ptr)); }
+  AYAN_SIMD_INLINE static Pack Gather(const float* base, const int32_t* indices) noexcept {
+#if defined(AYAN_SIMD_AVX2)
+    // the masked form: the plain one reads an undefined source register
+    return Pack(_mm_mask_i32gather_ps(_mm_setzero_ps(), base,
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices)), _mm_castsi128_ps(_mm_set1_epi32(-1)), 4));
+#else
+    return Pack(_mm_setr_ps(base[indices[0]], base[indices[1]], base[indices[2]], base[indices[3]]));
+#endif
+  }
+
+  AYAN_SIMD_INLINE __m128 native() const noexcept { return reg; }
+
+  // ----- ----- ---- Element access ---- ----- -----
+  AYAN_SIMD_INLINE void store(float* ptr) const noexcept { _mm_store_ps(ptr, reg); }
+  AYAN_SIMD_INLINE void store_unaligned(float* ptr) const noexcept { _mm_storeu_ps(ptr, reg); }
+  AYAN_SIMD_INLINE float operator[](size_t lane) const noexcept {
+    alignas(16) float out[4];
+    store(out);
+    return out[lane];
+  }
+
+  // ----- ----- ---- Operators ----- ----- ----
+  AYAN_SIMD_INLINE Pack operator-() const noexcept { return Pack(_mm_xor_ps(reg, _mm_set1_ps(-0.0f))); }
+  AYAN_SIMD_INLINE Pack& operator+=(const Pack& oth) noexcept { reg = _mm_add_ps(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Pack& operator-=(const Pack& oth) noexcept { reg = _mm_sub_ps(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Pack& operator*=(const Pack& oth) noexcept { reg = _mm_mul_ps(reg, oth.reg); return *this; }
+  AYAN_SIMD_INLINE Pack& operator/=(const Pack& oth) noexcept { reg = _mm_div_ps(reg, oth.reg); return *this; }
+};
+
+// ----- ----- ---- Arithmetic ----- ----- ----
+AYAN_SIMD_INLINE Pack4f operator+(const Pack4f& a, const Pack4f& b) noexcept { return Pack4f(_mm_add_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack4f operator-(const Pack4f& a, const Pack4f& b) noexcept { return Pack4f(_mm_sub_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack4f operator*(const Pack4f& a, const Pack4f& b) noexcept { return Pack4f(_mm_mul_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack4f operator/(const Pack4f& a, const Pack4f& b) noexcept { return Pack4f(_mm_div_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack4f min(const Pack4f& a, const Pack4f& b) noexcept { return Pack4f(_mm_min_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack4f max(const Pack4f& a, const Pack4f& b) noexcept { return Pack4f(_mm_max_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Pack4f abs(const Pack4f& a) noexcept { return Pack4f(_mm_andnot_ps(_mm_set1_ps(-0.0f), a.native())); }
+AYAN_SIMD_INLINE Pack4f sqrt(const Pack4f& a) noexcept { return Pack4f(_mm_sqrt_ps(a.native())); }
+AYAN_SIMD_INLINE Pack4f rcp(const Pack4f& a) noexcept { return Pack4f(_mm_rcp_ps(a.native())); }
+AYAN_SIMD_INLINE Pack4f rsqrt(const Pack4f& a) noexcept { return Pack4f(_mm_rsqrt_ps(a.native())); }
+
+AYAN_SIMD_INLINE Pack4f fmadd(const Pack4f& a, const Pack4f& b, const Pack4f& c) noexcept {
+#if defined(AYAN_SIMD_FMA)
+  return Pack4f(_mm_fmadd_ps(a.native(), b.native(), c.native()));
+#else
+  return a * b + c;
+#endif
+}
+
+AYAN_SIMD_INLINE Pack4f fnmadd(const Pack4f& a, const Pack4f& b, const Pack4f& c) noexcept {
+#if defined(AYAN_SIMD_FMA)
+  return Pack4f(_mm_fnmadd_ps(a.native(), b.native(), c.native()));
+#else
+  return c - a * b;
+#endif
+}
+
+// ----- ----- ---- Horizontal reductions ----- ----- ----
+AYAN_SIMD_INLINE float hsum(const Pack4f& a) noexcept {
+  const __m128 v = a.native();
+  const __m128 pairs = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_movehl_ps(pairs, pairs)));
+}
+
+AYAN_SIMD_INLINE float hmin(const Pack4f& a) noexcept {
+  const __m128 v = a.native();
+  const __m128 pairs = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtss_f32(_mm_min_ss(pairs, _mm_movehl_ps(pairs, pairs)));
+}
+
+AYAN_SIMD_INLINE float hmax(const Pack4f& a) noexcept {
+  const __m128 v = a.native();
+  const __m128 pairs = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtss_f32(_mm_max_ss(pairs, _mm_movehl_ps(pairs, pairs)));
+}
+
+// ----- ----- ---- Comparisons ----- ----- ----
+AYAN_SIMD_INLINE Mask4f operator==(const Pack4f& a, const Pack4f& b) noexcept { return Mask4f(_mm_cmpeq_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Mask4f operator!=(const Pack4f& a, const Pack4f& b) noexcept { return Mask4f(_mm_cmpneq_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Mask4f operator<(const Pack4f& a, const Pack4f& b) noexcept { return Mask4f(_mm_cmplt_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Mask4f operator<=(const Pack4f& a, const Pack4f& b) noexcept { return Mask4f(_mm_cmple_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Mask4f operator>(const Pack4f& a, const Pack4f& b) noexcept { return Mask4f(_mm_cmpgt_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Mask4f operator>=(const Pack4f& a, const Pack4f& b) noexcept { return Mask4f(_mm_cmpge_ps(a.native(), b.native())); }
+
+// ----- ----- ---- Masks ----- ----- ----
+AYAN_SIMD_INLINE Mask4f operator&(const Mask4f& a, const Mask4f& b) noexcept { return Mask4f(_mm_and_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Mask4f operator|(const Mask4f& a, const Mask4f& b) noexcept { return Mask4f(_mm_or_ps(a.native(), b.native())); }
+AYAN_SIMD_INLINE Mask4f operator^(const Mask4f& a, const Mask4f& b) noexcept { return Mask4f(_mm_xor_ps(a.native(), b.native())); }
+
+AYAN_SIMD_INLINE Pack4f select(const Mask4f& mask, const Pack4f& if_true, const Pack4f& if_false) noexcept {
+#if defined(AYAN_SIMD_SSE41)
+  return Pack4f(_mm_blendv_ps(if_false.native(), if_true.native(), mask.native()));
+#else
+  return Pack4f(_mm_or_ps(
+    _mm_and_ps(mask.native(), if_true.native()),
+    _mm_andnot_ps(mask.native(), if_false.native())));
+#endif
+}
+
+// ----- ----- ---- Permutations ----- ----- ----
+template<size_t I0, size_t I1, size_t I2, size_t I3> requires (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4)
+AYAN_SIMD_INLINE Pack4f shuffle(const Pack4f& a) noexcept {
+  return Pack4f(_mm_shuffle_ps(a.native(), a.native(), _MM_SHUFFLE(I3, I2, I1, I0)));
+}
+
+// 3 loads + 5 shuffles instead of 12 scalar moves. The 128-bit lanes of the AVX
+// variant in avx.hpp run the same shuffles, so they are shared through these helpers:
+namespace detail {
+
+// in: m0 = a0 b0 c0 a1, m1 = b1 c1 a2 b2, m2 = c2 a3 b3 c3
+template<typename RegT, typename ShuffleF>
+AYAN_SIMD_INLINE void deinterleave3(RegT m0, RegT m1, RegT m2, RegT& a, RegT& b, RegT& c, ShuffleF shuffle) noexcept {
+  const RegT t0 = shuffle.template operator()<_MM_SHUFFLE(2, 1, 3, 2)>(m1, m2); // a2 b2 a3 b3
+  const RegT t1 = shuffle.template operator()<_MM_SHUFFLE(1, 0, 2, 1)>(m0, m1); // b0 c0 b1 c1
+  a = shuffle.template operator()<_MM_SHUFFLE(2, 0, 3, 0)>(m0, t0);
+  b = shuffle.template operator()<_MM_SHUFFLE(3, 1, 2, 0)>(t1, t0);
+  c = shuffle.template operator()<_MM_SHUFFLE(3, 0, 3, 1)>(t1, m2);
+}
+
+template<typename RegT, typename ShuffleF>
+AYAN_SIMD_INLINE void interleave3(RegT a, RegT b, RegT c, RegT& m0, RegT& m1, RegT& m2, ShuffleF shuffle) noexcept {
+  const RegT t0 = shuffle.template operator()<_MM_SHUFFLE(2, 0, 2, 0)>(a, b); // a0 a2 b0 b2
+  const RegT t1 = shuffle.template operator()<_MM_SHUFFLE(3, 1, 3, 1)>(b, c); // b1 b3 c1 c3
+  const RegT t2 = shuffle.template operator()<_MM_SHUFFLE(3, 1, 2, 0)>(c, a); // c0 c2 a1 a3
+  m0 = shuffle.template operator()<_MM_SHUFFLE(2, 0, 2, 0)>(t0, t2);
+  m1 = shuffle.template operator()<_MM_SHUFFLE(3, 1, 2, 0)>(t1, t0);
+  m2 = shuffle.template operator()<_MM_SHUFFLE(3, 1, 3, 1)>(t2, t1);
+}
+
+inline constexpr auto shuffle_ps = []<int Imm>(__m128 x, __m128 y) noexcept { return _mm_shuffle_ps(x, y, Imm); };
+
+// lanes I0, I1 of the 4 doubles held as (lo, hi) register halves, for the
+// Pack4d permutations of sse_double.hpp and of avx.hpp without AVX2:
+template<size_t I0, size_t I1>
+AYAN_SIMD_INLINE __m128d shuffle_pd_halves(__m128d lo, __m128d hi) noexcept {
+  return _mm_shuffle_pd(I0 < 2 ? lo : hi, I1 < 2 ? lo : hi, int(I0 & 1) | int(I1 & 1) << 1);
+}
+
+} // namespace detail
+
+AYAN_SIMD_INLINE void load_deinterleave3(const float* src, Pack4f& a, Pack4f& b, Pack4f& c) noexcept {
+  __m128 ra, rb, rc;
+  detail::deinterleave3(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), ra, rb, rc, detail::shuffle_ps);
+  a = Pack4f(ra);
+  b = Pack4f(rb);
+  c = Pack4f(rc);
+}
+
+AYAN_SIMD_INLINE void store_interleave3(float* dst, const Pack4f& a, const Pack4f& b, const Pack4f& c) noexcept {
+  __m128 m0, m1, m2;
+  detail::interleave3(a.native(), b.native(), c.native(), m0, m1, m2, detail::shuffle_ps);
+  _mm_storeu_ps(dst, m0);
+  _mm_storeu_ps(dst + 4, m1);
+  _mm_storeu_ps(dst + 8, m2);
+}
+
+} // namespace ayan::math::simd
+
+#if defined(AYAN_SIMD_AVX)
+  #include "avx.hpp"
+#else
+  #include "sse_double.hpp"
+#endif
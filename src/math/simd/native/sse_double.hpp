@@ -0,0 +1,248 @@
+#pragma once
+
+// SSE2 Pack<double, 4>: a pair of __m128d registers holding lanes {0, 1} and {2, 3}.
+// Only used when AVX is not available (see avx.hpp).
+
+#include "../pack.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::simd {
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                    Mask<double, 4>                   |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<>
+class Mask<double, 4> {
+private: // Fields:
+  __m128d lo; // lanes 0, 1;
+  __m128d hi; // lanes 2, 3;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  AYAN_SIMD_INLINE Mask() noexcept : lo(_mm_setzero_pd()), hi(_mm_setzero_pd()) {}
+  AYAN_SIMD_INLINE Mask(__m128d l, __m128d h) noexcept : lo(l), hi(h) {}
+  AYAN_SIMD_INLINE explicit Mask(bool value) noexcept
+    : lo(_mm_castsi128_pd(_mm_set1_epi32(value ? -1 : 0))), hi(lo) {}
+
+  AYAN_SIMD_INLINE static Mask FromBits(uint32_t bits) noexcept {
+    const auto lane = [](bool set) { return set ? -1 : 0; };
+    return Mask(
+      _mm_castsi128_pd(_mm_setr_epi32(lane(bits & 1u), lane(bits & 1u), lane(bits & 2u), lane(bits & 2u))),
+      _mm_castsi128_pd(_mm_setr_epi32(lane(bits & 4u), lane(bits & 4u), lane(bits & 8u), lane(bits & 8u))));
+  }
+
+  AYAN_SIMD_INLINE __m128d native_lo() const noexcept { return lo; }
+  AYAN_SIMD_INLINE __m128d native_hi() const noexcept { return hi; }
+
+  // ----- ----- ---- Lane queries ---- ----- -----
+  AYAN_SIMD_INLINE uint32_t bits() const noexcept {
+    return uint32_t(_mm_movemask_pd(lo)) | (uint32_t(_mm_movemask_pd(hi)) << 2);
+  }
+  AYAN_SIMD_INLINE bool operator[](size_t lane) const noexcept { return (bits() >> lane) & 1u; }
+  AYAN_SIMD_INLINE bool any() const noexcept { return bits() != 0; }
+  AYAN_SIMD_INLINE bool all() const noexcept { return bits() == 0xFu; }
+  AYAN_SIMD_INLINE bool none() const noexcept { return bits() == 0; }
+
+  // ----- ----- ---- Logical operators ---- ----- -----
+  AYAN_SIMD_INLINE Mask operator~() const noexcept {
+    const __m128d ones = _mm_castsi128_pd(_mm_set1_epi32(-1));
+    return Mask(_mm_xor_pd(lo, ones), _mm_xor_pd(hi, ones));
+  }
+  AYAN_SIMD_INLINE Mask& operator&=(const Mask& oth) noexcept {
+    lo = _mm_and_pd(lo, oth.lo); hi = _mm_and_pd(hi, oth.hi); return *this;
+  }
+  AYAN_SIMD_INLINE Mask& operator|=(const Mask& oth) noexcept {
+    lo = _mm_or_pd(lo, oth.lo); hi = _mm_or_pd(hi, oth.hi); return *this;
+  }
+  AYAN_SIMD_INLINE Mask& operator^=(const Mask& oth) noexcept {
+    lo = _mm_xor_pd(lo, oth.lo); hi = _mm_xor_pd(hi, oth.hi); return *this;
+  }
+};
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                    Pack<double, 4>                   |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<>
+class Pack<double, 4> {
+public: // Types:
+  using value_type = double;
+  using mask_type = Mask<double, 4>;
+  static constexpr size_t lanes = 4;
+
+private: // Fields:
+  __m128d lo; // lanes 0, 1;
+  __m128d hi; // lanes 2, 3;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  AYAN_SIMD_INLINE Pack() noexcept : lo(_mm_setzero_pd()), hi(_mm_setzero_pd()) {}
+  AYAN_SIMD_INLINE explicit Pack(double scalar) noexcept : lo(_mm_set1_pd(scalar)), hi(lo) {}
+  AYAN_SIMD_INLINE Pack(__m128d l, __m128d h) noexcept : lo(l), hi(h) {}
+
+  AYAN_SIMD_INLINE static Pack Broadcast(double scalar) noexcept { return Pack(scalar); }
+  AYAN_SIMD_INLINE static Pack Zero() noexcept { return Pack(); }
+  AYAN_SIMD_INLINE static Pack Load(const double* ptr) noexcept {
+    return Pack(_mm_load_pd(ptr), _mm_load_pd(ptr + 2));
+  }
+  AYAN_SIMD_INLINE static Pack LoadUnaligned(const double* ptr) noexcept {
+    return Pack(_mm_loadu_pd(ptr), _mm_loadu_pd(ptr + 2));
+  }
+
+  AYAN_SIMD_INLINE static Pack Gather(const double* base, const int32_t* indices) noexcept {
+    return Pack(
+      _mm_setr_pd(base[indices[0]], base[indices[1]]),
+      _mm_setr_pd(base[indices[2]], base[indices[3]]));
+  }
+
+  AYAN_SIMD_INLINE __m128d native_lo() const noexcept { return lo; }
+  AYAN_SIMD_INLINE __m128d native_hi() const noexcept { return hi; }
+
+  // ----- ----- ---- Element access ---- ----- -----
+  AYAN_SIMD_INLINE void store(double* ptr) const noexcept { _mm_store_pd(ptr, lo); _mm_store_pd(ptr + 2, hi); }
+  AYAN_SIMD_INLINE void store_unaligned(double* ptr) const noexcept { _mm_storeu_pd(ptr, lo); _mm_storeu_pd(ptr + 2, hi); }
+  AYAN_SIMD_INLINE double operator[](size_t lane) const noexcept {
+    alignas(16) double out[4];
+    store(out);
+    return out[lane];
+  }
+
+  // ----- ----- ---- Operators ----- ----- ----
+  AYAN_SIMD_INLINE Pack operator-() const noexcept {
+    const __m128d sign = _mm_set1_pd(-0.0);
+    return Pack(_mm_xor_pd(lo, sign), _mm_xor_pd(hi, sign));
+  }
+  AYAN_SIMD_INLINE Pack& operator+=(const Pack& oth) noexcept {
+    lo = _mm_add_pd(lo, oth.lo); hi = _mm_add_pd(hi, oth.hi); return *this;
+  }
+  AYAN_SIMD_INLINE Pack& operator-=(const Pack& oth) noexcept {
+    lo = _mm_sub_pd(lo, oth.lo); hi = _mm_sub_pd(hi, oth.hi); return *this;
+  }
+  AYAN_SIMD_INLINE Pack& operator*=(const Pack& oth) noexcept {
+    lo = _mm_mul_pd(lo, oth.lo); hi = _mm_mul_pd(hi, oth.hi); return *this;
+  }
+  AYAN_SIMD_INLINE Pack& operator/=(const Pack& oth) noexcept {
+    lo = _mm_div_pd(lo, oth.lo); hi = _mm_div_pd(hi, oth.hi); return *this;
+  }
+};
+
+// Applies a two-register SSE2 intrinsic to both halves:
+#define AYAN_SIMD_PD_PAIR(op, a, b) Pack4d(op((a).native_lo(), (b).native_lo()), op((a).native_hi(), (b).native_hi()))
+#define AYAN_SIMD_PD_MASK(op, a, b) Mask4d(op((a).native_lo(), (b).native_lo()), op((a).native_hi(), (b).native_hi()))
+
+// ----- ----- ---- Arithmetic ----- ----- ----
+AYAN_SIMD_INLINE Pack4d operator+(const Pack4d& a, const Pack4d& b) noexcept { return AYAN_SIMD_PD_PAIR(_mm_add_pd, a, b); }
+AYAN_SIMD_INLINE Pack4d operator-(const Pack4d& a, const Pack4d& b) noexcept { return AYAN_SIMD_PD_PAIR(_mm_sub_pd, a, b); }
+AYAN_SIMD_INLINE Pack4d operator*(const Pack4d& a, const Pack4d& b) noexcept { return AYAN_SIMD_PD_PAIR(_mm_mul_pd, a, b); }
+AYAN_SIMD_INLINE Pack4d operator/(const Pack4d& a, const Pack4d& b) noexcept { return AYAN_SIMD_PD_PAIR(_mm_div_pd, a, b); }
+AYAN_SIMD_INLINE Pack4d min(const Pack4d& a, const Pack4d& b) noexcept { return AYAN_SIMD_PD_PAIR(_mm_min_pd, a, b); }
+AYAN_SIMD_INLINE Pack4d max(const Pack4d& a, const Pack4d& b) noexcept { return AYAN_SIMD_PD_PAIR(_mm_max_pd, a, b); }
+AYAN_SIMD_INLINE Pack4d abs(const Pack4d& a) noexcept { return AYAN_SIMD_PD_PAIR(_mm_andnot_pd, Pack4d(-0.0), a); }
+AYAN_SIMD_INLINE Pack4d sqrt(const Pack4d& a) noexcept { return Pack4d(_mm_sqrt_pd(a.native_lo()), _mm_sqrt_pd(a.native_hi())); }
+AYAN_SIMD_INLINE Pack4d rcp(const Pack4d& a) noexcept { return Pack4d(1.0) / a; }
+AYAN_SIMD_INLINE Pack4d rsqrt(const Pack4d& a) noexcept { return Pack4d(1.0) / sqrt(a); }
+AYAN_SIMD_INLINE Pack4d fmadd(const Pack4d& a, const Pack4d& b, const Pack4d& c) noexcept {
+#if defined(AYAN_SIMD_FMA)
+  return Pack4d(
+    _mm_fmadd_pd(a.native_lo(), b.native_lo(), c.native_lo()),
+    _mm_fmadd_pd(a.native_hi(), b.native_hi(), c.native_hi()));
+#else
+  return a * b + c;
+#endif
+}
+
+AYAN_SIMD_INLINE Pack4d fnmadd(const Pack4d& a, const Pack4d& b, const Pack4d& c) noexcept {
+#if defined(AYAN_SIMD_FMA)
+  return Pack4d(
+    _mm_fnmadd_pd(a.native_lo(), b.native_lo(), c.native_lo()),
+    _mm_fnmadd_pd(a.native_hi(), b.native_hi(), c.native_hi()));
+#else
+  return c - a * b;
+#endif
+}
+
+// ----- ----- ---- Horizontal reductions ----- ----- ----
+AYAN_SIMD_INLINE double hsum(const Pack4d& a) noexcept {
+  const __m128d sum = _mm_add_pd(a.native_lo(), a.native_hi());
+  return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+AYAN_SIMD_INLINE double hmin(const Pack4d& a) noexcept {
+  const __m128d m = _mm_min_pd(a.native_lo(), a.native_hi());
+  return _mm_cvtsd_f64(_mm_min_sd(m, _mm_unpackhi_pd(m, m)));
+}
+
+AYAN_SIMD_INLINE double hmax(const Pack4d& a) noexcept {
+  const __m128d m = _mm_max_pd(a.native_lo(), a.native_hi());
+  return _mm_cvtsd_f64(_mm_max_sd(m, _mm_unpackhi_pd(m, m)));
+}
+
+// ----- ----- ---- Comparisons ----- ----- ----
+AYAN_SIMD_INLINE Mask4d operator==(const Pack4d& a, const Pack4d& b) noexcept { return AYAN_SIMD_PD_MASK(_mm_cmpeq_pd, a, b); }
+AYAN_SIMD_INLINE Mask4d operator!=(const Pack4d& a, const Pack4d& b) noexcept { return AYAN_SIMD_PD_MASK(_mm_cmpneq_pd, a, b); }
+AYAN_SIMD_INLINE Mask4d operator<(const Pack4d& a, const Pack4d& b) noexcept { return AYAN_SIMD_PD_MASK(_mm_cmplt_pd, a, b); }
+AYAN_SIMD_INLINE Mask4d operator<=(const Pack4d& a, const Pack4d& b) noexcept { return AYAN_SIMD_PD_MASK(_mm_cmple_pd, a, b); }
+AYAN_SIMD_INLINE Mask4d operator>(const Pack4d& a, const Pack4d& b) noexcept { return AYAN_SIMD_PD_MASK(_mm_cmpgt_pd, a, b); }
+AYAN_SIMD_INLINE Mask4d operator>=(const Pack4d& a, const Pack4d& b) noexcept { return AYAN_SIMD_PD_MASK(_mm_cmpge_pd, a, b); }
+
+// ----- ----- ---- Masks ----- ----- ----
+AYAN_SIMD_INLINE Mask4d operator&(const Mask4d& a, const Mask4d& b) noexcept { return AYAN_SIMD_PD_MASK(_mm_and_pd, a, b); }
+AYAN_SIMD_INLINE Mask4d operator|(const Mask4d& a, const Mask4d& b) noexcept { return AYAN_SIMD_PD_MASK(_mm_or_pd, a, b); }
+AYAN_SIMD_INLINE Mask4d operator^(const Mask4d& a, const Mask4d& b) noexcept { return AYAN_SIMD_PD_MASK(_mm_xor_pd, a, b); }
+
+AYAN_SIMD_INLINE Pack4d select(const Mask4d& mask, const Pack4d& if_true, const Pack4d& if_false) noexcept {
+#if defined(AYAN_SIMD_SSE41)
+  return Pack4d(
+    _mm_blendv_pd(if_false.native_lo(), if_true.native_lo(), mask.native_lo()),
+    _mm_blendv_pd(if_false.native_hi(), if_true.native_hi(), mask.native_hi()));
+#else
+  return Pack4d(
+    _mm_or_pd(_mm_and_pd(mask.native_lo(), if_true.native_lo()), _mm_andnot_pd(mask.native_lo(), if_false.native_lo())),
+    _mm_or_pd(_mm_and_pd(mask.native_hi(), if_true.native_hi()), _mm_andnot_pd(mask.native_hi(), if_false.native_hi())));
+#endif
+}
+
+// ----- ----- ---- Permutations ----- ----- ----
+template<size_t I0, size_t I1, size_t I2, size_t I3> requires (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4)
+AYAN_SIMD_INLINE Pack4d shuffle(const Pack4d& a) noexcept {
+  return Pack4d(
+    detail::shuffle_pd_halves<I0, I1>(a.native_lo(), a.native_hi()),
+    detail::shuffle_pd_halves<I2, I3>(a.native_lo(), a.native_hi()));
+}
+
+// every register holds two triples' worth of one component: m0 = a0 b0, m1 = c0 a1, m2 = b1 c1
+namespace detail {
+
+AYAN_SIMD_INLINE void deinterleave3_pd(const double* src, __m128d& a, __m128d& b, __m128d& c) noexcept {
+  const __m128d m0 = _mm_loadu_pd(src);
+  const __m128d m1 = _mm_loadu_pd(src + 2);
+  const __m128d m2 = _mm_loadu_pd(src + 4);
+  a = _mm_move_sd(m1, m0);
+  b = _mm_shuffle_pd(m0, m2, 0b01);
+  c = _mm_move_sd(m2, m1);
+}
+
+AYAN_SIMD_INLINE void interleave3_pd(double* dst, __m128d a, __m128d b, __m128d c) noexcept {
+  _mm_storeu_pd(dst, _mm_unpacklo_pd(a, b));
+  _mm_storeu_pd(dst + 2, _mm_move_sd(a, c));
+  _mm_storeu_pd(dst + 4, _mm_unpackhi_pd(b, c));
+}
+
+} // namespace detail
+
+AYAN_SIMD_INLINE void load_deinterleave3(const double* src, Pack4d& a, Pack4d& b, Pack4d& c) noexcept {
+  __m128d a_lo, b_lo, c_lo, a_hi, b_hi, c_hi;
+  detail::deinterleave3_pd(src, a_lo, b_lo, c_lo);
+  detail::deinterleave3_pd(src + 6, a_hi, b_hi, c_hi);
+  a = Pack4d(a_lo, a_hi);
+  b = Pack4d(b_lo, b_hi);
+  c = Pack4d(c_lo, c_hi);
+}
+
+AYAN_SIMD_INLINE void store_interleave3(double* dst, const Pack4d& a, const Pack4d& b, const Pack4d& c) noexcept {
+  detail::interleave3_pd(dst, a.native_lo(), b.native_lo(), c.native_lo());
+  detail::interleave3_pd(dst + 6, a.native_hi(), b.native_hi(), c.native_hi());
+}
+
+#undef AYAN_SIMD_PD_PAIR
+#undef AYAN_SIMD_PD_MASK
+
+} // namespace ayan::math::simd
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+#include "fwd.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::simd {
+
+template<typename T, size_t Lanes>
+class Mask {
+private: // Fields:
+  uint32_t lanes_bits; // bit `i` is set if lane `i` is true;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  Mask() noexcept;
+  explicit Mask(bool value) noexcept;
+  static Mask FromBits(uint32_t bits) noexcept;
+
+  // ----- ----- ---- Lane queries ---- ----- -----
+  uint32_t bits() const noexcept;
+  bool operator[](size_t lane) const noexcept;
+  bool any() const noexcept;
+  bool all() const noexcept;
+  bool none() const noexcept;
+
+  // ----- ----- ---- Logical operators ---- ----- -----
+  Mask operator~() const noexcept;
+  Mask& operator&=(const Mask& oth) noexcept;
+  Mask& operator|=(const Mask& oth) noexcept;
+  Mask& operator^=(const Mask& oth) noexcept;
+};
+
+template<typename T, size_t Lanes>
+class Pack {
+  static_assert(Lanes > 0 && Lanes <= 32, "Pack supports from 1 to 32 lanes");
+
+public: // Types:
+  using value_type = T;
+  using mask_type = Mask<T, Lanes>;
+  static constexpr size_t lanes = Lanes;
+
+private: // Fields:
+  alignas(sizeof(T) * Lanes) std::array<T, Lanes> data;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  Pack() noexcept;
+  explicit Pack(T scalar) noexcept;
+
+  static Pack Broadcast(T scalar) noexcept;
+  static Pack Zero() noexcept;
+  // `ptr` must be aligned to sizeof(T) * Lanes:
+  static Pack Load(const T* ptr) noexcept;
+  static Pack LoadUnaligned(const T* ptr) noexcept;
+  // lane `i` is loaded from base[indices[i]]:
+  static Pack Gather(const T* base, const int32_t* indices) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  void store(T* ptr) const noexcept;
+  void store_unaligned(T* ptr) const noexcept;
+  T operator[](size_t lane) const noexcept;
+
+  // ----- ----- ---- Operators ----- ----- ----
+  Pack operator-() const noexcept;
+  Pack& operator+=(const Pack& oth) noexcept;
+  Pack& operator-=(const Pack& oth) noexcept;
+  Pack& operator*=(const Pack& oth) noexcept;
+  Pack& operator/=(const Pack& oth) noexcept;
+};
+
+// ----- ----- ---- Arithmetic ----- ----- ----
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator+(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept;
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator-(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept;
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator*(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept;
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator/(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept;
+
+// with scalar (broadcasted to all lanes):
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator+(const Pack<T, Lanes>& a, std::type_identity_t<T> scalar) noexcept;
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator-(const Pack<T, Lanes>& a, std::type_identity_t<T> scalar) noexcept;
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator*(const Pack<T, Lanes>& a, std::type_identity_t<T> scalar) noexcept;
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator*(std::type_identity_t<T> scalar, const Pack<T, Lanes>& a) noexcept;
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> operator/(const Pack<T, Lanes>& a, std::type_identity_t<T> scalar) noexcept;
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> min(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept;
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> max(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept;
+
+template<typename T, size_t Lanes>
+Pack<T, Lanes> abs(const Pack<T, Lanes>& a) noexcept;
+
+// a * b + c (single rounding where FMA is available):
+template<typename T, size_t Lanes>
+Pack<T, Lanes> fmadd(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b, const Pack<T, Lanes>& c) noexcept;
+
+// c - a * b (single rounding where FMA is available):
+template<typename T, size_t Lanes>
+Pack<T, Lanes> fnmadd(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b, const Pack<T, Lanes>& c) noexcept;
+
+template<typename T, size_t Lanes> requires (std::floating_point<T>)
+Pack<T, Lanes> sqrt(const Pack<T, Lanes>& a) noexcept;
+
+// Approximate 1 / a and 1 / sqrt(a) (exact in the generic version):
+template<typename T, size_t Lanes> requires (std::floating_point<T>)
+Pack<T, Lanes> rcp(const Pack<T, Lanes>& a) noexcept;
+
+template<typename T, size_t Lanes> requires (std::floating_point<T>)
+Pack<T, Lanes> rsqrt(const Pack<T, Lanes>& a) noexcept;
+
+// ----- ----- ---- Horizontal reductions ----- ----- ----
+template<typename T, size_t Lanes>
+T hsum(const Pack<T, Lanes>& a) noexcept;
+
+template<typename T, size_t Lanes>
+T hmin(const Pack<T, Lanes>& a) noexcept;
+
+template<typename T, size_t Lanes>
+T hmax(const Pack<T, Lanes>& a) noexcept;
+
+// ----- ----- ---- Comparisons ----- ----- ----
+// Ordered comparisons: a lane holding NaN compares false (except `!=`):
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator==(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept;
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator!=(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept;
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator<(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept;
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator<=(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept;
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator>(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept;
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator>=(const Pack<T, Lanes>& a, const Pack<T, Lanes>& b) noexcept;
+
+// ----- ----- ---- Masks ----- ----- ----
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator&(const Mask<T, Lanes>& a, const Mask<T, Lanes>& b) noexcept;
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator|(const Mask<T, Lanes>& a, const Mask<T, Lanes>& b) noexcept;
+
+template<typename T, size_t Lanes>
+Mask<T, Lanes> operator^(const Mask<T, Lanes>& a, const Mask<T, Lanes>& b) noexcept;
+
+// mask[i] ? if_true[i] : if_false[i] for every lane:
+template<typename T, size_t Lanes>
+Pack<T, Lanes> select(const Mask<T, Lanes>& mask,
+  const Pack<T, Lanes>& if_true, const Pack<T, Lanes>& if_false) noexcept;
+
+// ----- ----- ---- Permutations ----- ----- ----
+// lane `i` of the result is lane I<i> of `a` (cross products, quaternion
+// products, broadcasts of one lane):
+template<size_t I0, size_t I1, size_t I2, size_t I3, typename T> requires (I0 < 4 && I1 < 4 && I2 < 4 && I3 < 4)
+Pack<T, 4> shuffle(const Pack<T, 4>& a) noexcept;
+
+// ----- ----- ---- Interleaved memory ----- ----- ----
+// `src` holds `Lanes` triples a0 b0 c0 a1 b1 c1 ... (no alignment required),
+// one pack per component is produced (AoS -> SoA, e.g. Vec3 arrays):
+template<typename T, size_t Lanes>
+void load_deinterleave3(const T* src, Pack<T, Lanes>& a, Pack<T, Lanes>& b, Pack<T, Lanes>& c) noexcept;
+
+// inverse of load_deinterleave3 (SoA -> AoS):
+template<typename T, size_t Lanes>
+void store_interleave3(T* dst, const Pack<T, Lanes>& a, const Pack<T, Lanes>& b, const Pack<T, Lanes>& c) noexcept;
+
+} // namespace ayan::math::simd
+
+#include "impl/pack.hpp"
+
+#if defined(AYAN_SIMD_SSE2)
+  #include "native/sse.hpp"
+#endif
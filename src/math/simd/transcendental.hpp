@@ -0,0 +1,63 @@
+#pragma once
+
+#include "pack.hpp"
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//            TRANSCENDENTAL FUNCTIONS OF PACKS         |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+// Range reduction + minimax polynomials (the coefficients of Cephes) in Pack
+// arithmetic: no table lookups, no branches, 4 (SSE) or 8 (AVX) floats per
+// instruction and the scalar fallback elsewhere. Maximum errors against the
+// correctly rounded result (dense sweeps). No FMA, so every instruction set
+// gives the same bits:
+//   sin, cos, sincos  |x| <= pi      : 2 ulp
+//                     |x| <= 8192    : 2 ulp or 2^-24 absolute near the zeros,
+//                                      accuracy drops beyond
+//   exp               any x          : 1 ulp, results below FLT_MIN are 0
+//   log               x > 0          : 1 ulp, denormals included
+//   pow               x > 0          : |y| + 2 ulp (2 ulp on the sRGB curves)
+//   atan2             any y, x       : 3 ulp
+// Special values (zeros, infinities, NaN) follow std:: except for the flushed
+// exp results and pow(x < 0, y), which is NaN for integral y too.
+// The kernels are force-inlined, so a loop keeps the coefficients in registers.
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::simd {
+
+// both results of sincos():
+template<typename T>
+struct SinCos {
+  T sin;
+  T cos;
+};
+
+template<size_t Lanes>
+Pack<float, Lanes> sin(const Pack<float, Lanes>& x) noexcept;
+
+template<size_t Lanes>
+Pack<float, Lanes> cos(const Pack<float, Lanes>& x) noexcept;
+
+// one range reduction for both (hemisphere and disk sampling):
+template<size_t Lanes>
+SinCos<Pack<float, Lanes>> sincos(const Pack<float, Lanes>& x) noexcept;
+
+template<size_t Lanes>
+Pack<float, Lanes> exp(const Pack<float, Lanes>& x) noexcept;
+
+// natural logarithm:
+template<size_t Lanes>
+Pack<float, Lanes> log(const Pack<float, Lanes>& x) noexcept;
+
+template<size_t Lanes>
+Pack<float, Lanes> pow(const Pack<float, Lanes>& x, const Pack<float, Lanes>& y) noexcept;
+
+template<size_t Lanes>
+Pack<float, Lanes> pow(const Pack<float, Lanes>& x, std::type_identity_t<float> y) noexcept;
+
+// angle of (x, y) in [-pi, pi]:
+template<size_t Lanes>
+Pack<float, Lanes> atan2(const Pack<float, Lanes>& y, const Pack<float, Lanes>& x) noexcept;
+
+} // namespace ayan::math::simd
+
+#include "impl/transcendental.hpp"
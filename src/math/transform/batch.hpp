@@ -0,0 +1,64 @@
+#pragma once
+
+#include <concepts>
+#include <span>
+#include <type_traits>
+
+#include <ayan/math/vec.hpp>
+#include <ayan/math/mat.hpp>
+#include <ayan/sync.hpp>
+
+#include "transform.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// How the elements of a batch are multiplied by the Mat4:
+enum class TransformAs {
+  Point,  // w = 1, divided by the resulting w if the matrix is projective;
+  Vector, // w = 0, translation is ignored;
+  Normal  // w = 0 by the inverse-transpose, computed once per call;
+};
+
+// out[i] = in[i] transformed by `matrix`, 8 (float, AVX) or 4 elements per iteration.
+// `out` must hold at least in.size() elements and may be the same span as `in`.
+// With a cached Transform pass normal_matrix().to_mat4() as TransformAs::Vector to skip the inversion.
+
+// AoS:
+template<TransformAs As, typename NumT> requires (std::floating_point<NumT>)
+void transform_batch(const Mat4<NumT>& matrix,
+  std::type_identity_t<std::span<const Vec3<NumT>>> in,
+  std::type_identity_t<std::span<Vec3<NumT>>> out) noexcept;
+
+// AoS, the w of the input is replaced according to `As`, the resulting w is kept
+// (a projective matrix divides only x, y and z by it):
+template<TransformAs As, typename NumT> requires (std::floating_point<NumT>)
+void transform_batch(const Mat4<NumT>& matrix,
+  std::type_identity_t<std::span<const Vec4<NumT>>> in,
+  std::type_identity_t<std::span<Vec4<NumT>>> out) noexcept;
+
+// SoA:
+template<TransformAs As, size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+void transform_batch(const Mat4<NumT>& matrix,
+  std::type_identity_t<std::span<const Vec3x<Lanes, NumT>>> in,
+  std::type_identity_t<std::span<Vec3x<Lanes, NumT>>> out) noexcept;
+
+// The same, split across the workers of `pool` (the calling thread takes part
+// and may itself be a task of `pool`):
+template<TransformAs As, typename NumT> requires (std::floating_point<NumT>)
+void transform_batch(sync::ThreadPool& pool, const Mat4<NumT>& matrix,
+  std::type_identity_t<std::span<const Vec3<NumT>>> in,
+  std::type_identity_t<std::span<Vec3<NumT>>> out);
+
+template<TransformAs As, typename NumT> requires (std::floating_point<NumT>)
+void transform_batch(sync::ThreadPool& pool, const Mat4<NumT>& matrix,
+  std::type_identity_t<std::span<const Vec4<NumT>>> in,
+  std::type_identity_t<std::span<Vec4<NumT>>> out);
+
+template<TransformAs As, size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+void transform_batch(sync::ThreadPool& pool, const Mat4<NumT>& matrix,
+  std::type_identity_t<std::span<const Vec3x<Lanes, NumT>>> in,
+  std::type_identity_t<std::span<Vec3x<Lanes, NumT>>> out);
+
+} // namespace ayan::math
+
+#include "impl/batch.hpp"
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "../batch.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+// elements per task when a batch is split across threads:
+inline constexpr size_t kBatchGrain = size_t(1) << 14;
+
+// widest native pack for NumT:
+template<typename NumT>
+inline constexpr size_t batch_lanes = simd::IsNative<NumT, 8> ? 8 : 4;
+
+// Mat4 with every element broadcast over `Lanes` lanes, hoisted out of the loop:
+template<size_t Lanes, typename NumT>
+class BroadcastMat4 {
+public: // Types:
+  using pack_type = simd::Pack<NumT, Lanes>;
+  using packet_type = Vec3x<Lanes, NumT>;
+
+private: // Fields:
+  pack_type elems[4][4]; // [row][col]
+  pack_type zero_w[4];   // translation times a zero w, as Mat4 * Vec4 adds it
+
+public: // Member functions:
+  explicit BroadcastMat4(const Mat4<NumT>& matrix) noexcept {
+    for (size_t r = 0; r < 4; ++r) {
+      for (size_t c = 0; c < 4; ++c) {
+        elems[r][c] = pack_type(matrix(r, c));
+      }
+      zero_w[r] = pack_type(matrix(r, 3) * NumT(0));
+    }
+  }
+
+  // row `r` times (x, y, z, 1) for points or (x, y, z, 0) otherwise, in the
+  // order of Mat4 * Vec4 and without FMA (the same bits as transform_one):
+  template<bool IsPoint>
+  pack_type row(size_t r, const packet_type& v) const noexcept {
+    pack_type acc = elems[r][0] * v.x();
+    acc = acc + elems[r][1] * v.y();
+    acc = acc + elems[r][2] * v.z();
+    return acc + (IsPoint ? elems[r][3] : zero_w[r]);
+  }
+
+  template<bool IsPoint, bool Projective>
+  packet_type apply(const packet_type& v) const noexcept {
+    packet_type result(row<IsPoint>(0, v), row<IsPoint>(1, v), row<IsPoint>(2, v));
+    if constexpr (Projective) result /= row<IsPoint>(3, v);
+    return result;
+  }
+};
+
+template<bool IsPoint, bool Projective, typename NumT>
+Vec3<NumT> transform_one(const Mat4<NumT>& matrix, const Vec3<NumT>& v) noexcept {
+  const Vec4<NumT> r = matrix * Vec4<NumT>(v.x(), v.y(), v.z(), IsPoint ? NumT(1) : NumT(0));
+  if constexpr (Projective) return Vec3<NumT>(r.x(), r.y(), r.z()) / r.w();
+  return Vec3<NumT>(r.x(), r.y(), r.z());
+}
+
+template<bool IsPoint, bool Projective, typename NumT>
+void transform_range(const Mat4<NumT>& matrix, const Vec3<NumT>* in, Vec3<NumT>* out, size_t count) noexcept {
+  constexpr size_t lanes = batch_lanes<NumT>;
+  using packet_type = Vec3x<lanes, NumT>;
+  const BroadcastMat4<lanes, NumT> m(matrix);
+
+  size_t i = 0;
+  for (; i + lanes <= count; i += lanes) {
+    m.template apply<IsPoint, Projective>(packet_type::Load(in + i)).store(out + i);
+  }
+  for (; i < count; ++i) {
+    out[i] = transform_one<IsPoint, Projective>(matrix, in[i]);
+  }
+}
+
+template<bool IsPoint, bool Projective, typename NumT>
+void transform_range(const Mat4<NumT>& matrix, const Vec4<NumT>* in, Vec4<NumT>* out, size_t count) noexcept {
+  // one Vec4 already fills a native pack, the column-combination kernel of Mat4 does the rest:
+  for (size_t i = 0; i < count; ++i) {
+    const Vec4<NumT> r = matrix * Vec4<NumT>(in[i].x(), in[i].y(), in[i].z(), IsPoint ? NumT(1) : NumT(0));
+    if constexpr (Projective) {
+      out[i] = Vec4<NumT>(r.x() / r.w(), r.y() / r.w(), r.z() / r.w(), r.w());
+    } else {
+      out[i] = r;
+    }
+  }
+}
+
+template<bool IsPoint, bool Projective, size_t Lanes, typename NumT>
+void transform_range(const Mat4<NumT>& matrix, const Vec3x<Lanes, NumT>* in, Vec3x<Lanes, NumT>* out, size_t count) noexcept {
+  const BroadcastMat4<Lanes, NumT> m(matrix);
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = m.template apply<IsPoint, Projective>(in[i]);
+  }
+}
+
+// resolves `As` into the matrix actually applied and the kernel flavour,
+// then calls kernel.template operator()<IsPoint, Projective>(applied):
+template<TransformAs As, typename NumT, typename Kernel>
+void resolve_transform(const Mat4<NumT>& matrix, Kernel&& kernel) noexcept {
+  if constexpr (As == TransformAs::Normal) {
+    kernel.template operator()<false, false>(Transform<NumT>(matrix).normal_matrix().to_mat4());
+  } else if constexpr (As == TransformAs::Vector) {
+    kernel.template operator()<false, false>(matrix);
+  } else if (matrix.is_affine()) {
+    kernel.template operator()<true, false>(matrix);
+  } else {
+    kernel.template operator()<true, true>(matrix);
+  }
+}
+
+// runs the kernel over [0, count) or over its chunks on `pool`:
+template<TransformAs As, typename NumT, typename ElemT>
+void run_batch(sync::ThreadPool* pool, const Mat4<NumT>& matrix,
+  const ElemT* in, ElemT* out, size_t count)
+{
+  resolve_transform<As>(matrix, [&]<bool IsPoint, bool Projective>(const Mat4<NumT>& applied) {
+    if (pool == nullptr) {
+      transform_range<IsPoint, Projective>(applied, in, out, count);
+      return;
+    }
+    // the grain is counted in Vec3s, a SoA packet holds `Lanes` of them:
+    const size_t grain = std::max<size_t>(1, kBatchGrain * 3 * sizeof(NumT) / sizeof(ElemT));
+    pool->parallel_for(count, grain, [&](size_t begin, size_t end) {
+      transform_range<IsPoint, Projective>(applied, in + begin, out + begin, end - begin);
+    });
+  });
+}
+
+} // namespace detail
+
+template<TransformAs As, typename NumT> requires (std::floating_point<NumT>)
+void transform_batch(const Mat4<NumT>& matrix,
+  std::type_identity_t<std::span<const Vec3<NumT>>> in,
+  std::type_identity_t<std::span<Vec3<NumT>>> out) noexcept
+{
+  detail::run_batch<As>(nullptr, matrix, in.data(), out.data(), in.size());
+}
+
+template<TransformAs As, typename NumT> requires (std::floating_point<NumT>)
+void transform_batch(const Mat4<NumT>& matrix,
+  std::type_identity_t<std::span<const Vec4<NumT>>> in,
+  std::type_identity_t<std::span<Vec4<NumT>>> out) noexcept
+{
+  detail::run_batch<As>(nullptr, matrix, in.data(), out.data(), in.size());
+}
+
+template<TransformAs As, size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+void transform_batch(const Mat4<NumT>& matrix,
+  std::type_identity_t<std::span<const Vec3x<Lanes, NumT>>> in,
+  std::type_identity_t<std::span<Vec3x<Lanes, NumT>>> out) noexcept
+{
+  detail::run_batch<As>(nullptr, matrix, in.data(), out.data(), in.size());
+}
+
+template<TransformAs As, typename NumT> requires (std::floating_point<NumT>)
+void transform_batch(sync::ThreadPool& pool, const Mat4<NumT>& matrix,
+  std::type_identity_t<std::span<const Vec3<NumT>>> in,
+  std::type_identity_t<std::span<Vec3<NumT>>> out)
+{
+  detail::run_batch<As>(&pool, matrix, in.data(), out.data(), in.size());
+}
+
+template<TransformAs As, typename NumT> requires (std::floating_point<NumT>)
+void transform_batch(sync::ThreadPool& pool, const Mat4<NumT>& matrix,
+  std::type_identity_t<std::span<const Vec4<NumT>>> in,
+  std::type_identity_t<std::span<Vec4<NumT>>> out)
+{
+  detail::run_batch<As>(&pool, matrix, in.data(), out.data(), in.size());
+}
+
+template<TransformAs As, size_t Lanes, typename NumT> requires (std::floating_point<NumT>)
+void transform_batch(sync::ThreadPool& pool, const Mat4<NumT>& matrix,
+  std::type_identity_t<std::span<const Vec3x<Lanes, NumT>>> in,
+  std::type_identity_t<std::span<Vec3x<Lanes, NumT>>> out)
+{
+  detail::run_batch<As>(&pool, matrix, in.data(), out.data(), in.size());
+}
+
+} // namespace ayan::math
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+#include "../quat.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Quat<NumT>::Quat() noexcept : coeffs(Vec4<NumT>::UnitW()) {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Quat<NumT>::Quat(NumT x, NumT y, NumT z, NumT w) noexcept : coeffs(x, y, z, w) {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Quat<NumT>::Quat(const Vec4<NumT>& coeffs) noexcept : coeffs(coeffs) {}
+
+// ----- ----- ---- Static member funcs ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Quat<NumT> Quat<NumT>::Identity() noexcept {
+  return Quat();
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+Quat<NumT> Quat<NumT>::AxisAngle(const Vec3<NumT>& axis, NumT angle) noexcept {
+  const NumT half = angle * NumT(0.5);
+  const NumT s = std::sin(half);
+  return Quat(axis.x() * s, axis.y() * s, axis.z() * s, std::cos(half));
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+Quat<NumT> Quat<NumT>::FromMat3(const Mat3<NumT>& m) noexcept {
+  // the square root is taken of the largest of 4 * (w^2, x^2, y^2, z^2), the
+  // other components follow from sums and differences of off-diagonal elements:
+  const NumT trace = m(0, 0) + m(1, 1) + m(2, 2);
+  if (trace > NumT(0)) {
+    const NumT s = std::sqrt(trace + NumT(1)) * NumT(2);
+    return Quat((m(2, 1) - m(1, 2)) / s, (m(0, 2) - m(2, 0)) / s, (m(1, 0) - m(0, 1)) / s, s * NumT(0.25));
+  }
+  if (m(0, 0) > m(1, 1) && m(0, 0) > m(2, 2)) {
+    const NumT s = std::sqrt(NumT(1) + m(0, 0) - m(1, 1) - m(2, 2)) * NumT(2);
+    return Quat(s * NumT(0.25), (m(0, 1) + m(1, 0)) / s, (m(0, 2) + m(2, 0)) / s, (m(2, 1) - m(1, 2)) / s);
+  }
+  if (m(1, 1) > m(2, 2)) {
+    const NumT s = std::sqrt(NumT(1) + m(1, 1) - m(0, 0) - m(2, 2)) * NumT(2);
+    return Quat((m(0, 1) + m(1, 0)) / s, s * NumT(0.25), (m(1, 2) + m(2, 1)) / s, (m(0, 2) - m(2, 0)) / s);
+  }
+  const NumT s = std::sqrt(NumT(1) + m(2, 2) - m(0, 0) - m(1, 1)) * NumT(2);
+  return Quat((m(0, 2) + m(2, 0)) / s, (m(1, 2) + m(2, 1)) / s, s * NumT(0.25), (m(1, 0) - m(0, 1)) / s);
+}
+
+// ----- ----- ---- Element access ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT Quat<NumT>::x() const noexcept { return coeffs.x(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT Quat<NumT>::y() const noexcept { return coeffs.y(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT Quat<NumT>::z() const noexcept { return coeffs.z(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT Quat<NumT>::w() const noexcept { return coeffs.w(); }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Vec3<NumT> Quat<NumT>::xyz() const noexcept {
+  return Vec3<NumT>(coeffs.x(), coeffs.y(), coeffs.z());
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const Vec4<NumT>& Quat<NumT>::to_vec4() const noexcept { return coeffs; }
+
+// ----- ----- ---- Operators ----- ----- ----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Quat<NumT> Quat<NumT>::operator-() const noexcept {
+  return Quat(-coeffs);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Quat<NumT> Quat<NumT>::operator+(const Quat& oth) const noexcept {
+  return Quat(coeffs + oth.coeffs);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Quat<NumT> Quat<NumT>::operator-(const Quat& oth) const noexcept {
+  return Quat(coeffs - oth.coeffs);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Quat<NumT> Quat<NumT>::operator*(NumT scalar) const noexcept {
+  return Quat(coeffs * scalar);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Quat<NumT> Quat<NumT>::operator*(const Quat& oth) const noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return multiply_native(oth);
+  }
+
+  const Vec4<NumT>& a = coeffs;
+  const Vec4<NumT>& b = oth.coeffs;
+  return Quat(
+    b * a.w() +
+    Vec4<NumT>(b.w(), -b.z(), b.y(), -b.x()) * a.x() +
+    Vec4<NumT>(b.z(), b.w(), -b.x(), -b.y()) * a.y() +
+    Vec4<NumT>(-b.y(), b.x(), b.w(), -b.z()) * a.z()
+  );
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+Quat<NumT> Quat<NumT>::multiply_native(const Quat& oth) const noexcept {
+  using P = simd::Pack<NumT, 4>;
+  const P a = coeffs.to_pack();
+  const P b = oth.coeffs.to_pack();
+  // the signs of the permuted columns go into the broadcasts (exact, the
+  // products and sums round as in the constexpr path):
+  const P sign_x = Vec4<NumT>(NumT(1), NumT(-1), NumT(1), NumT(-1)).to_pack();
+  const P sign_y = Vec4<NumT>(NumT(1), NumT(1), NumT(-1), NumT(-1)).to_pack();
+  const P sign_z = Vec4<NumT>(NumT(-1), NumT(1), NumT(1), NumT(-1)).to_pack();
+
+  P result = b * simd::shuffle<3, 3, 3, 3>(a);
+  result = result + simd::shuffle<3, 2, 1, 0>(b) * (simd::shuffle<0, 0, 0, 0>(a) * sign_x);
+  result = result + simd::shuffle<2, 3, 0, 1>(b) * (simd::shuffle<1, 1, 1, 1>(a) * sign_y);
+  result = result + simd::shuffle<1, 0, 3, 2>(b) * (simd::shuffle<2, 2, 2, 2>(a) * sign_z);
+  return Quat(Vec4<NumT>::FromPack(result));
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+Vec3<NumT> Quat<NumT>::rotate_native(const Vec3<NumT>& vec) const noexcept {
+  using P = simd::Pack<NumT, 4>;
+  // a x b = (a * b.yzx - a.yzx * b).yzx, w stays 0 for a zero w in either input:
+  const auto cross = [](const P& a, const P& b) {
+    const P c = a * simd::shuffle<1, 2, 0, 3>(b) - simd::shuffle<1, 2, 0, 3>(a) * b;
+    return simd::shuffle<1, 2, 0, 3>(c);
+  };
+  const P q = coeffs.to_pack();
+  // from broadcasts: a Vec4 built of scalars is stored and reloaded (a stalled store forward):
+  const P v = P(vec.x()) * Vec4<NumT>::UnitX().to_pack() + P(vec.y()) * Vec4<NumT>::UnitY().to_pack() +
+    P(vec.z()) * Vec4<NumT>::UnitZ().to_pack();
+  const P t = cross(q, v) * NumT(2);
+  const P result = (v + t * simd::shuffle<3, 3, 3, 3>(q)) + cross(q, t);
+
+  alignas(sizeof(NumT) * 4) NumT out[4];
+  result.store(out);
+  return Vec3<NumT>(out[0], out[1], out[2]);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Quat<NumT>& Quat<NumT>::operator*=(const Quat& oth) noexcept {
+  *this = *this * oth;
+  return *this;
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr bool Quat<NumT>::operator==(const Quat& oth) const noexcept {
+  return coeffs == oth.coeffs;
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr bool Quat<NumT>::operator!=(const Quat& oth) const noexcept {
+  return !(*this == oth);
+}
+
+// ----- ----- ---- Operations ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT Quat<NumT>::dot(const Quat& oth) const noexcept {
+  return coeffs.dot(oth.coeffs);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr NumT Quat<NumT>::length_squared() const noexcept {
+  return coeffs.dot(coeffs);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+NumT Quat<NumT>::length() const noexcept {
+  return std::sqrt(length_squared());
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+Quat<NumT> Quat<NumT>::normalize() const noexcept {
+  return Quat(coeffs.normalize());
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Quat<NumT> Quat<NumT>::conjugate() const noexcept {
+  return Quat(-coeffs.x(), -coeffs.y(), -coeffs.z(), coeffs.w());
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Quat<NumT> Quat<NumT>::inverse() const noexcept {
+  return conjugate() * (NumT(1) / length_squared());
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Vec3<NumT> Quat<NumT>::rotate(const Vec3<NumT>& vec) const noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return rotate_native(vec);
+  }
+
+  const Vec3<NumT> u = xyz();
+  const Vec3<NumT> t = u.cross(vec) * NumT(2);
+  return vec + t * coeffs.w() + u.cross(t);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Mat3<NumT> Quat<NumT>::to_mat3() const noexcept {
+  const NumT x = coeffs.x(), y = coeffs.y(), z = coeffs.z(), w = coeffs.w();
+  const NumT x2 = x + x, y2 = y + y, z2 = z + z;
+  const NumT xx = x * x2, yy = y * y2, zz = z * z2;
+  const NumT xy = x * y2, xz = x * z2, yz = y * z2;
+  const NumT wx = w * x2, wy = w * y2, wz = w * z2;
+
+  return Mat3<NumT>(
+    Vec3<NumT>(NumT(1) - yy - zz, xy + wz, xz - wy),
+    Vec3<NumT>(xy - wz, NumT(1) - xx - zz, yz + wx),
+    Vec3<NumT>(xz + wy, yz - wx, NumT(1) - xx - yy)
+  );
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Mat4<NumT> Quat<NumT>::to_mat4() const noexcept {
+  return to_mat3().to_mat4();
+}
+
+// ----- ----- ---- Interpolation ----- ----- ----
+template<typename NumT>
+Quat<NumT> nlerp(const Quat<NumT>& a, const Quat<NumT>& b, NumT t) noexcept {
+  const NumT wb = a.dot(b) < NumT(0) ? -t : t;
+  return (a * (NumT(1) - t) + b * wb).normalize();
+}
+
+template<typename NumT>
+Quat<NumT> slerp(const Quat<NumT>& a, const Quat<NumT>& b, NumT t) noexcept {
+  NumT cos_theta = a.dot(b);
+  const NumT sign = cos_theta < NumT(0) ? NumT(-1) : NumT(1);
+  cos_theta *= sign;
+
+  // sin(theta) loses all precision near 0, where the arc is a straight line anyway:
+  if (cos_theta > NumT(0.9995)) return nlerp(a, b, t);
+
+  const NumT theta = std::acos(cos_theta);
+  const NumT inv_sin = NumT(1) / std::sin(theta);
+  const NumT wa = std::sin((NumT(1) - t) * theta) * inv_sin;
+  const NumT wb = std::sin(t * theta) * inv_sin * sign;
+  return a * wa + b * wb;
+}
+
+} // namespace ayan::math
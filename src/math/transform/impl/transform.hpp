@@ -0,0 +1,83 @@
+#pragma once
+
+#include "../transform.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Transform<NumT>::Transform() noexcept : mat(), inv_mat(), normal_mat() {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Transform<NumT>::Transform(const Mat4<NumT>& matrix) noexcept
+  : Transform(matrix, matrix.is_affine() ? matrix.affine_inverse() : matrix.inverse()) {}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Transform<NumT>::Transform(const Mat4<NumT>& matrix, const Mat4<NumT>& inverse) noexcept
+  : mat(matrix), inv_mat(inverse), normal_mat(NormalMatrix(inverse)) {}
+
+// ----- ----- ---- Static member funcs ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Transform<NumT> Transform<NumT>::Identity() noexcept {
+  return Transform();
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Mat3<NumT> Transform<NumT>::NormalMatrix(const Mat4<NumT>& inverse) noexcept {
+  return Mat3<NumT>(inverse).transpose();
+}
+
+// ----- ----- ---- Element access ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const Mat4<NumT>& Transform<NumT>::matrix() const noexcept { return mat; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const Mat4<NumT>& Transform<NumT>::inverse() const noexcept { return inv_mat; }
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr const Mat3<NumT>& Transform<NumT>::normal_matrix() const noexcept { return normal_mat; }
+
+// ----- ----- ---- Operations ---- ----- -----
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Transform<NumT> Transform<NumT>::inverted() const noexcept {
+  return Transform(inv_mat, mat);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Vec3<NumT> Transform<NumT>::transform_point(const Vec3<NumT>& point) const noexcept {
+  const Vec4<NumT> p = mat * Vec4<NumT>(point.x(), point.y(), point.z(), NumT(1));
+  if (p.w() == NumT(1)) return Vec3<NumT>(p.x(), p.y(), p.z());
+  return Vec3<NumT>(p.x(), p.y(), p.z()) / p.w();
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Vec3<NumT> Transform<NumT>::transform_vector(const Vec3<NumT>& vec) const noexcept {
+  const Vec4<NumT> v = mat * Vec4<NumT>(vec.x(), vec.y(), vec.z(), NumT(0));
+  return Vec3<NumT>(v.x(), v.y(), v.z());
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Vec3<NumT> Transform<NumT>::transform_normal(const Vec3<NumT>& normal) const noexcept {
+  return normal_mat * normal;
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Vec3<NumT> Transform<NumT>::inverse_point(const Vec3<NumT>& point) const noexcept {
+  const Vec4<NumT> p = inv_mat * Vec4<NumT>(point.x(), point.y(), point.z(), NumT(1));
+  if (p.w() == NumT(1)) return Vec3<NumT>(p.x(), p.y(), p.z());
+  return Vec3<NumT>(p.x(), p.y(), p.z()) / p.w();
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Vec3<NumT> Transform<NumT>::inverse_vector(const Vec3<NumT>& vec) const noexcept {
+  const Vec4<NumT> v = inv_mat * Vec4<NumT>(vec.x(), vec.y(), vec.z(), NumT(0));
+  return Vec3<NumT>(v.x(), v.y(), v.z());
+}
+
+// ----- ----- ---- External Operators ---- ----- ----
+template<typename NumT>
+constexpr Transform<NumT> operator*(const Transform<NumT>& a, const Transform<NumT>& b) noexcept {
+  return Transform<NumT>(a.matrix() * b.matrix(), b.inverse() * a.inverse());
+}
+
+} // namespace ayan::math
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../trs.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr TRS<NumT> TRS<NumT>::Identity() noexcept {
+  return TRS();
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Vec3<NumT> TRS<NumT>::transform_point(const Vec3<NumT>& point) const noexcept {
+  return translation + rotation.rotate(scale * point);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Vec3<NumT> TRS<NumT>::transform_vector(const Vec3<NumT>& vec) const noexcept {
+  return rotation.rotate(scale * vec);
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr TRS<NumT> TRS<NumT>::inverse() const noexcept {
+  const Quat<NumT> inv_rotation = rotation.conjugate();
+  const Vec3<NumT> inv_scale = Vec3<NumT>::One() / scale;
+  return TRS{ -(inv_scale * inv_rotation.rotate(translation)), inv_rotation, inv_scale };
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Mat4<NumT> TRS<NumT>::to_mat4() const noexcept {
+  const Mat3<NumT> r = rotation.to_mat3();
+  return Mat4<NumT>(
+    detail::pad_column(r.template col<0>() * scale.x()),
+    detail::pad_column(r.template col<1>() * scale.y()),
+    detail::pad_column(r.template col<2>() * scale.z()),
+    Vec4<NumT>(translation.x(), translation.y(), translation.z(), NumT(1))
+  );
+}
+
+template<typename NumT> requires (std::floating_point<NumT>)
+constexpr Mat3x4<NumT> TRS<NumT>::to_affine() const noexcept {
+  const Mat3<NumT> r = rotation.to_mat3();
+  const auto row = [&](size_t i) {
+    return Vec4<NumT>(r(i, 0) * scale.x(), r(i, 1) * scale.y(), r(i, 2) * scale.z(), translation[i]);
+  };
+  return Mat3x4<NumT>(row(0), row(1), row(2));
+}
+
+// ----- ----- ---- External Operators ---- ----- ----
+template<typename NumT>
+constexpr TRS<NumT> operator*(const TRS<NumT>& parent, const TRS<NumT>& child) noexcept {
+  return TRS<NumT>{
+    parent.transform_point(child.translation),
+    parent.rotation * child.rotation,
+    parent.scale * child.scale
+  };
+}
+
+template<typename NumT>
+TRS<NumT> lerp(const TRS<NumT>& a, const TRS<NumT>& b, std::type_identity_t<NumT> t) noexcept {
+  return TRS<NumT>{
+    a.translation + (b.translation - a.translation) * t,
+    nlerp(a.rotation, b.rotation, t),
+    a.scale + (b.scale - a.scale) * t
+  };
+}
+
+// ----- ----- ---- Hierarchy update ----- ----- ----
+template<typename NumT> requires (std::floating_point<NumT>)
+void propagate_hierarchy(
+  std::type_identity_t<std::span<const TRS<NumT>>> local,
+  std::span<const uint32_t> parents,
+  std::type_identity_t<std::span<TRS<NumT>>> world) noexcept
+{
+  for (size_t i = 0; i < local.size(); ++i) {
+    const uint32_t parent = parents[i];
+    if (parent == kNoParent) {
+      world[i] = local[i];
+    } else {
+      world[i] = world[parent] * local[i];
+    }
+  }
+}
+
+} // namespace ayan::math
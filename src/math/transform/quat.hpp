@@ -0,0 +1,93 @@
+#pragma once
+
+#include <concepts>
+
+#include <ayan/math/vec.hpp>
+#include <ayan/math/mat.hpp>
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// Rotation quaternion x*i + y*j + z*k + w in one Vec4 (the vector part in
+// x, y, z and the scalar part in w), so products and blends are Vec4 (packed)
+// arithmetic. Rotations expect unit quaternions, nothing is renormalized
+// implicitly:
+template<typename NumT> requires (std::floating_point<NumT>)
+class Quat {
+private: // Fields:
+  Vec4<NumT> coeffs;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  // identity rotation:
+  constexpr Quat() noexcept;
+  constexpr Quat(NumT x, NumT y, NumT z, NumT w) noexcept;
+  explicit constexpr Quat(const Vec4<NumT>& coeffs) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  static constexpr Quat Identity() noexcept;
+  // rotation by `angle` radians about the unit vector `axis`:
+  static Quat AxisAngle(const Vec3<NumT>& axis, NumT angle) noexcept;
+  // the rotation part of `mat` (must be orthonormal), Shepperd's method:
+  static Quat FromMat3(const Mat3<NumT>& mat) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  constexpr NumT x() const noexcept;
+  constexpr NumT y() const noexcept;
+  constexpr NumT z() const noexcept;
+  constexpr NumT w() const noexcept;
+  // the vector part:
+  constexpr Vec3<NumT> xyz() const noexcept;
+  constexpr const Vec4<NumT>& to_vec4() const noexcept;
+
+  // ----- ----- ---- Operators ----- ----- ----
+  constexpr Quat operator-() const noexcept;
+  constexpr Quat operator+(const Quat& oth) const noexcept;
+  constexpr Quat operator-(const Quat& oth) const noexcept;
+  constexpr Quat operator*(NumT scalar) const noexcept;
+  // Hamilton product, *this applied after oth. As a column combination: oth
+  // permuted with signs, weighted by the components of *this (4 broadcasts, no FMA):
+  constexpr Quat operator*(const Quat& oth) const noexcept;
+  constexpr Quat& operator*=(const Quat& oth) noexcept;
+  constexpr bool operator==(const Quat& oth) const noexcept;
+  constexpr bool operator!=(const Quat& oth) const noexcept;
+
+  // ----- ----- ---- Operations ---- ----- -----
+  constexpr NumT dot(const Quat& oth) const noexcept;
+  constexpr NumT length_squared() const noexcept;
+  NumT length() const noexcept;
+  Quat normalize() const noexcept;
+  constexpr Quat conjugate() const noexcept;
+  // conjugate() over length_squared(), equal to conjugate() for unit quaternions:
+  constexpr Quat inverse() const noexcept;
+
+  // q * (vec, 0) * q^-1 in 2 cross products (t = 2 q.xyz x vec, vec + w t + q.xyz x t):
+  constexpr Vec3<NumT> rotate(const Vec3<NumT>& vec) const noexcept;
+
+  constexpr Mat3<NumT> to_mat3() const noexcept;
+  constexpr Mat4<NumT> to_mat4() const noexcept;
+
+private:
+  // register kernels behind the constexpr product and rotation (native packs only):
+  Quat multiply_native(const Quat& oth) const noexcept;
+  Vec3<NumT> rotate_native(const Vec3<NumT>& vec) const noexcept;
+};
+
+// ----- ----- ---- Interpolation ----- ----- ----
+// Both take the shorter arc (b is negated if a.dot(b) < 0) and return unit
+// quaternions for unit inputs.
+
+// normalized linear blend: constant cost, the angular speed is uneven for wide
+// arcs; exact at t = 0 and 1:
+template<typename NumT>
+Quat<NumT> nlerp(const Quat<NumT>& a, const Quat<NumT>& b, NumT t) noexcept;
+
+// constant angular speed; falls back to nlerp() for nearly parallel inputs:
+template<typename NumT>
+Quat<NumT> slerp(const Quat<NumT>& a, const Quat<NumT>& b, NumT t) noexcept;
+
+using Quatf = Quat<float>;
+using Quatd = Quat<double>;
+
+} // namespace ayan::math
+
+#include "impl/quat.hpp"
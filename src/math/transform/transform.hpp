@@ -0,0 +1,64 @@
+#pragma once
+
+#include <concepts>
+
+#include <ayan/math/vec.hpp>
+#include <ayan/math/mat.hpp>
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// Mat4 together with its inverse and its normal matrix. They are computed
+// once (per instance) instead of on every ray sent into object space:
+template<typename NumT> requires (std::floating_point<NumT>)
+class Transform {
+private: // Fields:
+  Mat4<NumT> mat;
+  Mat4<NumT> inv_mat;
+  // inverse-transpose of the upper 3x3 part, no translation:
+  Mat3<NumT> normal_mat;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  constexpr Transform() noexcept;
+  // takes the affine fast path if matrix.is_affine():
+  constexpr explicit Transform(const Mat4<NumT>& matrix) noexcept;
+  // `inverse` must be the inverse of `matrix`, nothing is inverted here:
+  constexpr Transform(const Mat4<NumT>& matrix, const Mat4<NumT>& inverse) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  static constexpr Transform Identity() noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  constexpr const Mat4<NumT>& matrix() const noexcept;
+  constexpr const Mat4<NumT>& inverse() const noexcept;
+  constexpr const Mat3<NumT>& normal_matrix() const noexcept;
+
+  // ----- ----- ---- Operations ---- ----- -----
+  // swaps the matrix and its inverse (no inversion):
+  constexpr Transform inverted() const noexcept;
+
+  // points are divided by w if the matrix is projective:
+  constexpr Vec3<NumT> transform_point(const Vec3<NumT>& point) const noexcept;
+  constexpr Vec3<NumT> transform_vector(const Vec3<NumT>& vec) const noexcept;
+  // the result is not normalized, scaling changes normal lengths:
+  constexpr Vec3<NumT> transform_normal(const Vec3<NumT>& normal) const noexcept;
+
+  // world -> object space:
+  constexpr Vec3<NumT> inverse_point(const Vec3<NumT>& point) const noexcept;
+  constexpr Vec3<NumT> inverse_vector(const Vec3<NumT>& vec) const noexcept;
+
+private:
+  static constexpr Mat3<NumT> NormalMatrix(const Mat4<NumT>& inverse) noexcept;
+};
+
+// ----- ----- ---- External Operators ---- ----- ----
+// `a` applied after `b`, all three matrices are composed without inversion:
+template<typename NumT>
+constexpr Transform<NumT> operator*(const Transform<NumT>& a, const Transform<NumT>& b) noexcept;
+
+using Transformf = Transform<float>;
+using Transformd = Transform<double>;
+
+} // namespace ayan::math
+
+#include "impl/transform.hpp"
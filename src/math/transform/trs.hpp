@@ -0,0 +1,68 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include <ayan/math/vec.hpp>
+#include <ayan/math/mat.hpp>
+
+#include "quat.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// Local transform of a scene node, applied as translation * rotation * scale.
+// Composition and interpolation stay in this form (a quaternion product and a
+// few Vec3 operations instead of a Mat4 product and a decomposition), Mat4 and
+// Mat3x4 are built in one pass from the rotation matrix when they are needed.
+// The form is closed only under uniform scales: a non-uniform parent scale under
+// a rotated child is a shear, composition keeps the per-axis product of scales:
+template<typename NumT> requires (std::floating_point<NumT>)
+struct TRS {
+  Vec3<NumT> translation = Vec3<NumT>::Zero();
+  Quat<NumT> rotation = Quat<NumT>::Identity();
+  Vec3<NumT> scale = Vec3<NumT>::One();
+
+  static constexpr TRS Identity() noexcept;
+
+  constexpr Vec3<NumT> transform_point(const Vec3<NumT>& point) const noexcept;
+  // translation is ignored:
+  constexpr Vec3<NumT> transform_vector(const Vec3<NumT>& vec) const noexcept;
+
+  // the exact inverse for uniform scales:
+  constexpr TRS inverse() const noexcept;
+
+  // columns of the rotation matrix times scale, then translation:
+  constexpr Mat4<NumT> to_mat4() const noexcept;
+  constexpr Mat3x4<NumT> to_affine() const noexcept;
+};
+
+// `parent` applied after `child`: the world transform of a child node:
+template<typename NumT>
+constexpr TRS<NumT> operator*(const TRS<NumT>& parent, const TRS<NumT>& child) noexcept;
+
+// translation and scale are blended linearly, rotation by nlerp():
+template<typename NumT>
+TRS<NumT> lerp(const TRS<NumT>& a, const TRS<NumT>& b, std::type_identity_t<NumT> t) noexcept;
+
+// ----- ----- ---- Hierarchy update ----- ----- ----
+// parents[i] of a root node:
+inline constexpr uint32_t kNoParent = std::numeric_limits<uint32_t>::max();
+
+// world[i] = world[parents[i]] * local[i] (local[i] for roots) in one forward
+// pass, so every parent must come before its children (parents[i] < i). The
+// spans have the same size, `world` may be the same span as `local`:
+template<typename NumT> requires (std::floating_point<NumT>)
+void propagate_hierarchy(
+  std::type_identity_t<std::span<const TRS<NumT>>> local,
+  std::span<const uint32_t> parents,
+  std::type_identity_t<std::span<TRS<NumT>>> world) noexcept;
+
+using TRSf = TRS<float>;
+using TRSd = TRS<double>;
+
+} // namespace ayan::math
+
+#include "impl/trs.hpp"
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+
+#include "fwd.hpp"
+#include "precision.hpp"
+#include "vec2.hpp"
+#include "vec3.hpp"
+#include "vec4.hpp"
+
+// Opt-in expression templates for Vec arithmetic. Wrapping an operand in
+// lazy() makes the operators build a tree instead of a temporary per step;
+// the whole expression is then evaluated in one pass per component:
+//
+//   Vec3f r = lazy(a) + lazy(b) * s - lazy(c) * t;  // same bits as a + b * s - c * t
+//   Vec3f f = eval<Precision::Fast>(lazy(a) + lazy(b) * s - lazy(c) * t);
+//
+// (`lazy(a) + b * s` works too, but b * s is then a plain Vec temporary.)
+//
+// Exact evaluation (the default and the implicit conversion) performs the
+// same operations in the same order as the plain operators, so the results are
+// bit-identical. Fast/FastRefined fuse x * y + z and x * y - z into one FMA where
+// the target has it (AYAN_SIMD_FMA). Nodes keep pointers to the wrapped vectors:
+// evaluate the expression before they go out of scope (don't store it in `auto`).
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::expr {
+
+// CRTP base of every node: `Derived::component<P>(i)` computes component `i`:
+template<typename Derived, size_t Len, typename NumT>
+class Expression {
+public: // Types:
+  using value_type = NumT;
+  static constexpr size_t size = Len;
+
+public: // Member functions:
+  template<Precision P = Precision::Exact>
+  AYAN_SIMD_INLINE constexpr NumT at(size_t index) const noexcept;
+
+  template<Precision P = Precision::Exact>
+  AYAN_SIMD_INLINE constexpr Vec<Len, NumT> eval() const noexcept;
+
+  AYAN_SIMD_INLINE constexpr operator Vec<Len, NumT>() const noexcept;
+};
+
+namespace detail {
+
+template<typename T>
+inline constexpr bool is_vec = false;
+
+template<size_t Len, typename NumT>
+inline constexpr bool is_vec<Vec<Len, NumT>> = true;
+
+template<typename T>
+concept IsExpression = requires { T::size; typename T::value_type; } &&
+  std::derived_from<T, Expression<T, T::size, typename T::value_type>>;
+
+} // namespace detail
+
+template<typename T>
+concept AnyExpression = detail::IsExpression<std::remove_cvref_t<T>>;
+
+template<typename T>
+concept AnyVec = detail::is_vec<std::remove_cvref_t<T>>;
+
+// ----- ----- ---- Nodes ----- ----- ----
+// leaf, a wrapped vector:
+template<size_t Len, typename NumT>
+class Ref : public Expression<Ref<Len, NumT>, Len, NumT> {
+private: // Fields:
+  const Vec<Len, NumT>* source;
+
+public: // Member functions:
+  explicit constexpr Ref(const Vec<Len, NumT>& vec) noexcept;
+
+  template<Precision P>
+  AYAN_SIMD_INLINE constexpr NumT component(size_t index) const noexcept;
+};
+
+// leaf, one scalar for every component (right side of *, / or left side of *):
+template<typename NumT>
+class Scalar {
+private: // Fields:
+  NumT value;
+
+public: // Member functions:
+  explicit constexpr Scalar(NumT value) noexcept;
+
+  template<Precision P>
+  AYAN_SIMD_INLINE constexpr NumT at(size_t index) const noexcept;
+};
+
+struct Add {};
+struct Sub {};
+struct Mul {};
+struct Div {};
+
+template<typename Op, typename Lhs, typename Rhs, size_t Len, typename NumT>
+class Binary : public Expression<Binary<Op, Lhs, Rhs, Len, NumT>, Len, NumT> {
+public: // Fields (read by the parent node when it fuses a product into an FMA):
+  Lhs lhs;
+  Rhs rhs;
+
+public: // Member functions:
+  constexpr Binary(const Lhs& lhs, const Rhs& rhs) noexcept;
+
+  template<Precision P>
+  AYAN_SIMD_INLINE constexpr NumT component(size_t index) const noexcept;
+};
+
+template<typename Arg, size_t Len, typename NumT>
+class Negate : public Expression<Negate<Arg, Len, NumT>, Len, NumT> {
+private: // Fields:
+  Arg arg;
+
+public: // Member functions:
+  explicit constexpr Negate(const Arg& arg) noexcept;
+
+  template<Precision P>
+  AYAN_SIMD_INLINE constexpr NumT component(size_t index) const noexcept;
+};
+
+// ----- ----- ---- Entry points ----- ----- ----
+template<size_t Len, typename NumT>
+AYAN_SIMD_INLINE constexpr Ref<Len, NumT> lazy(const Vec<Len, NumT>& vec) noexcept;
+
+// e.eval<P>() without `template` in dependent contexts:
+template<Precision P = Precision::Exact, AnyExpression E>
+AYAN_SIMD_INLINE constexpr auto eval(const E& e) noexcept;
+
+// ----- ----- ---- Operators ----- ----- ----
+// At least one operand is an expression, the other one may be a plain Vec
+// of the same size and type:
+template<typename A, typename B>
+concept Operands = (AnyExpression<A> && (AnyExpression<B> || AnyVec<B>)) || (AnyVec<A> && AnyExpression<B>);
+
+template<typename A, typename B> requires (Operands<A, B>)
+AYAN_SIMD_INLINE constexpr auto operator+(const A& a, const B& b) noexcept;
+
+template<typename A, typename B> requires (Operands<A, B>)
+AYAN_SIMD_INLINE constexpr auto operator-(const A& a, const B& b) noexcept;
+
+// per component:
+template<typename A, typename B> requires (Operands<A, B>)
+AYAN_SIMD_INLINE constexpr auto operator*(const A& a, const B& b) noexcept;
+
+template<typename A, typename B> requires (Operands<A, B>)
+AYAN_SIMD_INLINE constexpr auto operator/(const A& a, const B& b) noexcept;
+
+template<AnyExpression E>
+AYAN_SIMD_INLINE constexpr auto operator*(const E& e, std::type_identity_t<typename E::value_type> scalar) noexcept;
+
+template<AnyExpression E>
+AYAN_SIMD_INLINE constexpr auto operator*(std::type_identity_t<typename E::value_type> scalar, const E& e) noexcept;
+
+template<AnyExpression E>
+AYAN_SIMD_INLINE constexpr auto operator/(const E& e, std::type_identity_t<typename E::value_type> scalar) noexcept;
+
+template<AnyExpression E>
+AYAN_SIMD_INLINE constexpr auto operator-(const E& e) noexcept;
+
+} // namespace ayan::math::expr
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+using expr::lazy;
+using expr::eval;
+
+} // namespace ayan::math
+
+#include "impl/expr.hpp"
@@ -1,18 +1,35 @@
 #pragma once
 
 #include <cstddef>
-#include <array>
+#include <concepts>
+#include <utility>
 
 #include "../detail/validate.hpp"
 
-namespace ayan::math {
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
 
 template<size_t Len, typename NumT = double>
 class Vec;
 
-// Temporary solution:
+namespace detail {
+
+// 4 floats/doubles fill exactly one SSE/AVX register, so such vectors are
+// aligned to the register width and can be loaded by a single instruction:
+template<typename T, size_t Size>
+inline constexpr size_t vec_alignment = (Size == 4 && std::floating_point<T>) ? sizeof(T) * 4 : alignof(T);
+
+} // namespace detail
+
+// Component storage of Vec:
 template<typename T, size_t Size>
-using CacheFriendlyArr = std::array<T, Size>;
+struct alignas(detail::vec_alignment<T, Size>) CacheFriendlyArr {
+  T elems[Size];
+
+  constexpr T& operator[](size_t index) noexcept { return elems[index]; }
+  constexpr const T& operator[](size_t index) const noexcept { return elems[index]; }
+  constexpr T* data() noexcept { return elems; }
+  constexpr const T* data() const noexcept { return elems; }
+};
 
 // 2-dimensional vector:
 template<typename NumT> requires (detail::ValidNumType<NumT>)
@@ -38,4 +55,18 @@ using Vec4f = Vec4<float>;
 using Vec4d = Vec4<double>;
 using Vec4i = Vec4<int>;
 
+// Packet of `Lanes` 3-dimensional vectors stored as x[], y[], z[] lanes (SoA):
+template<size_t Lanes, typename NumT = float> requires (detail::ValidNumType<NumT>)
+class Vec3x;
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+using Vec3x4 = Vec3x<4, NumT>;
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+using Vec3x8 = Vec3x<8, NumT>;
+
+using Vec3x4f = Vec3x4<float>;
+using Vec3x4d = Vec3x4<double>;
+using Vec3x8f = Vec3x8<float>;
+
 } // namespace ayan::math
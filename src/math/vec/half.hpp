@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "vec3.hpp"
+#include "vec4.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// IEEE 754 binary16, a storage format only: it is converted to float for any math.
+// 11 significant bits (relative error <= 2^-11), normal range 2^-14 ... 65504,
+// float -> half rounds to nearest even, overflows to inf and keeps NaNs quiet:
+class Half {
+private: // Fields:
+  uint16_t half_bits = 0;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  constexpr Half() noexcept = default;
+  explicit constexpr Half(float value) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  static constexpr Half FromBits(uint16_t bits) noexcept;
+
+  // ----- ----- ---- Conversions ---- ----- -----
+  constexpr uint16_t bits() const noexcept;
+  constexpr float to_float() const noexcept;
+  explicit constexpr operator float() const noexcept;
+};
+
+// Vec3f in 6 bytes (half of the memory), for positions of bounded meshes,
+// texture coordinates, colors:
+class HalfVec3 {
+private: // Fields:
+  Half comps[3];
+
+public: // Member functions:
+  constexpr HalfVec3() noexcept = default;
+  constexpr HalfVec3(Half x, Half y, Half z) noexcept;
+  explicit constexpr HalfVec3(const Vec3f& vec) noexcept;
+
+  constexpr Half x() const noexcept;
+  constexpr Half y() const noexcept;
+  constexpr Half z() const noexcept;
+
+  constexpr Vec3f decode() const noexcept;
+};
+
+// Vec4f in 8 bytes:
+class HalfVec4 {
+private: // Fields:
+  Half comps[4];
+
+public: // Member functions:
+  constexpr HalfVec4() noexcept = default;
+  constexpr HalfVec4(Half x, Half y, Half z, Half w) noexcept;
+  explicit constexpr HalfVec4(const Vec4f& vec) noexcept;
+
+  constexpr Half x() const noexcept;
+  constexpr Half y() const noexcept;
+  constexpr Half z() const noexcept;
+  constexpr Half w() const noexcept;
+
+  constexpr Vec4f decode() const noexcept;
+};
+
+// ----- ----- ---- Batch conversion ----- ----- ----
+// out[i] = in[i] converted, `out` must hold at least in.size() elements
+// (std::invalid_argument is thrown otherwise, nothing is written then).
+// 8 values per instruction with F16C (which returns signaling NaNs quiet),
+// 4 with the SSE2 bit manipulation otherwise:
+inline void encode(std::span<const Vec3f> in, std::span<HalfVec3> out);
+inline void encode(std::span<const Vec4f> in, std::span<HalfVec4> out);
+inline void decode(std::span<const HalfVec3> in, std::span<Vec3f> out);
+inline void decode(std::span<const HalfVec4> in, std::span<Vec4f> out);
+
+} // namespace ayan::math
+
+#include "impl/half.hpp"
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <utility>
+
+#include "../expr.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE::expr {
+
+namespace detail {
+
+#if defined(AYAN_SIMD_FMA)
+inline constexpr bool has_fma = true;
+#else
+inline constexpr bool has_fma = false;
+#endif
+
+// x * y + z is evaluated as one FMA:
+template<Precision P, typename NumT>
+inline constexpr bool fuses = has_fma && (P != Precision::Exact) && std::floating_point<NumT>;
+
+template<typename T>
+inline constexpr bool is_product = false;
+
+template<typename Lhs, typename Rhs, size_t Len, typename NumT>
+inline constexpr bool is_product<Binary<Mul, Lhs, Rhs, Len, NumT>> = true;
+
+template<typename T>
+AYAN_SIMD_INLINE constexpr auto as_node(const T& operand) noexcept {
+  if constexpr (AnyVec<T>) {
+    return lazy(operand);
+  } else {
+    return operand;
+  }
+}
+
+template<typename Op, typename Lhs, typename Rhs>
+AYAN_SIMD_INLINE constexpr auto make_binary(const Lhs& lhs, const Rhs& rhs) noexcept {
+  static_assert(Lhs::size == Rhs::size, "Vec expression: operands of different sizes");
+  static_assert(std::is_same_v<typename Lhs::value_type, typename Rhs::value_type>,
+    "Vec expression: operands of different types");
+  return Binary<Op, Lhs, Rhs, Lhs::size, typename Lhs::value_type>(lhs, rhs);
+}
+
+} // namespace detail
+
+// ----- ----- ---- Expression ----- ----- ----
+template<typename Derived, size_t Len, typename NumT>
+template<Precision P>
+AYAN_SIMD_INLINE constexpr NumT Expression<Derived, Len, NumT>::at(size_t index) const noexcept {
+  return static_cast<const Derived&>(*this).template component<P>(index);
+}
+
+template<typename Derived, size_t Len, typename NumT>
+template<Precision P>
+AYAN_SIMD_INLINE constexpr Vec<Len, NumT> Expression<Derived, Len, NumT>::eval() const noexcept {
+  // unrolled, every component is a separate straight-line expression:
+  Vec<Len, NumT> result;
+  [&]<size_t... Index>(std::index_sequence<Index...>) {
+    ((result[Index] = at<P>(Index)), ...);
+  }(std::make_index_sequence<Len>{});
+  return result;
+}
+
+template<typename Derived, size_t Len, typename NumT>
+AYAN_SIMD_INLINE constexpr Expression<Derived, Len, NumT>::operator Vec<Len, NumT>() const noexcept {
+  return eval();
+}
+
+// ----- ----- ---- Nodes ----- ----- ----
+template<size_t Len, typename NumT>
+constexpr Ref<Len, NumT>::Ref(const Vec<Len, NumT>& vec) noexcept : source(&vec) {}
+
+template<size_t Len, typename NumT>
+template<Precision P>
+AYAN_SIMD_INLINE constexpr NumT Ref<Len, NumT>::component(size_t index) const noexcept {
+  return (*source)[index];
+}
+
+template<typename NumT>
+constexpr Scalar<NumT>::Scalar(NumT value) noexcept : value(value) {}
+
+template<typename NumT>
+template<Precision P>
+AYAN_SIMD_INLINE constexpr NumT Scalar<NumT>::at(size_t) const noexcept {
+  return value;
+}
+
+template<typename Op, typename Lhs, typename Rhs, size_t Len, typename NumT>
+constexpr Binary<Op, Lhs, Rhs, Len, NumT>::Binary(const Lhs& lhs, const Rhs& rhs) noexcept : lhs(lhs), rhs(rhs) {}
+
+template<typename Op, typename Lhs, typename Rhs, size_t Len, typename NumT>
+template<Precision P>
+AYAN_SIMD_INLINE constexpr NumT Binary<Op, Lhs, Rhs, Len, NumT>::component(size_t index) const noexcept {
+  constexpr bool fuse_rhs = detail::fuses<P, NumT> && detail::is_product<Rhs>;
+  constexpr bool fuse_lhs = detail::fuses<P, NumT> && detail::is_product<Lhs>;
+
+  if constexpr (std::is_same_v<Op, Add>) {
+    if constexpr (fuse_rhs) {
+      return math::detail::fmadd(rhs.lhs.template at<P>(index), rhs.rhs.template at<P>(index), lhs.template at<P>(index));
+    } else if constexpr (fuse_lhs) {
+      return math::detail::fmadd(lhs.lhs.template at<P>(index), lhs.rhs.template at<P>(index), rhs.template at<P>(index));
+    } else {
+      return lhs.template at<P>(index) + rhs.template at<P>(index);
+    }
+  } else if constexpr (std::is_same_v<Op, Sub>) {
+    if constexpr (fuse_rhs) {
+      return math::detail::fmadd(-rhs.lhs.template at<P>(index), rhs.rhs.template at<P>(index), lhs.template at<P>(index));
+    } else if constexpr (fuse_lhs) {
+      return math::detail::fmadd(lhs.lhs.template at<P>(index), lhs.rhs.template at<P>(index), -rhs.template at<P>(index));
+    } else {
+      return lhs.template at<P>(index) - rhs.template at<P>(index);
+    }
+  } else if constexpr (std::is_same_v<Op, Mul>) {
+    return lhs.template at<P>(index) * rhs.template at<P>(index);
+  } else {
+    static_assert(std::is_same_v<Op, Div>);
+    return lhs.template at<P>(index) / rhs.template at<P>(index);
+  }
+}
+
+template<typename Arg, size_t Len, typename NumT>
+constexpr Negate<Arg, Len, NumT>::Negate(const Arg& arg) noexcept : arg(arg) {}
+
+template<typename Arg, size_t Len, typename NumT>
+template<Precision P>
+AYAN_SIMD_INLINE constexpr NumT Negate<Arg, Len, NumT>::component(size_t index) const noexcept {
+  return -arg.template at<P>(index);
+}
+
+// ----- ----- ---- Entry points ----- ----- ----
+template<size_t Len, typename NumT>
+AYAN_SIMD_INLINE constexpr Ref<Len, NumT> lazy(const Vec<Len, NumT>& vec) noexcept {
+  return Ref<Len, NumT>(vec);
+}
+
+template<Precision P, AnyExpression E>
+AYAN_SIMD_INLINE constexpr auto eval(const E& e) noexcept {
+  return e.template eval<P>();
+}
+
+// ----- ----- ---- Operators ----- ----- ----
+template<typename A, typename B> requires (Operands<A, B>)
+AYAN_SIMD_INLINE constexpr auto operator+(const A& a, const B& b) noexcept {
+  return detail::make_binary<Add>(detail::as_node(a), detail::as_node(b));
+}
+
+template<typename A, typename B> requires (Operands<A, B>)
+AYAN_SIMD_INLINE constexpr auto operator-(const A& a, const B& b) noexcept {
+  return detail::make_binary<Sub>(detail::as_node(a), detail::as_node(b));
+}
+
+template<typename A, typename B> requires (Operands<A, B>)
+AYAN_SIMD_INLINE constexpr auto operator*(const A& a, const B& b) noexcept {
+  return detail::make_binary<Mul>(detail::as_node(a), detail::as_node(b));
+}
+
+template<typename A, typename B> requires (Operands<A, B>)
+AYAN_SIMD_INLINE constexpr auto operator/(const A& a, const B& b) noexcept {
+  return detail::make_binary<Div>(detail::as_node(a), detail::as_node(b));
+}
+
+template<AnyExpression E>
+AYAN_SIMD_INLINE constexpr auto operator*(const E& e, std::type_identity_t<typename E::value_type> scalar) noexcept {
+  using NumT = typename E::value_type;
+  return Binary<Mul, E, Scalar<NumT>, E::size, NumT>(e, Scalar<NumT>(scalar));
+}
+
+template<AnyExpression E>
+AYAN_SIMD_INLINE constexpr auto operator*(std::type_identity_t<typename E::value_type> scalar, const E& e) noexcept {
+  // Vec * scalar order, the product is the same either way:
+  return e * scalar;
+}
+
+template<AnyExpression E>
+AYAN_SIMD_INLINE constexpr auto operator/(const E& e, std::type_identity_t<typename E::value_type> scalar) noexcept {
+  using NumT = typename E::value_type;
+  return Binary<Div, E, Scalar<NumT>, E::size, NumT>(e, Scalar<NumT>(scalar));
+}
+
+template<AnyExpression E>
+AYAN_SIMD_INLINE constexpr auto operator-(const E& e) noexcept {
+  return Negate<E, E::size, typename E::value_type>(e);
+}
+
+} // namespace ayan::math::expr
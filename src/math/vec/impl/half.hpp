@@ -0,0 +1,175 @@
+#pragma once
+
+#include <bit>
+#include <stdexcept>
+
+#include "../half.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+// F. Giesen, "Half to float done quic", float_to_half_fast3_rtne and
+// half_to_float_fast5: exact conversions built from integer and float adds:
+constexpr uint16_t float_to_half_bits(float value) noexcept {
+  uint32_t bits = std::bit_cast<uint32_t>(value);
+  const uint32_t sign = (bits >> 16) & 0x8000u;
+  bits &= 0x7fffffffu;
+
+  if (bits >= 0x47800000u) {
+    // >= 65536 (the normal path below rounds [65520, 65536) to inf by itself), inf, NaN:
+    return uint16_t(sign | (bits > 0x7f800000u ? 0x7e00u : 0x7c00u));
+  }
+  if (bits < 0x38800000u) {
+    // < 2^-14, a half subnormal: adding 0.5 aligns the half ulp (2^-24) with
+    // the last mantissa bit and the FPU rounds to nearest even:
+    const float aligned = std::bit_cast<float>(bits) + 0.5f;
+    return uint16_t(sign | (std::bit_cast<uint32_t>(aligned) - 0x3f000000u));
+  }
+  // rebias the exponent, add 0.5 ulp (- 1 if the kept mantissa is even) and truncate:
+  const uint32_t mantissa_odd = (bits >> 13) & 1u;
+  bits += 0xc8000fffu + mantissa_odd;
+  return uint16_t(sign | (bits >> 13));
+}
+
+constexpr float half_bits_to_float(uint16_t half) noexcept {
+  constexpr uint32_t shifted_exp = 0x7c00u << 13;
+  uint32_t bits = (half & 0x7fffu) << 13;
+  const uint32_t exp = bits & shifted_exp;
+  bits += (127u - 15u) << 23;
+
+  if (exp == shifted_exp) {
+    bits += (128u - 16u) << 23; // inf, NaN
+  } else if (exp == 0) {
+    // subnormal: renormalized by the FPU
+    bits += 1u << 23;
+    bits = std::bit_cast<uint32_t>(std::bit_cast<float>(bits) - std::bit_cast<float>(113u << 23));
+  }
+  return std::bit_cast<float>(bits | (uint32_t(half & 0x8000u) << 16));
+}
+
+// `count` halves -> floats, the batch kernel of every Half vector:
+inline void halves_to_floats(const uint16_t* src, float* dst, size_t count) noexcept {
+  size_t i = 0;
+#if defined(AYAN_SIMD_F16C) && defined(AYAN_SIMD_AVX)
+  for (; i + 8 <= count; i += 8) {
+    const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(halves));
+  }
+#elif defined(AYAN_SIMD_SSE2)
+  // half_to_float_SSE2: the exponent is rebiased by a multiplication by 2^112,
+  // which also renormalizes subnormals, inf/NaN get the max exponent back:
+  const __m128i mask_nosign = _mm_set1_epi32(0x7fff);
+  const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+  const __m128i was_infnan = _mm_set1_epi32(0x7bff);
+  const __m128i exp_infnan = _mm_set1_epi32(255 << 23);
+  for (; i + 4 <= count; i += 4) {
+    const __m128i halves = _mm_unpacklo_epi16(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)), _mm_setzero_si128());
+    const __m128i expmant = _mm_and_si128(mask_nosign, halves);
+    const __m128i justsign = _mm_xor_si128(halves, expmant);
+    const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expmant, 13)), magic);
+    const __m128i infnan = _mm_and_si128(_mm_cmpgt_epi32(expmant, was_infnan), exp_infnan);
+    const __m128i sign_infnan = _mm_or_si128(_mm_slli_epi32(justsign, 16), infnan);
+    _mm_storeu_ps(dst + i, _mm_or_ps(scaled, _mm_castsi128_ps(sign_infnan)));
+  }
+#endif
+  for (; i < count; ++i) dst[i] = half_bits_to_float(src[i]);
+}
+
+inline void floats_to_halves(const float* src, uint16_t* dst, size_t count) noexcept {
+  size_t i = 0;
+#if defined(AYAN_SIMD_F16C) && defined(AYAN_SIMD_AVX)
+  for (; i + 8 <= count; i += 8) {
+    const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), halves);
+  }
+#endif
+  for (; i < count; ++i) dst[i] = float_to_half_bits(src[i]);
+}
+
+} // namespace detail
+
+// ----- ----- ---- Half ---- ----- -----
+constexpr Half::Half(float value) noexcept : half_bits(detail::float_to_half_bits(value)) {}
+
+constexpr Half Half::FromBits(uint16_t bits) noexcept {
+  Half result;
+  result.half_bits = bits;
+  return result;
+}
+
+constexpr uint16_t Half::bits() const noexcept { return half_bits; }
+
+constexpr float Half::to_float() const noexcept { return detail::half_bits_to_float(half_bits); }
+
+constexpr Half::operator float() const noexcept { return to_float(); }
+
+// ----- ----- ---- HalfVec3 ---- ----- -----
+constexpr HalfVec3::HalfVec3(Half x, Half y, Half z) noexcept : comps{x, y, z} {}
+
+constexpr HalfVec3::HalfVec3(const Vec3f& vec) noexcept
+: comps{Half(vec.x()), Half(vec.y()), Half(vec.z())} {}
+
+constexpr Half HalfVec3::x() const noexcept { return comps[0]; }
+constexpr Half HalfVec3::y() const noexcept { return comps[1]; }
+constexpr Half HalfVec3::z() const noexcept { return comps[2]; }
+
+constexpr Vec3f HalfVec3::decode() const noexcept {
+  return Vec3f(comps[0].to_float(), comps[1].to_float(), comps[2].to_float());
+}
+
+// ----- ----- ---- HalfVec4 ---- ----- -----
+constexpr HalfVec4::HalfVec4(Half x, Half y, Half z, Half w) noexcept : comps{x, y, z, w} {}
+
+constexpr HalfVec4::HalfVec4(const Vec4f& vec) noexcept
+: comps{Half(vec.x()), Half(vec.y()), Half(vec.z()), Half(vec.w())} {}
+
+constexpr Half HalfVec4::x() const noexcept { return comps[0]; }
+constexpr Half HalfVec4::y() const noexcept { return comps[1]; }
+constexpr Half HalfVec4::z() const noexcept { return comps[2]; }
+constexpr Half HalfVec4::w() const noexcept { return comps[3]; }
+
+constexpr Vec4f HalfVec4::decode() const noexcept {
+  return Vec4f(comps[0].to_float(), comps[1].to_float(), comps[2].to_float(), comps[3].to_float());
+}
+
+// ----- ----- ---- Batch conversion ----- ----- ----
+namespace detail {
+
+inline void check_half_batch(const char* message, size_t in, size_t out) {
+  if (out < in) throw std::invalid_argument(message);
+}
+
+} // namespace detail
+
+// Vec3f, Vec4f and the Half vectors are tightly packed, so a span of them is
+// one flat run of scalars:
+static_assert(sizeof(HalfVec3) == 3 * sizeof(uint16_t) && sizeof(HalfVec4) == 4 * sizeof(uint16_t));
+static_assert(sizeof(Vec3f) == 3 * sizeof(float) && sizeof(Vec4f) == 4 * sizeof(float));
+
+inline void encode(std::span<const Vec3f> in, std::span<HalfVec3> out) {
+  detail::check_half_batch("[encode]: `out` holds fewer vectors than `in`", in.size(), out.size());
+  detail::floats_to_halves(reinterpret_cast<const float*>(in.data()),
+    reinterpret_cast<uint16_t*>(out.data()), 3 * in.size());
+}
+
+inline void encode(std::span<const Vec4f> in, std::span<HalfVec4> out) {
+  detail::check_half_batch("[encode]: `out` holds fewer vectors than `in`", in.size(), out.size());
+  detail::floats_to_halves(reinterpret_cast<const float*>(in.data()),
+    reinterpret_cast<uint16_t*>(out.data()), 4 * in.size());
+}
+
+inline void decode(std::span<const HalfVec3> in, std::span<Vec3f> out) {
+  detail::check_half_batch("[decode]: `out` holds fewer vectors than `in`", in.size(), out.size());
+  detail::halves_to_floats(reinterpret_cast<const uint16_t*>(in.data()),
+    reinterpret_cast<float*>(out.data()), 3 * in.size());
+}
+
+inline void decode(std::span<const HalfVec4> in, std::span<Vec4f> out) {
+  detail::check_half_batch("[decode]: `out` holds fewer vectors than `in`", in.size(), out.size());
+  detail::halves_to_floats(reinterpret_cast<const uint16_t*>(in.data()),
+    reinterpret_cast<float*>(out.data()), 4 * in.size());
+}
+
+} // namespace ayan::math
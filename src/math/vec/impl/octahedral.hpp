@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "../octahedral.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+inline constexpr float oct_snorm_max = 32767.0f;
+
+// the point of the square -> the point of the octahedron (not normalized):
+inline Vec3f oct_unfold(float u, float v) noexcept {
+  const float z = 1.0f - std::abs(u) - std::abs(v);
+  const float t = std::max(-z, 0.0f);
+  return Vec3f(u + (u >= 0.0f ? -t : t), v + (v >= 0.0f ? -t : t), z);
+}
+
+template<size_t Lanes>
+void oct_unfold(simd::Pack<float, Lanes>& u, simd::Pack<float, Lanes>& v, simd::Pack<float, Lanes>& z) noexcept {
+  using pack_type = simd::Pack<float, Lanes>;
+  const pack_type zero = pack_type::Zero();
+  z = pack_type(1.0f) - simd::abs(u) - simd::abs(v);
+  const pack_type t = simd::max(-z, zero);
+  u += simd::select(u >= zero, -t, t);
+  v += simd::select(v >= zero, -t, t);
+}
+
+inline float oct_dequantize(int16_t value) noexcept {
+  return std::max(float(value) * (1.0f / oct_snorm_max), -1.0f);
+}
+
+// `Lanes` consecutive normals -> raw coordinates, converted in registers when the
+// int16 pairs can be split by 32-bit shifts (a round trip through memory stalls store forwarding):
+template<size_t Lanes>
+AYAN_SIMD_INLINE void oct_load(const OctNormal* src, simd::Pack<float, Lanes>& u, simd::Pack<float, Lanes>& v) noexcept {
+  using pack_type = simd::Pack<float, Lanes>;
+#if defined(AYAN_SIMD_AVX2)
+  if constexpr (Lanes == 8 && simd::IsNative<float, 8>) {
+    const __m256i pairs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    u = pack_type(_mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(pairs, 16), 16)));
+    v = pack_type(_mm256_cvtepi32_ps(_mm256_srai_epi32(pairs, 16)));
+    return;
+  }
+#endif
+#if defined(AYAN_SIMD_SSE2)
+  if constexpr (Lanes == 4 && simd::IsNative<float, 4>) {
+    const __m128i pairs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    u = pack_type(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(pairs, 16), 16)));
+    v = pack_type(_mm_cvtepi32_ps(_mm_srai_epi32(pairs, 16)));
+    return;
+  }
+#endif
+  alignas(64) float us[Lanes], vs[Lanes];
+  for (size_t lane = 0; lane < Lanes; ++lane) {
+    us[lane] = float(src[lane].u());
+    vs[lane] = float(src[lane].v());
+  }
+  u = pack_type::Load(us);
+  v = pack_type::Load(vs);
+}
+
+} // namespace detail
+
+// ----- ----- ---- Constructors ---- ----- -----
+constexpr OctNormal::OctNormal(int16_t u, int16_t v) noexcept : coords{u, v} {}
+
+// ----- ----- ---- Static member funcs ---- ----- -----
+inline OctNormal OctNormal::Encode(const Vec3f& normal) noexcept {
+  const Vec3f unit = normal.normalize();
+  const float l1 = std::abs(unit.x()) + std::abs(unit.y()) + std::abs(unit.z());
+  float u = unit.x() / l1;
+  float v = unit.y() / l1;
+  if (unit.z() < 0.0f) {
+    const float folded_u = (1.0f - std::abs(v)) * (u >= 0.0f ? 1.0f : -1.0f);
+    const float folded_v = (1.0f - std::abs(u)) * (v >= 0.0f ? 1.0f : -1.0f);
+    u = folded_u;
+    v = folded_v;
+  }
+
+  // rounding each coordinate on its own isn't the closest direction, check all 4 neighbours.
+  // They are compared by distance: cosines of angles this small are all 1 in float:
+  const float base_u = std::floor(std::clamp(u, -1.0f, 1.0f) * detail::oct_snorm_max);
+  const float base_v = std::floor(std::clamp(v, -1.0f, 1.0f) * detail::oct_snorm_max);
+  OctNormal best;
+  float best_distance = std::numeric_limits<float>::infinity();
+  for (int du = 0; du <= 1; ++du) {
+    for (int dv = 0; dv <= 1; ++dv) {
+      const OctNormal candidate(
+        int16_t(std::clamp(base_u + float(du), -detail::oct_snorm_max, detail::oct_snorm_max)),
+        int16_t(std::clamp(base_v + float(dv), -detail::oct_snorm_max, detail::oct_snorm_max)));
+      const float distance = candidate.decode().distance_squared(unit);
+      if (distance < best_distance) {
+        best_distance = distance;
+        best = candidate;
+      }
+    }
+  }
+  return best;
+}
+
+constexpr OctNormal OctNormal::FromBits(uint32_t bits) noexcept {
+  return OctNormal(int16_t(uint16_t(bits & 0xffffu)), int16_t(uint16_t(bits >> 16)));
+}
+
+// ----- ----- ---- Element access ---- ----- -----
+constexpr int16_t OctNormal::u() const noexcept { return coords[0]; }
+constexpr int16_t OctNormal::v() const noexcept { return coords[1]; }
+
+constexpr uint32_t OctNormal::bits() const noexcept {
+  return uint32_t(uint16_t(coords[0])) | (uint32_t(uint16_t(coords[1])) << 16);
+}
+
+inline Vec3f OctNormal::decode() const noexcept {
+  return detail::oct_unfold(detail::oct_dequantize(coords[0]), detail::oct_dequantize(coords[1])).normalize();
+}
+
+// ----- ----- ---- Batch conversion ----- ----- ----
+inline void encode(std::span<const Vec3f> in, std::span<OctNormal> out) noexcept {
+  for (size_t i = 0; i < in.size(); ++i) out[i] = OctNormal::Encode(in[i]);
+}
+
+inline void decode(std::span<const OctNormal> in, std::span<Vec3f> out) noexcept {
+#if defined(AYAN_SIMD_AVX2)
+  constexpr size_t Lanes = simd::IsNative<float, 8> ? 8 : 4;
+#else
+  constexpr size_t Lanes = 4;
+#endif
+  using pack_type = simd::Pack<float, Lanes>;
+  const pack_type scale(1.0f / detail::oct_snorm_max);
+  const pack_type lowest(-1.0f);
+
+  size_t i = 0;
+  for (; i + Lanes <= in.size(); i += Lanes) {
+    pack_type u, v, z;
+    detail::oct_load(in.data() + i, u, v);
+    u = simd::max(u * scale, lowest);
+    v = simd::max(v * scale, lowest);
+    detail::oct_unfold(u, v, z);
+    Vec3x<Lanes, float>(u, v, z).normalize().store(out.data() + i);
+  }
+  for (; i < in.size(); ++i) out[i] = in[i].decode();
+}
+
+} // namespace ayan::math
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include "../quantized.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+inline constexpr float quantized_max = 65535.0f;
+
+inline uint16_t quantize_axis(float value, float origin, float inv_step) noexcept {
+  const float scaled = std::clamp((value - origin) * inv_step, 0.0f, quantized_max);
+  return uint16_t(std::lround(scaled));
+}
+
+// `count` coordinates of consecutive QuantizedVec3 -> floats, coordinate `i` is
+// src[i] * scales[i % 3] + offsets[i % 3]. Three registers hold a whole number of
+// vectors (24 or 12 coordinates), so each gets a fixed pattern of scales and no shuffles:
+inline void dequantize_coords(const uint16_t* src, float* dst, size_t count,
+  const float* scales, const float* offsets) noexcept
+{
+  size_t i = 0;
+#if defined(AYAN_SIMD_AVX2)
+  __m256 scale[3], offset[3];
+  for (int r = 0; r < 3; ++r) {
+    alignas(32) float s[8], o[8];
+    for (int lane = 0; lane < 8; ++lane) {
+      s[lane] = scales[(r * 8 + lane) % 3];
+      o[lane] = offsets[(r * 8 + lane) % 3];
+    }
+    scale[r] = _mm256_load_ps(s);
+    offset[r] = _mm256_load_ps(o);
+  }
+  for (; i + 24 <= count; i += 24) {
+    for (int r = 0; r < 3; ++r) {
+      const __m128i coords = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + r * 8));
+      const __m256 values = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(coords));
+      _mm256_storeu_ps(dst + i + r * 8, _mm256_add_ps(_mm256_mul_ps(values, scale[r]), offset[r]));
+    }
+  }
+#elif defined(AYAN_SIMD_SSE2)
+  __m128 scale[3], offset[3];
+  for (int r = 0; r < 3; ++r) {
+    scale[r] = _mm_setr_ps(scales[(r * 4) % 3], scales[(r * 4 + 1) % 3],
+      scales[(r * 4 + 2) % 3], scales[(r * 4 + 3) % 3]);
+    offset[r] = _mm_setr_ps(offsets[(r * 4) % 3], offsets[(r * 4 + 1) % 3],
+      offsets[(r * 4 + 2) % 3], offsets[(r * 4 + 3) % 3]);
+  }
+  for (; i + 12 <= count; i += 12) {
+    for (int r = 0; r < 3; ++r) {
+      const __m128i coords = _mm_unpacklo_epi16(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i + r * 4)), _mm_setzero_si128());
+      const __m128 values = _mm_cvtepi32_ps(coords);
+      _mm_storeu_ps(dst + i + r * 4, _mm_add_ps(_mm_mul_ps(values, scale[r]), offset[r]));
+    }
+  }
+#endif
+  for (; i < count; ++i) dst[i] = float(src[i]) * scales[i % 3] + offsets[i % 3];
+}
+
+} // namespace detail
+
+// ----- ----- ---- Constructors ---- ----- -----
+inline PositionQuantizer::PositionQuantizer(const Vec3f& min, const Vec3f& max) noexcept
+: origin(min), step((max - min) / detail::quantized_max)
+{
+  for (size_t axis = 0; axis < 3; ++axis) {
+    inv_step[axis] = step[axis] > 0.0f ? 1.0f / step[axis] : 0.0f;
+  }
+}
+
+// ----- ----- ---- Element access ---- ----- -----
+inline const Vec3f& PositionQuantizer::min() const noexcept { return origin; }
+
+inline const Vec3f& PositionQuantizer::step_size() const noexcept { return step; }
+
+// ----- ----- ---- Conversion ----- ----- ----
+inline QuantizedVec3 PositionQuantizer::encode(const Vec3f& position) const noexcept {
+  return QuantizedVec3{{
+    detail::quantize_axis(position.x(), origin.x(), inv_step.x()),
+    detail::quantize_axis(position.y(), origin.y(), inv_step.y()),
+    detail::quantize_axis(position.z(), origin.z(), inv_step.z())
+  }};
+}
+
+inline Vec3f PositionQuantizer::decode(const QuantizedVec3& position) const noexcept {
+  return Vec3f(
+    float(position.coords[0]) * step.x() + origin.x(),
+    float(position.coords[1]) * step.y() + origin.y(),
+    float(position.coords[2]) * step.z() + origin.z()
+  );
+}
+
+inline void PositionQuantizer::encode(std::span<const Vec3f> in, std::span<QuantizedVec3> out) const noexcept {
+  for (size_t i = 0; i < in.size(); ++i) out[i] = encode(in[i]);
+}
+
+inline void PositionQuantizer::decode(std::span<const QuantizedVec3> in, std::span<Vec3f> out) const noexcept {
+  static_assert(sizeof(QuantizedVec3) == 3 * sizeof(uint16_t) && sizeof(Vec3f) == 3 * sizeof(float));
+  // a * b + c unfused, the same roundings as the scalar decode():
+  const float scales[3] = {step.x(), step.y(), step.z()};
+  const float offsets[3] = {origin.x(), origin.y(), origin.z()};
+  detail::dequantize_coords(reinterpret_cast<const uint16_t*>(in.data()),
+    reinterpret_cast<float*>(out.data()), 3 * in.size(), scales, offsets);
+}
+
+} // namespace ayan::math
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "../transcendental.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+namespace detail {
+
+template<size_t Lanes, typename Func>
+Vec3x<Lanes, float> map_lanes(const Vec3x<Lanes, float>& vec, Func&& func) noexcept {
+  return Vec3x<Lanes, float>(func(vec.x()), func(vec.y()), func(vec.z()));
+}
+
+template<size_t Lanes, typename Func>
+Vec3x<Lanes, float> map_lanes(const Vec3x<Lanes, float>& a, const Vec3x<Lanes, float>& b, Func&& func) noexcept {
+  return Vec3x<Lanes, float>(func(a.x(), b.x()), func(a.y(), b.y()), func(a.z(), b.z()));
+}
+
+} // namespace detail
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                        Vec4f                         |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+inline Vec4f sin(const Vec4f& vec) noexcept {
+  return Vec4f::FromPack(simd::sin(vec.to_pack()));
+}
+
+inline Vec4f cos(const Vec4f& vec) noexcept {
+  return Vec4f::FromPack(simd::cos(vec.to_pack()));
+}
+
+inline simd::SinCos<Vec4f> sincos(const Vec4f& vec) noexcept {
+  const auto [s, c] = simd::sincos(vec.to_pack());
+  return { Vec4f::FromPack(s), Vec4f::FromPack(c) };
+}
+
+inline Vec4f exp(const Vec4f& vec) noexcept {
+  return Vec4f::FromPack(simd::exp(vec.to_pack()));
+}
+
+inline Vec4f log(const Vec4f& vec) noexcept {
+  return Vec4f::FromPack(simd::log(vec.to_pack()));
+}
+
+inline Vec4f pow(const Vec4f& vec, const Vec4f& exponents) noexcept {
+  return Vec4f::FromPack(simd::pow(vec.to_pack(), exponents.to_pack()));
+}
+
+inline Vec4f pow(const Vec4f& vec, float exponent) noexcept {
+  return Vec4f::FromPack(simd::pow(vec.to_pack(), exponent));
+}
+
+inline Vec4f atan2(const Vec4f& y, const Vec4f& x) noexcept {
+  return Vec4f::FromPack(simd::atan2(y.to_pack(), x.to_pack()));
+}
+
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+//                        Vec3x                         |
+// ----- ----- ----- ----- ----- ----- ----- ----- -----
+template<size_t Lanes>
+Vec3x<Lanes, float> sin(const Vec3x<Lanes, float>& vec) noexcept {
+  return detail::map_lanes(vec, [](const auto& lanes) { return simd::sin(lanes); });
+}
+
+template<size_t Lanes>
+Vec3x<Lanes, float> cos(const Vec3x<Lanes, float>& vec) noexcept {
+  return detail::map_lanes(vec, [](const auto& lanes) { return simd::cos(lanes); });
+}
+
+template<size_t Lanes>
+simd::SinCos<Vec3x<Lanes, float>> sincos(const Vec3x<Lanes, float>& vec) noexcept {
+  const auto [sx, cx] = simd::sincos(vec.x());
+  const auto [sy, cy] = simd::sincos(vec.y());
+  const auto [sz, cz] = simd::sincos(vec.z());
+  return { Vec3x<Lanes, float>(sx, sy, sz), Vec3x<Lanes, float>(cx, cy, cz) };
+}
+
+template<size_t Lanes>
+Vec3x<Lanes, float> exp(const Vec3x<Lanes, float>& vec) noexcept {
+  return detail::map_lanes(vec, [](const auto& lanes) { return simd::exp(lanes); });
+}
+
+template<size_t Lanes>
+Vec3x<Lanes, float> log(const Vec3x<Lanes, float>& vec) noexcept {
+  return detail::map_lanes(vec, [](const auto& lanes) { return simd::log(lanes); });
+}
+
+template<size_t Lanes>
+Vec3x<Lanes, float> pow(const Vec3x<Lanes, float>& vec, const Vec3x<Lanes, float>& exponents) noexcept {
+  return detail::map_lanes(vec, exponents, [](const auto& x, const auto& y) { return simd::pow(x, y); });
+}
+
+template<size_t Lanes>
+Vec3x<Lanes, float> pow(const Vec3x<Lanes, float>& vec, float exponent) noexcept {
+  return detail::map_lanes(vec, [exponent](const auto& lanes) { return simd::pow(lanes, exponent); });
+}
+
+template<size_t Lanes>
+Vec3x<Lanes, float> atan2(const Vec3x<Lanes, float>& y, const Vec3x<Lanes, float>& x) noexcept {
+  return detail::map_lanes(y, x, [](const auto& a, const auto& b) { return simd::atan2(a, b); });
+}
+
+} // namespace ayan::math
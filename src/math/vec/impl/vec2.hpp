@@ -4,7 +4,7 @@
 
 #include "../vec2.hpp"
 
-namespace ayan::math {
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
 
 // ----- ----- ---- Constructors ---- ----- -----
 template<typename NumT> requires (detail::ValidNumType<NumT>)
@@ -60,6 +60,12 @@ constexpr const NumT& Vec<2, NumT>::x() const noexcept { return data[0]; }
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr const NumT& Vec<2, NumT>::y() const noexcept { return data[1]; }
 
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT& Vec<2, NumT>::operator[](size_t index) noexcept { return data[index]; }
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr const NumT& Vec<2, NumT>::operator[](size_t index) const noexcept { return data[index]; }
+
 // ----- ----- ---- Operators ----- ----- ----
 // unary:
 template<typename NumT> requires (detail::ValidNumType<NumT>)
@@ -129,7 +135,13 @@ constexpr NumT Vec<2, NumT>::dot(const Vec<2, NumT>& oth) const noexcept {
 }
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
+template<Precision P>
 NumT Vec<2, NumT>::length() const noexcept {
+  if constexpr (detail::uses_rsqrt<P, NumT>) {
+    const NumT len_sq = lengthSquared();
+    if (std::isnormal(len_sq)) [[likely]] return len_sq * detail::rsqrt<P>(len_sq);
+    return length<Precision::Exact>();
+  }
   return std::sqrt(x() * x() + y() * y());
 }
 
@@ -144,7 +156,13 @@ constexpr Vec<2, NumT> Vec<2, NumT>::perpendicular() const noexcept {
 }
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
+template<Precision P>
 Vec<2, NumT> Vec<2, NumT>::normalize() const noexcept {
+  if constexpr (detail::uses_rsqrt<P, NumT>) {
+    const NumT len_sq = lengthSquared();
+    if (std::isnormal(len_sq)) [[likely]] return *this * detail::rsqrt<P>(len_sq);
+    return normalize<Precision::Exact>();
+  }
   NumT len = length();
   if (len > NumT{0}) {
     return *this / len;
@@ -159,7 +177,7 @@ NumT Vec<2, NumT>::distance(const Vec<2, NumT>& oth) const noexcept {
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr NumT Vec<2, NumT>::distance_squared(const Vec<2, NumT>& oth) const noexcept {
-  return (*this - oth).length_squared();
+  return (*this - oth).lengthSquared();
 }
 
 // ----- ----- ---- Utility functional methods ----- ----- ----
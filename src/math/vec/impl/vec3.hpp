@@ -4,7 +4,7 @@
 
 #include "../vec3.hpp"
 
-namespace ayan::math {
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
 
 // ----- ----- ---- Constructors ---- ----- -----
 template<typename NumT> requires (detail::ValidNumType<NumT>)
@@ -73,6 +73,12 @@ constexpr const NumT& Vec<3, NumT>::y() const noexcept { return data[1]; }
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr const NumT& Vec<3, NumT>::z() const noexcept { return data[2]; }
 
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT& Vec<3, NumT>::operator[](size_t index) noexcept { return data[index]; }
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr const NumT& Vec<3, NumT>::operator[](size_t index) const noexcept { return data[index]; }
+
 // ----- ----- ---- Operators ----- ----- ----
 // unary:
 template<typename NumT> requires (detail::ValidNumType<NumT>)
@@ -151,7 +157,13 @@ constexpr NumT Vec<3, NumT>::dot(const Vec<3, NumT>& oth) const noexcept {
 }
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
+template<Precision P>
 NumT Vec<3, NumT>::length() const noexcept {
+  if constexpr (detail::uses_rsqrt<P, NumT>) {
+    const NumT len_sq = length_squared();
+    if (std::isnormal(len_sq)) [[likely]] return len_sq * detail::rsqrt<P>(len_sq);
+    return length<Precision::Exact>();
+  }
   return std::sqrt(x() * x() + y() * y() + z() * z());
 }
 
@@ -161,7 +173,13 @@ constexpr NumT Vec<3, NumT>::length_squared() const noexcept {
 }
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
+template<Precision P>
 Vec<3, NumT> Vec<3, NumT>::normalize() const noexcept {
+  if constexpr (detail::uses_rsqrt<P, NumT>) {
+    const NumT len_sq = length_squared();
+    if (std::isnormal(len_sq)) [[likely]] return *this * detail::rsqrt<P>(len_sq);
+    return normalize<Precision::Exact>();
+  }
   NumT len = length();
   if (len > NumT{0}) {
     return *this / len;
@@ -190,7 +208,7 @@ constexpr Vec<3, NumT> Vec<3, NumT>::cross(const Vec<3, NumT>& oth) const noexce
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr NumT Vec<3, NumT>::triple(const Vec<3, NumT>& b, const Vec<3, NumT>& c) const noexcept {
-  return dot(cross(b), c);
+  return dot(b.cross(c));
 }
 
 // ----- ----- ---- Utility functional methods ----- ----- ----
@@ -0,0 +1,338 @@
+#pragma once
+
+#include "../vec3x.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT>::Vec3x() noexcept
+  : x_lanes(pack_type::Zero()), y_lanes(pack_type::Zero()), z_lanes(pack_type::Zero()) {}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT>::Vec3x(const pack_type& x, const pack_type& y, const pack_type& z) noexcept
+  : x_lanes(x), y_lanes(y), z_lanes(z) {}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT>::Vec3x(const Vec3<NumT>& vec) noexcept
+  : x_lanes(vec.x()), y_lanes(vec.y()), z_lanes(vec.z()) {}
+
+// ----- ----- ---- Static member funcs ---- ----- -----
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT> Vec3x<Lanes, NumT>::Zero() noexcept {
+  return Vec3x();
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT> Vec3x<Lanes, NumT>::Broadcast(const Vec3<NumT>& vec) noexcept {
+  return Vec3x(vec);
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT> Vec3x<Lanes, NumT>::Load(const Vec3<NumT>* src) noexcept {
+  // Vec3 is tightly packed, so `Lanes` vectors are 3 * Lanes consecutive scalars:
+  Vec3x result;
+  simd::load_deinterleave3(&src->x(), result.x_lanes, result.y_lanes, result.z_lanes);
+  return result;
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT> Vec3x<Lanes, NumT>::LoadStrided(const Vec3<NumT>* src, size_t stride) noexcept {
+  // one register load per component, filling the packet lane by lane through
+  // set_lane() would stall on store forwarding for every lane:
+  alignas(64) NumT xs[Lanes], ys[Lanes], zs[Lanes];
+  for (size_t i = 0; i < Lanes; ++i) {
+    const Vec3<NumT>& vec = src[i * stride];
+    xs[i] = vec.x();
+    ys[i] = vec.y();
+    zs[i] = vec.z();
+  }
+  return Vec3x(pack_type::Load(xs), pack_type::Load(ys), pack_type::Load(zs));
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT> Vec3x<Lanes, NumT>::Gather(const Vec3<NumT>* base, const int32_t* indices) noexcept {
+  // Vec3 is tightly packed, so component `c` of base[i] is scalars[3 * i + c]:
+  alignas(64) int32_t offsets[Lanes];
+  for (size_t i = 0; i < Lanes; ++i) offsets[i] = indices[i] * 3;
+
+  const NumT* scalars = &base->x();
+  return Vec3x(
+    pack_type::Gather(scalars + 0, offsets),
+    pack_type::Gather(scalars + 1, offsets),
+    pack_type::Gather(scalars + 2, offsets)
+  );
+}
+
+// ----- ----- ---- Element access ---- ----- -----
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+typename Vec3x<Lanes, NumT>::pack_type& Vec3x<Lanes, NumT>::x() noexcept { return x_lanes; }
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+typename Vec3x<Lanes, NumT>::pack_type& Vec3x<Lanes, NumT>::y() noexcept { return y_lanes; }
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+typename Vec3x<Lanes, NumT>::pack_type& Vec3x<Lanes, NumT>::z() noexcept { return z_lanes; }
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+const typename Vec3x<Lanes, NumT>::pack_type& Vec3x<Lanes, NumT>::x() const noexcept { return x_lanes; }
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+const typename Vec3x<Lanes, NumT>::pack_type& Vec3x<Lanes, NumT>::y() const noexcept { return y_lanes; }
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+const typename Vec3x<Lanes, NumT>::pack_type& Vec3x<Lanes, NumT>::z() const noexcept { return z_lanes; }
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+typename Vec3x<Lanes, NumT>::pack_type& Vec3x<Lanes, NumT>::operator[](size_t axis) noexcept {
+  return axis == 0 ? x_lanes : (axis == 1 ? y_lanes : z_lanes);
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+const typename Vec3x<Lanes, NumT>::pack_type& Vec3x<Lanes, NumT>::operator[](size_t axis) const noexcept {
+  return axis == 0 ? x_lanes : (axis == 1 ? y_lanes : z_lanes);
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3<NumT> Vec3x<Lanes, NumT>::lane(size_t index) const noexcept {
+  return Vec3<NumT>(x_lanes[index], y_lanes[index], z_lanes[index]);
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+void Vec3x<Lanes, NumT>::set_lane(size_t index, const Vec3<NumT>& vec) noexcept {
+  alignas(64) NumT xs[Lanes], ys[Lanes], zs[Lanes];
+  x_lanes.store(xs);
+  y_lanes.store(ys);
+  z_lanes.store(zs);
+  xs[index] = vec.x();
+  ys[index] = vec.y();
+  zs[index] = vec.z();
+  *this = Vec3x(pack_type::Load(xs), pack_type::Load(ys), pack_type::Load(zs));
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+void Vec3x<Lanes, NumT>::store(Vec3<NumT>* dst) const noexcept {
+  simd::store_interleave3(&dst->x(), x_lanes, y_lanes, z_lanes);
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+void Vec3x<Lanes, NumT>::scatter(Vec3<NumT>* base, const int32_t* indices) const noexcept {
+  scatter(base, indices, mask_type(true));
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+void Vec3x<Lanes, NumT>::scatter(Vec3<NumT>* base, const int32_t* indices, const mask_type& mask) const noexcept {
+  alignas(64) NumT xs[Lanes], ys[Lanes], zs[Lanes];
+  x_lanes.store(xs);
+  y_lanes.store(ys);
+  z_lanes.store(zs);
+  for (uint32_t active = mask.bits(); active != 0; active &= active - 1) {
+    const int lane = std::countr_zero(active);
+    base[indices[lane]] = Vec3<NumT>(xs[lane], ys[lane], zs[lane]);
+  }
+}
+
+// ----- ----- ---- Operators ----- ----- ----
+// unary:
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT> Vec3x<Lanes, NumT>::operator-() const noexcept {
+  return Vec3x(-x_lanes, -y_lanes, -z_lanes);
+}
+
+// with assignment:
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT>& Vec3x<Lanes, NumT>::operator+=(const Vec3x& oth) noexcept {
+  x_lanes += oth.x_lanes;
+  y_lanes += oth.y_lanes;
+  z_lanes += oth.z_lanes;
+  return *this;
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT>& Vec3x<Lanes, NumT>::operator-=(const Vec3x& oth) noexcept {
+  x_lanes -= oth.x_lanes;
+  y_lanes -= oth.y_lanes;
+  z_lanes -= oth.z_lanes;
+  return *this;
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT>& Vec3x<Lanes, NumT>::operator*=(const pack_type& scalars) noexcept {
+  x_lanes *= scalars;
+  y_lanes *= scalars;
+  z_lanes *= scalars;
+  return *this;
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT>& Vec3x<Lanes, NumT>::operator/=(const pack_type& scalars) noexcept {
+  x_lanes /= scalars;
+  y_lanes /= scalars;
+  z_lanes /= scalars;
+  return *this;
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT>& Vec3x<Lanes, NumT>::operator*=(const Vec3x& oth) noexcept {
+  x_lanes *= oth.x_lanes;
+  y_lanes *= oth.y_lanes;
+  z_lanes *= oth.z_lanes;
+  return *this;
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT>& Vec3x<Lanes, NumT>::operator/=(const Vec3x& oth) noexcept {
+  x_lanes /= oth.x_lanes;
+  y_lanes /= oth.y_lanes;
+  z_lanes /= oth.z_lanes;
+  return *this;
+}
+
+// comparing:
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+typename Vec3x<Lanes, NumT>::mask_type Vec3x<Lanes, NumT>::operator==(const Vec3x& oth) const noexcept {
+  return (x_lanes == oth.x_lanes) & (y_lanes == oth.y_lanes) & (z_lanes == oth.z_lanes);
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+typename Vec3x<Lanes, NumT>::mask_type Vec3x<Lanes, NumT>::operator!=(const Vec3x& oth) const noexcept {
+  return ~(*this == oth);
+}
+
+// ----- ----- ---- Linear Algebra Operations ----- ----- ----
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+typename Vec3x<Lanes, NumT>::pack_type Vec3x<Lanes, NumT>::dot(const Vec3x& oth) const noexcept {
+  return x_lanes * oth.x_lanes + y_lanes * oth.y_lanes + z_lanes * oth.z_lanes;
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+template<Precision P>
+typename Vec3x<Lanes, NumT>::pack_type Vec3x<Lanes, NumT>::length() const noexcept {
+  const pack_type len_sq = length_squared();
+  if constexpr (detail::uses_rsqrt<P, NumT>) {
+    const pack_type len = len_sq * detail::rsqrt<P>(len_sq);
+    const mask_type in_range = detail::rsqrt_in_range(len_sq);
+    if (in_range.all()) [[likely]] return len;
+    return select(in_range, len, simd::sqrt(len_sq));
+  }
+  return simd::sqrt(len_sq);
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+typename Vec3x<Lanes, NumT>::pack_type Vec3x<Lanes, NumT>::length_squared() const noexcept {
+  return dot(*this);
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+template<Precision P>
+Vec3x<Lanes, NumT> Vec3x<Lanes, NumT>::normalize() const noexcept {
+  if constexpr (detail::uses_rsqrt<P, NumT>) {
+    const pack_type len_sq = length_squared();
+    const Vec3x normalized = *this * detail::rsqrt<P>(len_sq);
+    const mask_type in_range = detail::rsqrt_in_range(len_sq);
+    if (in_range.all()) [[likely]] return normalized;
+    return select(in_range, normalized, normalize());
+  }
+  // zero-length lanes are returned unchanged, as Vec3::normalize() does:
+  const pack_type len = length();
+  return select(len > pack_type::Zero(), *this / len, *this);
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+typename Vec3x<Lanes, NumT>::pack_type Vec3x<Lanes, NumT>::distance(const Vec3x& oth) const noexcept {
+  return (*this - oth).length();
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+typename Vec3x<Lanes, NumT>::pack_type Vec3x<Lanes, NumT>::distance_squared(const Vec3x& oth) const noexcept {
+  return (*this - oth).length_squared();
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+Vec3x<Lanes, NumT> Vec3x<Lanes, NumT>::cross(const Vec3x& oth) const noexcept {
+  return Vec3x(
+    y_lanes * oth.z_lanes - z_lanes * oth.y_lanes,
+    z_lanes * oth.x_lanes - x_lanes * oth.z_lanes,
+    x_lanes * oth.y_lanes - y_lanes * oth.x_lanes
+  );
+}
+
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+typename Vec3x<Lanes, NumT>::pack_type Vec3x<Lanes, NumT>::triple(const Vec3x& b, const Vec3x& c) const noexcept {
+  return dot(b.cross(c));
+}
+
+// ----- ----- ---- Binary operators ----- ----- ----
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator+(const Vec3x<Lanes, NumT>& a, const Vec3x<Lanes, NumT>& b) noexcept {
+  return Vec3x<Lanes, NumT>(a.x() + b.x(), a.y() + b.y(), a.z() + b.z());
+}
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator-(const Vec3x<Lanes, NumT>& a, const Vec3x<Lanes, NumT>& b) noexcept {
+  return Vec3x<Lanes, NumT>(a.x() - b.x(), a.y() - b.y(), a.z() - b.z());
+}
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator*(const Vec3x<Lanes, NumT>& a, const Vec3x<Lanes, NumT>& b) noexcept {
+  return Vec3x<Lanes, NumT>(a.x() * b.x(), a.y() * b.y(), a.z() * b.z());
+}
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator/(const Vec3x<Lanes, NumT>& a, const Vec3x<Lanes, NumT>& b) noexcept {
+  return Vec3x<Lanes, NumT>(a.x() / b.x(), a.y() / b.y(), a.z() / b.z());
+}
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator*(const Vec3x<Lanes, NumT>& vec, const simd::Pack<NumT, Lanes>& scalars) noexcept {
+  return Vec3x<Lanes, NumT>(vec.x() * scalars, vec.y() * scalars, vec.z() * scalars);
+}
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator*(const simd::Pack<NumT, Lanes>& scalars, const Vec3x<Lanes, NumT>& vec) noexcept {
+  return vec * scalars;
+}
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator/(const Vec3x<Lanes, NumT>& vec, const simd::Pack<NumT, Lanes>& scalars) noexcept {
+  return Vec3x<Lanes, NumT>(vec.x() / scalars, vec.y() / scalars, vec.z() / scalars);
+}
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator*(const Vec3x<Lanes, NumT>& vec, std::type_identity_t<NumT> scalar) noexcept {
+  return vec * simd::Pack<NumT, Lanes>::Broadcast(scalar);
+}
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator*(std::type_identity_t<NumT> scalar, const Vec3x<Lanes, NumT>& vec) noexcept {
+  return vec * simd::Pack<NumT, Lanes>::Broadcast(scalar);
+}
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator/(const Vec3x<Lanes, NumT>& vec, std::type_identity_t<NumT> scalar) noexcept {
+  return vec / simd::Pack<NumT, Lanes>::Broadcast(scalar);
+}
+
+// ----- ----- ---- Lane selection ----- ----- ----
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> select(const simd::Mask<NumT, Lanes>& mask,
+  const Vec3x<Lanes, NumT>& if_true, const Vec3x<Lanes, NumT>& if_false) noexcept
+{
+  return Vec3x<Lanes, NumT>(
+    simd::select(mask, if_true.x(), if_false.x()),
+    simd::select(mask, if_true.y(), if_false.y()),
+    simd::select(mask, if_true.z(), if_false.z())
+  );
+}
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> min(const Vec3x<Lanes, NumT>& a, const Vec3x<Lanes, NumT>& b) noexcept {
+  return Vec3x<Lanes, NumT>(simd::min(a.x(), b.x()), simd::min(a.y(), b.y()), simd::min(a.z(), b.z()));
+}
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> max(const Vec3x<Lanes, NumT>& a, const Vec3x<Lanes, NumT>& b) noexcept {
+  return Vec3x<Lanes, NumT>(simd::max(a.x(), b.x()), simd::max(a.y(), b.y()), simd::max(a.z(), b.z()));
+}
+
+} // namespace ayan::math
@@ -1,10 +1,11 @@
 #pragma once
 
 #include <cmath>
+#include <type_traits>
 
 #include "../vec4.hpp"
 
-namespace ayan::math {
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
 
 // ----- ----- ---- Constructors ---- ----- -----
 template<typename NumT> requires (detail::ValidNumType<NumT>)
@@ -86,10 +87,19 @@ constexpr const NumT& Vec<4, NumT>::z() const noexcept { return data[2]; }
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr const NumT& Vec<4, NumT>::w() const noexcept { return data[3]; }
 
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT& Vec<4, NumT>::operator[](size_t index) noexcept { return data[index]; }
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr const NumT& Vec<4, NumT>::operator[](size_t index) const noexcept { return data[index]; }
+
 // ----- ----- ---- Operators ----- ----- ----
 // unary:
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr Vec<4, NumT> Vec<4, NumT>::operator-() const noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return FromPack(-to_pack());
+  }
   return Vec(-x(), -y(), -z(), -w());
 }
 
@@ -97,6 +107,9 @@ constexpr Vec<4, NumT> Vec<4, NumT>::operator-() const noexcept {
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 template<typename U> requires (std::same_as<U, NumT> || std::convertible_to<U, NumT>)
 constexpr Vec<4, NumT>& Vec<4, NumT>::operator+=(const Vec4<U>& oth) noexcept {
+  if constexpr (simd::IsNative<NumT, 4> && std::same_as<U, NumT>) {
+    if (!std::is_constant_evaluated()) return *this = FromPack(to_pack() + oth.to_pack());
+  }
   data[0] += oth.x();
   data[1] += oth.y();
   data[2] += oth.z();
@@ -106,6 +119,9 @@ constexpr Vec<4, NumT>& Vec<4, NumT>::operator+=(const Vec4<U>& oth) noexcept {
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr Vec<4, NumT>& Vec<4, NumT>::operator-=(const Vec4<NumT>& oth) noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return *this = FromPack(to_pack() - oth.to_pack());
+  }
   data[0] -= oth.x();
   data[1] -= oth.y();
   data[2] -= oth.z();
@@ -115,6 +131,9 @@ constexpr Vec<4, NumT>& Vec<4, NumT>::operator-=(const Vec4<NumT>& oth) noexcept
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr Vec<4, NumT>& Vec<4, NumT>::operator*=(NumT scalar) noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return *this = FromPack(to_pack() * scalar);
+  }
   data[0] *= scalar;
   data[1] *= scalar;
   data[2] *= scalar;
@@ -124,6 +143,9 @@ constexpr Vec<4, NumT>& Vec<4, NumT>::operator*=(NumT scalar) noexcept {
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr Vec<4, NumT>& Vec<4, NumT>::operator/=(NumT scalar) noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return *this = FromPack(to_pack() / scalar);
+  }
   data[0] /= scalar;
   data[1] /= scalar;
   data[2] /= scalar;
@@ -133,6 +155,9 @@ constexpr Vec<4, NumT>& Vec<4, NumT>::operator/=(NumT scalar) noexcept {
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr Vec<4, NumT>& Vec<4, NumT>::operator*=(const Vec4<NumT>& oth) noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return *this = FromPack(to_pack() * oth.to_pack());
+  }
   data[0] *= oth.x();
   data[1] *= oth.y();
   data[2] *= oth.z();
@@ -142,6 +167,9 @@ constexpr Vec<4, NumT>& Vec<4, NumT>::operator*=(const Vec4<NumT>& oth) noexcept
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr Vec<4, NumT>& Vec<4, NumT>::operator/=(const Vec4<NumT>& oth) noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return *this = FromPack(to_pack() / oth.to_pack());
+  }
   data[0] /= oth.x();
   data[1] /= oth.y();
   data[2] /= oth.z();
@@ -164,13 +192,36 @@ constexpr bool Vec<4, NumT>::operator!=(const Vec<4, NumT>& oth) const noexcept
 }
 
 // ----- ----- ---- Linear Algebra Operations ----- ----- ----
+namespace detail {
+
+// the lanes of a * b summed left to right as in the constexpr path (simd::hsum
+// adds them pairwise):
+template<typename NumT>
+NumT dot_native(const simd::Pack<NumT, 4>& a, const simd::Pack<NumT, 4>& b) noexcept {
+  const simd::Pack<NumT, 4> products = a * b;
+  const simd::Pack<NumT, 4> sum = products + simd::shuffle<1, 1, 1, 1>(products) +
+    simd::shuffle<2, 2, 2, 2>(products) + simd::shuffle<3, 3, 3, 3>(products);
+  return sum[0];
+}
+
+} // namespace detail
+
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 constexpr NumT Vec<4, NumT>::dot(const Vec4<NumT>& oth) const noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return detail::dot_native(to_pack(), oth.to_pack());
+  }
   return x() * oth.x() + y() * oth.y() + z() * oth.z() + w() * oth.w();
 }
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
+template<Precision P>
 NumT Vec<4, NumT>::length() const {
+  if constexpr (detail::uses_rsqrt<P, NumT>) {
+    const NumT len_sq = length_squared();
+    if (std::isnormal(len_sq)) [[likely]] return len_sq * detail::rsqrt<P>(len_sq);
+    return length<Precision::Exact>();
+  }
   return std::sqrt(length_squared());
 }
 
@@ -180,7 +231,21 @@ constexpr NumT Vec<4, NumT>::length_squared() const noexcept {
 }
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
+template<Precision P>
 Vec4<NumT> Vec<4, NumT>::normalize() const {
+  if constexpr (detail::uses_rsqrt<P, NumT>) {
+    const NumT len_sq = length_squared();
+    if (std::isnormal(len_sq)) [[likely]] return *this * detail::rsqrt<P>(len_sq);
+    return normalize<Precision::Exact>();
+  }
+  if constexpr (simd::IsNative<NumT, 4>) {
+    const simd::Pack<NumT, 4> vec = to_pack();
+    const NumT len = std::sqrt(dot(*this));
+    if (len > NumT{0}) {
+      return FromPack(vec / len);
+    }
+    return *this;
+  }
   NumT len = length();
   if (len > NumT{0}) {
     return *this / len;
@@ -229,29 +294,57 @@ constexpr const NumT& Vec<4, NumT>::get() const noexcept {
   else if constexpr (Index == 3) return w();
 }
 
+// ----- ----- ---- SIMD interop ----- ----- ----
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+simd::Pack<NumT, 4> Vec<4, NumT>::to_pack() const noexcept {
+  return simd::Pack<NumT, 4>::Load(data.data());
+}
+
+template<typename NumT> requires (detail::ValidNumType<NumT>)
+Vec4<NumT> Vec<4, NumT>::FromPack(const simd::Pack<NumT, 4>& pack) noexcept {
+  Vec4<NumT> vec;
+  pack.store(vec.data.data());
+  return vec;
+}
+
 // ----- ----- ---- Binary operators ----- ----- ----
 template<typename NumT>
 constexpr Vec4<NumT> operator+(const Vec4<NumT>& a, const Vec4<NumT>& b) noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return Vec4<NumT>::FromPack(a.to_pack() + b.to_pack());
+  }
   return Vec4<NumT>{a.x() + b.x(), a.y() + b.y(), a.z() + b.z(), a.w() + b.w()};
 }
 
 template<typename NumT>
 constexpr Vec4<NumT> operator-(const Vec4<NumT>& a, const Vec4<NumT>& b) noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return Vec4<NumT>::FromPack(a.to_pack() - b.to_pack());
+  }
   return Vec4<NumT>{a.x() - b.x(), a.y() - b.y(), a.z() - b.z(), a.w() - b.w()};
 }
 
 template<typename NumT>
 constexpr Vec4<NumT> operator*(const Vec4<NumT>& a, const Vec4<NumT>& b) noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return Vec4<NumT>::FromPack(a.to_pack() * b.to_pack());
+  }
   return Vec4<NumT>{a.x() * b.x(), a.y() * b.y(), a.z() * b.z(), a.w() * b.w()};
 }
 
 template<typename NumT>
 constexpr Vec4<NumT> operator/(const Vec4<NumT>& a, const Vec4<NumT>& b) noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return Vec4<NumT>::FromPack(a.to_pack() / b.to_pack());
+  }
   return Vec4<NumT>{a.x() / b.x(), a.y() / b.y(), a.z() / b.z(), a.w() / b.w()};
 }
 
 template<typename NumT>
 constexpr Vec4<NumT> operator*(const Vec4<NumT>& vec, NumT scalar) noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return Vec4<NumT>::FromPack(vec.to_pack() * scalar);
+  }
   return Vec4<NumT>{vec.x() * scalar, vec.y() * scalar, vec.z() * scalar, vec.w() * scalar};
 }
 
@@ -262,6 +355,9 @@ constexpr Vec4<NumT> operator*(NumT scalar, const Vec4<NumT>& vec) noexcept {
 
 template<typename NumT>
 constexpr Vec4<NumT> operator/(const Vec4<NumT>& vec, NumT scalar) noexcept {
+  if constexpr (simd::IsNative<NumT, 4>) {
+    if (!std::is_constant_evaluated()) return Vec4<NumT>::FromPack(vec.to_pack() / scalar);
+  }
   return Vec4<NumT>{vec.x() / scalar, vec.y() / scalar, vec.z() / scalar, vec.w() / scalar};
 }
 
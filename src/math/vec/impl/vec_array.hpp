@@ -0,0 +1,410 @@
+#pragma once
+
+#include <algorithm>
+
+#include "../vec_array.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- VecRef ---- ----- -----
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr VecRef<N, NumT>::VecRef(NumT* first, size_t step) noexcept : first(first), step(step) {}
+
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT& VecRef<N, NumT>::x() const noexcept { return first[0]; }
+
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT& VecRef<N, NumT>::y() const noexcept { return first[step]; }
+
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT& VecRef<N, NumT>::z() const noexcept requires (N >= 3) { return first[2 * step]; }
+
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT& VecRef<N, NumT>::w() const noexcept requires (N >= 4) { return first[3 * step]; }
+
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr NumT& VecRef<N, NumT>::operator[](size_t index) const noexcept { return first[index * step]; }
+
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr Vec<N, NumT> VecRef<N, NumT>::value() const noexcept {
+  Vec<N, NumT> vec;
+  for (size_t c = 0; c < N; ++c) vec[c] = first[c * step];
+  return vec;
+}
+
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr VecRef<N, NumT>::operator Vec<N, NumT>() const noexcept { return value(); }
+
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr VecRef<N, NumT>& VecRef<N, NumT>::operator=(const Vec<N, NumT>& vec) noexcept {
+  for (size_t c = 0; c < N; ++c) first[c * step] = vec[c];
+  return *this;
+}
+
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr VecRef<N, NumT>& VecRef<N, NumT>::operator=(const VecRef& oth) noexcept {
+  return *this = oth.value();
+}
+
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr VecRef<N, NumT>& VecRef<N, NumT>::operator+=(const Vec<N, NumT>& vec) noexcept {
+  for (size_t c = 0; c < N; ++c) first[c * step] += vec[c];
+  return *this;
+}
+
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr VecRef<N, NumT>& VecRef<N, NumT>::operator-=(const Vec<N, NumT>& vec) noexcept {
+  for (size_t c = 0; c < N; ++c) first[c * step] -= vec[c];
+  return *this;
+}
+
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr VecRef<N, NumT>& VecRef<N, NumT>::operator*=(NumT scalar) noexcept {
+  for (size_t c = 0; c < N; ++c) first[c * step] *= scalar;
+  return *this;
+}
+
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+constexpr bool VecRef<N, NumT>::operator==(const Vec<N, NumT>& vec) const noexcept {
+  return value() == vec;
+}
+
+// ----- ----- ---- Constructors ---- ----- -----
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+VecArray<N, NumT, L>::VecArray(size_t count, const value_type& value) {
+  resize(count, value);
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+VecArray<N, NumT, L>::VecArray(std::span<const value_type> values) {
+  grow(values.size());
+  for (size_t i = 0; i < values.size(); ++i) set(i, values[i]);
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+template<Layout Other>
+VecArray<N, NumT, L>::VecArray(const VecArray<N, NumT, Other>& oth) {
+  grow(oth.size());
+  size_t i = 0;
+  if constexpr (has_packets && VecArray<N, NumT, Other>::has_packets) {
+    for (; i + lanes <= count; i += lanes) set_packet(i, oth.packet(i));
+  }
+  for (; i < count; ++i) set(i, oth.get(i));
+}
+
+// ----- ----- ---- Capacity ---- ----- -----
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+size_t VecArray<N, NumT, L>::size() const noexcept { return count; }
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+bool VecArray<N, NumT, L>::empty() const noexcept { return count == 0; }
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+size_t VecArray<N, NumT, L>::capacity() const noexcept {
+  if constexpr (L == Layout::AoS) return storage.capacity();
+  else if constexpr (L == Layout::SoA) return stride;
+  else return storage.capacity() / N;
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+void VecArray<N, NumT, L>::reserve(size_t capacity) {
+  if constexpr (L == Layout::AoS) {
+    storage.reserve(capacity);
+  } else if constexpr (L == Layout::SoA) {
+    if (capacity <= stride) return;
+    // every component moves, the distance between them changes:
+    const size_t new_stride = (capacity + soa_pad - 1) / soa_pad * soa_pad;
+    storage_type relaid(N * new_stride);
+    for (size_t c = 0; c < N; ++c) {
+      std::copy_n(storage.data() + c * stride, padded_size(), relaid.data() + c * new_stride);
+    }
+    storage.swap(relaid);
+    stride = new_stride;
+  } else {
+    storage.reserve((capacity + block - 1) / block * block * N);
+  }
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+void VecArray<N, NumT, L>::resize(size_t new_count, const value_type& value) {
+  if constexpr (L == Layout::AoS) {
+    storage.resize(new_count, value);
+    count = new_count;
+  } else {
+    const size_t old_count = count;
+    grow(new_count);
+    // the padding after a shrink holds stale vectors:
+    for (size_t i = old_count; i < new_count; ++i) set(i, value);
+  }
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+void VecArray<N, NumT, L>::push_back(const value_type& value) {
+  grow(count + 1);
+  set(count - 1, value);
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+void VecArray<N, NumT, L>::clear() noexcept {
+  if constexpr (L != Layout::SoA) storage.clear();
+  count = 0;
+}
+
+// ----- ----- ---- Element access ---- ----- -----
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+typename VecArray<N, NumT, L>::reference VecArray<N, NumT, L>::operator[](size_t index) noexcept {
+  if constexpr (L == Layout::AoS) return storage[index];
+  else return VecRef<N, NumT>(storage.data() + offset(index, 0), step());
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+typename VecArray<N, NumT, L>::const_reference VecArray<N, NumT, L>::operator[](size_t index) const noexcept {
+  if constexpr (L == Layout::AoS) return storage[index];
+  else return get(index);
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+typename VecArray<N, NumT, L>::value_type VecArray<N, NumT, L>::get(size_t index) const noexcept {
+  if constexpr (L == Layout::AoS) {
+    return storage[index];
+  } else {
+    value_type value;
+    for (size_t c = 0; c < N; ++c) value[c] = storage[offset(index, c)];
+    return value;
+  }
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+void VecArray<N, NumT, L>::set(size_t index, const value_type& value) noexcept {
+  if constexpr (L == Layout::AoS) {
+    storage[index] = value;
+  } else {
+    for (size_t c = 0; c < N; ++c) storage[offset(index, c)] = value[c];
+  }
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+NumT* VecArray<N, NumT, L>::data() noexcept {
+  if constexpr (L == Layout::AoS) return reinterpret_cast<NumT*>(storage.data());
+  else return storage.data();
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+const NumT* VecArray<N, NumT, L>::data() const noexcept {
+  if constexpr (L == Layout::AoS) return reinterpret_cast<const NumT*>(storage.data());
+  else return storage.data();
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+std::span<typename VecArray<N, NumT, L>::value_type> VecArray<N, NumT, L>::values() noexcept requires (L == Layout::AoS) {
+  return std::span<value_type>(storage.data(), count);
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+std::span<const typename VecArray<N, NumT, L>::value_type> VecArray<N, NumT, L>::values() const noexcept requires (L == Layout::AoS) {
+  return std::span<const value_type>(storage.data(), count);
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+std::span<NumT> VecArray<N, NumT, L>::component(size_t axis) noexcept requires (L == Layout::SoA) {
+  return std::span<NumT>(storage.data() + axis * stride, count);
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+std::span<const NumT> VecArray<N, NumT, L>::component(size_t axis) const noexcept requires (L == Layout::SoA) {
+  return std::span<const NumT>(storage.data() + axis * stride, count);
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+typename VecArray<N, NumT, L>::packet_type VecArray<N, NumT, L>::packet(size_t index) const noexcept requires (has_packets) {
+  packet_type packet;
+  if constexpr (L == Layout::AoS) {
+    simd::load_deinterleave3(data() + 3 * index, packet[0], packet[1], packet[2]);
+  } else {
+    // every component of a packet starts on a multiple of `lanes` in 64-byte aligned storage:
+    for (size_t c = 0; c < N; ++c) packet[c] = pack_type::Load(storage.data() + offset(index, c));
+  }
+  return packet;
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+void VecArray<N, NumT, L>::set_packet(size_t index, const packet_type& packet) noexcept requires (has_packets) {
+  if constexpr (L == Layout::AoS) {
+    simd::store_interleave3(data() + 3 * index, packet[0], packet[1], packet[2]);
+  } else {
+    for (size_t c = 0; c < N; ++c) packet[c].store(storage.data() + offset(index, c));
+  }
+}
+
+// ----- ----- ---- Bulk operations ----- ----- ----
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+VecArray<N, NumT, L>& VecArray<N, NumT, L>::operator+=(const VecArray& oth) noexcept {
+  zip_flat(oth, [](auto& a, const auto& b) { a += b; });
+  return *this;
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+VecArray<N, NumT, L>& VecArray<N, NumT, L>::operator-=(const VecArray& oth) noexcept {
+  zip_flat(oth, [](auto& a, const auto& b) { a -= b; });
+  return *this;
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+VecArray<N, NumT, L>& VecArray<N, NumT, L>::operator*=(NumT scalar) noexcept {
+  const pack_type scalars(scalar);
+  zip_flat(*this, [&](auto& a, const auto&) {
+    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(a)>, pack_type>) a *= scalars;
+    else a *= scalar;
+  });
+  return *this;
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+void VecArray<N, NumT, L>::dot(const VecArray& oth, std::span<NumT> out) const noexcept {
+  size_t i = 0;
+  if constexpr (has_packets) {
+    // AoS stops at the last whole packet, the padded layouts run into the padding:
+    const size_t end = L == Layout::AoS ? count / lanes * lanes : count;
+    for (; i < end; i += lanes) {
+      const packet_type a = packet(i);
+      const packet_type b = oth.packet(i);
+      pack_type products = a[0] * b[0];
+      for (size_t c = 1; c < N; ++c) products = products + a[c] * b[c];
+      if (i + lanes <= count) {
+        products.store_unaligned(out.data() + i);
+      } else {
+        alignas(sizeof(NumT) * lanes) NumT tail[lanes];
+        products.store(tail);
+        std::copy_n(tail, count - i, out.data() + i);
+      }
+    }
+  }
+  for (; i < count; ++i) out[i] = get(i).dot(oth.get(i));
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+template<Precision P>
+void VecArray<N, NumT, L>::normalize() noexcept requires (std::floating_point<NumT>) {
+  if constexpr (!has_packets) {
+    for (value_type& value : storage) value = value.template normalize<P>();
+  } else {
+    // the same steps as Vec3x::normalize() for any N, written out so that they
+    // are inlined into the loop (a call per packet measured 2x slower). The sum
+    // is unfused in the order of Vec::dot, so packets and the tail agree:
+    const size_t tail = for_each_packet([](packet_type& packet) {
+      pack_type len_sq = packet[0] * packet[0];
+      for (size_t c = 1; c < N; ++c) len_sq = len_sq + packet[c] * packet[c];
+      if constexpr (detail::uses_rsqrt<P, NumT>) {
+        // a packet with a lane out of the estimate's range goes the exact way as a whole:
+        if (detail::rsqrt_in_range(len_sq).all()) [[likely]] {
+          const pack_type inv_len = detail::rsqrt<P>(len_sq);
+          for (size_t c = 0; c < N; ++c) packet[c] *= inv_len;
+          return;
+        }
+      }
+      const pack_type len = simd::sqrt(len_sq);
+      const auto non_zero = len > pack_type::Zero();
+      for (size_t c = 0; c < N; ++c) packet[c] = simd::select(non_zero, packet[c] / len, packet[c]);
+    });
+    for (size_t i = tail; i < count; ++i) set(i, get(i).template normalize<P>());
+  }
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+template<TransformAs As>
+void VecArray<N, NumT, L>::transform(const Mat4<NumT>& matrix) noexcept requires (std::floating_point<NumT> && N >= 3) {
+  if constexpr (L == Layout::AoS) {
+    transform_batch<As, NumT>(matrix, values(), values());
+  } else {
+    detail::resolve_transform<As>(matrix, [&]<bool IsPoint, bool Projective>(const Mat4<NumT>& applied) {
+      const detail::BroadcastMat4<lanes, NumT> m(applied);
+      for_each_packet([&](packet_type& packet) {
+        if constexpr (N == 3) {
+          packet = m.template apply<IsPoint, Projective>(packet);
+        } else {
+          const Vec3x<lanes, NumT> xyz(packet[0], packet[1], packet[2]);
+          for (size_t r = 0; r < 4; ++r) packet[r] = m.template row<IsPoint>(r, xyz);
+          if constexpr (Projective) {
+            // w is kept, as by transform_batch:
+            for (size_t c = 0; c < 3; ++c) packet[c] /= packet[3];
+          }
+        }
+      });
+    });
+  }
+}
+
+// ----- ----- ---- Private member funcs ----- ----- ----
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+size_t VecArray<N, NumT, L>::padded_size() const noexcept {
+  if constexpr (L == Layout::AoS) return count;
+  else if constexpr (L == Layout::SoA) return (count + lanes - 1) / lanes * lanes;
+  else return (count + block - 1) / block * block;
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+size_t VecArray<N, NumT, L>::offset(size_t index, size_t axis) const noexcept {
+  if constexpr (L == Layout::AoS) return index * N + axis;
+  else if constexpr (L == Layout::SoA) return axis * stride + index;
+  else return index / block * (block * N) + axis * block + index % block;
+}
+
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+size_t VecArray<N, NumT, L>::step() const noexcept {
+  if constexpr (L == Layout::AoS) return 1;
+  else if constexpr (L == Layout::SoA) return stride;
+  else return block;
+}
+
+// sets size() to `new_count`, new vectors are left for the caller to set:
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+void VecArray<N, NumT, L>::grow(size_t new_count) {
+  if constexpr (L == Layout::AoS) {
+    storage.resize(new_count);
+  } else if constexpr (L == Layout::SoA) {
+    if (new_count > stride) reserve(std::max(new_count, 2 * stride));
+  } else {
+    storage.resize((new_count + block - 1) / block * block * N);
+  }
+  count = new_count;
+}
+
+// op(a, b) for every pack of the flat storage and the pack at the same place in
+// `oth` (AoS: scalars for the tail). Runs over the padding, which is never read back:
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+template<typename Op>
+void VecArray<N, NumT, L>::zip_flat(const VecArray& oth, Op op) noexcept {
+  auto run = [&](NumT* a, const NumT* b, size_t total) {
+    size_t i = 0;
+    for (; i + lanes <= total; i += lanes) {
+      pack_type packed = pack_type::Load(a + i);
+      op(packed, pack_type::Load(b + i));
+      packed.store(a + i);
+    }
+    for (; i < total; ++i) op(a[i], b[i]);
+  };
+  if constexpr (L == Layout::SoA) {
+    for (size_t c = 0; c < N; ++c) run(data() + c * stride, oth.data() + c * oth.stride, padded_size());
+  } else if constexpr (L == Layout::AoS) {
+    run(data(), oth.data(), count * N);
+  } else {
+    run(data(), oth.data(), storage.size());
+  }
+}
+
+// kernel(packet) for every packet, stored back. Returns the first vector left
+// out (AoS: the tail shorter than a packet, otherwise size()):
+template<size_t N, typename NumT, Layout L> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+template<typename Kernel>
+size_t VecArray<N, NumT, L>::for_each_packet(Kernel kernel) noexcept {
+  const size_t end = L == Layout::AoS ? count / lanes * lanes : count;
+  size_t i = 0;
+  for (; i < end; i += lanes) {
+    packet_type packet = this->packet(i);
+    kernel(packet);
+    set_packet(i, packet);
+  }
+  return std::min(i, count);
+}
+
+} // namespace ayan::math
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "vec3.hpp"
+#include "vec3x.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// Unit vector in 4 bytes (a third of a Vec3f): the sphere is projected onto the
+// octahedron |x| + |y| + |z| = 1, the lower half is folded over the upper one
+// and the resulting square is stored as two snorm16 (Cigolle et al. 2014, "A Survey
+// of Efficient Representations for Independent Unit Vectors"). Encode() picks the
+// best of the 4 nearest grid points, the angular error is below 5e-5 rad (0.003 deg).
+// A default constructed OctNormal is +z:
+class OctNormal {
+private: // Fields:
+  int16_t coords[2] = {0, 0}; // u, v in [-32767, 32767];
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  constexpr OctNormal() noexcept = default;
+  constexpr OctNormal(int16_t u, int16_t v) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  // `normal` must not be zero, it doesn't have to be unit:
+  static OctNormal Encode(const Vec3f& normal) noexcept;
+  static constexpr OctNormal FromBits(uint32_t bits) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  constexpr int16_t u() const noexcept;
+  constexpr int16_t v() const noexcept;
+  // u in the low half:
+  constexpr uint32_t bits() const noexcept;
+
+  // the unit vector:
+  Vec3f decode() const noexcept;
+};
+
+// ----- ----- ---- Batch conversion ----- ----- ----
+// out[i] = in[i] converted, `out` must hold at least in.size() elements.
+// decode() unfolds and normalizes a packet of 8 (AVX2) or 4 normals at a time:
+inline void encode(std::span<const Vec3f> in, std::span<OctNormal> out) noexcept;
+inline void decode(std::span<const OctNormal> in, std::span<Vec3f> out) noexcept;
+
+} // namespace ayan::math
+
+#include "impl/octahedral.hpp"
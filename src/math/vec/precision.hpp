@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <type_traits>
+
+#include "../simd/pack.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// Accuracy of length() and normalize(), chosen per call site as a template
+// argument (`v.normalize<Precision::Fast>()`). The max errors for float, measured
+// over every float in [1, 4) (the error pattern repeats for each pair of exponents):
+//   Exact       - std::sqrt and a division, correctly rounded: the default;
+//   Fast        - hardware rsqrt estimate (12 bits) + one Newton step:
+//                 relative error < 2^-21.8, about 4 ulp;
+//   FastRefined - + a second Newton step in correction form:
+//                 < 1 ulp with FMA, < 1.5 ulp without.
+// Vectors whose squared length is 0, subnormal, inf or NaN are handled as in
+// Exact. double and integer vectors have no hardware estimate and always are Exact,
+// as are builds without SSE (where simd::rsqrt itself is exact).
+// The estimate pays off mostly in packets (Vec3x): on recent cores scalar
+// sqrtss + divss are already pipelined well.
+enum class Precision {
+  Exact,
+  Fast,
+  FastRefined
+};
+
+namespace detail {
+
+template<Precision P, typename NumT>
+inline constexpr bool uses_rsqrt = (P != Precision::Exact) && std::is_same_v<NumT, float>;
+
+// a * b + c, fused only where it is a single instruction:
+template<typename NumT> requires (std::floating_point<NumT>)
+AYAN_SIMD_INLINE NumT fmadd(NumT a, NumT b, NumT c) noexcept {
+#if defined(AYAN_SIMD_FMA)
+  return std::fma(a, b, c);
+#else
+  return a * b + c;
+#endif
+}
+
+AYAN_SIMD_INLINE float rsqrt_estimate(float x) noexcept {
+#if defined(AYAN_SIMD_SSE2)
+  return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+#else
+  return 1.0f / std::sqrt(x);
+#endif
+}
+
+// 1 / sqrt(x) for a normal positive `x`, P is Fast or FastRefined:
+template<Precision P>
+AYAN_SIMD_INLINE float rsqrt(float x) noexcept {
+  const float estimate = rsqrt_estimate(x);
+  const float r = estimate * (1.5f - 0.5f * x * estimate * estimate);
+  if constexpr (P == Precision::FastRefined) {
+    const float residual = fmadd(-x * r, r, 1.0f);
+    return fmadd(0.5f * r, residual, r);
+  }
+  return r;
+}
+
+template<Precision P, size_t Lanes>
+AYAN_SIMD_INLINE simd::Pack<float, Lanes> rsqrt(const simd::Pack<float, Lanes>& x) noexcept {
+  using pack_type = simd::Pack<float, Lanes>;
+  const pack_type estimate = simd::rsqrt(x);
+  const pack_type r = estimate * (pack_type(1.5f) - pack_type(0.5f) * x * estimate * estimate);
+  if constexpr (P == Precision::FastRefined) {
+    const pack_type residual = simd::fnmadd(x * r, r, pack_type(1.0f));
+    return simd::fmadd(pack_type(0.5f) * r, residual, r);
+  }
+  return r;
+}
+
+// true for lanes whose squared length can go through the estimate:
+template<size_t Lanes>
+AYAN_SIMD_INLINE simd::Mask<float, Lanes> rsqrt_in_range(const simd::Pack<float, Lanes>& x) noexcept {
+  using pack_type = simd::Pack<float, Lanes>;
+  return (x >= pack_type(std::numeric_limits<float>::min())) & (x <= pack_type(std::numeric_limits<float>::max()));
+}
+
+} // namespace detail
+
+} // namespace ayan::math
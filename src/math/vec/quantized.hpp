@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "vec3.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// Position inside known bounds as 16-bit fixed point per axis, 6 bytes instead of 12:
+struct QuantizedVec3 {
+  uint16_t coords[3];
+};
+
+// Maps positions inside [min, max] to QuantizedVec3 and back. The error is at most
+// half a step, (max - min) / 65535 / 2 per axis (plus float rounding of the decode).
+// Positions outside the bounds are clamped, a flat axis (min == max) decodes to min:
+class PositionQuantizer {
+private: // Fields:
+  Vec3f origin;
+  Vec3f step;     // (max - min) / 65535;
+  Vec3f inv_step; // 1 / step, 0 on a flat axis;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  PositionQuantizer(const Vec3f& min, const Vec3f& max) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  const Vec3f& min() const noexcept;
+  const Vec3f& step_size() const noexcept;
+
+  // ----- ----- ---- Conversion ----- ----- ----
+  QuantizedVec3 encode(const Vec3f& position) const noexcept;
+  Vec3f decode(const QuantizedVec3& position) const noexcept;
+
+  // out[i] = in[i] converted, `out` must hold at least in.size() elements.
+  // decode() converts 8 (AVX2) or 4 positions per step, bit-identical to the scalar one:
+  void encode(std::span<const Vec3f> in, std::span<QuantizedVec3> out) const noexcept;
+  void decode(std::span<const QuantizedVec3> in, std::span<Vec3f> out) const noexcept;
+};
+
+} // namespace ayan::math
+
+#include "impl/quantized.hpp"
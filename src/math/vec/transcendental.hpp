@@ -0,0 +1,50 @@
+#pragma once
+
+#include "vec4.hpp"
+#include "vec3x.hpp"
+#include "../simd/transcendental.hpp"
+
+// Component-wise simd:: transcendental functions (errors are listed in
+// simd/transcendental.hpp). Unlike map(std::sin) every component goes through
+// the same registers: Vec4f is one Pack4f, a Vec3x is three packs.
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// ----- ----- ---- Vec4f ----- ----- ----
+inline Vec4f sin(const Vec4f& vec) noexcept;
+inline Vec4f cos(const Vec4f& vec) noexcept;
+inline simd::SinCos<Vec4f> sincos(const Vec4f& vec) noexcept;
+inline Vec4f exp(const Vec4f& vec) noexcept;
+inline Vec4f log(const Vec4f& vec) noexcept;
+inline Vec4f pow(const Vec4f& vec, const Vec4f& exponents) noexcept;
+inline Vec4f pow(const Vec4f& vec, float exponent) noexcept;
+inline Vec4f atan2(const Vec4f& y, const Vec4f& x) noexcept;
+
+// ----- ----- ---- Vec3x ----- ----- ----
+template<size_t Lanes>
+Vec3x<Lanes, float> sin(const Vec3x<Lanes, float>& vec) noexcept;
+
+template<size_t Lanes>
+Vec3x<Lanes, float> cos(const Vec3x<Lanes, float>& vec) noexcept;
+
+template<size_t Lanes>
+simd::SinCos<Vec3x<Lanes, float>> sincos(const Vec3x<Lanes, float>& vec) noexcept;
+
+template<size_t Lanes>
+Vec3x<Lanes, float> exp(const Vec3x<Lanes, float>& vec) noexcept;
+
+template<size_t Lanes>
+Vec3x<Lanes, float> log(const Vec3x<Lanes, float>& vec) noexcept;
+
+template<size_t Lanes>
+Vec3x<Lanes, float> pow(const Vec3x<Lanes, float>& vec, const Vec3x<Lanes, float>& exponents) noexcept;
+
+template<size_t Lanes>
+Vec3x<Lanes, float> pow(const Vec3x<Lanes, float>& vec, float exponent) noexcept;
+
+template<size_t Lanes>
+Vec3x<Lanes, float> atan2(const Vec3x<Lanes, float>& y, const Vec3x<Lanes, float>& x) noexcept;
+
+} // namespace ayan::math
+
+#include "impl/transcendental.hpp"
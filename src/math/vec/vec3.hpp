@@ -4,8 +4,9 @@
 #include <initializer_list>
 
 #include "fwd.hpp"
+#include "precision.hpp"
 
-namespace ayan::math {
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
 
 template<typename NumT> requires (detail::ValidNumType<NumT>)
 class Vec<3, NumT> {
@@ -37,6 +38,8 @@ public: // Member functions:
   constexpr const NumT& x() const noexcept;
   constexpr const NumT& y() const noexcept;
   constexpr const NumT& z() const noexcept;
+  constexpr NumT& operator[](size_t index) noexcept;
+  constexpr const NumT& operator[](size_t index) const noexcept;
 
   // ----- ----- ---- Operators ----- ----- ----
   // unary:
@@ -58,8 +61,11 @@ public: // Member functions:
 
   // ----- ----- ---- Linear Algebra Operations ----- ----- ----
   constexpr NumT dot(const Vec& oth) const noexcept;
+  // see Precision for the accuracy of the fast paths:
+  template<Precision P = Precision::Exact>
   NumT length() const noexcept;
   constexpr NumT length_squared() const noexcept;
+  template<Precision P = Precision::Exact>
   Vec normalize() const noexcept;
   NumT distance(const Vec& oth) const noexcept;
   constexpr NumT distance_squared(const Vec& oth) const noexcept;
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+#include "fwd.hpp"
+#include "vec3.hpp"
+#include "precision.hpp"
+#include "../simd/pack.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// SoA packet of Vec3: lane `i` of x(), y(), z() is the i-th vector.
+// One operation on a packet processes `Lanes` vectors at once
+// (8 rays per AVX instruction with Vec3x8f):
+template<size_t Lanes, typename NumT> requires (detail::ValidNumType<NumT>)
+class Vec3x {
+public: // Types:
+  using pack_type = simd::Pack<NumT, Lanes>;
+  using mask_type = simd::Mask<NumT, Lanes>;
+  static constexpr size_t lanes = Lanes;
+
+private: // Fields:
+  pack_type x_lanes;
+  pack_type y_lanes;
+  pack_type z_lanes;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  Vec3x() noexcept;
+  Vec3x(const pack_type& x, const pack_type& y, const pack_type& z) noexcept;
+  // the same vector in every lane:
+  explicit Vec3x(const Vec3<NumT>& vec) noexcept;
+
+  // ----- ----- ---- Static member funcs ---- ----- -----
+  static Vec3x Zero() noexcept;
+  static Vec3x Broadcast(const Vec3<NumT>& vec) noexcept;
+
+  // `Lanes` consecutive vectors starting at `src` (AoS -> SoA):
+  static Vec3x Load(const Vec3<NumT>* src) noexcept;
+  // lane `i` is src[i * stride], one member of an array of structs (AABB corners, Triangle vertices):
+  static Vec3x LoadStrided(const Vec3<NumT>* src, size_t stride) noexcept;
+  // lane `i` is loaded from base[indices[i]]:
+  static Vec3x Gather(const Vec3<NumT>* base, const int32_t* indices) noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  pack_type& x() noexcept;
+  pack_type& y() noexcept;
+  pack_type& z() noexcept;
+  const pack_type& x() const noexcept;
+  const pack_type& y() const noexcept;
+  const pack_type& z() const noexcept;
+  // component `axis` of all lanes (0 - x, 1 - y, 2 - z):
+  pack_type& operator[](size_t axis) noexcept;
+  const pack_type& operator[](size_t axis) const noexcept;
+
+  Vec3<NumT> lane(size_t index) const noexcept;
+  void set_lane(size_t index, const Vec3<NumT>& vec) noexcept;
+
+  // `Lanes` consecutive vectors starting at `dst` (SoA -> AoS):
+  void store(Vec3<NumT>* dst) const noexcept;
+  // lane `i` is stored to base[indices[i]], only lanes set in `mask` if it is given:
+  void scatter(Vec3<NumT>* base, const int32_t* indices) const noexcept;
+  void scatter(Vec3<NumT>* base, const int32_t* indices, const mask_type& mask) const noexcept;
+
+  // ----- ----- ---- Operators ----- ----- ----
+  // unary:
+  Vec3x operator-() const noexcept;
+
+  // with assignment:
+  Vec3x& operator+=(const Vec3x& oth) noexcept;
+  Vec3x& operator-=(const Vec3x& oth) noexcept;
+  Vec3x& operator*=(const pack_type& scalars) noexcept;
+  Vec3x& operator/=(const pack_type& scalars) noexcept;
+  Vec3x& operator*=(const Vec3x& oth) noexcept;
+  Vec3x& operator/=(const Vec3x& oth) noexcept;
+
+  // comparing (per lane):
+  mask_type operator==(const Vec3x& oth) const noexcept;
+  mask_type operator!=(const Vec3x& oth) const noexcept;
+
+  // ----- ----- ---- Linear Algebra Operations ----- ----- ----
+  pack_type dot(const Vec3x& oth) const noexcept;
+  // see Precision for the accuracy of the fast paths:
+  template<Precision P = Precision::Exact>
+  pack_type length() const noexcept;
+  pack_type length_squared() const noexcept;
+  template<Precision P = Precision::Exact>
+  Vec3x normalize() const noexcept;
+  pack_type distance(const Vec3x& oth) const noexcept;
+  pack_type distance_squared(const Vec3x& oth) const noexcept;
+  Vec3x cross(const Vec3x& oth) const noexcept;
+  pack_type triple(const Vec3x& b, const Vec3x& c) const noexcept;
+};
+
+// ----- ----- ---- Binary operators ----- ----- ----
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator+(const Vec3x<Lanes, NumT>& a, const Vec3x<Lanes, NumT>& b) noexcept;
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator-(const Vec3x<Lanes, NumT>& a, const Vec3x<Lanes, NumT>& b) noexcept;
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator*(const Vec3x<Lanes, NumT>& a, const Vec3x<Lanes, NumT>& b) noexcept;
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator/(const Vec3x<Lanes, NumT>& a, const Vec3x<Lanes, NumT>& b) noexcept;
+
+// per-lane scalars:
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator*(const Vec3x<Lanes, NumT>& vec, const simd::Pack<NumT, Lanes>& scalars) noexcept;
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator*(const simd::Pack<NumT, Lanes>& scalars, const Vec3x<Lanes, NumT>& vec) noexcept;
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator/(const Vec3x<Lanes, NumT>& vec, const simd::Pack<NumT, Lanes>& scalars) noexcept;
+
+// one scalar for all lanes:
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator*(const Vec3x<Lanes, NumT>& vec, std::type_identity_t<NumT> scalar) noexcept;
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator*(std::type_identity_t<NumT> scalar, const Vec3x<Lanes, NumT>& vec) noexcept;
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> operator/(const Vec3x<Lanes, NumT>& vec, std::type_identity_t<NumT> scalar) noexcept;
+
+// ----- ----- ---- Lane selection ----- ----- ----
+// mask[i] ? if_true.lane(i) : if_false.lane(i) for every lane:
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> select(const simd::Mask<NumT, Lanes>& mask,
+  const Vec3x<Lanes, NumT>& if_true, const Vec3x<Lanes, NumT>& if_false) noexcept;
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> min(const Vec3x<Lanes, NumT>& a, const Vec3x<Lanes, NumT>& b) noexcept;
+
+template<size_t Lanes, typename NumT>
+Vec3x<Lanes, NumT> max(const Vec3x<Lanes, NumT>& a, const Vec3x<Lanes, NumT>& b) noexcept;
+
+} // namespace ayan::math
+
+#include "impl/vec3x.hpp"
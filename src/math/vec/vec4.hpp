@@ -4,8 +4,10 @@
 #include <initializer_list>
 
 #include "fwd.hpp"
+#include "precision.hpp"
+#include "../simd/pack.hpp"
 
-namespace ayan::math {
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
 
 // 4-dimensional vector:
 template<typename NumT> requires (detail::ValidNumType<NumT>)
@@ -44,6 +46,8 @@ public: // Member functions:
   constexpr const NumT& y() const noexcept;
   constexpr const NumT& z() const noexcept;
   constexpr const NumT& w() const noexcept;
+  constexpr NumT& operator[](size_t index) noexcept;
+  constexpr const NumT& operator[](size_t index) const noexcept;
 
   // ----- ----- ---- Operators ----- ----- ----
   // unary:
@@ -65,8 +69,11 @@ public: // Member functions:
 
   // ----- ----- ---- Linear Algebra Operations ----- ----- ----
   constexpr NumT dot(const Vec4<NumT>& oth) const noexcept;
+  // see Precision for the accuracy of the fast paths:
+  template<Precision P = Precision::Exact>
   NumT length() const;
   constexpr NumT length_squared() const noexcept;
+  template<Precision P = Precision::Exact>
   Vec4<NumT> normalize() const;
   NumT distance(const Vec4<NumT>& oth) const;
   constexpr NumT distance_squared(const Vec4<NumT>& oth) const noexcept;
@@ -81,6 +88,11 @@ public: // Member functions:
 
   template <size_t Index>
   constexpr const NumT& get() const noexcept;
+
+  // ----- ----- ---- SIMD interop ----- ----- ----
+  // Vec4f and Vec4d are aligned to the register width, so these are single loads/stores:
+  simd::Pack<NumT, 4> to_pack() const noexcept;
+  static Vec FromPack(const simd::Pack<NumT, 4>& pack) noexcept;
 };
 
 // ----- ----- ---- Binary operators ----- ----- ----
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "fwd.hpp"
+#include "vec2.hpp"
+#include "vec3.hpp"
+#include "vec4.hpp"
+#include "vec3x.hpp"
+#include "precision.hpp"
+#include "../detail/aligned_allocator.hpp"
+#include "../transform/batch.hpp"
+
+namespace ayan::math::inline AYAN_SIMD_NAMESPACE {
+
+// Memory layout of a VecArray:
+enum class Layout {
+  AoS,  // x0 y0 z0 x1 y1 z1 ...      - Vec<N, NumT> one after another;
+  SoA,  // x0 x1 ... | y0 y1 ... | ... - one array per component;
+  AoSoA // x0..x7 y0..y7 z0..z7 | x8.. - SoA blocks of 8 vectors;
+};
+
+// One vector of a SoA/AoSoA VecArray, component `c` lives at first[c * step].
+// Reads and assigns like Vec<N, NumT> (as std::vector<bool>::reference does for bool):
+template<size_t N, typename NumT> requires (detail::ValidNumType<NumT>)
+class VecRef {
+private: // Fields:
+  NumT* first;
+  size_t step;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  constexpr VecRef(NumT* first, size_t step) noexcept;
+  VecRef(const VecRef&) noexcept = default;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  constexpr NumT& x() const noexcept;
+  constexpr NumT& y() const noexcept;
+  constexpr NumT& z() const noexcept requires (N >= 3);
+  constexpr NumT& w() const noexcept requires (N >= 4);
+  constexpr NumT& operator[](size_t index) const noexcept;
+
+  constexpr Vec<N, NumT> value() const noexcept;
+  constexpr operator Vec<N, NumT>() const noexcept;
+
+  // ----- ----- ---- Operators ----- ----- ----
+  // assign the referenced components, not the reference:
+  constexpr VecRef& operator=(const Vec<N, NumT>& vec) noexcept;
+  constexpr VecRef& operator=(const VecRef& oth) noexcept;
+
+  constexpr VecRef& operator+=(const Vec<N, NumT>& vec) noexcept;
+  constexpr VecRef& operator-=(const Vec<N, NumT>& vec) noexcept;
+  constexpr VecRef& operator*=(NumT scalar) noexcept;
+
+  constexpr bool operator==(const Vec<N, NumT>& vec) const noexcept;
+};
+
+// Growable array of Vec<N, NumT> (vertex buffers, framebuffers, ray queues) in
+// 64-byte aligned storage, the layout is chosen at compile time. AoS hands out
+// Vec<N, NumT>& as std::vector does, SoA and AoSoA hand out VecRef proxies.
+// Bulk operations work on packets of `lanes` vectors (8 for float with AVX, 4 otherwise):
+// SoA/AoSoA storage is padded to whole packets and has no scalar tail, AoS Vec3
+// packets are deinterleaved and AoS Vec2/Vec4 go one Vec at a time.
+// Converting between layouts is an explicit copy: VecArray<3, float, Layout::SoA>(aos).
+template<size_t N, typename NumT, Layout L = Layout::SoA> requires (detail::ValidNumType<NumT> && N >= 2 && N <= 4)
+class VecArray {
+public: // Types:
+  static constexpr Layout layout = L;
+  static constexpr size_t lanes = simd::IsNative<NumT, 8> ? 8 : 4;
+  static constexpr size_t block = 8; // vectors per AoSoA block
+
+  using value_type = Vec<N, NumT>;
+  using reference = std::conditional_t<L == Layout::AoS, value_type&, VecRef<N, NumT>>;
+  using const_reference = std::conditional_t<L == Layout::AoS, const value_type&, value_type>;
+  using pack_type = simd::Pack<NumT, lanes>;
+  // `lanes` vectors, one pack per component (Vec3x for N == 3):
+  using packet_type = std::conditional_t<N == 3, Vec3x<lanes, NumT>, std::array<pack_type, N>>;
+
+  // packet()/set_packet() exist for every layout except AoS Vec2/Vec4:
+  static constexpr bool has_packets = (L != Layout::AoS || N == 3);
+
+private: // Types:
+  static_assert(L != Layout::AoS || sizeof(value_type) == N * sizeof(NumT), "AoS vectors must be tightly packed");
+  // SoA components start on a cache line:
+  static constexpr size_t soa_pad = 64 / sizeof(NumT);
+  static_assert(soa_pad % block == 0 && block % lanes == 0);
+
+  using storage_type = std::conditional_t<L == Layout::AoS,
+    std::vector<value_type, detail::AlignedAllocator<value_type>>,
+    std::vector<NumT, detail::AlignedAllocator<NumT>>>;
+
+private: // Fields:
+  storage_type storage;
+  size_t count = 0;
+  size_t stride = 0; // SoA: distance between two components, the capacity;
+
+public: // Member functions:
+  // ----- ----- ---- Constructors ---- ----- -----
+  VecArray() noexcept = default;
+  explicit VecArray(size_t count, const value_type& value = value_type());
+  explicit VecArray(std::span<const value_type> values);
+  // the same vectors in another layout:
+  template<Layout Other>
+  explicit VecArray(const VecArray<N, NumT, Other>& oth);
+
+  // ----- ----- ---- Capacity ---- ----- -----
+  size_t size() const noexcept;
+  bool empty() const noexcept;
+  size_t capacity() const noexcept;
+  void reserve(size_t capacity);
+  void resize(size_t new_count, const value_type& value = value_type());
+  void push_back(const value_type& value);
+  void clear() noexcept;
+
+  // ----- ----- ---- Element access ---- ----- -----
+  reference operator[](size_t index) noexcept;
+  const_reference operator[](size_t index) const noexcept;
+  value_type get(size_t index) const noexcept;
+  void set(size_t index, const value_type& value) noexcept;
+
+  // the raw storage, see Layout (SoA: component `c` starts at data() + c * capacity()):
+  NumT* data() noexcept;
+  const NumT* data() const noexcept;
+  std::span<value_type> values() noexcept requires (L == Layout::AoS);
+  std::span<const value_type> values() const noexcept requires (L == Layout::AoS);
+  // component `axis` of every vector:
+  std::span<NumT> component(size_t axis) noexcept requires (L == Layout::SoA);
+  std::span<const NumT> component(size_t axis) const noexcept requires (L == Layout::SoA);
+
+  // `lanes` vectors starting at `index`, a multiple of `lanes`. The lanes past
+  // size() are padding (SoA/AoSoA), AoS needs index + lanes <= size():
+  packet_type packet(size_t index) const noexcept requires (has_packets);
+  void set_packet(size_t index, const packet_type& packet) noexcept requires (has_packets);
+
+  // ----- ----- ---- Bulk operations ----- ----- ----
+  // element-wise, `oth` has the same size():
+  VecArray& operator+=(const VecArray& oth) noexcept;
+  VecArray& operator-=(const VecArray& oth) noexcept;
+  VecArray& operator*=(NumT scalar) noexcept;
+
+  // out[i] = get(i).dot(oth.get(i)), `out` holds at least size() values:
+  void dot(const VecArray& oth, std::span<NumT> out) const noexcept;
+  // every vector in place, zero vectors are left unchanged (see Precision,
+  // AoS Vec2/Vec4 are always Exact):
+  template<Precision P = Precision::Exact>
+  void normalize() noexcept requires (std::floating_point<NumT>);
+  // every vector in place as by transform_batch (Vec4 keeps the resulting w):
+  template<TransformAs As>
+  void transform(const Mat4<NumT>& matrix) noexcept requires (std::floating_point<NumT> && N >= 3);
+
+private: // Member functions:
+  size_t padded_size() const noexcept;
+  size_t offset(size_t index, size_t axis) const noexcept;
+  size_t step() const noexcept;
+  void grow(size_t new_count);
+  template<typename Op>
+  void zip_flat(const VecArray& oth, Op op) noexcept;
+  template<typename Kernel>
+  size_t for_each_packet(Kernel kernel) noexcept;
+};
+
+template<size_t N, typename NumT>
+using VecArrayAoS = VecArray<N, NumT, Layout::AoS>;
+
+template<size_t N, typename NumT>
+using VecArraySoA = VecArray<N, NumT, Layout::SoA>;
+
+template<size_t N, typename NumT>
+using VecArrayAoSoA = VecArray<N, NumT, Layout::AoSoA>;
+
+} // namespace ayan::math
+
+#include "impl/vec_array.hpp"
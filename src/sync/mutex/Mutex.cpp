@@ -13,21 +13,14 @@ void Mutex::lock() noexcept {
     return; // fast way - successful locked;
   }
 
-  // slow way - mutex is already locked:
-  while (true) {
-    if (expected == MutexState::Locked || expected == MutexState::Contended) {
-      // atomically set `Contended` and check before waiting:
-      if (state.compare_exchange_strong(expected, MutexState::Contended, std::memory_order_acquire)) {
-          // now we are guaranteed to be waiting on `Contended` state:
-          detail::futex_wait(reinterpret_cast<int*>(&state), static_cast<int>(MutexState::Contended));
-      }
-    }
-
-    // trying to lock the mutex again:
-    expected = MutexState::Unlocked;
-    if (state.compare_exchange_strong(expected, MutexState::Locked, std::memory_order_acquire)) {
-      return;
-    }
+  // slow way - mutex is already locked. The lock is taken as `Contended` from now on:
+  // other waiters may still sleep on the futex, and unlock() must wake one of them:
+  if (expected != MutexState::Contended) {
+    expected = state.exchange(MutexState::Contended, std::memory_order_acquire);
+  }
+  while (expected != MutexState::Unlocked) {
+    detail::futex_wait(reinterpret_cast<int*>(&state), static_cast<int>(MutexState::Contended));
+    expected = state.exchange(MutexState::Contended, std::memory_order_acquire);
   }
 }
 
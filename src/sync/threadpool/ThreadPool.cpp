@@ -0,0 +1,124 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace ayan::sync {
+
+// ------------------------- ThreadPool Public Methods -------------------------
+
+ThreadPool::ThreadPool(size_t threads_count) {
+  if (threads_count == 0) {
+    threads_count = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  workers.reserve(threads_count);
+  for (size_t i = 0; i < threads_count; ++i) {
+    workers.emplace_back([this] { worker_routine(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  mutex.lock();
+  stopping = true;
+  has_tasks.notify_all();
+  mutex.unlock();
+
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+}
+
+size_t ThreadPool::size() const noexcept {
+  return workers.size();
+}
+
+void ThreadPool::submit(Task task) {
+  mutex.lock();
+  tasks.push_back(std::move(task));
+  // notifying under the lock: a worker between its queue check and wait() holds the mutex:
+  has_tasks.notify_one();
+  mutex.unlock();
+}
+
+void ThreadPool::wait(WaitGroup& wg) {
+  // the tasks `wg` waits for may sit in the queue behind others, and the
+  // workers may all be waiting like this thread:
+  while (!wg.try_wait()) {
+    if (!try_run_task()) {
+      // every task of `wg` is taken, none can wait for this thread:
+      wg.wait();
+      return;
+    }
+  }
+}
+
+void ThreadPool::parallel_for(size_t count, size_t grain, const RangeTask& func) {
+  if (count == 0) return;
+  grain = std::max<size_t>(grain, 1);
+
+  // at most one chunk per worker plus one for the calling thread:
+  const size_t chunks = std::min((count + grain - 1) / grain, workers.size() + 1);
+  if (chunks <= 1) {
+    func(0, count);
+    return;
+  }
+
+  const size_t chunk_size = (count + chunks - 1) / chunks;
+  WaitGroup wg;
+  wg.add(chunks - 1);
+  for (size_t chunk = 1; chunk < chunks; ++chunk) {
+    const size_t begin = chunk * chunk_size;
+    const size_t end = std::min(begin + chunk_size, count);
+    submit([&func, &wg, begin, end] {
+      if (begin < end) func(begin, end);
+      wg.done();
+    });
+  }
+
+  func(0, std::min(chunk_size, count));
+  wait(wg);
+}
+
+ThreadPool& ThreadPool::Global() {
+  static ThreadPool pool;
+  return pool;
+}
+
+// ------------------------- ThreadPool Private Methods -------------------------
+
+void ThreadPool::worker_routine() {
+  while (true) {
+    mutex.lock();
+    while (tasks.empty() && !stopping) {
+      has_tasks.wait(mutex);
+    }
+    if (tasks.empty()) {
+      // stopping and nothing left to do:
+      mutex.unlock();
+      return;
+    }
+
+    Task task = std::move(tasks.front());
+    tasks.pop_front();
+    mutex.unlock();
+
+    task();
+  }
+}
+
+bool ThreadPool::try_run_task() {
+  mutex.lock();
+  if (tasks.empty()) {
+    mutex.unlock();
+    return false;
+  }
+  Task task = std::move(tasks.front());
+  tasks.pop_front();
+  mutex.unlock();
+
+  task();
+  return true;
+}
+
+} // namespace ayan::sync;
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "../mutex/Mutex.hpp"
+#include "../condvar/CondVar.hpp"
+#include "../waitgroup/WaitGroup.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace ayan::sync {
+
+// Fixed set of worker threads taking tasks from one shared FIFO queue:
+class ThreadPool {
+public: // types:
+  using Task = std::function<void()>;
+  // processes items [begin, end):
+  using RangeTask = std::function<void(size_t begin, size_t end)>;
+
+private: // fields:
+  std::vector<std::thread> workers;
+  std::deque<Task> tasks;
+  Mutex mutex;
+  ConditionVar has_tasks;
+  bool stopping = false;
+
+public: // methods:
+  // `threads_count == 0` means one worker per hardware thread:
+  explicit ThreadPool(size_t threads_count = 0);
+  // queued tasks are finished before the workers are joined:
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  size_t size() const noexcept;
+  void submit(Task task);
+
+  // runs queued tasks on the calling thread until `wg` is done, then blocks
+  // for the ones still running elsewhere. The tasks of `wg` are submitted
+  // before; safe from a task of this pool:
+  void wait(WaitGroup& wg);
+
+  // splits [0, count) into chunks of at least `grain` items and returns once
+  // every chunk is processed. The calling thread takes the first chunk itself,
+  // then wait()s, so it may be a task of this pool. `func` must not throw:
+  void parallel_for(size_t count, size_t grain, const RangeTask& func);
+
+  // process-wide pool, created on first use:
+  static ThreadPool& Global();
+
+private: // methods:
+  void worker_routine();
+  // pops and runs the front task, false if there is none:
+  bool try_run_task();
+}; // class ThreadPool;
+
+} // namespace ayan::sync;
@@ -25,4 +25,13 @@ void WaitGroup::wait() {
   mutex.unlock();
 }
 
+bool WaitGroup::try_wait() noexcept {
+  // under the mutex like wait(): the last done() may still hold it
+  // when the waiter goes on to destroy the group:
+  mutex.lock();
+  const bool is_zero = counter.load(std::memory_order_acquire) == 0;
+  mutex.unlock();
+  return is_zero;
+}
+
 } // namespace ayan::sync;
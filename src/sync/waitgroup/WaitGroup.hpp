@@ -17,6 +17,8 @@ public: // methods:
   void add(size_t count);
   void done();
   void wait();
+  // true if wait() would return at once:
+  bool try_wait() noexcept;
 }; // class WaitGroup;
 
 } // namespace ayan::sync;
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/geometry.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+TEST(RayTest, PrecomputesInverseAndSigns) {
+  const Rayf ray(Vec3f(1, 2, 3), Vec3f(2, -4, 0));
+
+  EXPECT_EQ(ray.inv_direction().x(), 0.5f);
+  EXPECT_EQ(ray.inv_direction().y(), -0.25f);
+  EXPECT_EQ(ray.inv_direction().z(), std::numeric_limits<float>::infinity());
+  EXPECT_EQ(ray.sign(0), 0u);
+  EXPECT_EQ(ray.sign(1), 1u);
+  EXPECT_EQ(ray.sign(2), 0u);
+  EXPECT_EQ(ray.at(2.0f), Vec3f(5, -6, 3));
+
+  // -0 keeps its sign, so the entry corner is the max one:
+  EXPECT_EQ(Rayf(Vec3f(), Vec3f(1, 1, -0.0f)).sign(2), 1u);
+}
+
+TEST(AABBTest, ExtendAndProperties) {
+  AABBf box;
+  EXPECT_TRUE(box.is_empty());
+  EXPECT_EQ(box.surface_area(), 0.0f);
+
+  box.extend(Vec3f(1, 2, 3)).extend(Vec3f(-1, 0, 7));
+  EXPECT_FALSE(box.is_empty());
+  EXPECT_EQ(box.min(), Vec3f(-1, 0, 3));
+  EXPECT_EQ(box.max(), Vec3f(1, 2, 7));
+  EXPECT_EQ(box.center(), Vec3f(0, 1, 5));
+  EXPECT_EQ(box.surface_area(), 2.0f * (2 * 2 + 2 * 4 + 4 * 2));
+  EXPECT_EQ(box.largest_axis(), 2u);
+  EXPECT_TRUE(box.contains(Vec3f(0, 1, 5)));
+  EXPECT_FALSE(box.contains(Vec3f(0, 3, 5)));
+
+  const AABBf merged = merge(box, AABBf(Vec3f(0, 0, 0), Vec3f(5, 1, 1)));
+  EXPECT_EQ(merged.min(), Vec3f(-1, 0, 0));
+  EXPECT_EQ(merged.max(), Vec3f(5, 2, 7));
+}
+
+TEST(AABBTest, ScalarSlabTest) {
+  const AABBf box(Vec3f(-1, -1, -1), Vec3f(1, 1, 1));
+  float t = 0.0f;
+
+  EXPECT_TRUE(box.intersect(Rayf(Vec3f(-5, 0, 0), Vec3f(1, 0, 0)), t));
+  EXPECT_FLOAT_EQ(t, 4.0f);
+  EXPECT_FALSE(box.intersect(Rayf(Vec3f(-5, 2, 0), Vec3f(1, 0, 0)), t));
+  EXPECT_FALSE(box.intersect(Rayf(Vec3f(-5, 0, 0), Vec3f(-1, 0, 0)), t));
+  // the interval ends before the box:
+  EXPECT_FALSE(box.intersect(Rayf(Vec3f(-5, 0, 0), Vec3f(1, 0, 0), 0.0f, 3.0f), t));
+  // starting inside, the entry distance is t_min:
+  EXPECT_TRUE(box.intersect(Rayf(Vec3f(0, 0, 0), Vec3f(0, 1, 0)), t));
+  EXPECT_EQ(t, 0.0f);
+}
+
+TEST(AABBTest, OriginOnSlabPlaneIsNaNSafe) {
+  const AABBf box(Vec3f(-1, -1, -1), Vec3f(1, 1, 1));
+  // (min.y - origin.y) * inv_dir.y = 0 * inf = NaN on the y axis:
+  const Rayf grazing(Vec3f(-5, -1, 0), Vec3f(1, 0, 0));
+  float t = 0.0f;
+  EXPECT_TRUE(box.intersect(grazing, t));
+  EXPECT_FLOAT_EQ(t, 4.0f);
+
+  AABBx4f boxes;
+  boxes.set_lane(2, box);
+  simd::Pack4f t_entry;
+  const simd::Mask4f hits = boxes.intersect(grazing, t_entry);
+  EXPECT_EQ(hits.bits(), 0b0100u);
+  EXPECT_FLOAT_EQ(t_entry[2], 4.0f);
+}
+
+template<typename BoxesT>
+class AABBxTypedTest : public ::testing::Test {};
+
+using AABBxTypes = ::testing::Types<AABBx4f, AABBx8f, AABBx4d>;
+TYPED_TEST_SUITE(AABBxTypedTest, AABBxTypes);
+
+TYPED_TEST(AABBxTypedTest, MatchesScalarSlabTest) {
+  using NumT = typename TypeParam::pack_type::value_type;
+  using V = Vec3<NumT>;
+  constexpr size_t lanes = TypeParam::lanes;
+
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<NumT> coord(-4, 4);
+  std::uniform_real_distribution<NumT> size(0.1, 2);
+
+  for (int iteration = 0; iteration < 200; ++iteration) {
+    std::vector<AABB<NumT>> boxes(lanes);
+    for (auto& box : boxes) {
+      const V min(coord(rng), coord(rng), coord(rng));
+      box = AABB<NumT>(min, min + V(size(rng), size(rng), size(rng)));
+    }
+    // every few rays one direction component is exactly zero:
+    V dir(coord(rng), coord(rng), coord(rng));
+    if (iteration % 3 == 0) dir[iteration % 9 / 3] = NumT(0);
+    const Ray<NumT> ray(V(coord(rng), coord(rng), coord(rng)) * NumT(2), dir, NumT(0), NumT(50));
+
+    const TypeParam packet = TypeParam::Load(boxes.data());
+    typename TypeParam::pack_type t_entry;
+    const auto hits = packet.intersect(ray, t_entry);
+
+    for (size_t i = 0; i < lanes; ++i) {
+      NumT t = 0;
+      const bool expected = boxes[i].intersect(ray, t);
+      ASSERT_EQ(hits[i], expected) << "iteration " << iteration << ", lane " << i;
+      if (expected) {
+        EXPECT_EQ(t_entry[i], t);
+      }
+    }
+  }
+}
+
+TYPED_TEST(AABBxTypedTest, EmptyLanesNeverHit) {
+  using NumT = typename TypeParam::pack_type::value_type;
+  using V = Vec3<NumT>;
+  const TypeParam empty;
+  typename TypeParam::pack_type t_entry;
+
+  EXPECT_TRUE(empty.intersect(Ray<NumT>(V(0, 0, 0), V(1, 0, 0)), t_entry).none());
+  EXPECT_TRUE(empty.intersect(Ray<NumT>(V(0, 0, 0), V(0, -1, 0)), t_entry).none());
+  EXPECT_TRUE(empty.intersect(Ray<NumT>(V(0, 0, 0), V(0, 0, -0.0)), t_entry).none());
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/transform.hpp>
+#include <ayan/sync.hpp>
+
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+// rotation about z, non-uniform scale and a translation:
+template<typename NumT>
+Mat4<NumT> affine_matrix() {
+  return Mat4<NumT>{
+    0, -2, 0, 5,
+    1,  0, 0, 6,
+    0,  0, 3, 7,
+    0,  0, 0, 1
+  };
+}
+
+template<typename NumT>
+std::vector<Vec3<NumT>> make_points(size_t count) {
+  std::vector<Vec3<NumT>> points(count);
+  for (size_t i = 0; i < count; ++i) {
+    points[i] = Vec3<NumT>(NumT(i % 7) - 3, NumT(i % 5) * NumT(0.5), NumT(i % 11) - 5);
+  }
+  return points;
+}
+
+template<typename NumT>
+void expect_vec_near(const Vec3<NumT>& a, const Vec3<NumT>& b) {
+  const NumT eps = std::is_same_v<NumT, float> ? NumT(1e-5) : NumT(1e-12);
+  EXPECT_NEAR(a.x(), b.x(), eps);
+  EXPECT_NEAR(a.y(), b.y(), eps);
+  EXPECT_NEAR(a.z(), b.z(), eps);
+}
+
+} // namespace
+
+template<typename NumT>
+class BatchTransformTest : public ::testing::Test {};
+
+using BatchNumTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(BatchTransformTest, BatchNumTypes);
+
+TYPED_TEST(BatchTransformTest, AoSMatchesTransform) {
+  const Transform<TypeParam> t(affine_matrix<TypeParam>());
+  // not a multiple of the packet width, so the scalar tail is covered too:
+  const auto in = make_points<TypeParam>(37);
+  std::vector<Vec3<TypeParam>> points(in.size()), vectors(in.size()), normals(in.size());
+
+  transform_batch<TransformAs::Point>(t.matrix(), in, points);
+  transform_batch<TransformAs::Vector>(t.matrix(), in, vectors);
+  transform_batch<TransformAs::Normal>(t.matrix(), in, normals);
+
+  for (size_t i = 0; i < in.size(); ++i) {
+    expect_vec_near(points[i], t.transform_point(in[i]));
+    expect_vec_near(vectors[i], t.transform_vector(in[i]));
+    expect_vec_near(normals[i], t.transform_normal(in[i]));
+  }
+}
+
+TYPED_TEST(BatchTransformTest, InPlaceAndProjective) {
+  Mat4<TypeParam> m = affine_matrix<TypeParam>();
+  m(3, 2) = TypeParam(0.125);
+  const Transform<TypeParam> t(m);
+  const auto in = make_points<TypeParam>(21);
+
+  auto points = in;
+  transform_batch<TransformAs::Point>(m, points, points);
+  for (size_t i = 0; i < in.size(); ++i) {
+    expect_vec_near(points[i], t.transform_point(in[i]));
+  }
+}
+
+TYPED_TEST(BatchTransformTest, Vec4ReplacesW) {
+  const Mat4<TypeParam> m = affine_matrix<TypeParam>();
+  const std::vector<Vec4<TypeParam>> in(5, Vec4<TypeParam>(1, 2, 3, 42));
+  std::vector<Vec4<TypeParam>> points(in.size()), vectors(in.size());
+
+  transform_batch<TransformAs::Point>(m, in, points);
+  transform_batch<TransformAs::Vector>(m, in, vectors);
+
+  for (size_t i = 0; i < in.size(); ++i) {
+    EXPECT_EQ(points[i], m * Vec4<TypeParam>(1, 2, 3, 1));
+    EXPECT_EQ(vectors[i], m * Vec4<TypeParam>(1, 2, 3, 0));
+  }
+}
+
+TYPED_TEST(BatchTransformTest, PacketsRoundLikeMat4TimesVec4) {
+  Mat4<TypeParam> m{
+    TypeParam(0.1), TypeParam(0.7), TypeParam(-1.3), TypeParam(2.9),
+    TypeParam(1.1), TypeParam(-0.3), TypeParam(0.37), TypeParam(5.5),
+    TypeParam(-2.2), TypeParam(0.01), TypeParam(3.3), TypeParam(0.6),
+    TypeParam(0), TypeParam(0), TypeParam(0), TypeParam(1)
+  };
+  std::vector<Vec3<TypeParam>> in(37);
+  for (size_t i = 0; i < in.size(); ++i) {
+    in[i] = Vec3<TypeParam>(TypeParam(0.3) * TypeParam(i), TypeParam(-1.1) + TypeParam(i), TypeParam(2.7) / TypeParam(i + 1));
+  }
+
+  for (const bool projective : {false, true}) {
+    if (projective) m(3, 2) = TypeParam(0.125);
+    std::vector<Vec3<TypeParam>> points(in.size()), vectors(in.size());
+    transform_batch<TransformAs::Point>(m, in, points);
+    transform_batch<TransformAs::Vector>(m, in, vectors);
+
+    for (size_t i = 0; i < in.size(); ++i) {
+      const Vec4<TypeParam> p = m * Vec4<TypeParam>(in[i].x(), in[i].y(), in[i].z(), 1);
+      const Vec4<TypeParam> v = m * Vec4<TypeParam>(in[i].x(), in[i].y(), in[i].z(), 0);
+      const Vec3<TypeParam> point = projective ? Vec3<TypeParam>(p.x(), p.y(), p.z()) / p.w() : Vec3<TypeParam>(p.x(), p.y(), p.z());
+      EXPECT_EQ(points[i], point) << "at " << i;
+      EXPECT_EQ(vectors[i], Vec3<TypeParam>(v.x(), v.y(), v.z())) << "at " << i;
+    }
+  }
+}
+
+TYPED_TEST(BatchTransformTest, Vec4KeepsProjectiveW) {
+  Mat4<TypeParam> m = affine_matrix<TypeParam>();
+  m(3, 2) = TypeParam(0.5);
+  const std::vector<Vec4<TypeParam>> in{Vec4<TypeParam>(1, 2, 2, 42)};
+  std::vector<Vec4<TypeParam>> out(in.size());
+
+  transform_batch<TransformAs::Point>(m, in, out);
+  const Vec4<TypeParam> r = m * Vec4<TypeParam>(1, 2, 2, 1);
+  EXPECT_EQ(r.w(), TypeParam(2));
+  EXPECT_EQ(out[0], Vec4<TypeParam>(r.x() / r.w(), r.y() / r.w(), r.z() / r.w(), r.w()));
+}
+
+TYPED_TEST(BatchTransformTest, SoAMatchesAoS) {
+  using Packet = Vec3x4<TypeParam>;
+  const Mat4<TypeParam> m = affine_matrix<TypeParam>();
+  const auto in = make_points<TypeParam>(4 * 6);
+
+  std::vector<Packet> packets;
+  for (size_t i = 0; i < in.size(); i += 4) packets.push_back(Packet::Load(in.data() + i));
+  std::vector<Vec3<TypeParam>> expected(in.size());
+
+  transform_batch<TransformAs::Point>(m, in, expected);
+  transform_batch<TransformAs::Point, 4, TypeParam>(m, packets, packets);
+
+  for (size_t i = 0; i < in.size(); ++i) {
+    expect_vec_near(packets[i / 4].lane(i % 4), expected[i]);
+  }
+}
+
+TYPED_TEST(BatchTransformTest, ThreadedMatchesSerial) {
+  ayan::sync::ThreadPool pool(3);
+  const Mat4<TypeParam> m = affine_matrix<TypeParam>();
+  const auto in = make_points<TypeParam>(100'003);
+  std::vector<Vec3<TypeParam>> serial(in.size()), threaded(in.size());
+
+  transform_batch<TransformAs::Point>(m, in, serial);
+  transform_batch<TransformAs::Point>(pool, m, in, threaded);
+
+  for (size_t i = 0; i < in.size(); ++i) {
+    ASSERT_EQ(serial[i], threaded[i]) << "at " << i;
+  }
+}
+
+TYPED_TEST(BatchTransformTest, ThreadedFromTaskOfThePool) {
+  // the only worker runs the caller, its chunks are run while it waits:
+  ayan::sync::ThreadPool pool(1);
+  const Mat4<TypeParam> m = affine_matrix<TypeParam>();
+  const auto in = make_points<TypeParam>(100'003);
+  std::vector<Vec3<TypeParam>> serial(in.size()), threaded(in.size());
+
+  transform_batch<TransformAs::Point>(m, in, serial);
+  ayan::sync::WaitGroup wg;
+  wg.add(1);
+  pool.submit([&] {
+    transform_batch<TransformAs::Point>(pool, m, in, threaded);
+    wg.done();
+  });
+  wg.wait();
+
+  EXPECT_EQ(serial, threaded);
+}
@@ -0,0 +1,237 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/bvh.hpp>
+#include <ayan/sync.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+Vec3f random_vec(std::mt19937& rng, float lo, float hi) {
+  std::uniform_real_distribution<float> dist(lo, hi);
+  return Vec3f(dist(rng), dist(rng), dist(rng));
+}
+
+// a cloud of small triangles, denser in the middle:
+std::vector<Trianglef> make_triangles(size_t count, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::vector<Trianglef> triangles;
+  for (size_t i = 0; i < count; ++i) {
+    const Vec3f center = random_vec(rng, -1, 1) * random_vec(rng, 0, 10);
+    triangles.emplace_back(center + random_vec(rng, -0.1f, 0.1f),
+      center + random_vec(rng, -0.1f, 0.1f), center + random_vec(rng, -0.1f, 0.1f));
+  }
+  return triangles;
+}
+
+bool contains(const AABBf& outer, const AABBf& inner) {
+  return inner.is_empty() || (outer.contains(inner.min()) && outer.contains(inner.max()));
+}
+
+// every primitive is in exactly one leaf, boxes are nested, sizes and stats add up:
+void expect_valid(const Bvh& bvh, std::span<const Trianglef> triangles, const BvhBuildSettings& settings) {
+  ASSERT_FALSE(bvh.is_empty());
+  std::vector<int> seen(triangles.size(), 0);
+  std::vector<std::pair<uint32_t, size_t>> stack{ { 0, 0 } };
+  size_t leaves = 0;
+  size_t inner = 0;
+  while (!stack.empty()) {
+    const auto [index, depth] = stack.back();
+    stack.pop_back();
+    const BvhNode& node = bvh.nodes()[index];
+    ASSERT_LE(depth, kBvhMaxDepth);
+    if (node.is_leaf()) {
+      ++leaves;
+      EXPECT_LE(node.count, std::max<size_t>(settings.max_leaf_size, 1));
+      for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+        const uint32_t prim = bvh.indices()[i];
+        ++seen[prim];
+        EXPECT_TRUE(contains(node.bounds, triangles[prim].bounds()));
+      }
+    } else {
+      ++inner;
+      EXPECT_EQ(node.offset % 2, 0u);
+      for (uint32_t child = node.offset; child < node.offset + 2; ++child) {
+        EXPECT_TRUE(contains(node.bounds, bvh.nodes()[child].bounds));
+        stack.push_back({ child, depth + 1 });
+      }
+    }
+  }
+  EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](int n) { return n == 1; }));
+  EXPECT_EQ(bvh.stats().leaf_count, leaves);
+  EXPECT_EQ(bvh.stats().inner_count, inner);
+  EXPECT_EQ(leaves, inner + 1);
+  EXPECT_EQ(bvh.nodes().size(), 2 * inner + 2);
+  EXPECT_FLOAT_EQ(bvh.stats().sah_cost, bvh.sah_cost(settings.traversal_cost, settings.intersection_cost));
+}
+
+} // namespace
+
+TEST(BvhTest, BuildsValidTree) {
+  const auto triangles = make_triangles(5000, 1);
+  for (size_t leaf_size : { 1, 4, 8 }) {
+    BvhBuildSettings settings;
+    settings.max_leaf_size = leaf_size;
+    const Bvh bvh = Bvh::Build(triangles, settings);
+    expect_valid(bvh, triangles, settings);
+    EXPECT_GE(bvh.stats().build_seconds, 0.0);
+
+    AABBf bounds;
+    for (const Trianglef& triangle : triangles) bounds.extend(triangle.bounds());
+    EXPECT_EQ(bvh.bounds().min(), bounds.min());
+    EXPECT_EQ(bvh.bounds().max(), bounds.max());
+  }
+}
+
+TEST(BvhTest, SahBeatsMedianSplits) {
+  // one large triangle among many small ones: SAH isolates it near the root,
+  // while a tree of median splits is only bounded by the cost of testing everything:
+  auto triangles = make_triangles(2000, 2);
+  triangles.emplace_back(Vec3f(-50, -50, 0), Vec3f(50, -50, 0), Vec3f(0, 50, 0));
+  const Bvh bvh = Bvh::Build(triangles);
+  expect_valid(bvh, triangles, {});
+  EXPECT_LT(bvh.stats().sah_cost, 0.05f * float(triangles.size()));
+  EXPECT_LE(bvh.stats().max_depth, 40u);
+}
+
+TEST(BvhTest, DegenerateInput) {
+  EXPECT_TRUE(Bvh::Build(std::span<const Trianglef>()).is_empty());
+  EXPECT_TRUE(Bvh().bounds().is_empty());
+  BvhHit hit{};
+  EXPECT_FALSE(Bvh().intersect({}, Rayf(Vec3f(), Vec3f(0, 0, 1)), hit));
+
+  // a single leaf:
+  const std::vector<Trianglef> one{ Trianglef(Vec3f(0, 0, 1), Vec3f(1, 0, 1), Vec3f(0, 1, 1)) };
+  const Bvh small = Bvh::Build(one);
+  ASSERT_EQ(small.nodes().size(), 2u);
+  EXPECT_TRUE(small.nodes()[0].is_leaf());
+  ASSERT_TRUE(small.intersect(one, Rayf(Vec3f(0.25f, 0.25f, 0), Vec3f(0, 0, 1)), hit));
+  EXPECT_FLOAT_EQ(hit.t, 1.0f);
+  EXPECT_EQ(hit.primitive, 0u);
+
+  // coincident centroids can't be binned, the ranges are halved instead:
+  const std::vector<Trianglef> stacked(1000, one[0]);
+  const Bvh halved = Bvh::Build(stacked);
+  expect_valid(halved, stacked, {});
+  EXPECT_LE(halved.stats().max_depth, 10u);
+
+  // empty and NaN boxes still land in leaves:
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  std::vector<AABBf> boxes(100, AABBf(Vec3f(0, 0, 0), Vec3f(1, 1, 1)));
+  boxes[10] = AABBf();
+  boxes[20] = AABBf(Vec3f(nan, 0, 0), Vec3f(nan, 1, 1));
+  for (size_t i = 0; i < boxes.size(); i += 3) boxes[i] = AABBf(Vec3f(float(i), 0, 0), Vec3f(float(i) + 1, 1, 1));
+  const Bvh mixed = Bvh::Build(boxes);
+  std::vector<uint32_t> order(mixed.indices().begin(), mixed.indices().end());
+  std::sort(order.begin(), order.end());
+  for (uint32_t i = 0; i < order.size(); ++i) EXPECT_EQ(order[i], i);
+  EXPECT_EQ(mixed.bounds().max().x(), 100.0f);
+}
+
+TEST(BvhTest, ClosestHitMatchesBruteForce) {
+  const auto triangles = make_triangles(3000, 3);
+  const Bvh bvh = Bvh::Build(triangles);
+  std::mt19937 rng(4);
+  size_t hits = 0;
+  for (size_t r = 0; r < 500; ++r) {
+    const Vec3f origin = random_vec(rng, -12, 12);
+    const Rayf ray(origin, random_vec(rng, -3, 3) - origin);
+
+    bool expected = false;
+    Rayf closest = ray;
+    TriangleHit<float> best{};
+    uint32_t best_index = 0;
+    for (uint32_t i = 0; i < triangles.size(); ++i) {
+      TriangleHit<float> triangle_hit;
+      if (triangles[i].intersect(closest, triangle_hit)) {
+        closest.set_t_max(triangle_hit.t);
+        best = triangle_hit;
+        best_index = i;
+        expected = true;
+      }
+    }
+
+    BvhHit hit{};
+    ASSERT_EQ(bvh.intersect(triangles, ray, hit), expected);
+    if (!expected) continue;
+    ++hits;
+    EXPECT_FLOAT_EQ(hit.t, best.t);
+    // the same t from two triangles (shared vertex) may resolve either way:
+    if (hit.primitive != best_index) continue;
+    EXPECT_FLOAT_EQ(hit.u, best.u);
+    EXPECT_FLOAT_EQ(hit.v, best.v);
+  }
+  EXPECT_GT(hits, 50u);
+}
+
+TEST(BvhTest, DeepNodesSplitAtTheObjectMedian) {
+  // two rows of centroids along +x and -x, 16 times apart from the smallest
+  // denormal up: the bins separate only the outermost one, SAH cuts off one
+  // primitive per level and the nodes past the SAH depth are split at the median:
+  std::vector<AABBf> boxes;
+  for (int i = 0; i < 68; ++i) {
+    const float x = std::ldexp(1.0f, 4 * i - 149);
+    boxes.emplace_back(Vec3f(x, 0, 0), Vec3f(1.5f * x, 1, 1));
+    boxes.emplace_back(Vec3f(-1.5f * x, 0, 0), Vec3f(-x, 1, 1));
+  }
+  std::shuffle(boxes.begin(), boxes.end(), std::mt19937(7));
+  BvhBuildSettings settings;
+  settings.max_leaf_size = 1;
+  const Bvh bvh = Bvh::Build(boxes, settings);
+  EXPECT_GT(bvh.stats().max_depth, 64u);
+  EXPECT_LE(bvh.stats().max_depth, kBvhMaxDepth);
+  EXPECT_EQ(bvh.stats().leaf_count, boxes.size());
+
+  // disjoint primitives on a line, the children of every node are disjoint:
+  for (const BvhNode& node : bvh.nodes()) {
+    if (node.is_leaf() || node.bounds.is_empty()) continue;
+    const AABBf& a = bvh.nodes()[node.offset].bounds;
+    const AABBf& b = bvh.nodes()[node.offset + 1].bounds;
+    EXPECT_TRUE(a.max().x() < b.min().x() || b.max().x() < a.min().x());
+  }
+}
+
+TEST(BvhTest, ThreadPoolMatchesSingleThread) {
+  // large enough for parallel binning at the root and many subtrees:
+  const auto triangles = make_triangles(150000, 5);
+  const Bvh serial = Bvh::Build(triangles);
+  ayan::sync::ThreadPool pool(3);
+  const Bvh parallel = Bvh::Build(pool, triangles);
+  expect_valid(parallel, triangles, {});
+
+  ASSERT_EQ(parallel.nodes().size(), serial.nodes().size());
+  for (size_t i = 0; i < serial.nodes().size(); ++i) {
+    const BvhNode& a = serial.nodes()[i];
+    const BvhNode& b = parallel.nodes()[i];
+    EXPECT_EQ(a.offset, b.offset);
+    EXPECT_EQ(a.count, b.count);
+    EXPECT_EQ(a.bounds.min(), b.bounds.min());
+    EXPECT_EQ(a.bounds.max(), b.bounds.max());
+  }
+  EXPECT_TRUE(std::equal(serial.indices().begin(), serial.indices().end(), parallel.indices().begin()));
+  EXPECT_EQ(serial.stats().sah_cost, parallel.stats().sah_cost);
+}
+
+TEST(BvhTest, BuildFromTaskOfThePool) {
+  // chunked top nodes and subtree tasks, all queued behind the caller:
+  const auto triangles = make_triangles(100000, 6);
+  const Bvh serial = Bvh::Build(triangles);
+  ayan::sync::ThreadPool pool(1);
+  Bvh parallel;
+  ayan::sync::WaitGroup wg;
+  wg.add(1);
+  pool.submit([&] {
+    parallel = Bvh::Build(pool, triangles);
+    wg.done();
+  });
+  wg.wait();
+
+  ASSERT_EQ(parallel.nodes().size(), serial.nodes().size());
+  EXPECT_TRUE(std::equal(serial.indices().begin(), serial.indices().end(), parallel.indices().begin()));
+}
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/color.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+template<ToneMap Curve>
+RGBf reference_encode(const RGBf& color, float exposure) {
+  return linear_to_srgb(tone_map<Curve>(color * std::exp2(exposure)));
+}
+
+// the scalar pipeline rounded to 8 bits (no dither):
+RGBA8 reference_pixel(ToneMap curve, const RGBf& color, float exposure) {
+  RGBf encoded;
+  switch (curve) {
+    case ToneMap::Clamp: encoded = reference_encode<ToneMap::Clamp>(color, exposure); break;
+    case ToneMap::Reinhard: encoded = reference_encode<ToneMap::Reinhard>(color, exposure); break;
+    case ToneMap::ACES: encoded = reference_encode<ToneMap::ACES>(color, exposure); break;
+    case ToneMap::AgX: encoded = reference_encode<ToneMap::AgX>(color, exposure); break;
+  }
+  const auto quantize = [](float value) {
+    return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+  };
+  return RGBA8{ quantize(encoded.r()), quantize(encoded.g()), quantize(encoded.b()), 255 };
+}
+
+std::vector<RGBf> random_image(size_t count, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::exponential_distribution<float> radiance(1.5f);
+  std::vector<RGBf> image(count);
+  for (RGBf& pixel : image) pixel = RGBf(radiance(rng), radiance(rng), radiance(rng));
+  return image;
+}
+
+int max_channel_diff(const RGBA8& a, const RGBA8& b) {
+  return std::max({ std::abs(a.r - b.r), std::abs(a.g - b.g), std::abs(a.b - b.b), std::abs(a.a - b.a) });
+}
+
+constexpr ToneMap kCurves[] = { ToneMap::Clamp, ToneMap::Reinhard, ToneMap::ACES, ToneMap::AgX };
+
+} // namespace
+
+TEST(ColorTest, ArithmeticAndLuminance) {
+  const RGBf a(0.5f, 1.0f, 2.0f);
+  const RGBf b(2.0f, 0.5f, 0.25f);
+  EXPECT_EQ(a + b, RGBf(2.5f, 1.5f, 2.25f));
+  EXPECT_EQ(a - b, RGBf(-1.5f, 0.5f, 1.75f));
+  EXPECT_EQ(a * b, RGBf(1.0f, 0.5f, 0.5f));
+  EXPECT_EQ(2.0f * a, RGBf(1.0f, 2.0f, 4.0f));
+  EXPECT_EQ(a / 2.0f, RGBf(0.25f, 0.5f, 1.0f));
+  EXPECT_EQ(a.max_channel(), 2.0f);
+
+  EXPECT_FLOAT_EQ(RGBf::White().luminance(), 1.0f);
+  EXPECT_FLOAT_EQ(RGBf(0, 1, 0).luminance(), 0.7152f);
+  EXPECT_TRUE(RGBf::Black().is_black());
+  EXPECT_FALSE(RGBf::Gray(0.1f).is_black());
+
+  const RGBAf rgba(a, 0.5f);
+  EXPECT_EQ(rgba.rgb(), a);
+  EXPECT_EQ(rgba.a(), 0.5f);
+  EXPECT_EQ(RGBAf().a(), 1.0f);
+  static_assert(sizeof(RGBf) == 3 * sizeof(float) && sizeof(RGBA8) == 4);
+}
+
+TEST(ColorTest, SrgbTransferFunctions) {
+  EXPECT_EQ(linear_to_srgb(0.0f), 0.0f);
+  EXPECT_NEAR(linear_to_srgb(1.0f), 1.0f, 1e-6f);
+  EXPECT_NEAR(linear_to_srgb(0.5f), 0.735357f, 1e-5f);
+  // linear segment:
+  EXPECT_NEAR(linear_to_srgb(0.001f), 0.01292f, 1e-6f);
+  EXPECT_NEAR(srgb_to_linear(0.5), 0.214041, 1e-6);
+
+  alignas(32) float in[8];
+  alignas(32) float out[8];
+  for (float x = 0.0f; x <= 1.0f; x += 1.0f / 64) {
+    EXPECT_NEAR(srgb_to_linear(linear_to_srgb(x)), x, 1e-6f);
+    std::fill(std::begin(in), std::end(in), x);
+    linear_to_srgb(simd::Pack<float, 8>::Load(in)).store(out);
+    EXPECT_NEAR(out[0], linear_to_srgb(x), 2e-6f);
+    srgb_to_linear(simd::Pack<float, 8>::Load(in)).store(out);
+    EXPECT_NEAR(out[0], srgb_to_linear(x), 2e-6f);
+  }
+}
+
+TEST(ColorTest, CurvesAreBoundedAndMonotonic) {
+  const auto check = [](auto curve_fn) {
+    float previous = -1.0f;
+    for (float x = 0.0f; x < 1000.0f; x = x * 1.25f + 1e-3f) {
+      const RGBf mapped = curve_fn(RGBf::Gray(x));
+      EXPECT_GE(mapped.r(), 0.0f);
+      EXPECT_LE(mapped.r(), 1.0f);
+      EXPECT_GE(mapped.r(), previous) << x;
+      previous = mapped.r();
+    }
+    EXPECT_GT(previous, 0.95f);
+  };
+  check([](const RGBf& c) { return tone_map<ToneMap::Clamp>(c); });
+  check([](const RGBf& c) { return tone_map<ToneMap::Reinhard>(c); });
+  check([](const RGBf& c) { return tone_map<ToneMap::ACES>(c); });
+  check([](const RGBf& c) { return tone_map<ToneMap::AgX>(c); });
+
+  EXPECT_FLOAT_EQ(tone_map<ToneMap::Reinhard>(RGBf::Gray(1.0f)).r(), 0.5f);
+}
+
+TEST(ColorTest, EncodeMatchesScalarPipeline) {
+  // not a multiple of any packet width:
+  const size_t width = 37;
+  const std::vector<RGBf> image = random_image(width * 29, 5);
+  std::vector<RGBA8> out(image.size());
+  for (ToneMap curve : kCurves) {
+    for (float exposure : { 0.0f, -1.5f }) {
+      encode_srgb8(ToneMapSettings{ curve, exposure, false }, image, width, out);
+      for (size_t i = 0; i < image.size(); ++i) {
+        ASSERT_LE(max_channel_diff(out[i], reference_pixel(curve, image[i], exposure)), 1)
+          << "curve " << static_cast<int>(curve) << ", pixel " << i;
+      }
+    }
+  }
+}
+
+TEST(ColorTest, DitherPreservesMeanLevel) {
+  // 8-bit level 100.4 on average: rounding gives 100 everywhere, the dither
+  // gives 100 and 101 with the right proportion:
+  const float encoded = 100.4f / 255.0f;
+  const size_t width = 64;
+  const std::vector<RGBf> image(width * width, RGBf::Gray(srgb_to_linear(encoded)));
+  std::vector<RGBA8> out(image.size());
+
+  encode_srgb8(ToneMapSettings{ ToneMap::Clamp, 0.0f, false }, image, width, out);
+  EXPECT_TRUE(std::all_of(out.begin(), out.end(), [](const RGBA8& p) { return p.g == 100; }));
+
+  encode_srgb8(ToneMapSettings{ ToneMap::Clamp, 0.0f, true }, image, width, out);
+  double sum = 0.0;
+  for (const RGBA8& pixel : out) {
+    EXPECT_TRUE(pixel.g == 100 || pixel.g == 101);
+    sum += pixel.g;
+  }
+  EXPECT_NEAR(sum / double(out.size()), 100.4, 0.02);
+}
+
+TEST(ColorTest, EncodeAlphaAndInvalidInput) {
+  constexpr float qnan = std::numeric_limits<float>::quiet_NaN();
+  constexpr float inf = std::numeric_limits<float>::infinity();
+  const std::vector<RGBAf> image = {
+    RGBAf(0, 0, 0, 0), RGBAf(1, 1, 1, 1), RGBAf(qnan, 0.5f, -1, 0.5f),
+    RGBAf(inf, inf, inf, 2.0f), RGBAf(0.2f, 0.2f, 0.2f, qnan)
+  };
+  std::vector<RGBA8> out(image.size());
+  encode_srgb8(ToneMapSettings{ ToneMap::Reinhard, 0.0f, false }, image, image.size(), out);
+
+  EXPECT_EQ(out[0], (RGBA8{ 0, 0, 0, 0 }));
+  EXPECT_EQ(out[1].a, 255);
+  EXPECT_EQ(out[1].r, reference_pixel(ToneMap::Reinhard, RGBf::White(), 0.0f).r);
+  EXPECT_EQ(out[2].r, 0);
+  EXPECT_EQ(out[2].b, 0);
+  EXPECT_EQ(out[2].a, 128);
+  EXPECT_EQ(out[3], (RGBA8{ 255, 255, 255, 255 }));
+  EXPECT_EQ(out[4].a, 0);
+
+  // the dither only touches RGB, alpha rounds the same at every pixel:
+  const std::vector<RGBAf> coverage(64, RGBAf(0.5f, 0.5f, 0.5f, 0.25f));
+  std::vector<RGBA8> dithered(coverage.size());
+  encode_srgb8(ToneMapSettings{ ToneMap::Clamp, 0.0f, true }, coverage, 8, dithered);
+  for (const RGBA8& pixel : dithered) EXPECT_EQ(pixel.a, 64);
+
+  // nothing to encode, any width; pixels but no width:
+  ayan::sync::ThreadPool pool(2);
+  const ToneMapSettings settings{ ToneMap::Clamp, 0.0f, true };
+  encode_srgb8(settings, std::span<const RGBf>(), 0, std::span<RGBA8>());
+  encode_srgb8(pool, settings, std::span<const RGBAf>(), 0, std::span<RGBA8>());
+  EXPECT_THROW(encode_srgb8(settings, image, 0, out), std::invalid_argument);
+  EXPECT_THROW(encode_srgb8(pool, settings, image, 0, out), std::invalid_argument);
+}
+
+TEST(ColorTest, ThreadPoolMatchesSingleThread) {
+  const size_t width = 301;
+  const std::vector<RGBf> image = random_image(width * 97, 9);
+  std::vector<RGBA8> single(image.size()), parallel(image.size());
+  ayan::sync::ThreadPool pool(3);
+  for (ToneMap curve : kCurves) {
+    const ToneMapSettings settings{ curve, 0.5f, true };
+    encode_srgb8(settings, image, width, single);
+    encode_srgb8(pool, settings, image, width, parallel);
+    EXPECT_EQ(single, parallel);
+  }
+}
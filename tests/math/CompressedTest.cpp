@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/compressed.hpp>
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace ayan::math;
+
+static_assert(Half(1.0f).bits() == 0x3c00 && Half(-2.0f).bits() == 0xc000);
+static_assert(Half::FromBits(0x7bff).to_float() == 65504.0f);
+static_assert(HalfVec3(Vec3f(0.5f, 1.0f, 2.0f)).decode() == Vec3f(0.5f, 1.0f, 2.0f));
+static_assert(sizeof(HalfVec3) == 6 && sizeof(OctNormal) == 4 && sizeof(QuantizedVec3) == 6);
+
+namespace {
+
+Vec3f random_vec(std::mt19937& rng, float lo, float hi) {
+  std::uniform_real_distribution<float> dist(lo, hi);
+  return Vec3f(dist(rng), dist(rng), dist(rng));
+}
+
+} // namespace
+
+TEST(HalfTest, SpecialValuesAndRounding) {
+  const float inf = std::numeric_limits<float>::infinity();
+
+  EXPECT_EQ(Half(65504.0f).bits(), 0x7bff);
+  EXPECT_EQ(Half(65519.0f).bits(), 0x7bff); // below the halfway point to 65536
+  EXPECT_EQ(Half(65520.0f).bits(), 0x7c00);
+  EXPECT_EQ(Half(inf).bits(), 0x7c00);
+  EXPECT_EQ(Half(-inf).bits(), 0xfc00);
+  EXPECT_TRUE(std::isnan(Half(std::numeric_limits<float>::quiet_NaN()).to_float()));
+  EXPECT_EQ(Half(-0.0f).bits(), 0x8000);
+
+  // smallest subnormal, ties to even:
+  EXPECT_EQ(Half(std::ldexp(1.0f, -24)).bits(), 0x0001);
+  EXPECT_EQ(Half(std::ldexp(1.0f, -25)).bits(), 0x0000);
+  EXPECT_EQ(Half(std::ldexp(3.0f, -25)).bits(), 0x0002);
+  // 1 + 2^-11 is halfway between 1 and the next half, rounds to even (1):
+  EXPECT_EQ(Half(1.0f + std::ldexp(1.0f, -11)).bits(), 0x3c00);
+  EXPECT_EQ(Half(1.0f + std::ldexp(3.0f, -11)).bits(), 0x3c02);
+}
+
+TEST(HalfTest, EveryHalfRoundTrips) {
+  for (uint32_t bits = 0; bits <= 0xffff; ++bits) {
+    const Half half = Half::FromBits(uint16_t(bits));
+    if (std::isnan(half.to_float())) continue;
+    ASSERT_EQ(Half(half.to_float()).bits(), bits);
+  }
+}
+
+TEST(HalfTest, BatchMatchesScalar) {
+  // every half (NaNs included) through the batch decode, 3 per Vec3:
+  std::vector<HalfVec3> halves;
+  for (uint32_t bits = 0; bits + 3 <= 0x10000; bits += 3) {
+    halves.push_back(HalfVec3(Half::FromBits(uint16_t(bits)),
+      Half::FromBits(uint16_t(bits + 1)), Half::FromBits(uint16_t(bits + 2))));
+  }
+
+  std::vector<Vec3f> decoded(halves.size());
+  decode(halves, decoded);
+  for (size_t i = 0; i < halves.size(); ++i) {
+    const Vec3f expected = halves[i].decode();
+    for (size_t axis = 0; axis < 3; ++axis) {
+      // F16C returns signaling NaNs quiet:
+      if (std::isnan(expected[axis])) {
+        ASSERT_TRUE(std::isnan(decoded[i][axis]));
+        continue;
+      }
+      ASSERT_EQ(std::bit_cast<uint32_t>(decoded[i][axis]), std::bit_cast<uint32_t>(expected[axis]));
+    }
+  }
+
+  std::mt19937 rng(1);
+  std::vector<Vec4f> in(29);
+  for (Vec4f& v : in) v = Vec4f(random_vec(rng, -1000, 1000).x(), 0.001f, -3.0f, 70000.0f);
+  std::vector<HalfVec4> encoded(in.size());
+  encode(in, encoded);
+  for (size_t i = 0; i < in.size(); ++i) {
+    EXPECT_EQ(encoded[i].x().bits(), Half(in[i].x()).bits());
+    EXPECT_EQ(encoded[i].y().bits(), Half(in[i].y()).bits());
+    EXPECT_EQ(encoded[i].w().bits(), 0x7c00);
+  }
+
+  // a shorter `out` is rejected before anything is written, a longer one is fine:
+  std::vector<HalfVec4> short_out(in.size() - 1, HalfVec4(Vec4f(1, 2, 3, 4)));
+  EXPECT_THROW(encode(in, short_out), std::invalid_argument);
+  EXPECT_EQ(short_out[0].x().bits(), Half(1.0f).bits());
+  std::vector<Vec3f> short_decoded(halves.size() - 1);
+  EXPECT_THROW(decode(halves, short_decoded), std::invalid_argument);
+  std::vector<HalfVec4> long_out(in.size() + 3);
+  encode(in, long_out);
+  EXPECT_EQ(long_out[0].x().bits(), encoded[0].x().bits());
+}
+
+TEST(OctNormalTest, AxesAreExact) {
+  EXPECT_EQ(OctNormal().decode(), Vec3f(0, 0, 1));
+  for (const Vec3f& axis : {Vec3f(1, 0, 0), Vec3f(-1, 0, 0), Vec3f(0, 1, 0),
+    Vec3f(0, -1, 0), Vec3f(0, 0, 1), Vec3f(0, 0, -1)})
+  {
+    EXPECT_EQ(OctNormal::Encode(axis).decode(), axis);
+  }
+  const OctNormal n(123, -4567);
+  EXPECT_EQ(OctNormal::FromBits(n.bits()).u(), 123);
+  EXPECT_EQ(OctNormal::FromBits(n.bits()).v(), -4567);
+}
+
+TEST(OctNormalTest, AngularErrorAndBatch) {
+  std::mt19937 rng(2);
+  std::normal_distribution<float> gauss;
+  std::vector<Vec3f> normals(10001);
+  for (Vec3f& n : normals) n = Vec3f(gauss(rng), gauss(rng), gauss(rng)).normalize();
+
+  std::vector<OctNormal> encoded(normals.size());
+  std::vector<Vec3f> decoded(normals.size());
+  encode(normals, encoded);
+  decode(encoded, decoded);
+
+  double max_angle = 0.0;
+  for (size_t i = 0; i < normals.size(); ++i) {
+    const double cos = std::clamp(double(decoded[i].dot(normals[i])), -1.0, 1.0);
+    const Vec3f cross = decoded[i].cross(normals[i]);
+    max_angle = std::max(max_angle, std::atan2(double(cross.length()), cos));
+    ASSERT_NEAR(decoded[i].length(), 1.0f, 1e-6f);
+    // the packet normalize() may fuse the dot product:
+    const Vec3f scalar = encoded[i].decode();
+    EXPECT_NEAR(decoded[i].x(), scalar.x(), 2.5e-7f);
+    EXPECT_NEAR(decoded[i].y(), scalar.y(), 2.5e-7f);
+    EXPECT_NEAR(decoded[i].z(), scalar.z(), 2.5e-7f);
+  }
+  EXPECT_LT(max_angle, 5e-5);
+}
+
+TEST(PositionQuantizerTest, ErrorIsHalfAStep) {
+  const Vec3f min(-10, 0, 5);
+  const Vec3f max(30, 1, 5); // z is flat
+  const PositionQuantizer quantizer(min, max);
+
+  std::mt19937 rng(3);
+  std::vector<Vec3f> positions(37);
+  for (Vec3f& p : positions) {
+    const Vec3f t = random_vec(rng, 0, 1);
+    p = Vec3f(min.x() + t.x() * 40, t.y(), 5);
+  }
+  positions[0] = min;
+  positions[1] = max;
+
+  std::vector<QuantizedVec3> encoded(positions.size());
+  std::vector<Vec3f> decoded(positions.size());
+  quantizer.encode(positions, encoded);
+  quantizer.decode(encoded, decoded);
+
+  const Vec3f step = quantizer.step_size();
+  EXPECT_EQ(decoded[0], min);
+  for (size_t i = 0; i < positions.size(); ++i) {
+    EXPECT_EQ(decoded[i], quantizer.decode(encoded[i]));
+    EXPECT_LE(std::abs(decoded[i].x() - positions[i].x()), step.x() * 0.5f + 4e-6f);
+    EXPECT_LE(std::abs(decoded[i].y() - positions[i].y()), step.y() * 0.5f + 1e-7f);
+    EXPECT_EQ(decoded[i].z(), 5.0f);
+  }
+
+  // outside the bounds is clamped:
+  EXPECT_EQ(quantizer.encode(Vec3f(-100, 2, 5)).coords[0], 0);
+  EXPECT_EQ(quantizer.encode(Vec3f(-100, 2, 5)).coords[1], 65535);
+}
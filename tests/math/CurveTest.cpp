@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/curve.hpp>
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+static_assert(morton_encode<uint32_t>(Vec3i(1, 0, 0)) == 1 && morton_encode<uint32_t>(Vec3i(0, 1, 0)) == 2);
+static_assert(morton_encode<uint32_t>(Vec3i(0, 0, 1)) == 4);
+static_assert(morton_encode<uint32_t>(Vec3i(1023, 1023, 1023)) == (1u << 30) - 1);
+static_assert(morton_encode<uint64_t>(Vec3i(0x1FFFFF, 0x1FFFFF, 0x1FFFFF)) == (1ull << 63) - 1);
+static_assert(morton_decode(morton_encode<uint64_t>(Vec3i(5, 1 << 20, 77))) == Vec3i(5, 1 << 20, 77));
+static_assert(hilbert_encode(Vec2i(0, 0), 1) == 0 && hilbert_encode(Vec2i(1, 0), 1) == 3);
+static_assert(hilbert_decode(hilbert_encode(Vec2i(12, 34), 6), 6) == Vec2i(12, 34));
+
+namespace {
+
+template<MortonCode CodeT>
+void check_morton_round_trip() {
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> dist(0, (1 << morton_axis_bits<CodeT>) - 1);
+  std::vector<Vec3i> cells(1000);
+  for (Vec3i& cell : cells) cell = Vec3i(dist(rng), dist(rng), dist(rng));
+
+  std::vector<CodeT> codes(cells.size());
+  morton_encode<CodeT>(cells, codes);
+  std::vector<Vec3i> decoded(cells.size());
+  morton_decode<CodeT>(codes, decoded);
+  for (size_t i = 0; i < cells.size(); ++i) {
+    EXPECT_EQ(decoded[i], cells[i]);
+    // bit 3k + axis of the code is bit k of the axis:
+    for (uint32_t bit = 0; bit < morton_axis_bits<CodeT>; ++bit) {
+      for (size_t axis = 0; axis < 3; ++axis) {
+        ASSERT_EQ((codes[i] >> (3 * bit + axis)) & 1u, CodeT((cells[i][axis] >> bit) & 1));
+      }
+    }
+  }
+}
+
+template<MortonCode CodeT>
+void check_grid_batch() {
+  const MortonGrid<CodeT> grid(AABBf(Vec3f(-1.0f, 0.0f, 2.0f), Vec3f(3.0f, 0.5f, 2.0f))); // flat z
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<float> dist(-2.0f, 4.0f); // partly outside
+  std::vector<Vec3f> points(1003);
+  for (Vec3f& p : points) p = Vec3f(dist(rng), dist(rng), dist(rng));
+  points[0] = Vec3f(3.0f, 0.5f, 2.0f); // max corner -> the last cell
+
+  std::vector<CodeT> codes(points.size());
+  grid.encode(points, codes);
+  for (size_t i = 0; i < points.size(); ++i) ASSERT_EQ(codes[i], grid.encode(points[i])) << i;
+
+  const int last = (1 << morton_axis_bits<CodeT>) - 1;
+  EXPECT_EQ(grid.cell(points[0]), Vec3i(last, last, 0));
+  EXPECT_EQ(grid.cell(Vec3f(-10.0f, -10.0f, 5.0f)), Vec3i(0, 0, 0));
+  EXPECT_EQ(grid.cell(Vec3f(1.0f, 0.25f, 2.0f)), Vec3i((last + 1) / 2, (last + 1) / 2, 0));
+}
+
+} // namespace
+
+TEST(MortonTest, RoundTrip30) {
+  check_morton_round_trip<uint32_t>();
+}
+
+TEST(MortonTest, RoundTrip63) {
+  check_morton_round_trip<uint64_t>();
+}
+
+TEST(MortonTest, HigherBitsAreDropped) {
+  EXPECT_EQ(morton_encode<uint32_t>(Vec3i(1024 + 3, 0, 0)), morton_encode<uint32_t>(Vec3i(3, 0, 0)));
+  EXPECT_EQ(morton_encode<uint64_t>(Vec3i(0, 1 << 21, 0)), 0u);
+}
+
+TEST(MortonTest, GridBatchMatchesScalar30) {
+  check_grid_batch<uint32_t>();
+}
+
+TEST(MortonTest, GridBatchMatchesScalar63) {
+  check_grid_batch<uint64_t>();
+}
+
+TEST(HilbertTest, ConsecutiveIndicesAreNeighbours) {
+  for (uint32_t order = 1; order <= 8; ++order) {
+    const uint32_t side = 1u << order;
+    std::vector<uint32_t> indices(side * side);
+    for (uint32_t i = 0; i < indices.size(); ++i) indices[i] = i;
+    std::vector<Vec2i> cells(indices.size());
+    hilbert_decode(indices, cells, order);
+
+    std::vector<bool> visited(indices.size());
+    for (uint32_t i = 0; i < indices.size(); ++i) {
+      const Vec2i cell = cells[i];
+      ASSERT_TRUE(cell.x() >= 0 && cell.x() < int(side) && cell.y() >= 0 && cell.y() < int(side));
+      ASSERT_FALSE(visited[cell.y() * side + cell.x()]);
+      visited[cell.y() * side + cell.x()] = true;
+      ASSERT_EQ(hilbert_decode(i, order), cell);
+      if (i > 0) {
+        const Vec2i prev = cells[i - 1];
+        ASSERT_EQ(std::abs(cell.x() - prev.x()) + std::abs(cell.y() - prev.y()), 1) << order << " " << i;
+      }
+    }
+    // starts and ends at the bottom corners:
+    EXPECT_EQ(cells.front(), Vec2i(0, 0));
+    EXPECT_EQ(cells.back(), Vec2i(int(side) - 1, 0));
+  }
+}
+
+TEST(HilbertTest, BatchRoundTrip) {
+  for (uint32_t order : {5u, 11u, 16u}) {
+    std::mt19937 rng(order);
+    std::uniform_int_distribution<int> dist(0, (1 << order) - 1);
+    std::vector<Vec2i> cells(517);
+    for (Vec2i& cell : cells) cell = Vec2i(dist(rng), dist(rng));
+
+    std::vector<uint32_t> indices(cells.size());
+    hilbert_encode(cells, indices, order);
+    std::vector<Vec2i> decoded(cells.size());
+    hilbert_decode(indices, decoded, order);
+    for (size_t i = 0; i < cells.size(); ++i) {
+      ASSERT_EQ(indices[i], hilbert_encode(cells[i], order));
+      ASSERT_LT(uint64_t(indices[i]), 1ull << (2 * order));
+      ASSERT_EQ(decoded[i], cells[i]);
+    }
+  }
+}
@@ -0,0 +1,82 @@
+# Fails if a weak function of the dispatch library outside the isa_ namespaces
+# holds VEX or EVEX code: the linker keeps any one copy of a weak symbol, the
+# one that runs on the baseline path too. Most telling on a Debug build, where
+# std:: inline functions are not inlined. Usage:
+#   cmake -DLIBRARY=<archive> -DNM=<nm> -DOBJDUMP=<objdump> -DWORK_DIR=<dir> -P DispatchIsolation.cmake
+
+foreach(var LIBRARY NM OBJDUMP WORK_DIR)
+    if (NOT ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif()
+endforeach()
+
+# weak functions of every archive member:
+execute_process(
+    COMMAND ${NM} --defined-only ${LIBRARY}
+    OUTPUT_FILE ${WORK_DIR}/dispatch_symbols.txt
+    RESULT_VARIABLE result
+)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "${NM} failed on ${LIBRARY}")
+endif()
+
+file(STRINGS ${WORK_DIR}/dispatch_symbols.txt lines)
+set(member "")
+set(weak_keys "")
+set(sections "")
+foreach(line IN LISTS lines)
+    if (line MATCHES "^(.+):$")
+        set(member "${CMAKE_MATCH_1}")
+    elseif (line MATCHES "^[0-9a-f]+ W (.+)$")
+        set(name "${CMAKE_MATCH_1}")
+        if (NOT name MATCHES "isa_")
+            list(APPEND weak_keys "${member}/${name}")
+            list(APPEND sections ".text.${name}")
+        endif()
+    endif()
+endforeach()
+if (NOT weak_keys)
+    message(STATUS "no weak functions outside the isa_ namespaces")
+    return()
+endif()
+list(REMOVE_DUPLICATES sections)
+set(section_args "")
+foreach(section IN LISTS sections)
+    list(APPEND section_args -j ${section})
+endforeach()
+
+# their code, COMDAT functions have a section each:
+execute_process(
+    COMMAND ${OBJDUMP} -d -w --no-show-raw-insn ${section_args} ${LIBRARY}
+    OUTPUT_FILE ${WORK_DIR}/dispatch_disassembly.txt
+    RESULT_VARIABLE result
+)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "${OBJDUMP} failed on ${LIBRARY}")
+endif()
+
+file(STRINGS ${WORK_DIR}/dispatch_disassembly.txt lines)
+set(member "")
+set(symbol "")
+set(offenders "")
+foreach(line IN LISTS lines)
+    if (line MATCHES "^(.+):[ \t]+file format")
+        set(member "${CMAKE_MATCH_1}")
+    elseif (line MATCHES "^[0-9a-f]+ <(.+)>:$")
+        set(symbol "${CMAKE_MATCH_1}")
+    elseif (line MATCHES "^ *[0-9a-f]+:\t(v|k)[a-z0-9]+ ")
+        # VEX/EVEX mnemonics start with v (and the AVX-512 mask ones with k):
+        list(FIND weak_keys "${member}/${symbol}" index)
+        if (NOT index EQUAL -1)
+            list(APPEND offenders "${member}: ${symbol}")
+        endif()
+    endif()
+endforeach()
+
+if (offenders)
+    list(REMOVE_DUPLICATES offenders)
+    list(JOIN offenders "\n  " offenders)
+    message(FATAL_ERROR "weak functions with VEX/EVEX code outside the isa_ namespaces:\n  ${offenders}")
+endif()
+list(LENGTH weak_keys count)
+message(STATUS "${count} weak functions outside the isa_ namespaces, none with VEX/EVEX code")
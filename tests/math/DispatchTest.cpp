@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/dispatch.hpp>
+
+#include <cstdlib>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+std::vector<dispatch::Level> supported_levels() {
+  std::vector<dispatch::Level> levels;
+  for (dispatch::Level level : {dispatch::Level::Baseline, dispatch::Level::SSE42,
+    dispatch::Level::AVX2, dispatch::Level::AVX512})
+  {
+    if (static_cast<int>(level) <= static_cast<int>(dispatch::detected())) levels.push_back(level);
+  }
+  return levels;
+}
+
+Vec3f random_vec(std::mt19937& rng, float lo, float hi) {
+  std::uniform_real_distribution<float> dist(lo, hi);
+  return Vec3f(dist(rng), dist(rng), dist(rng));
+}
+
+void expect_vec_near(const Vec3f& a, const Vec3f& b) {
+  EXPECT_NEAR(a.x(), b.x(), 1e-5f);
+  EXPECT_NEAR(a.y(), b.y(), 1e-5f);
+  EXPECT_NEAR(a.z(), b.z(), 1e-5f);
+}
+
+// every level runs the same checks, the previous level is restored at the end:
+class DispatchTest : public ::testing::TestWithParam<dispatch::Level> {
+protected:
+  void SetUp() override {
+    ASSERT_TRUE(dispatch::force(GetParam()));
+    ASSERT_EQ(dispatch::active(), GetParam());
+  }
+  void TearDown() override { dispatch::reset(); }
+};
+
+} // namespace
+
+TEST(DispatchLevelTest, ForceAndReset) {
+  EXPECT_STREQ(dispatch::name(dispatch::Level::SSE42), "sse4.2");
+  EXPECT_TRUE(dispatch::force(dispatch::Level::Baseline));
+  EXPECT_EQ(dispatch::active(), dispatch::Level::Baseline);
+  EXPECT_EQ(dispatch::kernels().level, dispatch::Level::Baseline);
+
+  if (dispatch::detected() != dispatch::Level::AVX512) {
+    const dispatch::Level above = static_cast<dispatch::Level>(static_cast<int>(dispatch::detected()) + 1);
+    EXPECT_FALSE(dispatch::force(above));
+    EXPECT_EQ(dispatch::active(), dispatch::Level::Baseline);
+  }
+
+  dispatch::reset();
+  EXPECT_EQ(dispatch::active(), dispatch::detected());
+}
+
+TEST_P(DispatchTest, TransformMatchesTransform) {
+  const Transform<float> t(Mat4f{
+    0, -2, 0, 5,
+    1,  0, 0, 6,
+    0,  0, 3, 7,
+    0,  0, 0, 1
+  });
+  std::mt19937 rng(3);
+  // not a multiple of any packet width:
+  std::vector<Vec3f> in(37);
+  for (Vec3f& v : in) v = random_vec(rng, -4, 4);
+  std::vector<Vec3f> points(in.size()), normals(in.size());
+  std::vector<Vec4f> in4(in.size()), vectors4(in.size());
+  for (size_t i = 0; i < in.size(); ++i) in4[i] = Vec4f(in[i].x(), in[i].y(), in[i].z(), 0);
+
+  dispatch::transform_batch<TransformAs::Point>(t.matrix(), in, points);
+  dispatch::transform_batch<TransformAs::Normal>(t.matrix(), in, normals);
+  dispatch::transform_batch<TransformAs::Vector>(t.matrix(), in4, vectors4);
+
+  std::vector<Vec3f> expected_points(in.size());
+  transform_batch<TransformAs::Point>(t.matrix(), in, expected_points);
+  // no FMA on any level, bit-identical to the kernel of this build:
+  EXPECT_EQ(points, expected_points);
+  for (size_t i = 0; i < in.size(); ++i) {
+    expect_vec_near(points[i], t.transform_point(in[i]));
+    expect_vec_near(normals[i], t.transform_normal(in[i]));
+    expect_vec_near(Vec3f(vectors4[i].x(), vectors4[i].y(), vectors4[i].z()), t.transform_vector(in[i]));
+  }
+}
+
+TEST_P(DispatchTest, MultiplyMatchesMat4) {
+  std::mt19937 rng(4);
+  std::uniform_real_distribution<float> dist(-5, 5);
+  std::vector<Mat4f> a(5), b(5), out(5);
+  for (size_t n = 0; n < a.size(); ++n) {
+    for (size_t i = 0; i < 4; ++i) {
+      for (size_t j = 0; j < 4; ++j) {
+        a[n](i, j) = dist(rng);
+        b[n](i, j) = dist(rng);
+      }
+    }
+  }
+
+  dispatch::multiply(a, b, out);
+  // no FMA on any level, the products round alike:
+  for (size_t n = 0; n < a.size(); ++n) EXPECT_EQ(out[n], a[n] * b[n]);
+}
+
+TEST_P(DispatchTest, BoxesMatchScalarSlabTest) {
+  std::mt19937 rng(5);
+  std::vector<AABBf> boxes;
+  for (size_t i = 0; i < 45; ++i) {
+    const Vec3f center = random_vec(rng, -4, 4);
+    boxes.emplace_back(center - Vec3f(0.5f, 0.5f, 0.5f), center + Vec3f(0.5f, 0.5f, 0.5f));
+  }
+  std::vector<float> t_entry(boxes.size());
+
+  for (size_t r = 0; r < 16; ++r) {
+    const Rayf ray(random_vec(rng, -6, -5), random_vec(rng, 0.5f, 1.0f));
+    size_t expected_hits = 0;
+    const size_t hits = dispatch::intersect(ray, boxes, t_entry);
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      float t;
+      if (boxes[i].intersect(ray, t)) {
+        ++expected_hits;
+        EXPECT_EQ(t_entry[i], t);
+      } else {
+        EXPECT_EQ(t_entry[i], std::numeric_limits<float>::infinity());
+      }
+    }
+    EXPECT_EQ(hits, expected_hits);
+  }
+}
+
+TEST_P(DispatchTest, TrianglesFindClosestHit) {
+  std::mt19937 rng(7);
+  std::vector<Trianglef> triangles;
+  for (size_t i = 0; i < 61; ++i) {
+    const Vec3f center = random_vec(rng, -1, 1);
+    triangles.emplace_back(center + random_vec(rng, -1, 1),
+      center + random_vec(rng, -1, 1), center + random_vec(rng, -1, 1));
+  }
+
+  size_t hit_rays = 0;
+  for (size_t r = 0; r < 64; ++r) {
+    const Vec3f origin = random_vec(rng, -3, 3);
+    const Rayf ray(origin, random_vec(rng, -0.5f, 0.5f) - origin);
+
+    size_t expected = triangles.size();
+    TriangleHit<float> expected_hit{};
+    for (size_t i = 0; i < triangles.size(); ++i) {
+      TriangleHit<float> candidate;
+      if (triangles[i].intersect(ray, candidate) && (expected == triangles.size() || candidate.t < expected_hit.t)) {
+        expected = i;
+        expected_hit = candidate;
+      }
+    }
+
+    TriangleHit<float> hit{};
+    const size_t index = dispatch::intersect(ray, triangles, hit);
+    ASSERT_EQ(index, expected);
+    if (index != triangles.size()) {
+      ++hit_rays;
+      EXPECT_EQ(hit.t, expected_hit.t);
+      EXPECT_EQ(hit.u, expected_hit.u);
+      EXPECT_EQ(hit.v, expected_hit.v);
+    }
+  }
+  EXPECT_GT(hit_rays, 0u);
+}
+
+TEST_P(DispatchTest, EncodeMatchesColorPipeline) {
+  std::mt19937 rng(9);
+  std::exponential_distribution<float> radiance(1.5f);
+  // not a multiple of any packet width:
+  const size_t width = 23;
+  std::vector<RGBf> in(width * 7);
+  std::vector<RGBAf> in4(in.size());
+  for (size_t i = 0; i < in.size(); ++i) {
+    in[i] = RGBf(radiance(rng), radiance(rng), radiance(rng));
+    in4[i] = RGBAf(in[i], float(i % 5) / 4);
+  }
+  std::vector<RGBA8> out(in.size()), expected(in.size()), out4(in.size()), expected4(in.size());
+
+  for (ToneMap curve : { ToneMap::Clamp, ToneMap::Reinhard, ToneMap::ACES, ToneMap::AgX }) {
+    const ToneMapSettings settings{ curve, -0.5f, true };
+    dispatch::encode_srgb8(settings, in, width, out);
+    dispatch::encode_srgb8(settings, in4, width, out4);
+    encode_srgb8(settings, in, width, expected);
+    encode_srgb8(settings, in4, width, expected4);
+    // every instruction set rounds pow() alike:
+    for (size_t i = 0; i < in.size(); ++i) {
+      EXPECT_EQ(out[i].r, expected[i].r);
+      EXPECT_EQ(out[i].g, expected[i].g);
+      EXPECT_EQ(out[i].b, expected[i].b);
+      EXPECT_EQ(out[i].a, 255);
+      EXPECT_EQ(out4[i].r, expected4[i].r);
+      EXPECT_EQ(out4[i].g, expected4[i].g);
+      EXPECT_EQ(out4[i].b, expected4[i].b);
+      EXPECT_EQ(out4[i].a, expected4[i].a);
+    }
+  }
+
+  // an empty image is a no-op, a zero width for any other is rejected:
+  const ToneMapSettings settings{ ToneMap::Clamp, 0.0f, true };
+  dispatch::encode_srgb8(settings, std::span<const RGBf>(), 0, std::span<RGBA8>());
+  EXPECT_THROW(dispatch::encode_srgb8(settings, in, 0, out), std::invalid_argument);
+}
+
+TEST_P(DispatchTest, RejectsSpansOfDifferentSizes) {
+  std::vector<Vec3f> in(5), out(4);
+  std::vector<Vec4f> in4(5), out4(6);
+  EXPECT_THROW(dispatch::transform_batch<TransformAs::Point>(Mat4f(), in, out), std::invalid_argument);
+  EXPECT_THROW(dispatch::transform_batch<TransformAs::Vector>(Mat4f(), in4, out4), std::invalid_argument);
+
+  std::vector<Mat4f> a(3), b(2), product(3);
+  EXPECT_THROW(dispatch::multiply(a, b, product), std::invalid_argument);
+  EXPECT_THROW(dispatch::multiply(a, a, std::span<Mat4f>(product).first(2)), std::invalid_argument);
+
+  const Rayf ray(Vec3f(0, 0, 0), Vec3f(0, 0, 1));
+  std::vector<AABBf> boxes(3, AABBf(Vec3f(-1, -1, 1), Vec3f(1, 1, 2)));
+  std::vector<float> t_entry(2);
+  EXPECT_THROW(dispatch::intersect(ray, boxes, t_entry), std::invalid_argument);
+
+  // matching sizes, empty ones included, go through:
+  t_entry.resize(boxes.size());
+  EXPECT_EQ(dispatch::intersect(ray, boxes, t_entry), boxes.size());
+  dispatch::multiply(std::span<const Mat4f>(), std::span<const Mat4f>(), std::span<Mat4f>());
+}
+
+INSTANTIATE_TEST_SUITE_P(Levels, DispatchTest, ::testing::ValuesIn(supported_levels()),
+  [](const ::testing::TestParamInfo<dispatch::Level>& info) {
+    switch (info.param) {
+      case dispatch::Level::Baseline: return "Baseline";
+      case dispatch::Level::SSE42: return "SSE42";
+      case dispatch::Level::AVX2: return "AVX2";
+      case dispatch::Level::AVX512: return "AVX512";
+    }
+    return "Unknown";
+  });
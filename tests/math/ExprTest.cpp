@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/expr.hpp>
+
+#include <cmath>
+#include <random>
+
+using namespace ayan::math;
+
+namespace {
+
+template<typename NumT>
+Vec3<NumT> random_vec3(std::mt19937& rng) {
+  std::uniform_real_distribution<NumT> dist(-100, 100);
+  return Vec3<NumT>(dist(rng), dist(rng), dist(rng));
+}
+
+} // namespace
+
+template<typename NumT>
+class ExprTest : public ::testing::Test {};
+
+using ExprTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(ExprTest, ExprTypes);
+
+TYPED_TEST(ExprTest, ExactIsBitIdenticalToOperators) {
+  using NumT = TypeParam;
+  std::mt19937 rng(9);
+  std::uniform_real_distribution<NumT> scalar(-3, 3);
+
+  for (int n = 0; n < 1000; ++n) {
+    const Vec3<NumT> a = random_vec3<NumT>(rng);
+    const Vec3<NumT> b = random_vec3<NumT>(rng);
+    const Vec3<NumT> c = random_vec3<NumT>(rng);
+    const NumT s = scalar(rng);
+    const NumT t = scalar(rng);
+
+    const Vec3<NumT> r1 = lazy(a) + lazy(b) * s - lazy(c) * t;
+    EXPECT_EQ(r1, a + b * s - c * t);
+
+    const Vec3<NumT> r2 = (s * lazy(a) - b) / t + a * c;
+    EXPECT_EQ(r2, (s * a - b) / t + a * c);
+
+    const Vec3<NumT> r3 = -(lazy(a) / b) * (c - a);
+    EXPECT_EQ(r3, -(a / b) * (c - a));
+
+    EXPECT_EQ(eval<Precision::Exact>(lazy(a) * b + c), a * b + c);
+  }
+}
+
+TYPED_TEST(ExprTest, FastFusesProducts) {
+  using NumT = TypeParam;
+  std::mt19937 rng(10);
+  std::uniform_real_distribution<NumT> scalar(-3, 3);
+
+  for (int n = 0; n < 1000; ++n) {
+    const Vec3<NumT> a = random_vec3<NumT>(rng);
+    const Vec3<NumT> b = random_vec3<NumT>(rng);
+    const Vec3<NumT> c = random_vec3<NumT>(rng);
+    const NumT s = scalar(rng);
+
+    const Vec3<NumT> fast = eval<Precision::Fast>(lazy(a) + lazy(b) * s - lazy(c) * b);
+    for (size_t i = 0; i < 3; ++i) {
+#if defined(AYAN_SIMD_FMA)
+      const NumT expected = std::fma(-c[i], b[i], std::fma(b[i], s, a[i]));
+#else
+      const NumT expected = a[i] + b[i] * s - c[i] * b[i];
+#endif
+      EXPECT_EQ(fast[i], expected);
+    }
+  }
+}
+
+TEST(ExprTest, Vec4AndVec2) {
+  const Vec4f a(1, 2, 3, 4);
+  const Vec4f b(0.5f, -1, 2, 0.25f);
+  const Vec4f r = lazy(a) * 2.0f + b - lazy(a) / b;
+  EXPECT_EQ(r, a * 2.0f + b - a / b);
+
+  const Vec2d p(1, 2);
+  const Vec2d q(3, 5);
+  const Vec2d m = (lazy(p) + q) * 0.5;
+  EXPECT_EQ(m.x(), 2.0);
+  EXPECT_EQ(m.y(), 3.5);
+}
+
+TEST(ExprTest, ConstantEvaluated) {
+  constexpr Vec3d a(1, 2, 3);
+  constexpr Vec3d b(4, 5, 6);
+  constexpr Vec3d r = lazy(a) * 2.0 - b;
+  static_assert(r == Vec3d(-2, -1, 0));
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/geometry.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+// right-handed perspective looking down -z, 90 degrees vertical field of view:
+Mat4f perspective(float aspect, float near_z, float far_z, ClipDepth depth) {
+  const float z_scale = depth == ClipDepth::ZeroToOne ? far_z / (near_z - far_z) : (far_z + near_z) / (near_z - far_z);
+  const float z_offset = depth == ClipDepth::ZeroToOne ? near_z * far_z / (near_z - far_z) : 2 * near_z * far_z / (near_z - far_z);
+  return Mat4f{
+    1 / aspect, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, z_scale, z_offset,
+    0.0f, 0.0f, -1.0f, 0.0f
+  };
+}
+
+void expect_plane_near(const Vec4f& a, const Vec4f& b) {
+  EXPECT_NEAR(a.x(), b.x(), 1e-5f);
+  EXPECT_NEAR(a.y(), b.y(), 1e-5f);
+  EXPECT_NEAR(a.z(), b.z(), 1e-5f);
+  EXPECT_NEAR(a.w(), b.w(), 1e-4f);
+}
+
+} // namespace
+
+TEST(FrustumTest, PlanesFromViewProjection) {
+  const float s = std::sqrt(0.5f);
+  for (ClipDepth depth : { ClipDepth::ZeroToOne, ClipDepth::NegativeOneToOne }) {
+    const Frustumf frustum = Frustumf::FromViewProjection(perspective(1, 1, 10, depth), depth);
+    // |x| <= -z and |y| <= -z, -10 <= z <= -1:
+    expect_plane_near(frustum.plane(Frustumf::Left), Vec4f(s, 0, -s, 0));
+    expect_plane_near(frustum.plane(Frustumf::Right), Vec4f(-s, 0, -s, 0));
+    expect_plane_near(frustum.plane(Frustumf::Bottom), Vec4f(0, s, -s, 0));
+    expect_plane_near(frustum.plane(Frustumf::Top), Vec4f(0, -s, -s, 0));
+    expect_plane_near(frustum.plane(Frustumf::Near), Vec4f(0, 0, -1, -1));
+    expect_plane_near(frustum.plane(Frustumf::Far), Vec4f(0, 0, 1, 10));
+
+    EXPECT_NEAR(frustum.signed_distance(Frustumf::Near, Vec3f(0, 0, -3)), 2.0f, 1e-4f);
+    EXPECT_TRUE(frustum.contains(Vec3f(0.5f, -0.5f, -2)));
+    EXPECT_FALSE(frustum.contains(Vec3f(0, 0, -0.5f)));
+    EXPECT_FALSE(frustum.contains(Vec3f(3, 0, -2)));
+  }
+}
+
+TEST(FrustumTest, BoxesAgainstPlanes) {
+  // the camera at (5, 0, 0), the planes are in world space:
+  const Mat4f view = Mat4f::Identity() + Mat4f{ 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+  const Frustumf frustum = Frustumf::FromViewProjection(perspective(2, 1, 10, ClipDepth::ZeroToOne) * view);
+
+  EXPECT_TRUE(frustum.intersects(AABBf(Vec3f(4, -1, -5), Vec3f(6, 1, -4))));
+  // straddles the near plane and the left plane:
+  EXPECT_TRUE(frustum.intersects(AABBf(Vec3f(-1, -1, -3), Vec3f(1, 1, 0))));
+  EXPECT_FALSE(frustum.intersects(AABBf(Vec3f(4, -1, 1), Vec3f(6, 1, 2))));
+  EXPECT_FALSE(frustum.intersects(AABBf(Vec3f(4, -1, -12), Vec3f(6, 1, -11))));
+  EXPECT_FALSE(frustum.intersects(AABBf(Vec3f(4, 3.5f, -3), Vec3f(6, 4, -2))));
+  EXPECT_FALSE(frustum.intersects(AABBf::Empty()));
+
+  // the packet test matches the scalar one, unused lanes never pass:
+  AABBx8f packet;
+  packet.set_lane(0, AABBf(Vec3f(4, -1, -5), Vec3f(6, 1, -4)));
+  packet.set_lane(1, AABBf(Vec3f(4, -1, 1), Vec3f(6, 1, 2)));
+  packet.set_lane(3, AABBf(Vec3f(-1, -1, -3), Vec3f(1, 1, 0)));
+  EXPECT_EQ(frustum.intersects(packet).bits(), 0b1001u);
+}
+
+TEST(FrustumTest, CullCompactsIndices) {
+  const Frustumf frustum = Frustumf::FromViewProjection(perspective(1.5f, 0.5f, 50, ClipDepth::ZeroToOne));
+
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> position(-40, 40);
+  std::uniform_real_distribution<float> size(0.1f, 3);
+  // not a multiple of 8, the tail is padded:
+  std::vector<AABBf> boxes(1003);
+  for (AABBf& box : boxes) {
+    const Vec3f min(position(rng), position(rng), position(rng));
+    box = AABBf(min, min + Vec3f(size(rng), size(rng), size(rng)));
+  }
+
+  std::vector<uint32_t> expected;
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    if (frustum.intersects(boxes[i])) expected.push_back(uint32_t(i));
+  }
+  ASSERT_FALSE(expected.empty());
+  ASSERT_LT(expected.size(), boxes.size());
+
+  std::vector<uint32_t> visible(boxes.size());
+  const size_t count = frustum_cull<float>(frustum, boxes, visible);
+  visible.resize(count);
+  EXPECT_EQ(visible, expected);
+
+  // the same boxes in packets:
+  std::vector<AABBx8f> packets;
+  for (size_t i = 0; i < boxes.size(); i += 8) {
+    AABBx8f packet;
+    for (size_t lane = 0; lane < 8 && i + lane < boxes.size(); ++lane) packet.set_lane(lane, boxes[i + lane]);
+    packets.push_back(packet);
+  }
+  std::vector<uint32_t> visible_soa(packets.size() * 8);
+  visible_soa.resize(frustum_cull<8>(frustum, packets, visible_soa));
+  EXPECT_EQ(visible_soa, expected);
+
+  // fewer boxes than one packet:
+  std::vector<uint32_t> few(5);
+  EXPECT_EQ(frustum_cull<float>(frustum, std::span<const AABBf>(boxes).first(few.size()), few), size_t(std::count_if(
+    expected.begin(), expected.end(), [&](uint32_t index) { return index < few.size(); })));
+}
+
+TEST(FrustumTest, InfiniteFarPlaneKeepsEverythingInside) {
+  // the limit of perspective() for far_z -> inf, row 3 minus row 2 is (0, 0, 0, near_z):
+  const Mat4f infinite{
+    1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, -1.0f, -1.0f,
+    0.0f, 0.0f, -1.0f, 0.0f
+  };
+  const Frustumf frustum = Frustumf::FromViewProjection(infinite);
+  EXPECT_EQ(frustum.plane(Frustumf::Far), Vec4f::UnitW());
+
+  EXPECT_TRUE(frustum.contains(Vec3f(0, 0, -1e30f)));
+  EXPECT_FALSE(frustum.contains(Vec3f(0, 0, -0.5f)));
+  const AABBf far_box(Vec3f(-1, -1, -1e6f), Vec3f(1, 1, -1e5f));
+  EXPECT_TRUE(frustum.intersects(far_box));
+  EXPECT_FALSE(frustum.intersects(AABBf::Empty()));
+
+  AABBx8f packet;
+  packet.set_lane(0, far_box);
+  packet.set_lane(2, AABBf(Vec3f(-1, -1, 1), Vec3f(1, 1, 2)));
+  EXPECT_EQ(frustum.intersects(packet).bits(), 0b1u);
+
+  const std::vector<AABBf> boxes{far_box, AABBf(Vec3f(-1, -1, 1), Vec3f(1, 1, 2)), far_box};
+  std::vector<uint32_t> visible(boxes.size());
+  visible.resize(frustum_cull<float>(frustum, boxes, visible));
+  EXPECT_EQ(visible, (std::vector<uint32_t>{0, 2}));
+}
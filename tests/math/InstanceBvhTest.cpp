@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/bvh.hpp>
+#include <ayan/math/transform.hpp>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+Vec3f random_vec(std::mt19937& rng, float lo, float hi) {
+  std::uniform_real_distribution<float> dist(lo, hi);
+  return Vec3f(dist(rng), dist(rng), dist(rng));
+}
+
+// a cloud of small triangles around the origin:
+std::vector<Trianglef> make_mesh(size_t count, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::vector<Trianglef> triangles;
+  for (size_t i = 0; i < count; ++i) {
+    const Vec3f center = random_vec(rng, -1, 1);
+    triangles.emplace_back(center + random_vec(rng, -0.2f, 0.2f),
+      center + random_vec(rng, -0.2f, 0.2f), center + random_vec(rng, -0.2f, 0.2f));
+  }
+  return triangles;
+}
+
+Transformf random_transform(std::mt19937& rng) {
+  std::uniform_real_distribution<float> angle(0.0f, 6.0f);
+  std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+  const Vec3f axis = random_vec(rng, -1, 1);
+  TRS<float> trs;
+  trs.translation = random_vec(rng, -20, 20);
+  trs.rotation = Quat<float>::AxisAngle(axis / axis.length(), angle(rng));
+  trs.scale = Vec3f(scale(rng), scale(rng), scale(rng));
+  return Transformf(trs.to_mat4());
+}
+
+// the scene as world space triangles, by instance then primitive:
+struct Flattened {
+  std::vector<Trianglef> triangles;
+  std::vector<std::pair<uint32_t, uint32_t>> origins;
+};
+
+Flattened flatten(const InstanceBvh& scene) {
+  Flattened flat;
+  for (uint32_t i = 0; i < scene.instances().size(); ++i) {
+    const BvhInstance& instance = scene.instances()[i];
+    const auto triangles = scene.meshes()[instance.mesh].triangles();
+    for (uint32_t p = 0; p < triangles.size(); ++p) {
+      const Trianglef& t = triangles[p];
+      flat.triangles.emplace_back(instance.transform.transform_point(t.vertex(0)),
+        instance.transform.transform_point(t.vertex(1)), instance.transform.transform_point(t.vertex(2)));
+      flat.origins.emplace_back(i, p);
+    }
+  }
+  return flat;
+}
+
+} // namespace
+
+TEST(InstanceBvhTest, MatchesFlattenedScene) {
+  std::vector<MeshBvh> meshes;
+  meshes.push_back(MeshBvh::Build(make_mesh(400, 1)));
+  meshes.push_back(MeshBvh::Build(make_mesh(900, 2)));
+  std::mt19937 rng(3);
+  std::vector<BvhInstance> instances;
+  for (uint32_t i = 0; i < 60; ++i) instances.push_back(BvhInstance{ i % 2, random_transform(rng) });
+  const InstanceBvh scene = InstanceBvh::Build(meshes, instances);
+  EXPECT_EQ(scene.bvh().indices().size(), instances.size());
+
+  // every world triangle is inside the box of its instance:
+  const Flattened flat = flatten(scene);
+  for (size_t i = 0; i < flat.triangles.size(); ++i) {
+    const AABBf& box = scene.instance_bounds()[flat.origins[i].first];
+    EXPECT_TRUE(box.contains(flat.triangles[i].bounds().min()) && box.contains(flat.triangles[i].bounds().max()));
+  }
+
+  // rays at world triangle centers from anywhere, nearest hits agree up to
+  // the rounding of the transforms:
+  const Bvh reference = Bvh::Build(flat.triangles);
+  std::uniform_int_distribution<size_t> pick(0, flat.triangles.size() - 1);
+  size_t same = 0;
+  for (size_t r = 0; r < 500; ++r) {
+    const Trianglef& target = flat.triangles[pick(rng)];
+    const Vec3f origin = random_vec(rng, -40, 40);
+    const Rayf ray(origin, (target.vertex(0) + target.vertex(1) + target.vertex(2)) / 3.0f - origin);
+    BvhHit expected{};
+    InstanceHit hit{};
+    ASSERT_TRUE(reference.intersect(flat.triangles, ray, expected));
+    ASSERT_TRUE(scene.intersect(ray, hit));
+    EXPECT_NEAR(hit.t, expected.t, 1e-4f * expected.t);
+    same += flat.origins[expected.primitive] == std::pair(hit.instance, hit.primitive);
+  }
+  EXPECT_GT(same, 490u);
+
+  // misses:
+  InstanceHit hit{};
+  EXPECT_FALSE(scene.intersect(Rayf(Vec3f(100, 100, 100), Vec3f(1, 0, 0)), hit));
+  EXPECT_FALSE(InstanceBvh().intersect(Rayf(Vec3f(), Vec3f(1, 0, 0)), hit));
+  EXPECT_TRUE(InstanceBvh::Build(meshes, {}).is_empty());
+}
+
+TEST(InstanceBvhTest, MovingInstancesKeepsMeshTrees) {
+  const std::vector<Trianglef> quad{ Trianglef(Vec3f(-1, -1, 0), Vec3f(1, -1, 0), Vec3f(1, 1, 0)),
+    Trianglef(Vec3f(-1, -1, 0), Vec3f(1, 1, 0), Vec3f(-1, 1, 0)) };
+  const std::vector<MeshBvh> meshes{ MeshBvh::Build(quad) };
+  const auto* nodes = meshes[0].bvh().nodes().data();
+  const double build_seconds = meshes[0].bvh().stats().build_seconds;
+
+  std::vector<BvhInstance> instances;
+  for (int i = 0; i < 10; ++i) {
+    TRS<float> trs;
+    trs.translation = Vec3f(0, 0, float(10 + i));
+    instances.push_back(BvhInstance{ 0, Transformf(trs.to_mat4()) });
+  }
+  InstanceBvh scene = InstanceBvh::Build(meshes, instances);
+  const Rayf ray(Vec3f(0.25f, 0.5f, 0), Vec3f(0, 0, 1));
+  InstanceHit hit{};
+  ASSERT_TRUE(scene.intersect(ray, hit));
+  EXPECT_EQ(hit.instance, 0u);
+  EXPECT_FLOAT_EQ(hit.t, 10.0f);
+
+  // the nearest quad moves behind the others, scaled by 2 and turned over:
+  TRS<float> moved;
+  moved.translation = Vec3f(0, 0, 30);
+  moved.rotation = Quat<float>::AxisAngle(Vec3f(1, 0, 0), 3.14159265f);
+  moved.scale = Vec3f(2, 2, 2);
+  scene.set_transform(0, Transformf(moved.to_mat4()));
+  ASSERT_TRUE(scene.intersect(ray, hit));
+  EXPECT_EQ(hit.instance, 1u);
+  EXPECT_FLOAT_EQ(hit.t, 11.0f);
+  EXPECT_NEAR(scene.instance_bounds()[0].max().x(), 2.0f, 1e-4f);
+  EXPECT_NEAR(scene.bounds().max().z(), 30.0f, 1e-3f);
+
+  // all the others out of the way in one rebuild, the moved one is hit in object space:
+  std::vector<uint32_t> indices;
+  std::vector<Transformf> transforms;
+  for (uint32_t i = 1; i < 10; ++i) {
+    TRS<float> away;
+    away.translation = Vec3f(100, 0, 0);
+    indices.push_back(i);
+    transforms.push_back(Transformf(away.to_mat4()));
+  }
+  scene.set_transforms(indices, transforms);
+  ASSERT_TRUE(scene.intersect(ray, hit));
+  EXPECT_EQ(hit.instance, 0u);
+  EXPECT_NEAR(hit.t, 30.0f, 1e-4f);
+  // (0.125, -0.25) in object space, below the diagonal:
+  EXPECT_EQ(hit.primitive, 0u);
+
+  // the shared tree wasn't touched:
+  EXPECT_EQ(meshes[0].bvh().nodes().data(), nodes);
+  EXPECT_EQ(meshes[0].bvh().stats().build_seconds, build_seconds);
+}
+
+TEST(InstanceBvhTest, RejectsInvalidInstances) {
+  const std::vector<MeshBvh> meshes{ MeshBvh::Build(make_mesh(8, 3)) };
+  Mat4f projective;
+  projective(3, 2) = 0.5f;
+
+  EXPECT_THROW(InstanceBvh::Build(meshes, { BvhInstance{ 1, Transformf() } }), std::invalid_argument);
+  EXPECT_THROW(InstanceBvh::Build(meshes, { BvhInstance{ 0, Transformf(projective) } }), std::invalid_argument);
+
+  InstanceBvh scene = InstanceBvh::Build(meshes, { BvhInstance{ 0, Transformf() }, BvhInstance{ 0, Transformf() } });
+  TRS<float> moved;
+  moved.translation = Vec3f(5, 0, 0);
+  const Transformf translate(moved.to_mat4());
+  EXPECT_THROW(scene.set_transform(2, translate), std::invalid_argument);
+  EXPECT_THROW(scene.set_transform(0, Transformf(projective)), std::invalid_argument);
+
+  // nothing moves if any of the instances is rejected:
+  const std::vector<uint32_t> indices{ 0, 2 };
+  const std::vector<Transformf> transforms{ translate, translate };
+  EXPECT_THROW(scene.set_transforms(indices, transforms), std::invalid_argument);
+  EXPECT_THROW(scene.set_transforms(std::span(indices).first(1), transforms), std::invalid_argument);
+  const std::vector<Transformf> with_projective{ translate, Transformf(projective) };
+  EXPECT_THROW(scene.set_transforms(std::vector<uint32_t>{ 0, 1 }, with_projective), std::invalid_argument);
+  EXPECT_EQ(scene.instances()[0].transform.matrix(), Mat4f());
+  EXPECT_LT(scene.instance_bounds()[0].max().x(), 2.0f);
+}
+
+TEST(InstanceBvhTest, BoundsCoverTheRoundingOfLargeCoordinates) {
+  // far from the origin in object space, moved back next to it: the terms of
+  // the transform are large, the results small, and the rounding is of the terms:
+  std::vector<Trianglef> far_mesh = make_mesh(64, 5);
+  for (Trianglef& t : far_mesh) {
+    const Vec3f offset(1e6f, -1e6f, 1e6f);
+    t = Trianglef(t.vertex(0) + offset, t.vertex(1) + offset, t.vertex(2) + offset);
+  }
+  const std::vector<MeshBvh> meshes{ MeshBvh::Build(far_mesh) };
+
+  std::mt19937 rng(11);
+  for (int n = 0; n < 16; ++n) {
+    // scales only: the vertices on the faces of the mesh box are its corners, so
+    // the rounding of the corners shows (a rotation widens the box by more):
+    TRS<float> trs;
+    trs.scale = random_vec(rng, 0.5f, 2.0f);
+    trs.translation = -trs.scale * Vec3f(1e6f, -1e6f, 1e6f);
+    const Transformf transform(trs.to_mat4());
+    const InstanceBvh scene = InstanceBvh::Build(meshes, { BvhInstance{ 0, transform } });
+    const AABBf& box = scene.instance_bounds()[0];
+
+    // every vertex transformed exactly (in double) is inside the world box:
+    const Mat4f& m = transform.matrix();
+    for (const Trianglef& t : far_mesh) {
+      for (size_t k = 0; k < 3; ++k) {
+        for (size_t a = 0; a < 3; ++a) {
+          double exact = m(a, 3);
+          for (size_t j = 0; j < 3; ++j) exact += double(m(a, j)) * double(t.vertex(k)[j]);
+          EXPECT_GE(exact, double(box.min()[a]));
+          EXPECT_LE(exact, double(box.max()[a]));
+        }
+      }
+    }
+  }
+}
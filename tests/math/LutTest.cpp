@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/lut.hpp>
+#include <ayan/math/color.hpp>
+
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <random>
+
+using namespace ayan::math;
+
+namespace {
+
+using Pack8f = simd::Pack<float, 8>;
+
+// linear functions are reproduced exactly by (bi/tri)linear interpolation:
+constexpr auto kLine = Lut1D<5>::Generate([](float u) { return 2.0f * u + 1.0f; });
+constexpr auto kPlane = Lut2D<4, 3>::Generate([](float u, float v) { return u + 10.0f * v; });
+constexpr auto kVolume = Lut3D<3, 4, 5>::Generate([](float u, float v, float w) { return u + 10.0f * v + 100.0f * w; });
+
+static_assert(kLine(0.0f) == 1.0f && kLine(1.0f) == 3.0f && kLine(0.5f) == 2.0f);
+static_assert(kPlane.at(3, 2) == 11.0f);
+static_assert(kLinearToSrgbLut(0.0f) == 0.0f && kLinearToSrgbLut(1.0f) == 1.0f);
+
+// lane `i` of a pack filled by `func(i)`:
+template<typename Func>
+Pack8f make_pack(Func&& func) {
+  alignas(32) float lanes[8];
+  for (size_t i = 0; i < 8; ++i) lanes[i] = func(i);
+  return Pack8f::Load(lanes);
+}
+
+} // namespace
+
+TEST(LutTest, InterpolatesLinearFunctionsExactly) {
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> coord(0.0f, 1.0f);
+  for (size_t n = 0; n < 64; ++n) {
+    const float u = coord(rng);
+    const float v = coord(rng);
+    const float w = coord(rng);
+    EXPECT_NEAR(kLine(u), 2.0f * u + 1.0f, 1e-5f);
+    EXPECT_NEAR(kPlane(u, v), u + 10.0f * v, 1e-4f);
+    EXPECT_NEAR(kVolume(u, v, w), u + 10.0f * v + 100.0f * w, 1e-3f);
+  }
+
+  // clamped to the edges, NaN reads the first value:
+  EXPECT_EQ(kLine(-5.0f), 1.0f);
+  EXPECT_EQ(kLine(7.0f), 3.0f);
+  EXPECT_EQ(kLine(std::numeric_limits<float>::quiet_NaN()), 1.0f);
+  EXPECT_EQ(kPlane(2.0f, -1.0f), 1.0f);
+}
+
+TEST(LutTest, PacketLookupsMatchScalar) {
+  std::mt19937 rng(2);
+  std::uniform_real_distribution<float> coord(-0.2f, 1.2f);
+  for (size_t n = 0; n < 16; ++n) {
+    alignas(32) float u[8], v[8], w[8], out1[8], out2[8], out3[8];
+    for (size_t i = 0; i < 8; ++i) {
+      u[i] = coord(rng);
+      v[i] = coord(rng);
+      w[i] = coord(rng);
+    }
+    u[7] = std::numeric_limits<float>::quiet_NaN();
+    kLine(Pack8f::Load(u)).store(out1);
+    kPlane(Pack8f::Load(u), Pack8f::Load(v)).store(out2);
+    kVolume(Pack8f::Load(u), Pack8f::Load(v), Pack8f::Load(w)).store(out3);
+    for (size_t i = 0; i < 8; ++i) {
+      EXPECT_FLOAT_EQ(out1[i], kLine(u[i]));
+      EXPECT_FLOAT_EQ(out2[i], kPlane(u[i], v[i]));
+      EXPECT_FLOAT_EQ(out3[i], kVolume(u[i], v[i], w[i]));
+    }
+  }
+}
+
+TEST(LutTest, SrgbTables) {
+  float worst = 0.0f;
+  for (float x = 0.0f; x <= 1.0f; x += 1.0f / 65536) {
+    worst = std::max(worst, std::abs(kLinearToSrgbLut(x) - linear_to_srgb(x)));
+  }
+  EXPECT_LT(worst, 2.5e-4f);
+
+  for (int level = 0; level < 256; ++level) {
+    const float linear = srgb8_to_linear(uint8_t(level));
+    EXPECT_NEAR(linear, srgb_to_linear(float(level) / 255.0f), 1e-6f);
+    EXPECT_EQ(int(linear_to_srgb(linear) * 255.0f + 0.5f), level);
+  }
+}
+
+TEST(LutTest, GGXTablesMatchIntegrals) {
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<float> coord(0.05f, 1.0f);
+  for (size_t n = 0; n < 16; ++n) {
+    const float mu = coord(rng);
+    const float roughness = coord(rng);
+    const float eta = 1.0f + 2.0f * coord(rng);
+    EXPECT_NEAR(ggx_albedo(mu, roughness), detail::integrate_ggx_albedo(mu, roughness, 0.0, 64), 0.01);
+    EXPECT_NEAR(ggx_dielectric_albedo(mu, roughness, eta), detail::integrate_ggx_albedo(mu, roughness, eta, 64), 0.01);
+  }
+
+  // a mirror reflects everything, nothing without a boundary:
+  EXPECT_NEAR(ggx_albedo(0.7f, 0.0f), 1.0f, 1e-3f);
+  EXPECT_NEAR(ggx_average_albedo(0.0f), 1.0f, 1e-3f);
+  EXPECT_NEAR(ggx_dielectric_albedo(0.7f, 0.5f, 1.0f), 0.0f, 1e-6f);
+  // energy loss grows with roughness:
+  for (float r = 0.1f; r <= 1.0f; r += 0.1f) EXPECT_LT(ggx_average_albedo(r), ggx_average_albedo(r - 0.1f));
+
+  // 0.0918 for glass (Kulla and Conty's F_avg), the closed form of Schlick:
+  EXPECT_NEAR(fresnel_dielectric_average(1.5f), 0.0918f, 5e-4f);
+  EXPECT_NEAR(fresnel_dielectric_average(1.0f), 0.0f, 1e-6f);
+  EXPECT_FLOAT_EQ(fresnel_schlick_average(1.0f), 1.0f);
+  EXPECT_FLOAT_EQ(fresnel_schlick_average(0.04f), 1.8f / 21.0f);
+}
+
+TEST(LutTest, MultiscatterRestoresEnergy) {
+  // white furnace: single + multiple scattering reflect all the light, the
+  // cosine-weighted integral of the lobe over the hemisphere is 1 - E(mu_o):
+  constexpr size_t samples = 256;
+  for (float roughness : { 0.3f, 0.6f, 1.0f }) {
+    for (float mu_o : { 0.2f, 0.5f, 0.9f }) {
+      double multiple = 0.0;
+      for (size_t i = 0; i < samples; ++i) {
+        const float mu_i = (float(i) + 0.5f) / samples;
+        multiple += ggx_multiscatter(mu_o, mu_i, roughness) * mu_i * 2.0 * std::numbers::pi / samples;
+      }
+      EXPECT_NEAR(ggx_albedo(mu_o, roughness) + multiple, 1.0, 0.01) << roughness << " " << mu_o;
+    }
+  }
+
+  const float e_avg = ggx_average_albedo(0.5f);
+  EXPECT_NEAR(ggx_multiscatter_fresnel(1.0f, e_avg), 1.0f, 1e-6f);
+  EXPECT_LT(ggx_multiscatter_fresnel(0.5f, e_avg), 0.5f);
+}
+
+TEST(LutTest, BsdfPacketLookupsMatchScalar) {
+  const Pack8f mu = make_pack([](size_t i) { return 0.1f + 0.11f * float(i); });
+  const Pack8f roughness = make_pack([](size_t i) { return 1.0f - 0.12f * float(i); });
+  const Pack8f eta = make_pack([](size_t i) { return 1.0f + 0.27f * float(i); });
+  alignas(32) float albedo[8], average[8], dielectric[8], multiple[8], fresnel[8];
+  ggx_albedo(mu, roughness).store(albedo);
+  ggx_average_albedo(roughness).store(average);
+  ggx_dielectric_albedo(mu, roughness, eta).store(dielectric);
+  ggx_multiscatter(mu, roughness, roughness).store(multiple);
+  fresnel_dielectric_average(eta).store(fresnel);
+  for (size_t i = 0; i < 8; ++i) {
+    EXPECT_FLOAT_EQ(albedo[i], ggx_albedo(mu[i], roughness[i]));
+    EXPECT_FLOAT_EQ(average[i], ggx_average_albedo(roughness[i]));
+    EXPECT_FLOAT_EQ(dielectric[i], ggx_dielectric_albedo(mu[i], roughness[i], eta[i]));
+    EXPECT_FLOAT_EQ(multiple[i], ggx_multiscatter(mu[i], roughness[i], roughness[i]));
+    EXPECT_FLOAT_EQ(fresnel[i], fresnel_dielectric_average(eta[i]));
+  }
+}
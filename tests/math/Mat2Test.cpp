@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/mat.hpp>
+
+using namespace ayan::math;
+
+static_assert((Mat2i{1, 2, 3, 4} * Mat2i{0, 1, 1, 0}) == Mat2i{2, 1, 4, 3});
+static_assert(Mat2d{4, 7, 2, 6}.determinant() == 10.0);
+
+template<typename NumT>
+class Mat2TypedTest : public ::testing::Test {};
+
+using Mat2NumTypes = ::testing::Types<float, double, int>;
+TYPED_TEST_SUITE(Mat2TypedTest, Mat2NumTypes);
+
+TYPED_TEST(Mat2TypedTest, ElementAccessAndProduct) {
+  const Mat2<TypeParam> m{
+    1, 2,
+    3, 4
+  };
+
+  EXPECT_EQ(m(0, 1), TypeParam(2));
+  EXPECT_EQ(m.template col<0>(), Vec2<TypeParam>(1, 3));
+  EXPECT_EQ(m.template row<1>(), Vec2<TypeParam>(3, 4));
+  EXPECT_EQ(m * Vec2<TypeParam>(1, 1), Vec2<TypeParam>(3, 7));
+  EXPECT_EQ(m * m, (Mat2<TypeParam>{7, 10, 15, 22}));
+  EXPECT_EQ(m * Mat2<TypeParam>::Identity(), m);
+  EXPECT_EQ(m.transpose(), (Mat2<TypeParam>{1, 3, 2, 4}));
+  EXPECT_EQ(m.determinant(), TypeParam(-2));
+  EXPECT_EQ(m.trace(), TypeParam(5));
+  EXPECT_TRUE((Mat2<TypeParam>{0, -1, 1, 0}).is_orthogonal());
+  EXPECT_FALSE(m.is_orthogonal());
+}
+
+TEST(Mat2Test, Inverse) {
+  const Mat2d m{
+    4, 7,
+    2, 6
+  };
+
+  const Mat2d expected{0.6, -0.7, -0.2, 0.4};
+  const Mat2d product = m * m.inverse();
+  for (size_t i = 0; i < 2; ++i) {
+    for (size_t j = 0; j < 2; ++j) {
+      EXPECT_NEAR(m.inverse()(i, j), expected(i, j), 1e-15);
+      EXPECT_NEAR(product(i, j), i == j ? 1.0 : 0.0, 1e-15);
+    }
+  }
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/mat.hpp>
+
+using namespace ayan::math;
+
+template<typename NumT>
+Mat3<NumT> reference_multiply(const Mat3<NumT>& a, const Mat3<NumT>& b) {
+  Mat3<NumT> result;
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      NumT sum = 0;
+      for (size_t k = 0; k < 3; ++k) {
+        sum += a(i, k) * b(k, j);
+      }
+      result(i, j) = sum;
+    }
+  }
+  return result;
+}
+
+constexpr Mat3f kConstProduct = Mat3f{
+  1, 0, 0,
+  0, 2, 0,
+  0, 0, 3
+} * Mat3f{
+  1, 1, 1,
+  0, 1, 1,
+  0, 0, 1
+};
+static_assert(kConstProduct(0, 2) == 1.0f && kConstProduct(1, 2) == 2.0f && kConstProduct(2, 2) == 3.0f);
+static_assert((Mat3d() * Vec3d{1.0, 2.0, 3.0}).z() == 3.0);
+
+// inexact products, the run time path rounds the same way:
+constexpr Mat3f kInexactLhs{
+  0.1f, 0.7f, -1.3f,
+  1.1f, -0.3f, 0.37f,
+  -2.2f, 0.01f, 3.3f
+};
+constexpr Mat3f kInexactRhs{
+  1.9f, -0.6f, 0.11f,
+  0.3f, 2.4f, -1.7f,
+  -0.8f, 0.05f, 1.3f
+};
+constexpr Mat3f kInexactProduct = kInexactLhs * kInexactRhs;
+constexpr Vec3f kInexactColumn = kInexactLhs * Vec3f{0.3f, -1.1f, 2.7f};
+static_assert(Mat3d().inverse() == Mat3d() && Mat3i().determinant() == 1);
+
+template<typename NumT>
+class Mat3TypedTest : public ::testing::Test {};
+
+using Mat3NumTypes = ::testing::Types<float, double, int>;
+TYPED_TEST_SUITE(Mat3TypedTest, Mat3NumTypes);
+
+TYPED_TEST(Mat3TypedTest, ElementAccessIsRowColumn) {
+  const Mat3<TypeParam> m{
+    1, 2, 3,
+    4, 5, 6,
+    7, 8, 9
+  };
+
+  EXPECT_EQ(m(0, 1), TypeParam(2));
+  EXPECT_EQ(m(2, 0), TypeParam(7));
+  EXPECT_EQ(m.template col<1>(), Vec3<TypeParam>(2, 5, 8));
+  EXPECT_EQ(m.template row<1>(), Vec3<TypeParam>(4, 5, 6));
+
+  Mat3<TypeParam> n = m;
+  n.template set_col<2>(Vec3<TypeParam>(0, 0, 1));
+  EXPECT_EQ(n(0, 2), TypeParam(0));
+  EXPECT_EQ(n(2, 2), TypeParam(1));
+}
+
+TYPED_TEST(Mat3TypedTest, ProductMatchesReference) {
+  const Mat3<TypeParam> a{
+    1, 2, 3,
+    4, 5, 6,
+    7, 8, 9
+  };
+  const Mat3<TypeParam> b{
+    2, -1,  0,
+    1,  4, -2,
+    0,  5,  1
+  };
+
+  EXPECT_EQ(a * b, reference_multiply(a, b));
+  EXPECT_EQ(b * a, reference_multiply(b, a));
+  EXPECT_EQ(a * Mat3<TypeParam>::Identity(), a);
+
+  Mat3<TypeParam> c = a;
+  c *= b;
+  EXPECT_EQ(c, a * b);
+  EXPECT_EQ(a * Vec3<TypeParam>(1, 0, -1), Vec3<TypeParam>(-2, -2, -2));
+}
+
+TEST(Mat3Test, ProductMatchesConstantEvaluation) {
+  const Mat3f lhs = kInexactLhs;
+  const Mat3f rhs = kInexactRhs;
+  EXPECT_EQ(lhs * rhs, kInexactProduct);
+  EXPECT_EQ(lhs * Vec3f(0.3f, -1.1f, 2.7f), kInexactColumn);
+}
+
+TYPED_TEST(Mat3TypedTest, DeterminantTransposeTrace) {
+  const Mat3<TypeParam> m{
+    2, -1,  0,
+    1,  4, -2,
+    0,  5,  1
+  };
+
+  EXPECT_EQ(m.determinant(), TypeParam(29));
+  EXPECT_EQ(m.transpose().determinant(), m.determinant());
+  EXPECT_EQ(m.transpose().template col<0>(), m.template row<0>());
+  EXPECT_EQ(m.transpose().transpose(), m);
+  EXPECT_EQ(m.trace(), TypeParam(7));
+  EXPECT_FALSE(m.is_symmetric());
+  EXPECT_TRUE((m + m.transpose()).is_symmetric());
+  EXPECT_TRUE(Mat3<TypeParam>().is_identity());
+}
+
+TYPED_TEST(Mat3TypedTest, Mat4RoundTrip) {
+  const Mat4<TypeParam> m4{
+    1, 2, 3, 10,
+    4, 5, 6, 11,
+    7, 8, 9, 12,
+    0, 0, 0, 1
+  };
+  const Mat3<TypeParam> m3(m4);
+
+  EXPECT_EQ(m3.template row<2>(), Vec3<TypeParam>(7, 8, 9));
+  EXPECT_EQ(m3.to_mat4()(0, 3), TypeParam(0));
+  EXPECT_EQ(Mat3<TypeParam>(m3.to_mat4()), m3);
+}
+
+template<typename NumT>
+class Mat3FloatTest : public ::testing::Test {};
+
+using Mat3FloatTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(Mat3FloatTest, Mat3FloatTypes);
+
+TYPED_TEST(Mat3FloatTest, Inverse) {
+  const Mat3<TypeParam> m{
+    2, -1,  0,
+    1,  4, -2,
+    0,  5,  1
+  };
+  const TypeParam eps = std::is_same_v<TypeParam, float> ? TypeParam(1e-6) : TypeParam(1e-14);
+
+  const Mat3<TypeParam> product = m * m.inverse();
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      EXPECT_NEAR(product(i, j), i == j ? TypeParam(1) : TypeParam(0), eps);
+    }
+  }
+  EXPECT_NEAR(m.inverse().determinant(), TypeParam(1) / m.determinant(), eps);
+}
+
+TYPED_TEST(Mat3FloatTest, OrthonormalBasis) {
+  const Vec3<TypeParam> normals[] = {
+    Vec3<TypeParam>(0, 0, 1),
+    Vec3<TypeParam>(0, 0, -1),
+    Vec3<TypeParam>(1, 2, 3).normalize(),
+    Vec3<TypeParam>(-3, 0.5, -0.25).normalize()
+  };
+  const TypeParam eps = std::is_same_v<TypeParam, float> ? TypeParam(1e-6) : TypeParam(1e-14);
+
+  for (const Vec3<TypeParam>& n : normals) {
+    const Mat3<TypeParam> basis = Mat3<TypeParam>::OrthonormalBasis(n);
+    EXPECT_EQ(basis.template col<2>(), n);
+    EXPECT_TRUE(basis.is_orthogonal());
+    // right-handed: tangent x bitangent == normal
+    EXPECT_NEAR(basis.determinant(), TypeParam(1), eps);
+  }
+}
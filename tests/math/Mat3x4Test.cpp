@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/mat.hpp>
+
+using namespace ayan::math;
+
+constexpr Mat3x4f kConstProduct = Mat3x4f::Translation(Vec3f{1, 2, 3}) * Mat3x4f{
+  0, -1, 0, 0,
+  1,  0, 0, 0,
+  0,  0, 1, 0
+};
+static_assert(kConstProduct(0, 1) == -1.0f && kConstProduct(1, 3) == 2.0f && kConstProduct(2, 3) == 3.0f);
+constexpr Mat3x4f kInexactLhs{
+  0.1f, 0.7f, -1.3f, 2.9f,
+  1.1f, -0.3f, 0.37f, 5.5f,
+  -2.2f, 0.01f, 3.3f, 0.6f
+};
+constexpr Mat3x4f kInexactRhs{
+  1.9f, -0.6f, 0.11f, 7.1f,
+  0.3f, 2.4f, -1.7f, 0.2f,
+  -0.8f, 0.05f, 1.3f, -3.9f
+};
+constexpr Mat3x4f kInexactProduct = kInexactLhs * kInexactRhs;
+static_assert(Mat3x4d().inverse() == Mat3x4d() && Mat3x4i().determinant() == 1);
+static_assert(sizeof(Affine3f) == 48 && sizeof(Mat3x4f) * 4 == sizeof(Mat4f) * 3);
+
+template<typename NumT>
+class Mat3x4TypedTest : public ::testing::Test {};
+
+using Mat3x4NumTypes = ::testing::Types<float, double, int>;
+TYPED_TEST_SUITE(Mat3x4TypedTest, Mat3x4NumTypes);
+
+TEST(Mat3x4Test, ProductMatchesConstantEvaluation) {
+  const Mat3x4f lhs = kInexactLhs;
+  const Mat3x4f rhs = kInexactRhs;
+  EXPECT_EQ(lhs * rhs, kInexactProduct);
+}
+
+template<typename NumT>
+Mat4<NumT> affine_sample() {
+  // rotation about z by 90 degrees, non-uniform scale and a translation:
+  return Mat4<NumT>{
+    0, -2, 0, 5,
+    1,  0, 0, 6,
+    0,  0, 3, 7,
+    0,  0, 0, 1
+  };
+}
+
+template<typename NumT>
+Mat4<NumT> affine_other() {
+  return Mat4<NumT>{
+    1, 2, 0, -1,
+    0, 1, 4,  2,
+    3, 0, 1,  0,
+    0, 0, 0,  1
+  };
+}
+
+TYPED_TEST(Mat3x4TypedTest, ConversionToMat4IsLossless) {
+  const Mat4<TypeParam> m = affine_sample<TypeParam>();
+  const Mat3x4<TypeParam> a(m);
+
+  EXPECT_EQ(a.to_mat4(), m);
+  EXPECT_EQ(Mat3x4<TypeParam>(a.to_mat4()), a);
+  EXPECT_EQ(a(0, 1), TypeParam(-2));
+  EXPECT_EQ(a(2, 3), TypeParam(7));
+  EXPECT_EQ(a.template row<1>(), Vec4<TypeParam>(1, 0, 0, 6));
+  EXPECT_EQ(a.translation(), Vec3<TypeParam>(5, 6, 7));
+  EXPECT_EQ(a.linear(), Mat3<TypeParam>(m));
+  EXPECT_EQ(Mat3x4<TypeParam>(a.linear(), a.translation()), a);
+  EXPECT_TRUE(Mat3x4<TypeParam>::Identity().is_identity());
+  EXPECT_EQ(Mat3x4<TypeParam>::Identity().to_mat4(), Mat4<TypeParam>::Identity());
+}
+
+TYPED_TEST(Mat3x4TypedTest, ComposeMatchesMat4) {
+  const Mat4<TypeParam> m = affine_sample<TypeParam>();
+  const Mat4<TypeParam> n = affine_other<TypeParam>();
+  const Mat3x4<TypeParam> a(m);
+  const Mat3x4<TypeParam> b(n);
+
+  EXPECT_EQ((a * b).to_mat4(), m * n);
+  EXPECT_EQ((b * a).to_mat4(), n * m);
+  EXPECT_EQ(a * Mat3x4<TypeParam>::Identity(), a);
+  EXPECT_EQ(Mat3x4<TypeParam>::Identity() * a, a);
+
+  Mat3x4<TypeParam> c = a;
+  c *= b;
+  EXPECT_EQ(c, a * b);
+  EXPECT_EQ(a.determinant(), m.determinant());
+}
+
+TYPED_TEST(Mat3x4TypedTest, PointsAndVectorsMatchMat4) {
+  const Mat4<TypeParam> m = affine_sample<TypeParam>();
+  const Mat3x4<TypeParam> a(m);
+  const Vec3<TypeParam> v(1, -2, 3);
+
+  const Vec4<TypeParam> point = m * Vec4<TypeParam>(v.x(), v.y(), v.z(), TypeParam(1));
+  const Vec4<TypeParam> vector = m * Vec4<TypeParam>(v.x(), v.y(), v.z(), TypeParam(0));
+  EXPECT_EQ(a.transform_point(v), Vec3<TypeParam>(point.x(), point.y(), point.z()));
+  EXPECT_EQ(a.transform_vector(v), Vec3<TypeParam>(vector.x(), vector.y(), vector.z()));
+  EXPECT_EQ(Mat3x4<TypeParam>::Translation(v).transform_vector(v), v);
+}
+
+template<typename NumT>
+class Mat3x4InverseTest : public ::testing::Test {};
+
+using Mat3x4FloatTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(Mat3x4InverseTest, Mat3x4FloatTypes);
+
+TYPED_TEST(Mat3x4InverseTest, InverseMatchesMat4AffineInverse) {
+  const TypeParam eps = std::is_same_v<TypeParam, float> ? TypeParam(1e-6) : TypeParam(1e-14);
+
+  for (const Mat4<TypeParam>& m : { affine_sample<TypeParam>(), affine_other<TypeParam>() }) {
+    const Mat3x4<TypeParam> a(m);
+    const Mat4<TypeParam> expected = m.affine_inverse();
+    const Mat4<TypeParam> actual = a.inverse().to_mat4();
+    for (size_t i = 0; i < 4; ++i) {
+      for (size_t j = 0; j < 4; ++j) {
+        EXPECT_NEAR(actual(i, j), expected(i, j), eps) << "at (" << i << ", " << j << ")";
+      }
+    }
+
+    // round trip of a point through the transform and its inverse:
+    const Vec3<TypeParam> p(TypeParam(0.5), TypeParam(-3), TypeParam(2));
+    const Vec3<TypeParam> back = a.inverse().transform_point(a.transform_point(p));
+    EXPECT_NEAR(back.x(), p.x(), eps * 10);
+    EXPECT_NEAR(back.y(), p.y(), eps * 10);
+    EXPECT_NEAR(back.z(), p.z(), eps * 10);
+  }
+}
@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/mat.hpp>
+
+#include <cmath>
+
+using namespace ayan::math;
+
+// textbook definition, the reference for the column-combination kernel:
+template<typename NumT>
+Mat4<NumT> reference_multiply(const Mat4<NumT>& a, const Mat4<NumT>& b) {
+  Mat4<NumT> result;
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 4; ++j) {
+      NumT sum = 0;
+      for (size_t k = 0; k < 4; ++k) {
+        sum += a(i, k) * b(k, j);
+      }
+      result(i, j) = sum;
+    }
+  }
+  return result;
+}
+
+// the scalar path must stay usable in constant expressions:
+constexpr Mat4f kConstProduct = Mat4f{
+  1, 0, 0, 5,
+  0, 2, 0, 6,
+  0, 0, 3, 7,
+  0, 0, 0, 1
+} * Mat4f{
+  1, 0, 0, 1,
+  0, 1, 0, 1,
+  0, 0, 1, 1,
+  0, 0, 0, 1
+};
+static_assert(kConstProduct(0, 3) == 6.0f && kConstProduct(1, 3) == 8.0f && kConstProduct(2, 3) == 10.0f);
+static_assert((Mat4d() * Vec4d{1.0, 2.0, 3.0, 4.0}).z() == 3.0);
+
+// inexact products, the run time path rounds the same way:
+constexpr Mat4f kInexactLhs{
+  0.1f, 0.7f, -1.3f, 2.9f,
+  1.1f, -0.3f, 0.37f, 5.5f,
+  -2.2f, 0.01f, 3.3f, 0.6f,
+  0.25f, 1.7f, -0.9f, 1.0f
+};
+constexpr Mat4f kInexactRhs{
+  1.9f, -0.6f, 0.11f, 7.1f,
+  0.3f, 2.4f, -1.7f, 0.2f,
+  -0.8f, 0.05f, 1.3f, -3.9f,
+  0.4f, 0.9f, 0.7f, 1.0f
+};
+constexpr Mat4f kInexactProduct = kInexactLhs * kInexactRhs;
+constexpr Vec4f kInexactColumn = kInexactLhs * Vec4f{0.3f, -1.1f, 2.7f, 1.0f};
+static_assert(Mat4d().inverse() == Mat4d() && Mat4f().affine_inverse() == Mat4f());
+static_assert(Mat4i().trace() == 4);
+static_assert(Mat4i().is_identity() && Mat4i().is_diagonal() && Mat4i().is_symmetric() && Mat4i().is_orthogonal());
+
+template<typename NumT>
+class Mat4TypedTest : public ::testing::Test {};
+
+using Mat4NumTypes = ::testing::Types<float, double, int>;
+TYPED_TEST_SUITE(Mat4TypedTest, Mat4NumTypes);
+
+TYPED_TEST(Mat4TypedTest, ElementAccessIsRowColumn) {
+  const Mat4<TypeParam> m{
+    1,  2,  3,  4,
+    5,  6,  7,  8,
+    9,  10, 11, 12,
+    13, 14, 15, 16
+  };
+
+  EXPECT_EQ(m(0, 1), TypeParam(2));
+  EXPECT_EQ(m(2, 0), TypeParam(9));
+  EXPECT_EQ(m.template col<1>(), Vec4<TypeParam>(2, 6, 10, 14));
+  EXPECT_EQ(m.template row<1>(), Vec4<TypeParam>(5, 6, 7, 8));
+}
+
+TYPED_TEST(Mat4TypedTest, ProductMatchesReference) {
+  const Mat4<TypeParam> a{
+    1,  2,  3,  4,
+    5,  6,  7,  8,
+    9,  10, 11, 12,
+    13, 14, 15, 16
+  };
+  const Mat4<TypeParam> b{
+    2, -1,  0,  3,
+    1,  4, -2,  0,
+    0,  5,  1, -3,
+    7,  0,  2,  1
+  };
+
+  EXPECT_EQ(a * b, reference_multiply(a, b));
+  EXPECT_EQ(b * a, reference_multiply(b, a));
+  EXPECT_EQ(a * Mat4<TypeParam>::Identity(), a);
+  EXPECT_EQ(Mat4<TypeParam>::Identity() * a, a);
+
+  Mat4<TypeParam> c = a;
+  c *= b;
+  EXPECT_EQ(c, a * b);
+}
+
+TEST(Mat4Test, ProductMatchesConstantEvaluation) {
+  const Mat4f lhs = kInexactLhs;
+  const Mat4f rhs = kInexactRhs;
+  EXPECT_EQ(lhs * rhs, kInexactProduct);
+  EXPECT_EQ(lhs * Vec4f(0.3f, -1.1f, 2.7f, 1.0f), kInexactColumn);
+}
+
+TYPED_TEST(Mat4TypedTest, ProductWithVector) {
+  const Mat4<TypeParam> translate{
+    1, 0, 0, 5,
+    0, 1, 0, 6,
+    0, 0, 1, 7,
+    0, 0, 0, 1
+  };
+
+  EXPECT_EQ(translate * Vec4<TypeParam>(1, 2, 3, 1), Vec4<TypeParam>(6, 8, 10, 1));
+  EXPECT_EQ(translate * Vec4<TypeParam>(1, 2, 3, 0), Vec4<TypeParam>(1, 2, 3, 0));
+}
+
+TYPED_TEST(Mat4TypedTest, TransposeAndTrace) {
+  const Mat4<TypeParam> m{
+    1,  2,  3,  4,
+    5,  6,  7,  8,
+    9,  10, 11, 12,
+    13, 14, 15, 16
+  };
+
+  EXPECT_EQ(m.transpose().template col<0>(), m.template row<0>());
+  EXPECT_EQ(m.transpose().transpose(), m);
+  EXPECT_EQ(m.trace(), TypeParam(34));
+  EXPECT_EQ(m.transpose().trace(), m.trace());
+}
+
+TYPED_TEST(Mat4TypedTest, Properties) {
+  const Mat4<TypeParam> m{
+    1,  2,  3,  4,
+    5,  6,  7,  8,
+    9,  10, 11, 12,
+    13, 14, 15, 16
+  };
+  const Mat4<TypeParam> diagonal{
+    2, 0, 0, 0,
+    0, 3, 0, 0,
+    0, 0, 4, 0,
+    0, 0, 0, 5
+  };
+  // a rotation by 90 degrees about z followed by a swap of z and w:
+  const Mat4<TypeParam> permutation{
+    0, -1, 0, 0,
+    1,  0, 0, 0,
+    0,  0, 0, 1,
+    0,  0, 1, 0
+  };
+
+  EXPECT_TRUE(Mat4<TypeParam>().is_identity());
+  EXPECT_FALSE(diagonal.is_identity());
+  EXPECT_TRUE(diagonal.is_diagonal());
+  EXPECT_FALSE(m.is_diagonal());
+  EXPECT_FALSE(permutation.is_diagonal());
+  EXPECT_FALSE(m.is_symmetric());
+  EXPECT_TRUE((m + m.transpose()).is_symmetric());
+  EXPECT_TRUE(diagonal.is_symmetric());
+  EXPECT_TRUE(permutation.is_orthogonal());
+  EXPECT_TRUE(Mat4<TypeParam>().is_orthogonal());
+  EXPECT_FALSE(diagonal.is_orthogonal());
+  EXPECT_FALSE(m.is_orthogonal());
+
+  Mat4<TypeParam> sum = m;
+  sum += diagonal;
+  EXPECT_EQ(sum, m + diagonal);
+}
+
+template<typename NumT>
+class Mat4InverseTest : public ::testing::Test {};
+
+using Mat4FloatTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(Mat4InverseTest, Mat4FloatTypes);
+
+template<typename NumT>
+void expect_near_identity(const Mat4<NumT>& m, NumT eps) {
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 4; ++j) {
+      EXPECT_NEAR(m(i, j), i == j ? NumT(1) : NumT(0), eps) << "at (" << i << ", " << j << ")";
+    }
+  }
+}
+
+TYPED_TEST(Mat4InverseTest, GeneralInverse) {
+  const Mat4<TypeParam> m{
+    2, -1,  0,  3,
+    1,  4, -2,  0,
+    0,  5,  1, -3,
+    7,  0,  2,  1
+  };
+  const TypeParam eps = std::is_same_v<TypeParam, float> ? TypeParam(1e-5) : TypeParam(1e-12);
+
+  expect_near_identity(m * m.inverse(), eps);
+  expect_near_identity(m.inverse() * m, eps);
+  EXPECT_NEAR(m.inverse().determinant(), TypeParam(1) / m.determinant(), eps);
+}
+
+TYPED_TEST(Mat4InverseTest, AffineInverseMatchesGeneral) {
+  // rotation about z by 90 degrees, non-uniform scale and a translation:
+  const Mat4<TypeParam> m{
+    0, -2, 0, 5,
+    1,  0, 0, 6,
+    0,  0, 3, 7,
+    0,  0, 0, 1
+  };
+  const TypeParam eps = std::is_same_v<TypeParam, float> ? TypeParam(1e-6) : TypeParam(1e-14);
+
+  ASSERT_TRUE(m.is_affine());
+  expect_near_identity(m * m.affine_inverse(), eps);
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 4; ++j) {
+      EXPECT_NEAR(m.affine_inverse()(i, j), m.inverse()(i, j), eps);
+    }
+  }
+}
+
+TYPED_TEST(Mat4InverseTest, ProjectiveIsNotAffine) {
+  Mat4<TypeParam> m;
+  m(3, 2) = TypeParam(-1);
+  EXPECT_FALSE(m.is_affine());
+  EXPECT_TRUE(Mat4<TypeParam>().is_affine());
+}
+
+TYPED_TEST(Mat4InverseTest, RotationsAreOrthogonal) {
+  // rounded sines and cosines, within the tolerance of is_orthogonal():
+  const TypeParam c = std::cos(TypeParam(0.3)), s = std::sin(TypeParam(0.3));
+  const Mat4<TypeParam> rotation{
+    c, -s, TypeParam(0), TypeParam(0),
+    s,  c, TypeParam(0), TypeParam(0),
+    TypeParam(0), TypeParam(0), TypeParam(1), TypeParam(0),
+    TypeParam(0), TypeParam(0), TypeParam(0), TypeParam(1)
+  };
+  EXPECT_TRUE(rotation.is_orthogonal());
+  EXPECT_TRUE((rotation * rotation.transpose()).is_orthogonal());
+  EXPECT_FALSE((rotation * TypeParam(1.001)).is_orthogonal());
+}
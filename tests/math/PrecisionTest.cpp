@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/vec.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+// |value - ref| in units of the float spacing at ref (0 for equal zeros):
+double ulp_error(float value, double ref) {
+  const float rounded = std::abs(static_cast<float>(ref));
+  const double ulp = std::nextafter(rounded, INFINITY) - rounded;
+  if (value == ref) return 0.0;
+  return std::abs(value - ref) / ulp;
+}
+
+std::vector<Vec3f> random_vectors(size_t count) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> mantissa(-1.0f, 1.0f);
+  std::uniform_int_distribution<int> exponent(-40, 40);
+  std::vector<Vec3f> vecs;
+  for (size_t i = 0; i < count; ++i) {
+    const float scale = std::ldexp(1.0f, exponent(rng));
+    vecs.emplace_back(mantissa(rng) * scale, mantissa(rng) * scale, mantissa(rng) * scale);
+  }
+  return vecs;
+}
+
+double exact_length(const Vec3f& v) {
+  return std::sqrt(double(v.x()) * v.x() + double(v.y()) * v.y() + double(v.z()) * v.z());
+}
+
+// the documented bound plus the rounding of the squared length and of the final product:
+constexpr double kFastUlp = 4.1 + 2.0;
+constexpr double kRefinedUlp = 1.5 + 2.0;
+
+} // namespace
+
+TEST(PrecisionTest, ExactIsTheDefault) {
+  const Vec3f v(1.0f, 2.0f, 3.0f);
+  EXPECT_EQ(v.length(), v.length<Precision::Exact>());
+  EXPECT_EQ(v.normalize(), v.normalize<Precision::Exact>());
+  EXPECT_EQ(v.length(), std::sqrt(14.0f));
+  // no estimate for double, every policy is exact:
+  const Vec3d d(1.0, 2.0, 3.0);
+  EXPECT_EQ(d.normalize<Precision::Fast>(), d.normalize());
+  EXPECT_EQ(d.length<Precision::FastRefined>(), std::sqrt(14.0));
+}
+
+TEST(PrecisionTest, FastErrorBounds) {
+  double max_fast = 0.0;
+  double max_refined = 0.0;
+  for (const Vec3f& v : random_vectors(100000)) {
+    const double len = exact_length(v);
+    max_fast = std::max(max_fast, ulp_error(v.length<Precision::Fast>(), len));
+    max_refined = std::max(max_refined, ulp_error(v.length<Precision::FastRefined>(), len));
+
+    const Vec3f fast = v.normalize<Precision::Fast>();
+    const Vec3f refined = v.normalize<Precision::FastRefined>();
+    for (size_t axis = 0; axis < 3; ++axis) {
+      if (v[axis] == 0.0f) continue;
+      max_fast = std::max(max_fast, ulp_error(fast[axis], v[axis] / len));
+      max_refined = std::max(max_refined, ulp_error(refined[axis], v[axis] / len));
+    }
+  }
+  EXPECT_LE(max_fast, kFastUlp);
+  EXPECT_LE(max_refined, kRefinedUlp);
+}
+
+TEST(PrecisionTest, OutOfRangeFallsBackToExact) {
+  // squared lengths that are 0, subnormal or overflow:
+  const Vec3f zero = Vec3f::Zero();
+  const Vec3f tiny(1e-25f, 0.0f, 0.0f);
+  const Vec3f huge(1e30f, 1e30f, 0.0f);
+  for (const Vec3f& v : {zero, tiny, huge}) {
+    EXPECT_EQ(v.normalize<Precision::Fast>(), v.normalize());
+    EXPECT_EQ(v.length<Precision::FastRefined>(), v.length());
+  }
+  EXPECT_EQ(Vec4f::Zero().normalize<Precision::Fast>(), Vec4f::Zero());
+}
+
+TEST(PrecisionTest, Vec4MatchesVec3) {
+  const Vec3f v3(0.3f, -1.7f, 2.5f);
+  const Vec4f v4(0.3f, -1.7f, 2.5f, 0.0f);
+  EXPECT_EQ(v4.length<Precision::Fast>(), v3.length<Precision::Fast>());
+  EXPECT_NEAR(v4.normalize<Precision::FastRefined>().length(), 1.0f, 2e-7f);
+}
+
+TEST(PrecisionTest, PacketMatchesScalar) {
+  const auto vecs = random_vectors(64);
+  std::vector<Vec3f> with_zero = vecs;
+  with_zero[5] = Vec3f::Zero();
+
+  for (size_t base = 0; base < with_zero.size(); base += 8) {
+    const Vec3x8f packet = Vec3x8f::Load(with_zero.data() + base);
+    const Vec3x8f fast = packet.normalize<Precision::Fast>();
+    const auto refined_len = packet.length<Precision::FastRefined>();
+    // the packet dot product is fused, so the squared lengths may differ in the last bit:
+    for (size_t i = 0; i < 8; ++i) {
+      const Vec3f& v = with_zero[base + i];
+      const Vec3f expected = v.normalize<Precision::Fast>();
+      for (size_t axis = 0; axis < 3; ++axis) {
+        EXPECT_LE(ulp_error(fast.lane(i)[axis], expected[axis]), 2.0) << base + i;
+      }
+      EXPECT_LE(ulp_error(refined_len[i], v.length<Precision::FastRefined>()), 2.0) << base + i;
+    }
+  }
+}
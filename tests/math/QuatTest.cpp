@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/transform.hpp>
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using namespace ayan::math;
+
+static_assert(Quatd() * Quatd(0, 0, 1, 0) == Quatd(0, 0, 1, 0));
+static_assert(Quatd(0, 0, 1, 0).rotate(Vec3d(1, 0, 0)) == Vec3d(-1, 0, 0));
+static_assert(TRSd::Identity().to_mat4() == Mat4d::Identity());
+
+constexpr Quatf kInexactLhs(0.1f, -0.7f, 0.37f, 0.6f);
+constexpr Quatf kInexactRhs(-0.3f, 0.11f, 0.9f, 0.29f);
+constexpr Vec3f kInexactVec(1.3f, -2.7f, 0.45f);
+constexpr Quatf kInexactProduct = kInexactLhs * kInexactRhs;
+constexpr Vec3f kInexactRotated = kInexactLhs.rotate(kInexactVec);
+
+template<typename NumT>
+class QuatTypedTest : public ::testing::Test {};
+
+using QuatNumTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(QuatTypedTest, QuatNumTypes);
+
+namespace {
+
+template<typename NumT>
+NumT tolerance() {
+  return std::is_same_v<NumT, float> ? NumT(1e-5) : NumT(1e-12);
+}
+
+template<typename NumT>
+void expect_vec_near(const Vec3<NumT>& a, const Vec3<NumT>& b) {
+  EXPECT_NEAR(a.x(), b.x(), tolerance<NumT>());
+  EXPECT_NEAR(a.y(), b.y(), tolerance<NumT>());
+  EXPECT_NEAR(a.z(), b.z(), tolerance<NumT>());
+}
+
+// equal as rotations (q and -q):
+template<typename NumT>
+void expect_rotation_near(const Quat<NumT>& a, const Quat<NumT>& b) {
+  EXPECT_NEAR(std::abs(a.dot(b)), NumT(1), tolerance<NumT>());
+}
+
+template<typename NumT>
+void expect_mat_near(const Mat4<NumT>& a, const Mat4<NumT>& b) {
+  for (size_t i = 0; i < 4; ++i) {
+    for (size_t j = 0; j < 4; ++j) {
+      EXPECT_NEAR(a(i, j), b(i, j), tolerance<NumT>() * 10) << "at (" << i << ", " << j << ")";
+    }
+  }
+}
+
+template<typename NumT>
+Quat<NumT> sample_rotation(NumT angle) {
+  return Quat<NumT>::AxisAngle(Vec3<NumT>(1, 2, -2) / NumT(3), angle);
+}
+
+} // namespace
+
+TEST(QuatTest, ProductAndRotationMatchConstantEvaluation) {
+  const Quatf lhs = kInexactLhs;
+  const Quatf rhs = kInexactRhs;
+  EXPECT_EQ(lhs * rhs, kInexactProduct);
+  EXPECT_EQ(lhs.rotate(kInexactVec), kInexactRotated);
+}
+
+TYPED_TEST(QuatTypedTest, ProductMatchesMatrices) {
+  const Quat<TypeParam> a = sample_rotation(TypeParam(0.7));
+  const Quat<TypeParam> b = Quat<TypeParam>::AxisAngle(Vec3<TypeParam>::UnitZ(), TypeParam(-1.9));
+  const Vec3<TypeParam> v(TypeParam(0.5), TypeParam(-3), TypeParam(2));
+
+  expect_mat_near((a * b).to_mat4(), a.to_mat4() * b.to_mat4());
+  expect_vec_near((a * b).rotate(v), a.rotate(b.rotate(v)));
+  expect_vec_near(a.rotate(v), a.to_mat3() * v);
+  expect_vec_near(a.inverse().rotate(a.rotate(v)), v);
+  expect_rotation_near(a * a.conjugate(), Quat<TypeParam>::Identity());
+
+  // a quarter turn about z:
+  const auto quarter = Quat<TypeParam>::AxisAngle(Vec3<TypeParam>::UnitZ(), std::numbers::pi_v<TypeParam> / 2);
+  expect_vec_near(quarter.rotate(Vec3<TypeParam>::UnitX()), Vec3<TypeParam>::UnitY());
+}
+
+TYPED_TEST(QuatTypedTest, FromMat3RoundTrip) {
+  // all 4 branches of Shepperd's method (largest w, x, y and z):
+  for (TypeParam angle : { TypeParam(0.3), TypeParam(3.0) }) {
+    for (const Vec3<TypeParam>& axis : { Vec3<TypeParam>::UnitX(), Vec3<TypeParam>::UnitY(), Vec3<TypeParam>::UnitZ() }) {
+      const Quat<TypeParam> q = Quat<TypeParam>::AxisAngle(axis, angle);
+      expect_rotation_near(Quat<TypeParam>::FromMat3(q.to_mat3()), q);
+    }
+  }
+  const Quat<TypeParam> q = sample_rotation(TypeParam(2.2));
+  expect_rotation_near(Quat<TypeParam>::FromMat3(q.to_mat3()), q);
+}
+
+TYPED_TEST(QuatTypedTest, Interpolation) {
+  const Vec3<TypeParam> axis = Vec3<TypeParam>(1, 2, -2) / TypeParam(3);
+  const Quat<TypeParam> a = Quat<TypeParam>::AxisAngle(axis, TypeParam(0.2));
+  const Quat<TypeParam> b = Quat<TypeParam>::AxisAngle(axis, TypeParam(2.2));
+
+  // constant angular speed along the arc:
+  for (TypeParam t : { TypeParam(0), TypeParam(0.25), TypeParam(0.5), TypeParam(1) }) {
+    expect_rotation_near(slerp(a, b, t), Quat<TypeParam>::AxisAngle(axis, TypeParam(0.2) + TypeParam(2) * t));
+    EXPECT_NEAR(nlerp(a, b, t).length(), TypeParam(1), tolerance<TypeParam>());
+  }
+  expect_rotation_near(nlerp(a, b, TypeParam(0.5)), slerp(a, b, TypeParam(0.5)));
+
+  // the shorter arc for the opposite sign:
+  expect_rotation_near(slerp(a, -b, TypeParam(0.5)), slerp(a, b, TypeParam(0.5)));
+  expect_rotation_near(nlerp(a, -b, TypeParam(0.25)), nlerp(a, b, TypeParam(0.25)));
+  // nearly parallel:
+  expect_rotation_near(slerp(a, a, TypeParam(0.5)), a);
+}
+
+TYPED_TEST(QuatTypedTest, TRSMatchesMatrices) {
+  const TRS<TypeParam> parent{ Vec3<TypeParam>(1, -2, 3), sample_rotation(TypeParam(0.9)), Vec3<TypeParam>(2, 2, 2) };
+  const TRS<TypeParam> child{ Vec3<TypeParam>(0, 4, 1),
+    Quat<TypeParam>::AxisAngle(Vec3<TypeParam>::UnitY(), TypeParam(-0.4)), Vec3<TypeParam>(1, 3, TypeParam(0.5)) };
+  const Vec3<TypeParam> v(TypeParam(0.5), TypeParam(-3), TypeParam(2));
+
+  expect_mat_near(parent.to_affine().to_mat4(), parent.to_mat4());
+  expect_mat_near((parent * child).to_mat4(), parent.to_mat4() * child.to_mat4());
+  expect_vec_near(child.transform_point(v), child.to_affine().transform_point(v));
+  expect_vec_near(child.transform_vector(v), child.to_affine().transform_vector(v));
+  expect_vec_near((parent * child).transform_point(v), parent.transform_point(child.transform_point(v)));
+  expect_mat_near(parent.inverse().to_mat4(), parent.to_mat4().affine_inverse());
+
+  expect_vec_near(lerp(parent, child, TypeParam(0)).translation, parent.translation);
+  expect_vec_near(lerp(parent, child, TypeParam(1)).scale, child.scale);
+  expect_rotation_near(lerp(parent, child, TypeParam(1)).rotation, child.rotation);
+}
+
+TYPED_TEST(QuatTypedTest, PropagateHierarchy) {
+  // root <- a <- b and root <- c, stored parents first:
+  const std::vector<uint32_t> parents{ kNoParent, 0, 1, 0 };
+  std::vector<TRS<TypeParam>> local(4);
+  for (size_t i = 0; i < local.size(); ++i) {
+    const TypeParam f = TypeParam(i + 1);
+    local[i] = TRS<TypeParam>{ Vec3<TypeParam>(f, -f, TypeParam(0.5) * f), sample_rotation(TypeParam(0.3) * f), Vec3<TypeParam>::One() * f };
+  }
+
+  std::vector<TRS<TypeParam>> world(local.size());
+  propagate_hierarchy<TypeParam>(local, parents, world);
+  expect_mat_near(world[0].to_mat4(), local[0].to_mat4());
+  expect_mat_near(world[2].to_mat4(), local[0].to_mat4() * local[1].to_mat4() * local[2].to_mat4());
+  expect_mat_near(world[3].to_mat4(), local[0].to_mat4() * local[3].to_mat4());
+
+  // in place:
+  std::vector<TRS<TypeParam>> nodes = local;
+  propagate_hierarchy<TypeParam>(nodes, parents, nodes);
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    expect_mat_near(nodes[i].to_mat4(), world[i].to_mat4());
+  }
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/sampling.hpp>
+
+#include <set>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+// every interval [k / n, (k + 1) / n) holds exactly one of the n values:
+bool stratified(const std::vector<uint32_t>& bits) {
+  const uint32_t n = uint32_t(bits.size());
+  const uint32_t shift = 32 - std::countr_zero(n);
+  std::vector<bool> hit(n);
+  for (uint32_t value : bits) {
+    const uint32_t cell = n == 1 ? 0 : value >> shift;
+    if (hit[cell]) return false;
+    hit[cell] = true;
+  }
+  return true;
+}
+
+// every elementary interval of area 1 / n (n = 2^k, all splits 2^a x 2^(k - a))
+// holds exactly one point, a (0, k, 2)-net:
+bool is_net(const std::vector<uint32_t>& xs, const std::vector<uint32_t>& ys) {
+  const uint32_t k = uint32_t(std::countr_zero(uint32_t(xs.size())));
+  for (uint32_t a = 0; a <= k; ++a) {
+    std::set<std::pair<uint32_t, uint32_t>> cells;
+    for (size_t i = 0; i < xs.size(); ++i) {
+      const uint32_t cx = a == 0 ? 0 : xs[i] >> (32 - a);
+      const uint32_t cy = a == k ? 0 : ys[i] >> (32 - (k - a));
+      if (!cells.insert({cx, cy}).second) return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+TEST(Pcg32Test, MatchesReference) {
+  // pcg32-demo, seed 42, stream 54:
+  Pcg32 rng(42, 54);
+  for (uint32_t expected : {0xa15c02b7u, 0x7b47f409u, 0xba1d3330u, 0x83d2f293u, 0xbfa4784bu, 0xcbed606eu}) {
+    EXPECT_EQ(rng.next_u32(), expected);
+  }
+}
+
+TEST(Pcg32Test, AdvanceSeeks) {
+  Pcg32 stepped(7, 3);
+  Pcg32 sought = stepped;
+  for (int i = 0; i < 1000; ++i) stepped.next_u32();
+  sought.advance(1000);
+  EXPECT_EQ(sought.next_u32(), stepped.next_u32());
+
+  sought.advance(uint64_t(0) - 1001); // back to the start
+  EXPECT_EQ(sought.next_u32(), Pcg32(7, 3).next_u32());
+
+  // dimension d of a sample is the d-th number of its stream:
+  Pcg32 stream = Pcg32::ForSample(12, 5);
+  for (uint32_t dim = 0; dim < 10; ++dim) {
+    EXPECT_EQ(Pcg32::ForSample(12, 5, dim).next_u32(), stream.next_u32());
+  }
+  EXPECT_NE(Pcg32::ForSample(12, 5).next_u32(), Pcg32::ForSample(13, 5).next_u32());
+  EXPECT_NE(Pcg32::ForSample(12, 5).next_u32(), Pcg32::ForSample(12, 5, 0, 1).next_u32());
+}
+
+TEST(Pcg32Test, LanesMatchScalar) {
+  auto rngs = Pcg32x<8>::ForSamples(3, 100, 2);
+  std::vector<Pcg32> scalar;
+  for (uint32_t i = 0; i < 8; ++i) scalar.push_back(Pcg32::ForSample(3, 100 + i, 2));
+
+  for (int round = 0; round < 50; ++round) {
+    alignas(32) uint32_t bits[8];
+    rngs.next_u32(bits);
+    for (size_t lane = 0; lane < 8; ++lane) ASSERT_EQ(bits[lane], scalar[lane].next_u32());
+    const auto floats = rngs.next_float();
+    for (size_t lane = 0; lane < 8; ++lane) {
+      const float expected = scalar[lane].next_float();
+      ASSERT_EQ(floats[lane], expected);
+      ASSERT_TRUE(expected >= 0.0f && expected < 1.0f);
+    }
+  }
+  rngs.advance(77);
+  scalar[5].advance(77);
+  EXPECT_EQ(rngs.lane(5).next_u32(), scalar[5].next_u32());
+
+  auto pixels = Pcg32x<4>::ForPixels(40, 9);
+  EXPECT_EQ(pixels.lane(3).next_u32(), Pcg32::ForSample(43, 9).next_u32());
+}
+
+TEST(SobolTest, PrefixesAreStratified) {
+  const SobolSampler sampler(17);
+  for (uint32_t pixel : {0u, 1u, 12345u}) {
+    for (uint32_t n : {1u, 2u, 16u, 256u}) {
+      std::vector<std::vector<uint32_t>> dims(10, std::vector<uint32_t>(n));
+      for (uint32_t dim = 0; dim < dims.size(); ++dim) {
+        for (uint32_t s = 0; s < n; ++s) dims[dim][s] = sampler.sample_bits(pixel, s, dim);
+        EXPECT_TRUE(stratified(dims[dim])) << pixel << " " << n << " " << dim;
+      }
+      EXPECT_TRUE(is_net(dims[0], dims[1])) << pixel << " " << n;
+      EXPECT_TRUE(is_net(dims[4], dims[5])) << pixel << " " << n;
+    }
+  }
+  // pixels and dimension groups are decorrelated:
+  EXPECT_NE(sampler.sample_bits(0, 3, 0), sampler.sample_bits(1, 3, 0));
+  EXPECT_NE(sampler.sample_bits(0, 3, 0), sampler.sample_bits(0, 3, 4));
+}
+
+TEST(SobolTest, BatchMatchesScalar) {
+  const SobolSampler sampler(5);
+  std::vector<float> out(37);
+  for (uint32_t dim : {0u, 3u, 6u}) {
+    sampler.samples(99, 11, dim, out);
+    for (uint32_t i = 0; i < out.size(); ++i) {
+      ASSERT_EQ(out[i], sampler.sample(99, 11 + i, dim));
+      ASSERT_TRUE(out[i] >= 0.0f && out[i] < 1.0f);
+    }
+  }
+}
+
+TEST(BlueNoiseTest, PixelBlocksAreStratified) {
+  const BlueNoiseSampler sampler(1, 4, 3);
+  // one sample per pixel: every aligned 2^j x 2^j block of pixels is a net in every dimension pair:
+  for (uint32_t dim : {0u, 2u}) {
+    for (int block = 1; block <= 16; block *= 2) {
+      for (int by = 0; by < 16; by += block) {
+        for (int bx = 0; bx < 16; bx += block) {
+          std::vector<uint32_t> xs, ys;
+          for (int y = by; y < by + block; ++y) {
+            for (int x = bx; x < bx + block; ++x) {
+              xs.push_back(sampler.sample_bits(Vec2i(x, y), 0, dim));
+              ys.push_back(sampler.sample_bits(Vec2i(x, y), 0, dim + 1));
+            }
+          }
+          ASSERT_TRUE(is_net(xs, ys)) << dim << " " << block << " " << bx << " " << by;
+        }
+      }
+    }
+  }
+  // the tile repeats:
+  EXPECT_EQ(sampler.sample_bits(Vec2i(3, 5), 0, 1), sampler.sample_bits(Vec2i(3 + 16, 5 - 32), 0, 1));
+}
+
+TEST(BlueNoiseTest, SamplesOfAPixelAreStratified) {
+  const BlueNoiseSampler sampler(16);
+  std::vector<uint32_t> xs, ys;
+  for (uint32_t s = 0; s < 16; ++s) {
+    xs.push_back(sampler.sample_bits(Vec2i(20, 7), s, 2));
+    ys.push_back(sampler.sample_bits(Vec2i(20, 7), s, 3));
+  }
+  EXPECT_TRUE(is_net(xs, ys));
+
+  std::vector<float> out(16);
+  sampler.samples(Vec2i(20, 7), 0, 3, out);
+  for (uint32_t s = 0; s < 16; ++s) ASSERT_EQ(out[s], sampler.sample(Vec2i(20, 7), s, 3));
+}
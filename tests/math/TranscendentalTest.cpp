@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/simd.hpp>
+#include <ayan/math/vec.hpp>
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+
+using namespace ayan::math;
+
+namespace {
+
+using Pack8f = simd::Pack8f;
+
+constexpr float inf = std::numeric_limits<float>::infinity();
+constexpr float qnan = std::numeric_limits<float>::quiet_NaN();
+
+// distance of two floats in units in the last place (representable floats between them):
+int64_t ulp_distance(float a, float b) {
+  const auto ordered = [](float f) {
+    const int32_t bits = std::bit_cast<int32_t>(f);
+    return bits < 0 ? int64_t(INT32_MIN) - bits : int64_t(bits);
+  };
+  return std::abs(ordered(a) - ordered(b));
+}
+
+// the largest error of `func` against `reference` (double, correctly rounded to
+// float) at `count` evenly spaced points of [lo, hi]. Points where the absolute
+// error is at most `abs_tolerance` are skipped:
+template<typename Func, typename RefFunc>
+int64_t max_ulp(float lo, float hi, size_t count, Func&& func, RefFunc&& reference, double abs_tolerance = 0.0) {
+  int64_t worst = 0;
+  alignas(32) float in[8];
+  alignas(32) float out[8];
+  for (size_t i = 0; i < count; i += 8) {
+    for (size_t k = 0; k < 8; ++k) in[k] = lo + (hi - lo) * float(double(i + k) / double(count));
+    func(Pack8f::Load(in)).store(out);
+    for (size_t k = 0; k < 8; ++k) {
+      const double expected = reference(double(in[k]));
+      if (std::abs(double(out[k]) - expected) <= abs_tolerance) continue;
+      worst = std::max(worst, ulp_distance(out[k], float(expected)));
+    }
+  }
+  return worst;
+}
+
+constexpr size_t kPoints = 1 << 20;
+
+} // namespace
+
+TEST(TranscendentalTest, SinCos) {
+  const auto sin = [](const Pack8f& x) { return simd::sin(x); };
+  const auto cos = [](const Pack8f& x) { return simd::cos(x); };
+  const auto ref_sin = [](double x) { return std::sin(x); };
+  const auto ref_cos = [](double x) { return std::cos(x); };
+  const float pi = std::numbers::pi_v<float>;
+
+  EXPECT_LE(max_ulp(-pi, pi, kPoints, sin, ref_sin), 2);
+  EXPECT_LE(max_ulp(-pi, pi, kPoints, cos, ref_cos), 2);
+  EXPECT_LE(max_ulp(-8192.0f, 8192.0f, kPoints, sin, ref_sin, 0x1p-24), 2);
+  EXPECT_LE(max_ulp(-8192.0f, 8192.0f, kPoints, cos, ref_cos, 0x1p-24), 2);
+
+  // the same results as the separate calls:
+  const Pack8f x = Pack8f::LoadUnaligned(std::array{ -7.0f, -2.0f, -0.5f, 0.0f, 0.3f, 1.6f, 3.2f, 100.0f }.data());
+  const auto [s, c] = simd::sincos(x);
+  for (size_t i = 0; i < 8; ++i) {
+    EXPECT_EQ(s[i], simd::sin(x)[i]);
+    EXPECT_EQ(c[i], simd::cos(x)[i]);
+  }
+}
+
+TEST(TranscendentalTest, ExpLog) {
+  const auto exp = [](const Pack8f& x) { return simd::exp(x); };
+  const auto log = [](const Pack8f& x) { return simd::log(x); };
+  const auto ref_exp = [](double x) { return std::exp(x); };
+  const auto ref_log = [](double x) { return std::log(x); };
+
+  EXPECT_LE(max_ulp(-87.3f, 88.7f, kPoints, exp, ref_exp), 1);
+  EXPECT_LE(max_ulp(-1.0f, 1.0f, kPoints, exp, ref_exp), 1);
+  EXPECT_LE(max_ulp(0.5f, 2.0f, kPoints, log, ref_log), 1);
+  EXPECT_LE(max_ulp(1e-30f, 3e38f, kPoints, log, ref_log), 1);
+  // denormals:
+  EXPECT_LE(max_ulp(1e-44f, 1e-38f, kPoints, log, ref_log), 1);
+}
+
+TEST(TranscendentalTest, Pow) {
+  for (float y : { -4.0f, -1.5f, -0.5f, 0.3f, 1.0f, 2.2f, 3.7f, 12.0f }) {
+    const auto pow = [y](const Pack8f& x) { return simd::pow(x, y); };
+    const auto ref_pow = [y](double x) { return std::pow(x, double(y)); };
+    EXPECT_LE(max_ulp(1.0f / 256.0f, 256.0f, kPoints / 4, pow, ref_pow), int64_t(std::abs(y)) + 2) << "y = " << y;
+  }
+
+  // the sRGB curves:
+  const float encode = 1.0f / 2.4f;
+  EXPECT_LE(max_ulp(0.0031308f, 1.0f, kPoints, [&](const Pack8f& x) { return simd::pow(x, encode); },
+    [&](double x) { return std::pow(x, double(encode)); }), 2);
+  EXPECT_LE(max_ulp(0.0521327f, 1.0f, kPoints, [](const Pack8f& x) { return simd::pow(x, 2.4f); },
+    [](double x) { return std::pow(x, double(2.4f)); }), 2);
+}
+
+TEST(TranscendentalTest, Atan2) {
+  for (float other : { 1.0f, -1.0f, 0.01f, -300.0f }) {
+    EXPECT_LE(max_ulp(-100.0f, 100.0f, kPoints / 4, [&](const Pack8f& y) { return simd::atan2(y, Pack8f(other)); },
+      [&](double y) { return std::atan2(y, double(other)); }), 3);
+    EXPECT_LE(max_ulp(-100.0f, 100.0f, kPoints / 4, [&](const Pack8f& x) { return simd::atan2(Pack8f(other), x); },
+      [&](double x) { return std::atan2(double(other), x); }), 3);
+  }
+}
+
+TEST(TranscendentalTest, SpecialValues) {
+  const float xs[8] = { 0.0f, -0.0f, inf, -inf, qnan, 1.0f, -1.0f, 1e-45f };
+  const Pack8f x = Pack8f::LoadUnaligned(xs);
+  const auto same = [](float a, float b) { return (std::isnan(a) && std::isnan(b)) || std::bit_cast<uint32_t>(a) == std::bit_cast<uint32_t>(b); };
+
+  for (size_t i = 0; i < 8; ++i) {
+    SCOPED_TRACE(xs[i]);
+    EXPECT_TRUE(same(simd::exp(x)[i], std::exp(xs[i])) || xs[i] == 1e-45f);
+    EXPECT_TRUE(same(simd::log(x)[i], std::log(xs[i])));
+    if (xs[i] == 0.0f) {
+      EXPECT_TRUE(same(simd::sin(x)[i], xs[i])); // the sign of zero
+    }
+    if (!std::isfinite(xs[i])) {
+      EXPECT_TRUE(std::isnan(simd::sin(x)[i]) && std::isnan(simd::cos(x)[i]));
+    }
+
+    for (float y : { 0.0f, -0.0f, inf, -inf, qnan, 1.0f, -1.0f }) {
+      SCOPED_TRACE(y);
+      EXPECT_TRUE(same(simd::atan2(Pack8f(y), x)[i], std::atan2(y, xs[i])));
+      // odd integral y keep the sign of -0 in std::pow:
+      if (!std::signbit(xs[i])) {
+        EXPECT_TRUE(same(simd::pow(x, y)[i], std::pow(xs[i], y)));
+      }
+    }
+  }
+  // below FLT_MIN, flushed:
+  EXPECT_EQ(simd::exp(Pack8f(-100.0f))[0], 0.0f);
+  EXPECT_EQ(simd::exp(Pack8f(89.0f))[0], inf);
+}
+
+TEST(TranscendentalTest, VecOverloadsMatchPacks) {
+  const Vec4f v(-2.5f, 0.25f, 1.5f, 40.0f);
+  const simd::Pack4f p = v.to_pack();
+
+  EXPECT_EQ(sin(v), Vec4f::FromPack(simd::sin(p)));
+  EXPECT_EQ(cos(v), Vec4f::FromPack(simd::cos(p)));
+  EXPECT_EQ(sincos(v).sin, sin(v));
+  EXPECT_EQ(sincos(v).cos, cos(v));
+  EXPECT_EQ(exp(v), Vec4f::FromPack(simd::exp(p)));
+  EXPECT_EQ(log(v * v), Vec4f::FromPack(simd::log(p * p)));
+  EXPECT_EQ(pow(Vec4f::One() * 2.0f, v), Vec4f::FromPack(simd::pow(simd::Pack4f(2.0f), p)));
+  EXPECT_EQ(atan2(v, Vec4f::One()), Vec4f::FromPack(simd::atan2(p, simd::Pack4f(1.0f))));
+
+  // every lane of a packet is the same as the vector alone:
+  Vec3f vectors[8];
+  for (size_t i = 0; i < 8; ++i) vectors[i] = Vec3f(0.7f * float(i) - 3.0f, 0.1f + float(i), -0.4f * float(i));
+  const Vec3x8f packet = Vec3x8f::Load(vectors);
+  const auto [s, c] = sincos(packet);
+  const Vec3x8f e = exp(packet);
+  const Vec3x8f a = atan2(packet, Vec3x8f(Vec3f(1.0f, -2.0f, 0.5f)));
+  for (size_t i = 0; i < 8; ++i) {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      const simd::Pack4f lane(vectors[i][axis]);
+      EXPECT_EQ(s[axis][i], simd::sin(lane)[0]);
+      EXPECT_EQ(c[axis][i], simd::cos(lane)[0]);
+      EXPECT_EQ(e[axis][i], simd::exp(lane)[0]);
+      EXPECT_EQ(a[axis][i], simd::atan2(lane, simd::Pack4f(std::array{ 1.0f, -2.0f, 0.5f }[axis]))[0]);
+    }
+  }
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/transform.hpp>
+
+using namespace ayan::math;
+
+template<typename NumT>
+class TransformTypedTest : public ::testing::Test {};
+
+using TransformNumTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(TransformTypedTest, TransformNumTypes);
+
+template<typename NumT>
+void expect_vec_near(const Vec3<NumT>& a, const Vec3<NumT>& b) {
+  const NumT eps = std::is_same_v<NumT, float> ? NumT(1e-5) : NumT(1e-12);
+  EXPECT_NEAR(a.x(), b.x(), eps);
+  EXPECT_NEAR(a.y(), b.y(), eps);
+  EXPECT_NEAR(a.z(), b.z(), eps);
+}
+
+// x scaled by 2, then translated by (1, 2, 3):
+template<typename NumT>
+Mat4<NumT> scale_translate() {
+  return Mat4<NumT>{
+    2, 0, 0, 1,
+    0, 1, 0, 2,
+    0, 0, 1, 3,
+    0, 0, 0, 1
+  };
+}
+
+TYPED_TEST(TransformTypedTest, PointsVectorsAndNormals) {
+  using V = Vec3<TypeParam>;
+  const Transform<TypeParam> t(scale_translate<TypeParam>());
+
+  expect_vec_near(t.transform_point(V(1, 1, 1)), V(3, 3, 4));
+  expect_vec_near(t.transform_vector(V(1, 1, 1)), V(2, 1, 1));
+  expect_vec_near(t.inverse_point(V(3, 3, 4)), V(1, 1, 1));
+  expect_vec_near(t.inverse_vector(V(2, 1, 1)), V(1, 1, 1));
+
+  // the plane x + y = 0 stays perpendicular to its normal after scaling:
+  const V tangent = t.transform_vector(V(1, -1, 0));
+  const V normal = t.transform_normal(V(1, 1, 0));
+  EXPECT_NEAR(tangent.dot(normal), TypeParam(0), TypeParam(1e-6));
+}
+
+TYPED_TEST(TransformTypedTest, InvertedAndComposed) {
+  using V = Vec3<TypeParam>;
+  const Transform<TypeParam> a(scale_translate<TypeParam>());
+  const Transform<TypeParam> b(Mat4<TypeParam>{
+    0, -1, 0, 0,
+    1,  0, 0, 0,
+    0,  0, 1, 0,
+    0,  0, 0, 1
+  });
+  const Transform<TypeParam> ab = a * b;
+
+  expect_vec_near(a.inverted().transform_point(V(3, 3, 4)), V(1, 1, 1));
+  expect_vec_near(ab.transform_point(V(1, 0, 0)), a.transform_point(b.transform_point(V(1, 0, 0))));
+  expect_vec_near(ab.inverse_point(ab.transform_point(V(4, 5, 6))), V(4, 5, 6));
+  expect_vec_near(ab.transform_normal(V(0, 1, 0)), a.transform_normal(b.transform_normal(V(0, 1, 0))));
+}
+
+TYPED_TEST(TransformTypedTest, ProjectiveUsesGeneralInverse) {
+  using V = Vec3<TypeParam>;
+  Mat4<TypeParam> m = scale_translate<TypeParam>();
+  m(3, 2) = TypeParam(1);
+  const Transform<TypeParam> t(m);
+
+  expect_vec_near(t.inverse_point(t.transform_point(V(1, 2, 3))), V(1, 2, 3));
+}
@@ -0,0 +1,227 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/geometry.hpp>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+template<typename NumT>
+Vec3<NumT> random_vec(std::mt19937& rng, NumT lo, NumT hi) {
+  std::uniform_real_distribution<NumT> dist(lo, hi);
+  return Vec3<NumT>(dist(rng), dist(rng), dist(rng));
+}
+
+template<typename NumT>
+std::vector<Triangle<NumT>> random_triangles(std::mt19937& rng, size_t count) {
+  std::vector<Triangle<NumT>> triangles;
+  for (size_t i = 0; i < count; ++i) {
+    const Vec3<NumT> center = random_vec<NumT>(rng, -2, 2);
+    triangles.emplace_back(center + random_vec<NumT>(rng, -1, 1),
+      center + random_vec<NumT>(rng, -1, 1), center + random_vec<NumT>(rng, -1, 1));
+  }
+  return triangles;
+}
+
+// rays from a shell around the scene towards random points near the origin:
+template<typename NumT>
+std::vector<Ray<NumT>> random_rays(std::mt19937& rng, size_t count) {
+  std::vector<Ray<NumT>> rays;
+  for (size_t i = 0; i < count; ++i) {
+    const Vec3<NumT> origin = random_vec<NumT>(rng, -6, 6);
+    const Vec3<NumT> target = random_vec<NumT>(rng, -1, 1);
+    rays.emplace_back(origin, target - origin, NumT(0), NumT(i % 4 == 0 ? 0.5 : 100));
+  }
+  return rays;
+}
+
+} // namespace
+
+TEST(TriangleTest, ScalarHitAndBarycentrics) {
+  const Trianglef triangle(Vec3f(0, 0, 5), Vec3f(4, 0, 5), Vec3f(0, 4, 5));
+  TriangleHit<float> hit{};
+
+  ASSERT_TRUE(triangle.intersect(Rayf(Vec3f(1, 2, 0), Vec3f(0, 0, 1)), hit));
+  EXPECT_FLOAT_EQ(hit.t, 5.0f);
+  EXPECT_FLOAT_EQ(hit.u, 0.25f);
+  EXPECT_FLOAT_EQ(hit.v, 0.5f);
+
+  // the other winding and the opposite side are hit too:
+  ASSERT_TRUE(triangle.intersect(Rayf(Vec3f(1, 2, 10), Vec3f(0, 0, -2)), hit));
+  EXPECT_FLOAT_EQ(hit.t, 2.5f);
+  ASSERT_TRUE(Trianglef(Vec3f(0, 0, 5), Vec3f(0, 4, 5), Vec3f(4, 0, 5)).intersect(Rayf(Vec3f(1, 2, 0), Vec3f(0, 0, 1)), hit));
+  EXPECT_FLOAT_EQ(hit.u, 0.5f);
+  EXPECT_FLOAT_EQ(hit.v, 0.25f);
+
+  EXPECT_FALSE(triangle.intersect(Rayf(Vec3f(3, 3, 0), Vec3f(0, 0, 1)), hit));
+  EXPECT_FALSE(triangle.intersect(Rayf(Vec3f(1, 2, 0), Vec3f(0, 0, -1)), hit));
+  EXPECT_FALSE(triangle.intersect(Rayf(Vec3f(1, 2, 0), Vec3f(0, 0, 1), 0.0f, 4.0f), hit));
+  // parallel to the plane:
+  EXPECT_FALSE(triangle.intersect(Rayf(Vec3f(-1, 1, 5), Vec3f(1, 0, 0)), hit));
+}
+
+TEST(TriangleTest, ScalarHitPointMatchesRay) {
+  std::mt19937 rng(7);
+  const auto triangles = random_triangles<double>(rng, 64);
+  const auto rays = random_rays<double>(rng, 64);
+
+  size_t hits = 0;
+  for (const auto& triangle : triangles) {
+    for (const auto& ray : rays) {
+      TriangleHit<double> hit{};
+      if (!triangle.intersect(ray, hit)) continue;
+      ++hits;
+      EXPECT_GE(hit.u, 0.0);
+      EXPECT_GE(hit.v, 0.0);
+      EXPECT_LE(hit.u + hit.v, 1.0 + 1e-12);
+      const Vec3d on_triangle = triangle.vertex(0) * (1.0 - hit.u - hit.v) +
+        triangle.vertex(1) * hit.u + triangle.vertex(2) * hit.v;
+      EXPECT_LT(on_triangle.distance(ray.at(hit.t)), 1e-9);
+    }
+  }
+  EXPECT_GT(hits, 0u);
+}
+
+// A ray through the shared edge of two triangles must hit at least one of them:
+TEST(TriangleTest, SharedEdgeIsWatertight) {
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<float> param(0.0f, 1.0f);
+
+  for (int n = 0; n < 2000; ++n) {
+    const Vec3f a = random_vec<float>(rng, -1, 1);
+    const Vec3f b = random_vec<float>(rng, -1, 1);
+    const Vec3f c = random_vec<float>(rng, -1, 1);
+    const Vec3f d = random_vec<float>(rng, -1, 1);
+    const Trianglef left(a, b, c);
+    const Trianglef right(b, a, d);
+
+    const Vec3f origin = random_vec<float>(rng, -4, 4);
+    const Vec3f on_edge = a + (b - a) * param(rng);
+    const Rayf ray(origin, on_edge - origin);
+
+    TriangleHit<float> hit{};
+    const bool hit_left = left.intersect(ray, hit);
+    const bool hit_right = right.intersect(ray, hit);
+    // c and d on the same side of the edge as seen from the origin leaves only a grazing ray:
+    const Vec3f normal = (b - a).cross(origin - a);
+    if ((c - a).dot(normal) * (d - a).dot(normal) < 0.0f) {
+      EXPECT_TRUE(hit_left || hit_right) << "n = " << n;
+    }
+  }
+
+  // axis aligned edge through the origin, the double fallback case:
+  const Trianglef left(Vec3f(0, -1, 1), Vec3f(0, 1, 1), Vec3f(-1, 0, 1));
+  const Trianglef right(Vec3f(0, 1, 1), Vec3f(0, -1, 1), Vec3f(1, 0, 1));
+  TriangleHit<float> hit{};
+  const Rayf ray(Vec3f(0, 0.25f, 0), Vec3f(0, 0, 1));
+  EXPECT_TRUE(left.intersect(ray, hit) || right.intersect(ray, hit));
+}
+
+template<typename Packet>
+class TrianglePacketTest : public ::testing::Test {};
+
+using TrianglePacketTypes = ::testing::Types<TriangleX4f, TriangleX8f, TriangleX4d>;
+TYPED_TEST_SUITE(TrianglePacketTest, TrianglePacketTypes);
+
+// 1 ray x N triangles agrees with the scalar test bit for bit:
+TYPED_TEST(TrianglePacketTest, OneRayManyTrianglesMatchesScalar) {
+  using NumT = typename TypeParam::pack_type::value_type;
+  constexpr size_t Lanes = TypeParam::lanes;
+
+  std::mt19937 rng(3);
+  const auto triangles = random_triangles<NumT>(rng, Lanes * 16);
+  const auto rays = random_rays<NumT>(rng, 128);
+
+  size_t hits = 0;
+  for (size_t base = 0; base < triangles.size(); base += Lanes) {
+    const TypeParam packet = TypeParam::Load(triangles.data() + base);
+    for (const auto& ray : rays) {
+      TriangleHitX<Lanes, NumT> hits_x{};
+      const auto mask = packet.intersect(ray, hits_x);
+      for (size_t i = 0; i < Lanes; ++i) {
+        TriangleHit<NumT> hit{};
+        const bool expected = triangles[base + i].intersect(ray, hit);
+        ASSERT_EQ(mask[i], expected);
+        if (!expected) continue;
+        ++hits;
+        EXPECT_EQ(hits_x.t[i], hit.t);
+        EXPECT_EQ(hits_x.u[i], hit.u);
+        EXPECT_EQ(hits_x.v[i], hit.v);
+      }
+    }
+  }
+  EXPECT_GT(hits, 0u);
+}
+
+// N rays x 1 triangle agrees with the scalar test bit for bit:
+TYPED_TEST(TrianglePacketTest, ManyRaysOneTriangleMatchesScalar) {
+  using NumT = typename TypeParam::pack_type::value_type;
+  constexpr size_t Lanes = TypeParam::lanes;
+
+  std::mt19937 rng(5);
+  const auto triangles = random_triangles<NumT>(rng, 64);
+  const auto rays = random_rays<NumT>(rng, Lanes * 16);
+
+  size_t hits = 0;
+  for (size_t base = 0; base < rays.size(); base += Lanes) {
+    const auto packet = RayX<Lanes, NumT>::Load(rays.data() + base);
+    for (const auto& triangle : triangles) {
+      TriangleHitX<Lanes, NumT> hits_x{};
+      const auto mask = triangle.intersect(packet, hits_x);
+      for (size_t i = 0; i < Lanes; ++i) {
+        TriangleHit<NumT> hit{};
+        const bool expected = triangle.intersect(rays[base + i], hit);
+        ASSERT_EQ(mask[i], expected);
+        if (!expected) continue;
+        ++hits;
+        EXPECT_EQ(hits_x.t[i], hit.t);
+        EXPECT_EQ(hits_x.u[i], hit.u);
+        EXPECT_EQ(hits_x.v[i], hit.v);
+      }
+    }
+  }
+  EXPECT_GT(hits, 0u);
+}
+
+TYPED_TEST(TrianglePacketTest, DefaultPacketNeverHits) {
+  using NumT = typename TypeParam::pack_type::value_type;
+  constexpr size_t Lanes = TypeParam::lanes;
+
+  TypeParam packet;
+  TriangleHitX<Lanes, NumT> hits_x{};
+  EXPECT_TRUE(packet.intersect(Ray<NumT>(Vec3<NumT>(0, 0, -1), Vec3<NumT>(0, 0, 1)), hits_x).none());
+
+  const Triangle<NumT> triangle(Vec3<NumT>(-1, -1, 2), Vec3<NumT>(1, -1, 2), Vec3<NumT>(0, 1, 2));
+  packet.set_lane(1, triangle);
+  EXPECT_EQ(packet.lane(1).vertex(2), triangle.vertex(2));
+  EXPECT_EQ(packet.intersect(Ray<NumT>(Vec3<NumT>(0, 0, -1), Vec3<NumT>(0, 0, 1)), hits_x).bits(), 0b10u);
+  EXPECT_EQ(hits_x.t[1], NumT(3));
+}
+
+// a vertex at infinity or NaN gives a NaN t, a miss for the scalar and the packet test:
+TYPED_TEST(TrianglePacketTest, NonFiniteVerticesNeverHit) {
+  using NumT = typename TypeParam::pack_type::value_type;
+  constexpr size_t Lanes = TypeParam::lanes;
+  const NumT nan = std::numeric_limits<NumT>::quiet_NaN();
+  const NumT inf = std::numeric_limits<NumT>::infinity();
+
+  const Ray<NumT> ray(Vec3<NumT>(0, 0, -1), Vec3<NumT>(0, 0, 1));
+  const Triangle<NumT> triangles[] = {
+    Triangle<NumT>(Vec3<NumT>(nan, 0, 2), Vec3<NumT>(1, -1, 2), Vec3<NumT>(0, 1, 2)),
+    Triangle<NumT>(Vec3<NumT>(-1, -1, 2), Vec3<NumT>(1, -1, 2), Vec3<NumT>(0, 0, inf)),
+    Triangle<NumT>(Vec3<NumT>(-1, -1, 2), Vec3<NumT>(1, -1, nan), Vec3<NumT>(0, 1, 2))
+  };
+  for (const Triangle<NumT>& triangle : triangles) {
+    TriangleHit<NumT> hit{};
+    EXPECT_FALSE(triangle.intersect(ray, hit));
+
+    TypeParam packet;
+    for (size_t i = 0; i < Lanes; ++i) packet.set_lane(i, triangle);
+    TriangleHitX<Lanes, NumT> hits_x{};
+    EXPECT_TRUE(packet.intersect(ray, hits_x).none());
+  }
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/vec.hpp>
+
+#include <array>
+
+using namespace ayan::math;
+
+template<typename Packet>
+class Vec3xTypedTest : public ::testing::Test {};
+
+using Vec3xTypes = ::testing::Types<Vec3x4f, Vec3x8f, Vec3x4d>;
+TYPED_TEST_SUITE(Vec3xTypedTest, Vec3xTypes);
+
+template<typename NumT, size_t Lanes>
+std::array<Vec3<NumT>, Lanes> MakeVectors(NumT shift) {
+  std::array<Vec3<NumT>, Lanes> vectors;
+  for (size_t i = 0; i < Lanes; ++i) {
+    const NumT k = NumT(i) + shift;
+    vectors[i] = Vec3<NumT>(k, NumT(2) * k - NumT(3), NumT(1) - k);
+  }
+  return vectors;
+}
+
+TYPED_TEST(Vec3xTypedTest, LoadStoreRoundTrip) {
+  using NumT = typename TypeParam::pack_type::value_type;
+  constexpr size_t Lanes = TypeParam::lanes;
+  const auto vectors = MakeVectors<NumT, Lanes>(NumT(1));
+
+  const TypeParam packet = TypeParam::Load(vectors.data());
+  std::array<Vec3<NumT>, Lanes> stored;
+  packet.store(stored.data());
+
+  for (size_t i = 0; i < Lanes; ++i) {
+    EXPECT_EQ(packet.lane(i), vectors[i]);
+    EXPECT_EQ(stored[i], vectors[i]);
+  }
+}
+
+TYPED_TEST(Vec3xTypedTest, MatchesScalarVec3) {
+  using NumT = typename TypeParam::pack_type::value_type;
+  constexpr size_t Lanes = TypeParam::lanes;
+  const auto as = MakeVectors<NumT, Lanes>(NumT(1));
+  const auto bs = MakeVectors<NumT, Lanes>(NumT(-2));
+
+  const TypeParam a = TypeParam::Load(as.data());
+  const TypeParam b = TypeParam::Load(bs.data());
+
+  const TypeParam sum = a + b * NumT(2);
+  const TypeParam cross = a.cross(b);
+  const auto dot = a.dot(b);
+  const TypeParam normalized = a.normalize();
+
+  for (size_t i = 0; i < Lanes; ++i) {
+    EXPECT_EQ(sum.lane(i), as[i] + bs[i] * NumT(2));
+    EXPECT_EQ(cross.lane(i), as[i].cross(bs[i]));
+    EXPECT_NEAR(dot[i], as[i].dot(bs[i]), 1e-4);
+    EXPECT_NEAR(normalized.lane(i).x(), as[i].normalize().x(), 1e-6);
+    EXPECT_NEAR(normalized.lane(i).length(), NumT(1), 1e-6);
+  }
+}
+
+TYPED_TEST(Vec3xTypedTest, GatherScatterWithMask) {
+  using NumT = typename TypeParam::pack_type::value_type;
+  constexpr size_t Lanes = TypeParam::lanes;
+  const auto source = MakeVectors<NumT, 2 * Lanes>(NumT(0));
+
+  std::array<int32_t, Lanes> indices;
+  for (size_t i = 0; i < Lanes; ++i) indices[i] = int32_t(2 * Lanes - 1 - 2 * i);
+
+  const TypeParam packet = TypeParam::Gather(source.data(), indices.data());
+  for (size_t i = 0; i < Lanes; ++i) {
+    EXPECT_EQ(packet.lane(i), source[indices[i]]);
+  }
+
+  // only even lanes are written back:
+  std::array<Vec3<NumT>, 2 * Lanes> target{};
+  const auto even = TypeParam::mask_type::FromBits(0x55555555u);
+  (-packet).scatter(target.data(), indices.data(), even);
+
+  for (size_t i = 0; i < Lanes; ++i) {
+    const auto expected = (i % 2 == 0) ? -source[indices[i]] : Vec3<NumT>::Zero();
+    EXPECT_EQ(target[indices[i]], expected);
+  }
+}
+
+TYPED_TEST(Vec3xTypedTest, SelectAndMasks) {
+  using NumT = typename TypeParam::pack_type::value_type;
+  constexpr size_t Lanes = TypeParam::lanes;
+  const auto vectors = MakeVectors<NumT, Lanes>(NumT(0));
+
+  const TypeParam a = TypeParam::Load(vectors.data());
+  const TypeParam zero = TypeParam::Zero();
+
+  // x() > 1 for every lane except 0 and 1:
+  const auto mask = a.x() > TypeParam::pack_type::Broadcast(NumT(1));
+  EXPECT_EQ(mask.bits(), ((1u << Lanes) - 1) & ~0b11u);
+
+  const TypeParam selected = select(mask, a, zero);
+  EXPECT_EQ((selected == a).bits(), mask.bits());
+  EXPECT_EQ((selected != a).bits(), (~mask).bits());
+  EXPECT_TRUE((a == a).all());
+
+  TypeParam packet;
+  packet.set_lane(1, Vec3<NumT>(1, 2, 3));
+  EXPECT_EQ(packet.lane(1), Vec3<NumT>(1, 2, 3));
+  EXPECT_EQ(packet.lane(0), Vec3<NumT>::Zero());
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/vec.hpp>
+
+#include <cmath>
+
+using namespace ayan::math;
+
+// the scalar path must stay usable in constant expressions:
+constexpr Vec4f kConstSum = Vec4f{1.0f, 2.0f, 3.0f, 4.0f} + Vec4f::One() * 2.0f;
+static_assert(kConstSum.x() == 3.0f && kConstSum.w() == 6.0f);
+static_assert(Vec4d{1.0, 2.0, 3.0, 4.0}.length_squared() == 30.0);
+
+static_assert(alignof(Vec4f) == 16);
+static_assert(alignof(Vec4d) == 32);
+static_assert(alignof(Vec4i) == alignof(int));
+static_assert(sizeof(Vec3f) == 3 * sizeof(float));
+
+template<typename NumT>
+class Vec4TypedTest : public ::testing::Test {};
+
+using Vec4NumTypes = ::testing::Types<float, double, int>;
+TYPED_TEST_SUITE(Vec4TypedTest, Vec4NumTypes);
+
+TYPED_TEST(Vec4TypedTest, ArithmeticMatchesComponentwise) {
+  using V = Vec4<TypeParam>;
+  const V a{1, 2, 3, 4};
+  const V b{8, 6, 4, 2};
+
+  EXPECT_EQ(a + b, V(9, 8, 7, 6));
+  EXPECT_EQ(a - b, V(-7, -4, -1, 2));
+  EXPECT_EQ(a * b, V(8, 12, 12, 8));
+  EXPECT_EQ(V(8, 6, 9, 16) / a, V(8, 3, 3, 4));
+  EXPECT_EQ(a * TypeParam(2), V(2, 4, 6, 8));
+  EXPECT_EQ(TypeParam(2) * a, V(2, 4, 6, 8));
+  EXPECT_EQ(-a, V(-1, -2, -3, -4));
+}
+
+TYPED_TEST(Vec4TypedTest, CompoundAssignment) {
+  using V = Vec4<TypeParam>;
+  V v{1, 2, 3, 4};
+
+  v += V(1, 1, 1, 1);
+  EXPECT_EQ(v, V(2, 3, 4, 5));
+  v -= V(2, 2, 2, 2);
+  EXPECT_EQ(v, V(0, 1, 2, 3));
+  v *= TypeParam(3);
+  EXPECT_EQ(v, V(0, 3, 6, 9));
+  v /= TypeParam(3);
+  EXPECT_EQ(v, V(0, 1, 2, 3));
+  v *= V(2, 2, 2, 2);
+  EXPECT_EQ(v, V(0, 2, 4, 6));
+}
+
+TYPED_TEST(Vec4TypedTest, DotAndLengthSquared) {
+  using V = Vec4<TypeParam>;
+  const V a{1, 2, 3, 4};
+  const V b{5, 6, 7, 8};
+
+  EXPECT_EQ(a.dot(b), TypeParam(70));
+  EXPECT_EQ(a.length_squared(), TypeParam(30));
+  EXPECT_EQ(a.distance_squared(b), TypeParam(64));
+}
+
+TEST(Vec4Test, DotSumsLeftToRight) {
+  // pairwise, (big + 1) + (-big + 1) would round to 0:
+  constexpr float big = 1e8f;
+  constexpr Vec4f kVec{big, 1.0f, -big, 1.0f};
+  constexpr float kDot = kVec.dot(Vec4f::One());
+  static_assert(kDot == 1.0f);
+
+  const Vec4f vec = kVec;
+  EXPECT_EQ(vec.dot(Vec4f::One()), kDot);
+  EXPECT_EQ(Vec4d(1e17, 1.0, -1e17, 1.0).dot(Vec4d::One()), 1.0);
+
+  constexpr Vec4f kInexact{0.1f, -0.7f, 1.3f, 2.9f};
+  constexpr float kLengthSquared = kInexact.length_squared();
+  const Vec4f inexact = kInexact;
+  EXPECT_EQ(inexact.length_squared(), kLengthSquared);
+}
+
+TEST(Vec4Test, NormalizeFloat) {
+  const Vec4f v{3.0f, 0.0f, 4.0f, 0.0f};
+  const Vec4f n = v.normalize();
+
+  EXPECT_FLOAT_EQ(n.x(), 0.6f);
+  EXPECT_FLOAT_EQ(n.z(), 0.8f);
+  EXPECT_FLOAT_EQ(n.length(), 1.0f);
+  EXPECT_EQ(Vec4f::Zero().normalize(), Vec4f::Zero());
+}
+
+TEST(Vec4Test, NormalizeDouble) {
+  const Vec4d v{1.0, 2.0, 3.0, 4.0};
+  EXPECT_NEAR(v.normalize().length(), 1.0, 1e-15);
+  EXPECT_DOUBLE_EQ(v.normalize().w(), 4.0 / std::sqrt(30.0));
+}
+
+TEST(Vec4Test, PackRoundTrip) {
+  const Vec4f v{1.0f, -2.0f, 3.5f, 0.25f};
+  EXPECT_EQ(Vec4f::FromPack(v.to_pack()), v);
+
+  const auto mask = v.to_pack() > simd::Pack4f::Zero();
+  EXPECT_EQ(mask.bits(), 0b1101u);
+}
+
+TEST(Vec4Test, PackShuffle) {
+  const Vec4f f{1.0f, 2.0f, 3.0f, 4.0f};
+  EXPECT_EQ(Vec4f::FromPack(simd::shuffle<3, 2, 1, 0>(f.to_pack())), Vec4f(4.0f, 3.0f, 2.0f, 1.0f));
+  EXPECT_EQ(Vec4f::FromPack(simd::shuffle<1, 1, 0, 3>(f.to_pack())), Vec4f(2.0f, 2.0f, 1.0f, 4.0f));
+
+  // crosses the 128-bit halves of double packs:
+  const Vec4d d{1.0, 2.0, 3.0, 4.0};
+  EXPECT_EQ(Vec4d::FromPack(simd::shuffle<3, 2, 1, 0>(d.to_pack())), Vec4d(4.0, 3.0, 2.0, 1.0));
+  EXPECT_EQ(Vec4d::FromPack(simd::shuffle<2, 0, 3, 3>(d.to_pack())), Vec4d(3.0, 1.0, 4.0, 4.0));
+}
@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/array.hpp>
+
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+using namespace ayan::math;
+
+namespace {
+
+// not a multiple of any packet width or of an AoSoA block:
+constexpr size_t kCount = 37;
+
+template<size_t N, typename NumT>
+Vec<N, NumT> make_vec(size_t i) {
+  Vec<N, NumT> vec;
+  for (size_t c = 0; c < N; ++c) vec[c] = NumT(int((i * (c + 3)) % 11) - 5) + NumT(c == 0);
+  return vec;
+}
+
+template<size_t N, typename NumT>
+std::vector<Vec<N, NumT>> make_vecs(size_t count) {
+  std::vector<Vec<N, NumT>> vecs(count);
+  for (size_t i = 0; i < count; ++i) vecs[i] = make_vec<N, NumT>(i);
+  return vecs;
+}
+
+template<size_t N, typename NumT>
+void expect_vec_near(const Vec<N, NumT>& a, const Vec<N, NumT>& b) {
+  for (size_t c = 0; c < N; ++c) EXPECT_NEAR(a[c], b[c], NumT(1e-5)) << "component " << c;
+}
+
+} // namespace
+
+template<typename ArrayT>
+class VecArrayTest : public ::testing::Test {};
+
+using VecArrayTypes = ::testing::Types<
+  VecArray<3, float, Layout::AoS>, VecArray<3, float, Layout::SoA>, VecArray<3, float, Layout::AoSoA>,
+  VecArray<4, float, Layout::AoS>, VecArray<4, float, Layout::SoA>, VecArray<4, float, Layout::AoSoA>,
+  VecArray<3, double, Layout::SoA>, VecArray<3, double, Layout::AoSoA>
+>;
+TYPED_TEST_SUITE(VecArrayTest, VecArrayTypes);
+
+TYPED_TEST(VecArrayTest, ElementAccessAndGrowth) {
+  using value_type = typename TypeParam::value_type;
+  constexpr size_t n = std::tuple_size_v<value_type>;
+  using NumT = std::remove_cvref_t<decltype(value_type()[0])>;
+
+  TypeParam array;
+  for (size_t i = 0; i < kCount; ++i) array.push_back(make_vec<n, NumT>(i));
+  ASSERT_EQ(array.size(), kCount);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(array.data()) % 64, 0u);
+  for (size_t i = 0; i < kCount; ++i) EXPECT_EQ(array.get(i), (make_vec<n, NumT>(i)));
+
+  // references write through, in every layout:
+  array[5].x() = NumT(42);
+  array[6] = array[5];
+  array[7] += value_type(array[6]);
+  EXPECT_EQ(array.get(6).x(), NumT(42));
+  EXPECT_EQ(array.get(7).x(), (make_vec<n, NumT>(7).x() + NumT(42)));
+
+  // shrinking and growing again does not bring the old vectors back:
+  array.resize(3);
+  array.resize(10, value_type());
+  EXPECT_EQ(array.get(2), (make_vec<n, NumT>(2)));
+  EXPECT_EQ(array.get(9), value_type());
+
+  // reserve keeps the vectors (SoA lays every component out again):
+  array.reserve(1000);
+  EXPECT_GE(array.capacity(), 1000u);
+  EXPECT_EQ(array.get(1), (make_vec<n, NumT>(1)));
+}
+
+TYPED_TEST(VecArrayTest, BulkOperationsMatchScalar) {
+  using value_type = typename TypeParam::value_type;
+  constexpr size_t n = std::tuple_size_v<value_type>;
+  using NumT = std::remove_cvref_t<decltype(value_type()[0])>;
+
+  const auto a = make_vecs<n, NumT>(kCount);
+  auto b = make_vecs<n, NumT>(kCount + 5);
+  b.erase(b.begin(), b.begin() + 5);
+
+  TypeParam sum(a);
+  sum += TypeParam(b);
+  sum *= NumT(2);
+  TypeParam diff(a);
+  diff -= TypeParam(b);
+
+  std::vector<NumT> dots(kCount);
+  TypeParam(a).dot(TypeParam(b), dots);
+
+  for (size_t i = 0; i < kCount; ++i) {
+    EXPECT_EQ(sum.get(i), (a[i] + b[i]) * NumT(2));
+    EXPECT_EQ(diff.get(i), a[i] - b[i]);
+    EXPECT_NEAR(dots[i], a[i].dot(b[i]), NumT(1e-4));
+  }
+}
+
+TYPED_TEST(VecArrayTest, NormalizeAndTransform) {
+  using value_type = typename TypeParam::value_type;
+  constexpr size_t n = std::tuple_size_v<value_type>;
+  using NumT = std::remove_cvref_t<decltype(value_type()[0])>;
+
+  auto vecs = make_vecs<n, NumT>(kCount);
+  vecs[4] = value_type(); // stays zero
+  TypeParam normalized(vecs);
+  normalized.normalize();
+  TypeParam fast(vecs);
+  fast.template normalize<Precision::Fast>();
+  for (size_t i = 0; i < kCount; ++i) {
+    expect_vec_near(normalized.get(i), vecs[i].normalize());
+    expect_vec_near(fast.get(i), vecs[i].normalize());
+  }
+
+  const Mat4<NumT> matrix{
+    0, -2, 0, 5,
+    1,  0, 0, 6,
+    0,  0, 3, 7,
+    0,  0, 0, 1
+  };
+  std::vector<value_type> expected(vecs);
+  transform_batch<TransformAs::Point, NumT>(matrix, expected, expected);
+  TypeParam points(vecs);
+  points.template transform<TransformAs::Point>(matrix);
+  for (size_t i = 0; i < kCount; ++i) expect_vec_near(points.get(i), expected[i]);
+}
+
+TYPED_TEST(VecArrayTest, EveryLayoutRoundsLikeTheScalarPath) {
+  using value_type = typename TypeParam::value_type;
+  constexpr size_t n = std::tuple_size_v<value_type>;
+  using NumT = std::remove_cvref_t<decltype(value_type()[0])>;
+
+  // inexact components, so a different order of the products or FMA would show:
+  auto vecs = make_vecs<n, NumT>(kCount);
+  for (value_type& vec : vecs) vec = vec * NumT(0.1) + value_type::One() * NumT(0.37);
+
+  std::vector<NumT> dots(kCount);
+  TypeParam(vecs).dot(TypeParam(vecs), dots);
+  TypeParam normalized(vecs);
+  normalized.normalize();
+  for (size_t i = 0; i < kCount; ++i) {
+    EXPECT_EQ(dots[i], vecs[i].dot(vecs[i])) << "at " << i;
+    EXPECT_EQ(normalized.get(i), vecs[i].normalize()) << "at " << i;
+  }
+
+  Mat4<NumT> matrix{
+    NumT(0.1), NumT(0.7), NumT(-1.3), NumT(2.9),
+    NumT(1.1), NumT(-0.3), NumT(0.37), NumT(5.5),
+    NumT(-2.2), NumT(0.01), NumT(3.3), NumT(0.6),
+    NumT(0), NumT(0), NumT(0), NumT(1)
+  };
+  for (const bool projective : {false, true}) {
+    if (projective) matrix(3, 2) = NumT(0.125);
+    std::vector<value_type> expected(vecs);
+    transform_batch<TransformAs::Point, NumT>(matrix, expected, expected);
+    TypeParam points(vecs);
+    points.template transform<TransformAs::Point>(matrix);
+    for (size_t i = 0; i < kCount; ++i) EXPECT_EQ(points.get(i), expected[i]) << "at " << i;
+  }
+}
+
+TEST(VecArrayLayoutTest, ConvertsBetweenLayouts) {
+  const auto vecs = make_vecs<3, float>(kCount);
+  const VecArrayAoS<3, float> aos(vecs);
+  const VecArraySoA<3, float> soa(aos);
+  const VecArrayAoSoA<3, float> aosoa(soa);
+  const VecArrayAoS<3, float> back(aosoa);
+  for (size_t i = 0; i < kCount; ++i) {
+    EXPECT_EQ(soa[i], vecs[i]);
+    EXPECT_EQ(aosoa[i], vecs[i]);
+    EXPECT_EQ(back[i], vecs[i]);
+  }
+
+  // SoA components and AoSoA blocks are where Layout says:
+  EXPECT_EQ(soa.component(1)[9], vecs[9].y());
+  EXPECT_EQ(aosoa.data()[8 * 3 + 2 * 8 + 1], vecs[9].z());
+
+  // Vec2 in AoS goes without packets:
+  const auto vecs2 = make_vecs<2, float>(kCount);
+  const VecArraySoA<2, float> soa2{ VecArrayAoS<2, float>(vecs2) };
+  for (size_t i = 0; i < kCount; ++i) EXPECT_EQ(soa2[i], vecs2[i]);
+}
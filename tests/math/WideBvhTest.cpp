@@ -0,0 +1,277 @@
+#include <gtest/gtest.h>
+
+#include <ayan/math/bvh.hpp>
+#include <ayan/sync.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <sys/mman.h>
+
+using namespace ayan::math;
+
+namespace {
+
+Vec3f random_vec(std::mt19937& rng, float lo, float hi) {
+  std::uniform_real_distribution<float> dist(lo, hi);
+  return Vec3f(dist(rng), dist(rng), dist(rng));
+}
+
+// a cloud of small triangles, denser in the middle:
+std::vector<Trianglef> make_triangles(size_t count, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::vector<Trianglef> triangles;
+  for (size_t i = 0; i < count; ++i) {
+    const Vec3f center = random_vec(rng, -1, 1) * random_vec(rng, 0, 10);
+    triangles.emplace_back(center + random_vec(rng, -0.1f, 0.1f),
+      center + random_vec(rng, -0.1f, 0.1f), center + random_vec(rng, -0.1f, 0.1f));
+  }
+  return triangles;
+}
+
+bool contains(const AABBf& outer, const AABBf& inner) {
+  return outer.contains(inner.min()) && outer.contains(inner.max());
+}
+
+// Checks node `index` and returns the bounds of its primitives, which the
+// decoded boxes of its children must contain (and the SIMD decode is the scalar one):
+template<size_t Width>
+AABBf check_node(const WideBvh<Width>& bvh, std::span<const Trianglef> triangles, uint32_t index, std::vector<int>& seen, size_t& leaves) {
+  using node_type = WideBvhNode<Width>;
+  const node_type& node = bvh.nodes()[index];
+  const AABBx<Width, float> boxes = node.child_bounds();
+  AABBf bounds;
+  for (size_t i = 0; i < Width; ++i) {
+    const AABBf box = node.child_bounds(i);
+    EXPECT_EQ(boxes.lane(i).min(), box.min());
+    EXPECT_EQ(boxes.lane(i).max(), box.max());
+
+    const uint32_t child = node.children[i];
+    if (child == node_type::Empty()) continue;
+    AABBf exact;
+    if (node_type::is_leaf(child)) {
+      ++leaves;
+      const uint32_t first = node_type::leaf_first(child);
+      for (uint32_t k = first; k < first + node_type::leaf_count(child); ++k) {
+        ++seen[bvh.indices()[k]];
+        exact.extend(triangles[bvh.indices()[k]].bounds());
+      }
+    } else {
+      EXPECT_GT(child, index);
+      exact = check_node(bvh, triangles, child, seen, leaves);
+    }
+    EXPECT_TRUE(contains(box, exact));
+    bounds.extend(exact);
+  }
+  return bounds;
+}
+
+// every primitive is in exactly one leaf, the boxes hold them, the stats add up:
+template<size_t Width>
+void expect_valid(const WideBvh<Width>& bvh, std::span<const Trianglef> triangles) {
+  ASSERT_FALSE(bvh.is_empty());
+  std::vector<int> seen(triangles.size(), 0);
+  size_t leaves = 0;
+  const AABBf bounds = check_node(bvh, triangles, 0, seen, leaves);
+  EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](int n) { return n == 1; }));
+  EXPECT_EQ(bounds.min(), bvh.bounds().min());
+  EXPECT_EQ(bounds.max(), bvh.bounds().max());
+  EXPECT_EQ(bvh.stats().leaf_count, leaves);
+  EXPECT_EQ(bvh.stats().inner_count, bvh.nodes().size());
+}
+
+template<size_t Width>
+void expect_same_hits(const WideBvh<Width>& wide, const Bvh& binary, std::span<const Trianglef> triangles, unsigned seed) {
+  std::mt19937 rng(seed);
+  size_t hits = 0;
+  for (size_t r = 0; r < 500; ++r) {
+    const Vec3f origin = random_vec(rng, -12, 12);
+    const Rayf ray(origin, random_vec(rng, -3, 3) - origin);
+    BvhHit expected{};
+    BvhHit hit{};
+    const bool found = binary.intersect(triangles, ray, expected);
+    ASSERT_EQ(wide.intersect(triangles, ray, hit), found);
+    if (!found) continue;
+    ++hits;
+    EXPECT_EQ(hit.t, expected.t);
+    // the same t from two triangles (shared vertex) may resolve either way:
+    if (hit.primitive != expected.primitive) continue;
+    EXPECT_EQ(hit.u, expected.u);
+    EXPECT_EQ(hit.v, expected.v);
+  }
+  EXPECT_GT(hits, 40u);
+}
+
+} // namespace
+
+TEST(WideBvhTest, CollapsesIntoValidTrees) {
+  const auto triangles = make_triangles(5000, 1);
+  const Bvh binary = Bvh::Build(triangles);
+  const Bvh4 bvh4 = Bvh4::Collapse(binary);
+  const Bvh8 bvh8 = Bvh8::Collapse(binary);
+  expect_valid(bvh4, triangles);
+  expect_valid(bvh8, triangles);
+
+  // fewer and shallower nodes, the same leaves:
+  EXPECT_LT(bvh8.stats().inner_count, bvh4.stats().inner_count);
+  EXPECT_LT(bvh4.stats().inner_count, binary.stats().inner_count / 2);
+  EXPECT_LT(bvh8.stats().max_depth, bvh4.stats().max_depth);
+  EXPECT_LT(bvh4.stats().max_depth, binary.stats().max_depth);
+  EXPECT_EQ(bvh4.stats().leaf_count, binary.stats().leaf_count);
+  EXPECT_EQ(bvh8.stats().leaf_count, binary.stats().leaf_count);
+  EXPECT_LT(bvh8.stats().sah_cost, binary.stats().sah_cost);
+  EXPECT_EQ(bvh8.bounds().min(), binary.bounds().min());
+  EXPECT_EQ(bvh8.bounds().max(), binary.bounds().max());
+  EXPECT_TRUE(std::equal(binary.indices().begin(), binary.indices().end(), bvh8.indices().begin()));
+
+  // leaves larger than a child word holds are split by Build:
+  BvhBuildSettings settings;
+  settings.max_leaf_size = 64;
+  settings.intersection_cost = 0.01f;
+  expect_valid(Bvh4::Build(triangles, settings), triangles);
+}
+
+TEST(WideBvhTest, QuantizedBoxesAreTight) {
+  const auto triangles = make_triangles(2000, 2);
+  const Bvh4 bvh = Bvh4::Build(triangles);
+  // a decoded leaf box is at most one grid step larger on each side:
+  for (const auto& node : bvh.nodes()) {
+    for (size_t i = 0; i < 4; ++i) {
+      const uint32_t child = node.children[i];
+      if (!Bvh4::node_type::is_leaf(child) || child == Bvh4::node_type::Empty()) continue;
+      AABBf exact;
+      const uint32_t first = Bvh4::node_type::leaf_first(child);
+      for (uint32_t k = first; k < first + Bvh4::node_type::leaf_count(child); ++k) {
+        exact.extend(triangles[bvh.indices()[k]].bounds());
+      }
+      const AABBf decoded = node.child_bounds(i);
+      for (size_t a = 0; a < 3; ++a) {
+        EXPECT_LE(exact.min()[a] - decoded.min()[a], 1.001f * node.scale[a]);
+        EXPECT_LE(decoded.max()[a] - exact.max()[a], 1.001f * node.scale[a]);
+      }
+    }
+  }
+  const auto& root = bvh.nodes()[0];
+  AABBf decoded;
+  for (size_t i = 0; i < 4; ++i) decoded.extend(root.child_bounds(i).min()).extend(root.child_bounds(i).max());
+  for (size_t a = 0; a < 3; ++a) {
+    EXPECT_LE(decoded.min()[a], bvh.bounds().min()[a]);
+    EXPECT_GE(decoded.max()[a], bvh.bounds().max()[a]);
+    EXPECT_LE(bvh.bounds().min()[a] - decoded.min()[a], root.scale[a]);
+    EXPECT_LE(decoded.max()[a] - bvh.bounds().max()[a], root.scale[a]);
+  }
+}
+
+TEST(WideBvhTest, DegenerateInput) {
+  EXPECT_TRUE(Bvh8::Build(std::span<const Trianglef>()).is_empty());
+  EXPECT_TRUE(Bvh8().bounds().is_empty());
+  BvhHit hit{};
+  EXPECT_FALSE(Bvh4().intersect({}, Rayf(Vec3f(), Vec3f(0, 0, 1)), hit));
+
+  // a single leaf under the root, the other slots are empty:
+  const std::vector<Trianglef> one{ Trianglef(Vec3f(0, 0, 1), Vec3f(1, 0, 1), Vec3f(0, 1, 1)) };
+  const Bvh8 small = Bvh8::Build(one);
+  ASSERT_EQ(small.nodes().size(), 1u);
+  EXPECT_EQ(small.nodes()[0].children[0], Bvh8::node_type::Leaf(0, 1));
+  EXPECT_EQ(small.nodes()[0].children[1], Bvh8::node_type::Empty());
+  ASSERT_TRUE(small.intersect(one, Rayf(Vec3f(0.25f, 0.25f, 0), Vec3f(0, 0, 1)), hit));
+  EXPECT_FLOAT_EQ(hit.t, 1.0f);
+  EXPECT_EQ(hit.primitive, 0u);
+  EXPECT_FALSE(small.intersect(one, Rayf(Vec3f(0.75f, 0.75f, 0), Vec3f(0, 0, 1)), hit));
+
+  // flat along z, a zero grid step:
+  const std::vector<Trianglef> stacked(1000, one[0]);
+  const Bvh4 flat = Bvh4::Build(stacked);
+  expect_valid(flat, stacked);
+  ASSERT_TRUE(flat.intersect(stacked, Rayf(Vec3f(0.25f, 0.25f, 0), Vec3f(0, 0, 1)), hit));
+  EXPECT_FLOAT_EQ(hit.t, 1.0f);
+
+  // empty and NaN boxes don't keep a ray from the others:
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  std::vector<AABBf> boxes(100, AABBf(Vec3f(0, 0, 0), Vec3f(1, 1, 1)));
+  boxes[10] = AABBf();
+  boxes[20] = AABBf(Vec3f(nan, 0, 0), Vec3f(nan, 1, 1));
+  const Bvh8 mixed = Bvh8::Build(boxes);
+  EXPECT_EQ(mixed.bounds().max().x(), 1.0f);
+  std::vector<int> visited(boxes.size(), 0);
+  Rayf ray(Vec3f(0.5f, 0.5f, -1), Vec3f(0, 0, 1));
+  mixed.traverse(ray, [&](uint32_t first, uint32_t count, Rayf&) {
+    for (uint32_t i = first; i < first + count; ++i) ++visited[mixed.indices()[i]];
+  });
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    if (i == 10 || i == 20) continue;
+    EXPECT_EQ(visited[i], 1);
+  }
+}
+
+TEST(WideBvhTest, RejectsLeavesTooLargeForAChildWord) {
+  // one binary leaf of 32 primitives, more than 4 bits count:
+  const auto triangles = make_triangles(32, 6);
+  BvhBuildSettings settings;
+  settings.max_leaf_size = 32;
+  settings.intersection_cost = 0.01f;
+  const Bvh binary = Bvh::Build(triangles, settings);
+  ASSERT_GT(binary.nodes()[0].count, kWideBvhMaxLeafSize);
+  EXPECT_THROW(Bvh8::Collapse(binary), std::invalid_argument);
+  EXPECT_THROW(Bvh4::Collapse(binary), std::invalid_argument);
+
+  // Build limits the binary leaves instead, every triangle is still hit:
+  const Bvh8 built = Bvh8::Build(triangles, settings);
+  expect_valid(built, triangles);
+  for (const Trianglef& triangle : triangles) {
+    const Vec3f center = (triangle.vertex(0) + triangle.vertex(1) + triangle.vertex(2)) / 3.0f;
+    const Rayf ray(center - Vec3f(0, 0, 20), Vec3f(0, 0, 1));
+    BvhHit expected{};
+    BvhHit hit{};
+    ASSERT_TRUE(binary.intersect(triangles, ray, expected));
+    ASSERT_TRUE(built.intersect(triangles, ray, hit));
+    EXPECT_EQ(hit.t, expected.t);
+  }
+}
+
+TEST(WideBvhTest, RejectsTooManyPrimitives) {
+  // reserved, never touched: the count is rejected before any box is read:
+  const size_t size = kWideBvhMaxPrimitives * sizeof(AABBf);
+  void* memory = mmap(nullptr, size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  ASSERT_NE(memory, MAP_FAILED);
+  const std::span<const AABBf> boxes(static_cast<const AABBf*>(memory), kWideBvhMaxPrimitives);
+  EXPECT_THROW(Bvh4::Build(boxes), std::invalid_argument);
+  ayan::sync::ThreadPool pool(2);
+  EXPECT_THROW(Bvh8::Build(pool, boxes), std::invalid_argument);
+  munmap(memory, size);
+}
+
+TEST(WideBvhTest, ClosestHitMatchesBinaryBvh) {
+  const auto triangles = make_triangles(3000, 3);
+  const Bvh binary = Bvh::Build(triangles);
+  expect_same_hits(Bvh4::Collapse(binary), binary, triangles, 4);
+  expect_same_hits(Bvh8::Collapse(binary), binary, triangles, 5);
+}
+
+TEST(WideBvhTest, TraversalIsNearestFirst) {
+  // a row of boxes along x, a ray from the left enters them in order:
+  std::vector<AABBf> boxes;
+  for (int i = 0; i < 40; ++i) boxes.emplace_back(Vec3f(float(i), 0, 0), Vec3f(float(i) + 0.5f, 1, 1));
+  BvhBuildSettings settings;
+  settings.max_leaf_size = 1;
+  const Bvh8 bvh = Bvh8::Build(boxes, settings);
+  Rayf ray(Vec3f(-1, 0.5f, 0.5f), Vec3f(1, 0, 0));
+  std::vector<uint32_t> order;
+  bvh.traverse(ray, [&](uint32_t first, uint32_t count, Rayf&) {
+    for (uint32_t i = first; i < first + count; ++i) order.push_back(bvh.indices()[i]);
+  });
+  ASSERT_EQ(order.size(), boxes.size());
+  EXPECT_TRUE(std::is_sorted(order.begin(), order.end()));
+
+  // shrinking t_max in the first leaf skips everything behind it:
+  order.clear();
+  Rayf shortened(Vec3f(-1, 0.5f, 0.5f), Vec3f(1, 0, 0));
+  bvh.traverse(shortened, [&](uint32_t first, uint32_t, Rayf& current) {
+    order.push_back(bvh.indices()[first]);
+    current.set_t_max(1.25f);
+  });
+  EXPECT_EQ(order, std::vector<uint32_t>{ 0 });
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <ayan/sync.hpp>
+
+#include <atomic>
+#include <vector>
+
+using namespace ayan::sync;
+
+TEST(ThreadPoolTest, RunsSubmittedTasks) {
+  std::atomic<int> counter = 0;
+  {
+    ThreadPool pool(4);
+    for (int i = 0; i < 1000; ++i) {
+      pool.submit([&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+    }
+    // the destructor finishes queued tasks
+  }
+  EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(ThreadPoolTest, ParallelForCoversRangeOnce) {
+  ThreadPool pool(3);
+  std::vector<int> hits(10'007, 0);
+
+  pool.parallel_for(hits.size(), 100, [&hits](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) ++hits[i];
+  });
+
+  for (size_t i = 0; i < hits.size(); ++i) {
+    ASSERT_EQ(hits[i], 1) << "at " << i;
+  }
+}
+
+TEST(ThreadPoolTest, ParallelForSmallRangeRunsInline) {
+  ThreadPool pool(2);
+  size_t calls = 0;
+  pool.parallel_for(10, 100, [&calls](size_t begin, size_t end) {
+    EXPECT_EQ(begin, 0u);
+    EXPECT_EQ(end, 10u);
+    ++calls;
+  });
+  EXPECT_EQ(calls, 1u);
+}
+
+TEST(ThreadPoolTest, ParallelForFromTasksOfTheSamePool) {
+  // every worker blocks in parallel_for while its chunks are queued behind
+  // the other tasks, the waiting callers run them:
+  for (size_t threads : { 1, 2 }) {
+    ThreadPool pool(threads);
+    std::vector<std::vector<int>> hits(4, std::vector<int>(1000, 0));
+    WaitGroup wg;
+    wg.add(hits.size());
+    for (std::vector<int>& row : hits) {
+      pool.submit([&pool, &wg, &row] {
+        pool.parallel_for(row.size(), 10, [&row](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) ++row[i];
+        });
+        wg.done();
+      });
+    }
+    pool.wait(wg);
+
+    for (const std::vector<int>& row : hits) {
+      for (int hit : row) ASSERT_EQ(hit, 1);
+    }
+  }
+}